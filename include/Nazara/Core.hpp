@@ -32,6 +32,8 @@
 #include <Nazara/Core/AbstractHash.hpp>
 #include <Nazara/Core/AbstractLogger.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/ByteArrayPool.hpp>
 #include <Nazara/Core/ByteStream.hpp>
@@ -51,14 +53,21 @@
 #include <Nazara/Core/HandledObject.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
 #include <Nazara/Core/Initializer.hpp>
+#include <Nazara/Core/LinearArena.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/MappedFileStream.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/MemoryTracker.hpp>
 #include <Nazara/Core/MemoryView.hpp>
 #include <Nazara/Core/ModuleBase.hpp>
 #include <Nazara/Core/Modules.hpp>
 #include <Nazara/Core/ObjectHandle.hpp>
 #include <Nazara/Core/ObjectLibrary.hpp>
 #include <Nazara/Core/ObjectRef.hpp>
+#include <Nazara/Core/PackedArchive.hpp>
+#include <Nazara/Core/PackedArchiveBuilder.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Core/ParameterKey.hpp>
 #include <Nazara/Core/ParameterList.hpp>
 #include <Nazara/Core/Plugin.hpp>
 #include <Nazara/Core/PluginInterface.hpp>
@@ -66,6 +75,7 @@
 #include <Nazara/Core/PoolByteStream.hpp>
 #include <Nazara/Core/Primitive.hpp>
 #include <Nazara/Core/PrimitiveList.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/RefCounted.hpp>
 #include <Nazara/Core/Resource.hpp>
 #include <Nazara/Core/ResourceLoader.hpp>
@@ -76,6 +86,7 @@
 #include <Nazara/Core/StdLogger.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskCounter.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Unicode.hpp>
 #include <Nazara/Core/Updatable.hpp>
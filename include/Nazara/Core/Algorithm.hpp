@@ -19,6 +19,18 @@
 #include <type_traits>
 #include <unordered_map>
 
+// Concatenates two tokens after expanding them, used by macros to declare variables with an unique name (ex: NazaraConcatMacro(prefix, __LINE__))
+#define NazaraConcat(a, b) a##b
+#define NazaraConcatMacro(a, b) NazaraConcat(a, b)
+
+// Enables instruction sets for a single function (ex: NAZARA_TARGET_FEATURES("avx")), which must only be called if the processor supports them
+// MSVC doesn't need it as it allows intrinsics of every instruction set
+#if defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_INTEL)
+	#define NAZARA_TARGET_FEATURES(features) __attribute__((target(features)))
+#else
+	#define NAZARA_TARGET_FEATURES(features)
+#endif
+
 namespace Nz
 {
 	class ByteArray;
@@ -37,6 +49,14 @@ namespace Nz
 	template<typename T>
 	std::enable_if_t<std::is_arithmetic<T>::value, bool> Serialize(SerializationContext& context, T value, TypeTag<T>);
 
+	template<typename T>
+	std::enable_if_t<std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value, bool> SerializeArray(SerializationContext& context, const T* values, std::size_t count);
+	inline bool SerializeBits(SerializationContext& context, UInt64 value, unsigned int bitCount);
+	template<typename T>
+	std::enable_if_t<std::is_floating_point<T>::value, bool> SerializeQuantized(SerializationContext& context, T value, T min, T max, unsigned int bitCount);
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> SerializeVarInt(SerializationContext& context, T value);
+
 	template<typename T>
 	bool Unserialize(SerializationContext& context, T* value);
 
@@ -45,6 +65,14 @@ namespace Nz
 
 	template<typename T>
 	std::enable_if_t<std::is_arithmetic<T>::value, bool> Unserialize(SerializationContext& context, T* value, TypeTag<T>);
+
+	template<typename T>
+	std::enable_if_t<std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value, bool> UnserializeArray(SerializationContext& context, T* values, std::size_t count);
+	inline bool UnserializeBits(SerializationContext& context, UInt64* value, unsigned int bitCount);
+	template<typename T>
+	std::enable_if_t<std::is_floating_point<T>::value, bool> UnserializeQuantized(SerializationContext& context, T* value, T min, T max, unsigned int bitCount);
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> UnserializeVarInt(SerializationContext& context, T* value);
 }
 
 #include <Nazara/Core/Algorithm.inl>
@@ -7,6 +7,7 @@
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Stream.hpp>
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <climits>
@@ -135,6 +136,180 @@ namespace Nz
 		return context.stream->Write(&value, sizeof(T)) == sizeof(T);
 	}
 
+	/*!
+	* \ingroup core
+	* \brief Serializes an array of trivially copyable values
+	* \return true if serialization succeeded
+	*
+	* \param context Context for the serialization
+	* \param values Pointer to the first value
+	* \param count Number of values
+	*
+	* \remark If the context endianness matches the platform one (or is Unknown), the array is written in one go
+	* \remark Arithmetic values are byte-swapped by blocks otherwise, other types are serialized one by one
+	*
+	* \see Serialize, UnserializeArray
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value, bool> SerializeArray(SerializationContext& context, const T* values, std::size_t count)
+	{
+		NazaraAssert(values || count == 0, "Invalid data pointer");
+
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			context.FlushBits();
+
+			if (sizeof(T) == 1 || context.endianness == Endianness::Unknown || context.endianness == GetPlatformEndianness())
+				return context.stream->Write(values, count * sizeof(T)) == count * sizeof(T);
+
+			std::array<T, 256> buffer;
+			while (count > 0)
+			{
+				std::size_t blockSize = std::min(count, buffer.size());
+				for (std::size_t i = 0; i < blockSize; ++i)
+				{
+					buffer[i] = values[i];
+					SwapBytes(&buffer[i], sizeof(T));
+				}
+
+				if (context.stream->Write(buffer.data(), blockSize * sizeof(T)) != blockSize * sizeof(T))
+					return false;
+
+				values += blockSize;
+				count -= blockSize;
+			}
+
+			return true;
+		}
+		else
+		{
+			if (context.endianness == Endianness::Unknown || context.endianness == GetPlatformEndianness())
+			{
+				context.FlushBits();
+				return context.stream->Write(values, count * sizeof(T)) == count * sizeof(T);
+			}
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (!Serialize(context, values[i]))
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Serializes the lowest bits of an integer
+	* \return true if serialization succeeded
+	*
+	* \param context Context for the serialization
+	* \param value Value to serialize
+	* \param bitCount Number of bits to write (up to 64)
+	*
+	* \remark Bits are packed along the ones written by boolean serialization, they're only written to the stream once a byte is complete (see SerializationContext::FlushBits)
+	*
+	* \see Serialize, UnserializeBits
+	*/
+	inline bool SerializeBits(SerializationContext& context, UInt64 value, unsigned int bitCount)
+	{
+		NazaraAssert(bitCount <= 64, "Bit count must not exceed 64");
+
+		while (bitCount > 0)
+		{
+			if (context.writeBitPos == 8)
+			{
+				context.writeBitPos = 0;
+				context.writeByte = 0;
+			}
+
+			unsigned int bitsInByte = std::min(bitCount, 8U - context.writeBitPos);
+			UInt8 mask = static_cast<UInt8>((1U << bitsInByte) - 1);
+
+			context.writeByte |= static_cast<UInt8>((value & mask) << context.writeBitPos);
+			context.writeBitPos += bitsInByte;
+
+			value >>= bitsInByte;
+			bitCount -= bitsInByte;
+
+			if (context.writeBitPos >= 8 && !Serialize(context, context.writeByte, TypeTag<UInt8>()))
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Serializes a floating-point value in a fixed range using a fixed number of bits
+	* \return true if serialization succeeded
+	*
+	* \param context Context for the serialization
+	* \param value Value to serialize, clamped to [min, max]
+	* \param min Minimum value of the range
+	* \param max Maximum value of the range
+	* \param bitCount Number of bits to use (up to 32), precision is (max - min) / (2^bitCount - 1)
+	*
+	* \see SerializeBits, UnserializeQuantized
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_floating_point<T>::value, bool> SerializeQuantized(SerializationContext& context, T value, T min, T max, unsigned int bitCount)
+	{
+		NazaraAssert(bitCount > 0 && bitCount <= 32, "Bit count must be between 1 and 32");
+		NazaraAssert(min < max, "Invalid range");
+
+		UInt64 maxQuantized = (UInt64(1) << bitCount) - 1;
+
+		T normalized = (std::clamp(value, min, max) - min) / (max - min);
+		UInt64 quantized = std::min(static_cast<UInt64>(normalized * maxQuantized + T(0.5)), maxQuantized);
+
+		return SerializeBits(context, quantized, bitCount);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Serializes an integer using a variable number of bytes
+	* \return true if serialization succeeded
+	*
+	* \param context Context for the serialization
+	* \param value Integer to serialize
+	*
+	* \remark Integers are encoded using LEB128 (7 bits per byte), signed integers are zigzag-encoded first so small negative values stay small
+	* \remark Context endianness has no effect on this encoding
+	*
+	* \see Serialize, UnserializeVarInt
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> SerializeVarInt(SerializationContext& context, T value)
+	{
+		using UnsignedT = std::make_unsigned_t<T>;
+
+		UnsignedT encoded;
+		if constexpr (std::is_signed<T>::value)
+			encoded = static_cast<UnsignedT>(static_cast<UnsignedT>(value) << 1) ^ static_cast<UnsignedT>(value >> (sizeof(T) * CHAR_BIT - 1));
+		else
+			encoded = value;
+
+		// Flush bits in case a writing is in progress
+		context.FlushBits();
+
+		std::array<UInt8, (sizeof(T) * CHAR_BIT + 6) / 7> buffer;
+		std::size_t size = 0;
+		do
+		{
+			UInt8 byte = static_cast<UInt8>(encoded & 0x7F);
+			encoded = static_cast<UnsignedT>(encoded >> 7);
+			if (encoded != 0)
+				byte |= 0x80;
+
+			buffer[size++] = byte;
+		}
+		while (encoded != 0);
+
+		return context.stream->Write(buffer.data(), size) == size;
+	}
+
 
 	template<typename T>
 	bool Unserialize(SerializationContext& context, T* value)
@@ -216,6 +391,177 @@ namespace Nz
 		else
 			return false;
 	}
+
+	/*!
+	* \ingroup core
+	* \brief Unserializes an array of trivially copyable values
+	* \return true if unserialization succedeed
+	*
+	* \param context Context for the unserialization
+	* \param values Pointer to the first value
+	* \param count Number of values
+	*
+	* \see SerializeArray, Unserialize
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value, bool> UnserializeArray(SerializationContext& context, T* values, std::size_t count)
+	{
+		NazaraAssert(values || count == 0, "Invalid data pointer");
+
+		if constexpr (std::is_arithmetic<T>::value)
+		{
+			context.ResetReadBitPosition();
+
+			if (context.stream->Read(values, count * sizeof(T)) != count * sizeof(T))
+				return false;
+
+			if (sizeof(T) > 1 && context.endianness != Endianness::Unknown && context.endianness != GetPlatformEndianness())
+			{
+				for (std::size_t i = 0; i < count; ++i)
+					SwapBytes(&values[i], sizeof(T));
+			}
+
+			return true;
+		}
+		else
+		{
+			if (context.endianness == Endianness::Unknown || context.endianness == GetPlatformEndianness())
+			{
+				context.ResetReadBitPosition();
+				return context.stream->Read(values, count * sizeof(T)) == count * sizeof(T);
+			}
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (!Unserialize(context, &values[i]))
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Unserializes bits written by SerializeBits
+	* \return true if unserialization succedeed
+	*
+	* \param context Context for the unserialization
+	* \param value Pointer to the integer receiving the bits
+	* \param bitCount Number of bits to read (up to 64)
+	*
+	* \see SerializeBits, Unserialize
+	*/
+	inline bool UnserializeBits(SerializationContext& context, UInt64* value, unsigned int bitCount)
+	{
+		NazaraAssert(value, "Invalid data pointer");
+		NazaraAssert(bitCount <= 64, "Bit count must not exceed 64");
+
+		UInt64 result = 0;
+		unsigned int shift = 0;
+		while (shift < bitCount)
+		{
+			if (context.readBitPos == 8)
+			{
+				if (!Unserialize(context, &context.readByte, TypeTag<UInt8>()))
+					return false;
+
+				context.readBitPos = 0;
+			}
+
+			unsigned int bitsInByte = std::min(bitCount - shift, 8U - context.readBitPos);
+			UInt64 bits = (context.readByte >> context.readBitPos) & ((1U << bitsInByte) - 1);
+
+			result |= bits << shift;
+			shift += bitsInByte;
+			context.readBitPos += bitsInByte;
+		}
+
+		*value = result;
+		return true;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Unserializes a floating-point value written by SerializeQuantized
+	* \return true if unserialization succedeed
+	*
+	* \param context Context for the unserialization
+	* \param value Pointer to the value to unserialize
+	* \param min Minimum value of the range
+	* \param max Maximum value of the range
+	* \param bitCount Number of bits used (up to 32)
+	*
+	* \remark Range and bit count have to be the same as the ones used for serialization
+	*
+	* \see SerializeQuantized, UnserializeBits
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_floating_point<T>::value, bool> UnserializeQuantized(SerializationContext& context, T* value, T min, T max, unsigned int bitCount)
+	{
+		NazaraAssert(value, "Invalid data pointer");
+		NazaraAssert(bitCount > 0 && bitCount <= 32, "Bit count must be between 1 and 32");
+		NazaraAssert(min < max, "Invalid range");
+
+		UInt64 quantized;
+		if (!UnserializeBits(context, &quantized, bitCount))
+			return false;
+
+		UInt64 maxQuantized = (UInt64(1) << bitCount) - 1;
+		*value = min + (max - min) * (static_cast<T>(quantized) / static_cast<T>(maxQuantized));
+
+		return true;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Unserializes an integer written by SerializeVarInt
+	* \return true if unserialization succedeed
+	*
+	* \param context Context for the unserialization
+	* \param value Pointer to the integer to unserialize
+	*
+	* \remark Fails if the encoded integer doesn't fit in T
+	*
+	* \see SerializeVarInt, Unserialize
+	*/
+	template<typename T>
+	std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> UnserializeVarInt(SerializationContext& context, T* value)
+	{
+		NazaraAssert(value, "Invalid data pointer");
+
+		using UnsignedT = std::make_unsigned_t<T>;
+
+		context.ResetReadBitPosition();
+
+		constexpr unsigned int BitCount = sizeof(T) * CHAR_BIT;
+
+		UnsignedT decoded = 0;
+		for (unsigned int shift = 0;; shift += 7)
+		{
+			if (shift >= BitCount)
+				return false;
+
+			UInt8 byte;
+			if (context.stream->Read(&byte, 1) != 1)
+				return false;
+
+			UnsignedT bits = static_cast<UnsignedT>(byte & 0x7F);
+			if (shift + 7 > BitCount && (bits >> (BitCount - shift)) != 0)
+				return false;
+
+			decoded |= static_cast<UnsignedT>(bits << shift);
+			if ((byte & 0x80) == 0)
+				break;
+		}
+
+		if constexpr (std::is_signed<T>::value)
+			*value = static_cast<T>(static_cast<UnsignedT>(decoded >> 1) ^ static_cast<UnsignedT>(UnsignedT(0) - (decoded & 1)));
+		else
+			*value = decoded;
+
+		return true;
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
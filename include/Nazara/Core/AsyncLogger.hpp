@@ -0,0 +1,105 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_ASYNCLOGGER_HPP
+#define NAZARA_CORE_ASYNCLOGGER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API AsyncLogger : public AbstractLogger
+	{
+		public:
+			AsyncLogger(std::unique_ptr<AbstractLogger> logger, std::size_t capacity = 1024, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Drop);
+			AsyncLogger(const AsyncLogger&) = delete;
+			AsyncLogger(AsyncLogger&&) = delete;
+			~AsyncLogger();
+
+			void EnableStdReplication(bool enable) override;
+
+			void Flush();
+
+			inline std::size_t GetCapacity() const;
+			inline UInt64 GetDroppedMessageCount() const;
+			inline AbstractLogger& GetLogger();
+			inline const AbstractLogger& GetLogger() const;
+			inline LogOverflowPolicy GetOverflowPolicy() const;
+			inline std::chrono::milliseconds GetRepeatInterval() const;
+
+			bool IsStdReplicationEnabled() const override;
+
+			inline void SetOverflowPolicy(LogOverflowPolicy overflowPolicy);
+			inline void SetRepeatInterval(std::chrono::milliseconds repeatInterval);
+
+			void Write(const std::string_view& string) override;
+			void WriteError(ErrorType type, const std::string_view& error, unsigned int line = 0, const char* file = nullptr, const char* function = nullptr) override;
+
+			AsyncLogger& operator=(const AsyncLogger&) = delete;
+			AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+		private:
+			struct Message;
+
+			bool HasPendingMessage() const;
+			bool IsLoggingThread() const;
+			bool Push(const std::string_view& string, bool isError, ErrorType errorType, bool canDrop);
+			bool Pop(Message& message);
+			void Process(const Message& message, std::chrono::steady_clock::time_point now);
+			void ThreadProc();
+			void WriteMessage(const Message& message);
+			void WriteRepeatSummary();
+
+			struct Message
+			{
+				std::string content;
+				ErrorType errorType;
+				bool isError;
+			};
+
+			struct Slot
+			{
+				std::atomic_size_t sequence;
+				Message message;
+			};
+
+			std::atomic_bool m_isRunning;
+			std::atomic_bool m_isThreadSleeping;
+			std::atomic<LogOverflowPolicy> m_overflowPolicy;
+			std::atomic<std::chrono::milliseconds::rep> m_repeatInterval;
+			std::atomic_size_t m_dequeuePosition;
+			std::atomic_size_t m_enqueuePosition;
+			std::atomic_size_t m_processedCount;
+			std::atomic<UInt64> m_droppedMessageCount;
+			std::chrono::steady_clock::time_point m_lastMessageTime;
+			std::condition_variable m_flushCondition;
+			std::condition_variable m_wakeCondition;
+			mutable std::mutex m_loggerMutex;
+			std::mutex m_threadMutex;
+			std::size_t m_capacityMask;
+			std::size_t m_repeatCount;
+			std::thread m_thread;
+			std::unique_ptr<AbstractLogger> m_logger;
+			std::unique_ptr<Slot[]> m_slots;
+			std::vector<Message> m_batch;
+			Message m_lastMessage;
+			bool m_hasLastMessage;
+	};
+}
+
+#include <Nazara/Core/AsyncLogger.inl>
+
+#endif // NAZARA_CORE_ASYNCLOGGER_HPP
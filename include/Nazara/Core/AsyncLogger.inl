@@ -0,0 +1,98 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the maximum number of messages waiting to be written
+	* \return Capacity of the message queue
+	*/
+	inline std::size_t AsyncLogger::GetCapacity() const
+	{
+		return m_capacityMask + 1;
+	}
+
+	/*!
+	* \brief Gets the number of messages which were discarded because the queue was full
+	* \return Dropped message count
+	*
+	* \see SetOverflowPolicy
+	*/
+	inline UInt64 AsyncLogger::GetDroppedMessageCount() const
+	{
+		return m_droppedMessageCount.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the logger messages are forwarded to
+	* \return Wrapped logger
+	*
+	* \remark This logger is used by the logging thread, it should not be accessed directly while messages are pending
+	*/
+	inline AbstractLogger& AsyncLogger::GetLogger()
+	{
+		return *m_logger;
+	}
+
+	/*!
+	* \brief Gets the logger messages are forwarded to
+	* \return Wrapped logger
+	*
+	* \remark This logger is used by the logging thread, it should not be accessed directly while messages are pending
+	*/
+	inline const AbstractLogger& AsyncLogger::GetLogger() const
+	{
+		return *m_logger;
+	}
+
+	/*!
+	* \brief Gets what happens when a message is written while the queue is full
+	* \return Current overflow policy
+	*/
+	inline LogOverflowPolicy AsyncLogger::GetOverflowPolicy() const
+	{
+		return m_overflowPolicy.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gets the interval at which repeated messages are summarized
+	* \return Repeat interval, zero if repeated messages are all written
+	*
+	* \see SetRepeatInterval
+	*/
+	inline std::chrono::milliseconds AsyncLogger::GetRepeatInterval() const
+	{
+		return std::chrono::milliseconds(m_repeatInterval.load(std::memory_order_relaxed));
+	}
+
+	/*!
+	* \brief Sets what happens when a message is written while the queue is full
+	*
+	* \param overflowPolicy New overflow policy
+	*
+	* \remark Errors (other than warnings) are never dropped
+	*/
+	inline void AsyncLogger::SetOverflowPolicy(LogOverflowPolicy overflowPolicy)
+	{
+		m_overflowPolicy.store(overflowPolicy, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Sets the interval at which repeated messages are summarized
+	*
+	* When the same message is written multiple times in a row, only the first one is forwarded and the next ones are counted,
+	* their count being written at most once per interval or when a different message is written.
+	*
+	* \param repeatInterval Repeat interval, zero to disable the filtering of repeated messages
+	*/
+	inline void AsyncLogger::SetRepeatInterval(std::chrono::milliseconds repeatInterval)
+	{
+		m_repeatInterval.store(repeatInterval.count(), std::memory_order_relaxed);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_BUFFEREDSTREAM_HPP
+#define NAZARA_CORE_BUFFEREDSTREAM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <memory>
+
+namespace Nz
+{
+	class NAZARA_CORE_API BufferedStream : public Stream
+	{
+		public:
+			BufferedStream(Stream& stream, std::size_t readBufferSize = DefaultBufferSize, std::size_t writeBufferSize = DefaultBufferSize);
+			BufferedStream(const BufferedStream&) = delete;
+			BufferedStream(BufferedStream&&) = delete;
+			~BufferedStream();
+
+			bool FlushWriteBuffer();
+
+			std::filesystem::path GetDirectory() const override;
+			const void* GetMappedPointer() const override;
+			std::filesystem::path GetPath() const override;
+			inline std::size_t GetReadBufferSize() const;
+			UInt64 GetSize() const override;
+			inline Stream& GetWrappedStream() const;
+			inline std::size_t GetWriteBufferSize() const;
+
+			std::string ReadLine(unsigned int lineSize = 0) override;
+
+			BufferedStream& operator=(const BufferedStream&) = delete;
+			BufferedStream& operator=(BufferedStream&&) = delete;
+
+		private:
+			bool FillReadBuffer();
+			void FlushStream() override;
+			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			bool SeekStreamCursor(UInt64 offset) override;
+			bool SeekWrappedStream(UInt64 offset);
+			UInt64 TellStreamCursor() const override;
+			bool TestStreamEnd() const override;
+			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
+
+			std::size_t m_readBufferCapacity;
+			std::size_t m_readBufferSize;
+			std::size_t m_writeBufferCapacity;
+			std::size_t m_writeBufferSize;
+			std::unique_ptr<UInt8[]> m_readBuffer;
+			std::unique_ptr<UInt8[]> m_writeBuffer;
+			Stream& m_stream;
+			UInt64 m_cursor;
+			UInt64 m_readBufferPos;
+			UInt64 m_streamCursor;
+			UInt64 m_writeBufferPos;
+	};
+}
+
+#include <Nazara/Core/BufferedStream.inl>
+
+#endif // NAZARA_CORE_BUFFEREDSTREAM_HPP
@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/BufferedStream.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the capacity of the read-ahead buffer
+	* \return Read buffer size (zero if reads are not buffered)
+	*/
+	inline std::size_t BufferedStream::GetReadBufferSize() const
+	{
+		return m_readBufferCapacity;
+	}
+
+	/*!
+	* \brief Gets the stream wrapped by this object
+	* \return Wrapped stream
+	*/
+	inline Stream& BufferedStream::GetWrappedStream() const
+	{
+		return m_stream;
+	}
+
+	/*!
+	* \brief Gets the capacity of the write-combining buffer
+	* \return Write buffer size (zero if writes are not buffered)
+	*/
+	inline std::size_t BufferedStream::GetWriteBufferSize() const
+	{
+		return m_writeBufferCapacity;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
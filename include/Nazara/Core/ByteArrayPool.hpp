@@ -9,31 +9,53 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/ByteArray.hpp>
-#include <vector>
+#include <memory>
 
 namespace Nz
 {
-	class AbstractHash;
-
 	class NAZARA_CORE_API ByteArrayPool
 	{
 		public:
-			ByteArrayPool() = default;
+			struct Stats;
+
+			ByteArrayPool();
 			ByteArrayPool(const ByteArrayPool&) = delete;
-			ByteArrayPool(ByteArrayPool&&) = default;
-			~ByteArrayPool() = default;
+			ByteArrayPool(ByteArrayPool&&) noexcept = default;
+			~ByteArrayPool();
 
-			inline void Clear();
+			void Clear();
 
-			inline ByteArray GetByteArray(std::size_t capacity = 0);
+			ByteArray GetByteArray(std::size_t capacity = 0);
+			Stats GetStats() const;
 
-			inline void ReturnByteArray(ByteArray byteArray);
+			void ResetStats();
+			void ReturnByteArray(ByteArray byteArray);
 
 			ByteArrayPool& operator=(const ByteArrayPool&) = delete;
-			ByteArrayPool& operator=(ByteArrayPool&&) = default;
+			ByteArrayPool& operator=(ByteArrayPool&&) noexcept = default;
+
+			static inline std::size_t GetPooledCapacity(std::size_t capacity);
+
+			static constexpr std::size_t BucketCount = 15;
+			static constexpr std::size_t MinPooledCapacity = 64;
+			static constexpr std::size_t MaxPooledCapacity = MinPooledCapacity << (BucketCount - 1);
+			static constexpr std::size_t ThreadCacheCapacity = 16;
+
+			struct Stats
+			{
+				UInt64 hitCount;
+				UInt64 missCount;
+				std::size_t peakPooledBytes;
+				std::size_t pooledBytes;
+			};
 
 		private:
-			std::vector<ByteArray> m_byteArrays;
+			struct State;
+			struct ThreadCache;
+
+			static ThreadCache& GetThreadCache();
+
+			std::shared_ptr<State> m_state;
 	};
 }
 
@@ -7,37 +7,22 @@
 
 namespace Nz
 {
-	namespace Detail
+	/*!
+	* \brief Gets the capacity of the byte arrays returned by GetByteArray for a requested capacity
+	* \return Requested capacity rounded up to the size class it belongs to, or the requested capacity if it's too big to be pooled
+	*
+	* \param capacity Requested capacity
+	*/
+	inline std::size_t ByteArrayPool::GetPooledCapacity(std::size_t capacity)
 	{
-		inline bool SortByteArrayByCapacity(const ByteArray& byteArray, std::size_t refCapacity)
-		{
-			return refCapacity > byteArray.GetCapacity();
-		}
-	}
+		if (capacity > MaxPooledCapacity)
+			return capacity;
 
-	inline void ByteArrayPool::Clear()
-	{
-		m_byteArrays.clear();
-	}
-
-	inline ByteArray ByteArrayPool::GetByteArray(std::size_t capacity)
-	{
-		ByteArray ret;
+		std::size_t pooledCapacity = MinPooledCapacity;
+		while (pooledCapacity < capacity)
+			pooledCapacity <<= 1;
 
-		auto it = std::lower_bound(m_byteArrays.begin(), m_byteArrays.end(), capacity, Detail::SortByteArrayByCapacity);
-		if (it != m_byteArrays.end())
-		{
-			ret = std::move(*it);
-			m_byteArrays.erase(it);
-		}
-
-		return ret;
-	}
-
-	inline void ByteArrayPool::ReturnByteArray(ByteArray byteArray)
-	{
-		auto it = std::lower_bound(m_byteArrays.begin(), m_byteArrays.end(), byteArray.GetCapacity(), Detail::SortByteArrayByCapacity);
-		m_byteArrays.emplace(it, std::move(byteArray));
+		return pooledCapacity;
 	}
 }
 
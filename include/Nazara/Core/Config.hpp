@@ -52,6 +52,24 @@
 // Incorporate the Unicode Character Data table (Necessary to make it work with the flag String::HandleUTF8)
 #define NAZARA_CORE_INCLUDE_UNICODEDATA 1
 
+// Write the default log (NazaraLog.log) from a background thread instead of the thread emitting the message
+#define NAZARA_CORE_LOG_ASYNC 1
+
+// Number of messages the asynchronous log can hold before applying its overflow policy
+#define NAZARA_CORE_LOG_ASYNC_CAPACITY 1024
+
+// Track every allocation made through the global operators new and delete, which are replaced by the Core module (see MemoryTracker)
+#define NAZARA_CORE_MEMORY_TRACKER 0
+
+// Maximum number of memory scopes (NazaraMemoryScope) whose allocations are tracked separately
+#define NAZARA_CORE_MEMORY_TRACKER_CALLSITES 1024
+
+// Compile profiler zones (NazaraProfileZone and NazaraProfileFrame), they cost almost nothing while no capture is running
+#define NAZARA_CORE_PROFILER 1
+
+// Maximum number of profiler events recorded by a thread during a capture (next events are dropped), buffers grow by 4096 events when needed
+#define NAZARA_CORE_PROFILER_THREAD_EVENTS 262144
+
 // Activate the security tests based on the code (Advised for development)
 #define NAZARA_CORE_SAFE 1
 
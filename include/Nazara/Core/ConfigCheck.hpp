@@ -14,7 +14,15 @@
 
 NazaraCheckTypeAndVal(NAZARA_CORE_DECIMAL_DIGITS, integral, >, 0, " shall be a strictly positive integer");
 NazaraCheckTypeAndVal(NAZARA_CORE_FILE_BUFFERSIZE, integral, >, 0, " shall be a strictly positive integer");
+NazaraCheckTypeAndVal(NAZARA_CORE_LOG_ASYNC_CAPACITY, integral, >, 0, " shall be a strictly positive integer");
+NazaraCheckTypeAndVal(NAZARA_CORE_MEMORY_TRACKER_CALLSITES, integral, >, 0, " shall be a strictly positive integer");
+NazaraCheckTypeAndVal(NAZARA_CORE_PROFILER_THREAD_EVENTS, integral, >, 0, " shall be a strictly positive integer");
 
 #undef NazaraCheckTypeAndVal
 
+// Replacing the global operators new and delete in a DLL only affects this DLL, memory would be allocated and freed by different operators
+#if NAZARA_CORE_MEMORY_TRACKER && defined(NAZARA_PLATFORM_WINDOWS) && !defined(NAZARA_STATIC)
+	#error NAZARA_CORE_MEMORY_TRACKER requires a static build on Windows
+#endif
+
 #endif // NAZARA_CORE_CONFIGCHECK_HPP
@@ -86,12 +86,39 @@ namespace Nz
 		SHA384,
 		SHA512,
 		Whirlpool,
+		XXH3,
+		XXH128,
 
-		Max = Whirlpool
+		Max = XXH128
 	};
 
 	constexpr std::size_t HashTypeCount = static_cast<std::size_t>(HashType::Max) + 1;
 
+	enum class LogOverflowPolicy
+	{
+		Block, // Wait until the logging thread frees some space
+		Drop,  // Discard the message (it is counted as dropped)
+
+		Max = Drop
+	};
+
+	constexpr std::size_t LogOverflowPolicyCount = static_cast<std::size_t>(LogOverflowPolicy::Max) + 1;
+
+	enum class MemoryTag
+	{
+		Audio,
+		Core,
+		Graphics,
+		Network,
+		Other,
+		Physics,
+		Utility,
+
+		Max = Utility
+	};
+
+	constexpr std::size_t MemoryTagCount = static_cast<std::size_t>(MemoryTag::Max) + 1;
+
 	enum class OpenMode
 	{
 		NotOpen,    // Use the current mod of opening
@@ -132,6 +159,16 @@ namespace Nz
 		Max = Userdata
 	};
 
+	enum class PackedArchiveCompression
+	{
+		None,
+		LZ4,
+
+		Max = LZ4
+	};
+
+	constexpr std::size_t PackedArchiveCompressionCount = static_cast<std::size_t>(PackedArchiveCompression::Max) + 1;
+
 	enum class PrimitiveType
 	{
 		Box,
@@ -162,12 +199,25 @@ namespace Nz
 		SSE41,
 		SSE42,
 		SSE4a,
+		SHA,
 
-		Max = SSE4a
+		Max = SHA
 	};
 
 	constexpr std::size_t ProcessorCapCount = static_cast<std::size_t>(ProcessorCap::Max) + 1;
 
+	enum class ProcessorCoreType
+	{
+		Unknown = -1,
+
+		Efficiency,  // Low-power core of a hybrid processor (Intel E-core, ARM LITTLE)
+		Performance, // High-performance core of a hybrid processor, or any core of a non-hybrid processor
+
+		Max = Performance
+	};
+
+	constexpr std::size_t ProcessorCoreTypeCount = static_cast<std::size_t>(ProcessorCoreType::Max) + 1;
+
 	enum class ProcessorVendor
 	{
 		Unknown = -1,
@@ -230,8 +280,9 @@ namespace Nz
 		Sequential,
 		Text,
 		Unbuffered,
+		MemoryMapped,
 
-		Max = Unbuffered
+		Max = MemoryMapped
 	};
 
 	template<>
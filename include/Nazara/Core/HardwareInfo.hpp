@@ -12,40 +12,81 @@
 #include <Nazara/Core/Enums.hpp>
 #include <array>
 #include <string_view>
+#include <vector>
 
 namespace Nz
 {
 	class NAZARA_CORE_API HardwareInfo
 	{
 		public:
+			struct CacheInfo;
+			struct LogicalProcessor;
+
 			HardwareInfo();
 			HardwareInfo(const HardwareInfo&) = delete;
 			HardwareInfo(HardwareInfo&&) = delete;
 			~HardwareInfo() = default;
 
 			inline const char* GetCpuBrandString() const;
+			inline const CacheInfo& GetCpuCacheInfo(unsigned int level) const;
+			inline unsigned int GetCpuCacheLineSize() const;
+			inline unsigned int GetCpuCoreCount() const;
+			unsigned int GetCpuCoreCount(ProcessorCoreType coreType) const;
+			inline const std::vector<LogicalProcessor>& GetCpuLogicalProcessors() const;
 			inline unsigned int GetCpuThreadCount() const;
 			inline ProcessorVendor GetCpuVendor() const;
 			std::string_view GetCpuVendorName() const;
+			inline unsigned int GetNumaNodeCount() const;
 			inline UInt64 GetSystemTotalMemory() const;
 
 			inline bool HasCapability(ProcessorCap capability) const;
 
+			inline bool IsCpuHybrid() const;
+
 			static void Cpuid(UInt32 functionId, UInt32 subFunctionId, UInt32 result[4]);
+			static std::vector<unsigned int> GetCurrentThreadAffinity();
 			static bool IsCpuidSupported();
 
+			static bool SetCurrentThreadAffinity(unsigned int logicalProcessorIndex);
+			static bool SetCurrentThreadAffinity(const std::vector<unsigned int>& logicalProcessorIndices);
+
 			HardwareInfo& operator=(const HardwareInfo&) = delete;
 			HardwareInfo& operator=(HardwareInfo&&) = delete;
 
+			static constexpr unsigned int MaxCacheLevel = 3;
+
+			struct CacheInfo
+			{
+				UInt64 size = 0;                     //< size of one cache instance in bytes, 0 if unknown
+				unsigned int lineSize = 0;           //< 0 if unknown
+				unsigned int sharingThreadCount = 0; //< logical processors sharing one instance of this cache, 0 if unknown
+			};
+
+			struct LogicalProcessor
+			{
+				unsigned int index;        //< index used by the OS (and SetCurrentThreadAffinity)
+				unsigned int coreIndex;    //< physical core, logical processors sharing a core are hyperthreads/SMT siblings
+				unsigned int numaNode;
+				unsigned int packageIndex; //< physical socket
+				ProcessorCoreType coreType;
+			};
+
 		private:
+			void FetchCPUCacheInfo();
 			void FetchCPUInfo();
+			void FetchCPUTopology();
 			void FetchMemoryInfo();
 
 			std::array<bool, ProcessorCapCount> m_cpuCapabilities;
 			std::array<char, 3 * 4 * 4> m_cpuBrandString;
+			std::array<CacheInfo, MaxCacheLevel> m_cpuCaches;
+			std::vector<LogicalProcessor> m_cpuLogicalProcessors;
 			ProcessorVendor m_cpuVendor;
+			unsigned int m_cpuCoreCount;
 			unsigned int m_cpuThreadCount;
+			unsigned int m_numaNodeCount;
 			UInt64 m_systemTotalMemory;
+			bool m_isCpuHybrid;
 	};
 }
 
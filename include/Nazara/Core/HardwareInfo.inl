@@ -4,6 +4,7 @@
 
 #include <Nazara/Core/HardwareInfo.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -13,6 +14,45 @@ namespace Nz
 		return m_cpuBrandString.data();
 	}
 
+	/*!
+	* \brief Returns information about the data (or unified) cache of a given level
+	* \return Cache information, with zeroed fields if the level doesn't exist or couldn't be queried
+	*
+	* \param level Cache level, from 1 to MaxCacheLevel
+	*/
+	inline auto HardwareInfo::GetCpuCacheInfo(unsigned int level) const -> const CacheInfo&
+	{
+		NazaraAssert(level >= 1 && level <= MaxCacheLevel, "invalid cache level");
+		return m_cpuCaches[level - 1];
+	}
+
+	/*!
+	* \brief Returns the size of a L1 data cache line, useful to avoid false sharing between threads
+	* \return Cache line size, or 64 if it couldn't be queried
+	*/
+	inline unsigned int HardwareInfo::GetCpuCacheLineSize() const
+	{
+		return (m_cpuCaches[0].lineSize > 0) ? m_cpuCaches[0].lineSize : 64;
+	}
+
+	/*!
+	* \brief Returns the number of physical cores, in all packages
+	* \return Physical core count, which is the logical processor count if the topology couldn't be queried
+	*/
+	inline unsigned int HardwareInfo::GetCpuCoreCount() const
+	{
+		return m_cpuCoreCount;
+	}
+
+	/*!
+	* \brief Returns the logical processors of the system
+	* \return Logical processors, ordered by index
+	*/
+	inline auto HardwareInfo::GetCpuLogicalProcessors() const -> const std::vector<LogicalProcessor>&
+	{
+		return m_cpuLogicalProcessors;
+	}
+
 	inline unsigned int HardwareInfo::GetCpuThreadCount() const
 	{
 		return m_cpuThreadCount;
@@ -23,6 +63,11 @@ namespace Nz
 		return m_cpuVendor;
 	}
 
+	inline unsigned int HardwareInfo::GetNumaNodeCount() const
+	{
+		return m_numaNodeCount;
+	}
+
 	inline UInt64 HardwareInfo::GetSystemTotalMemory() const
 	{
 		return m_systemTotalMemory;
@@ -32,6 +77,17 @@ namespace Nz
 	{
 		return m_cpuCapabilities[UnderlyingCast(capability)];
 	}
+
+	/*!
+	* \brief Checks if the processor mixes performance and efficiency cores
+	* \return True if the processor is hybrid
+	*
+	* \remark Core types are ProcessorCoreType::Unknown if the OS doesn't tell which core is which
+	*/
+	inline bool HardwareInfo::IsCpuHybrid() const
+	{
+		return m_isCpuHybrid;
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
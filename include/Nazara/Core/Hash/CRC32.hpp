@@ -26,11 +26,13 @@ namespace Nz
 			std::size_t GetDigestLength() const override;
 			const char* GetHashName() const override;
 
+			static constexpr UInt32 CastagnoliPolynomial = 0x1EDC6F41;
 			static constexpr UInt32 DefaultPolynomial = 0x04C11DB7;
 
 		private:
 			UInt32 m_crc;
 			const UInt32* m_table;
+			bool m_hardwareAccelerated;
 	};
 }
 
@@ -0,0 +1,36 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_HASH_XXH3_HPP
+#define NAZARA_CORE_HASH_XXH3_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+
+struct XXH3_state_s;
+
+namespace Nz
+{
+	class NAZARA_CORE_API XXH3Hash final : public AbstractHash
+	{
+		public:
+			XXH3Hash();
+			~XXH3Hash();
+
+			void Append(const UInt8* data, std::size_t len) override;
+			void Begin() override;
+			ByteArray End() override;
+
+			std::size_t GetDigestLength() const override;
+			const char* GetHashName() const override;
+
+		private:
+			XXH3_state_s* m_state;
+	};
+}
+
+#endif // NAZARA_CORE_HASH_XXH3_HPP
@@ -0,0 +1,87 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_LINEARARENA_HPP
+#define NAZARA_CORE_LINEARARENA_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API LinearArena
+	{
+		public:
+			explicit LinearArena(std::size_t blockSize = DefaultBlockSize);
+			LinearArena(const LinearArena&) = delete;
+			LinearArena(LinearArena&&) noexcept = default;
+			~LinearArena() = default;
+
+			void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+			template<typename T> T* Allocate(std::size_t count);
+
+			inline std::size_t GetAllocatedSize() const;
+			inline std::size_t GetBlockCount() const;
+			inline std::size_t GetCapacity() const;
+
+			void Release();
+			void Reset();
+
+			LinearArena& operator=(const LinearArena&) = delete;
+			LinearArena& operator=(LinearArena&&) noexcept = default;
+
+			static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+		private:
+			struct Block
+			{
+				std::unique_ptr<UInt8[]> memory;
+				std::size_t size;
+			};
+
+			void* AllocateFromNewBlock(std::size_t size, std::size_t alignment);
+
+			std::size_t m_allocatedSize;
+			std::size_t m_blockSize;
+			std::size_t m_capacity;
+			std::size_t m_currentOffset;
+			std::vector<Block> m_blocks;
+	};
+
+	template<typename T>
+	class ArenaAllocator
+	{
+		template<typename U> friend class ArenaAllocator;
+
+		public:
+			using value_type = T;
+
+			template<typename U>
+			struct rebind
+			{
+				using other = ArenaAllocator<U>;
+			};
+
+			ArenaAllocator(LinearArena& arena) noexcept;
+			template<typename U> ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept;
+
+			T* allocate(std::size_t n);
+			void deallocate(T* ptr, std::size_t n) noexcept;
+
+			template<typename U> bool operator==(const ArenaAllocator<U>& allocator) const noexcept;
+			template<typename U> bool operator!=(const ArenaAllocator<U>& allocator) const noexcept;
+
+		private:
+			LinearArena* m_arena;
+	};
+}
+
+#include <Nazara/Core/LinearArena.inl>
+
+#endif // NAZARA_CORE_LINEARARENA_HPP
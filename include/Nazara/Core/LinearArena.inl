@@ -0,0 +1,104 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/LinearArena.hpp>
+#include <limits>
+#include <new>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Allocates uninitialized storage for count objects of type T
+	* \return Pointer to the storage, suitably aligned for T
+	*
+	* \param count Number of objects
+	*
+	* \remark Destructors of objects constructed in this storage are never called by the arena
+	*/
+	template<typename T>
+	T* LinearArena::Allocate(std::size_t count)
+	{
+		if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+			throw std::bad_alloc();
+
+		return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	/*!
+	* \brief Gets the number of bytes allocated since the last reset (including alignment padding)
+	* \return Allocated size
+	*/
+	inline std::size_t LinearArena::GetAllocatedSize() const
+	{
+		return m_allocatedSize;
+	}
+
+	/*!
+	* \brief Gets the number of memory blocks owned by the arena
+	* \return Block count, one in the steady state
+	*/
+	inline std::size_t LinearArena::GetBlockCount() const
+	{
+		return m_blocks.size();
+	}
+
+	/*!
+	* \brief Gets the total size of the memory blocks owned by the arena
+	* \return Capacity in bytes
+	*/
+	inline std::size_t LinearArena::GetCapacity() const
+	{
+		return m_capacity;
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ArenaAllocator
+	* \brief Core class that allocates memory from a LinearArena, to be used with standard containers
+	*
+	* Deallocation does nothing, memory is reclaimed all at once when the arena is reset.
+	* Containers using this allocator must therefore be destroyed before their arena gets reset.
+	*/
+
+	template<typename T>
+	ArenaAllocator<T>::ArenaAllocator(LinearArena& arena) noexcept :
+	m_arena(&arena)
+	{
+	}
+
+	template<typename T>
+	template<typename U>
+	ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept :
+	m_arena(allocator.m_arena)
+	{
+	}
+
+	template<typename T>
+	T* ArenaAllocator<T>::allocate(std::size_t n)
+	{
+		return m_arena->Allocate<T>(n);
+	}
+
+	template<typename T>
+	void ArenaAllocator<T>::deallocate(T* /*ptr*/, std::size_t /*n*/) noexcept
+	{
+	}
+
+	template<typename T>
+	template<typename U>
+	bool ArenaAllocator<T>::operator==(const ArenaAllocator<U>& allocator) const noexcept
+	{
+		return m_arena == allocator.m_arena;
+	}
+
+	template<typename T>
+	template<typename U>
+	bool ArenaAllocator<T>::operator!=(const ArenaAllocator<U>& allocator) const noexcept
+	{
+		return !operator==(allocator);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
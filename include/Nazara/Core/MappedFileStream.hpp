@@ -0,0 +1,56 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_MAPPEDFILESTREAM_HPP
+#define NAZARA_CORE_MAPPEDFILESTREAM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <filesystem>
+#include <memory>
+
+namespace Nz
+{
+	class MappedFileImpl;
+
+	class NAZARA_CORE_API MappedFileStream : public Stream
+	{
+		public:
+			MappedFileStream();
+			MappedFileStream(const std::filesystem::path& filePath);
+			MappedFileStream(const MappedFileStream&) = delete;
+			MappedFileStream(MappedFileStream&&) noexcept;
+			~MappedFileStream();
+
+			void Close();
+
+			std::filesystem::path GetDirectory() const override;
+			const void* GetMappedPointer() const override;
+			std::filesystem::path GetPath() const override;
+			UInt64 GetSize() const override;
+
+			bool IsOpen() const;
+
+			bool Open(const std::filesystem::path& filePath);
+
+			MappedFileStream& operator=(const MappedFileStream&) = delete;
+			MappedFileStream& operator=(MappedFileStream&&) noexcept;
+
+		private:
+			void FlushStream() override;
+			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			bool SeekStreamCursor(UInt64 offset) override;
+			UInt64 TellStreamCursor() const override;
+			bool TestStreamEnd() const override;
+			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
+
+			std::filesystem::path m_filePath;
+			std::unique_ptr<MappedFileImpl> m_impl;
+			UInt64 m_cursor;
+	};
+}
+
+#endif // NAZARA_CORE_MAPPEDFILESTREAM_HPP
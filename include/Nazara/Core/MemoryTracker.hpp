@@ -0,0 +1,130 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_MEMORYTRACKER_HPP
+#define NAZARA_CORE_MEMORYTRACKER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#define NazaraMemoryScope(tag, scopeName) static constexpr Nz::MemoryCallSite NazaraConcatMacro(nazaraMemoryCallSite, __LINE__) = { scopeName, NAZARA_FUNCTION, __FILE__, __LINE__ }; \
+                                          Nz::MemoryTrackerScope NazaraConcatMacro(nazaraMemoryScope, __LINE__)(tag, NazaraConcatMacro(nazaraMemoryCallSite, __LINE__))
+
+namespace Nz
+{
+	struct MemoryCallSite
+	{
+		const char* name;
+		const char* function;
+		const char* file;
+		unsigned int line;
+	};
+
+	class NAZARA_CORE_API MemoryTracker
+	{
+		friend class MemoryTrackerScope;
+
+		public:
+			struct CallSiteStats;
+			struct Stats;
+
+			MemoryTracker() = delete;
+			~MemoryTracker() = delete;
+
+			static void* Allocate(std::size_t size, MemoryTag tag);
+
+			static void Free(void* ptr);
+
+			static MemoryTag GetCurrentTag();
+			static Stats GetStats(MemoryTag tag);
+			static std::vector<CallSiteStats> GetTopCallSites(std::size_t maxCount);
+			static Stats GetTotalStats();
+
+			static constexpr bool IsTrackingGlobalAllocations();
+
+			static void ResetStats();
+
+			static bool SaveReport(const std::filesystem::path& filePath);
+
+			static std::string ToReport(std::size_t maxCallSiteCount = 20);
+
+			struct CallSiteStats
+			{
+				const MemoryCallSite* callSite;
+				MemoryTag tag;
+				UInt64 allocatedBytes;
+				UInt64 allocationCount;
+				UInt64 liveBytes;
+			};
+
+			struct Stats
+			{
+				double allocationRate; //< allocations per second since the last ResetStats (or the first allocation)
+				UInt64 allocatedBytes;
+				UInt64 allocationCount;
+				UInt64 liveAllocationCount;
+				UInt64 liveBytes;
+				UInt64 peakBytes;
+			};
+
+		private:
+			struct ScopeState
+			{
+				MemoryTag tag;
+				UInt32 callSiteIndex;
+			};
+
+			static ScopeState PushScope(MemoryTag tag, const MemoryCallSite& callSite);
+			static void PopScope(const ScopeState& previousState);
+	};
+
+	class MemoryTrackerScope
+	{
+		public:
+			inline MemoryTrackerScope(MemoryTag tag, const MemoryCallSite& callSite);
+			MemoryTrackerScope(const MemoryTrackerScope&) = delete;
+			MemoryTrackerScope(MemoryTrackerScope&&) = delete;
+			inline ~MemoryTrackerScope();
+
+			MemoryTrackerScope& operator=(const MemoryTrackerScope&) = delete;
+			MemoryTrackerScope& operator=(MemoryTrackerScope&&) = delete;
+
+		private:
+			MemoryTracker::ScopeState m_previousState;
+	};
+
+	template<typename T, MemoryTag Tag>
+	class TaggedAllocator
+	{
+		public:
+			using value_type = T;
+
+			template<typename U>
+			struct rebind
+			{
+				using other = TaggedAllocator<U, Tag>;
+			};
+
+			TaggedAllocator() = default;
+			template<typename U> TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept;
+
+			T* allocate(std::size_t n);
+			void deallocate(T* ptr, std::size_t n) noexcept;
+
+			template<typename U> bool operator==(const TaggedAllocator<U, Tag>&) const noexcept;
+			template<typename U> bool operator!=(const TaggedAllocator<U, Tag>&) const noexcept;
+	};
+}
+
+#include <Nazara/Core/MemoryTracker.inl>
+
+#endif // NAZARA_CORE_MEMORYTRACKER_HPP
@@ -0,0 +1,85 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MemoryTracker.hpp>
+#include <new>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Checks if the global operators new and delete are replaced by the tracker
+	* \return NAZARA_CORE_MEMORY_TRACKER value
+	*
+	* \remark When false, only allocations made through Allocate (and TaggedAllocator) are tracked
+	*/
+	constexpr bool MemoryTracker::IsTrackingGlobalAllocations()
+	{
+		return NAZARA_CORE_MEMORY_TRACKER != 0;
+	}
+
+	/*!
+	* \brief Attributes the allocations of the calling thread to a tag and a call site until the scope is destroyed
+	*
+	* \param tag Subsystem the allocations belong to
+	* \param callSite Static information about the call site, must outlive the tracker
+	*
+	* \remark Prefer using NazaraMemoryScope which defines the call site
+	*/
+	inline MemoryTrackerScope::MemoryTrackerScope(MemoryTag tag, const MemoryCallSite& callSite) :
+	m_previousState(MemoryTracker::PushScope(tag, callSite))
+	{
+	}
+
+	inline MemoryTrackerScope::~MemoryTrackerScope()
+	{
+		MemoryTracker::PopScope(m_previousState);
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::TaggedAllocator
+	* \brief Core class that allocates memory through the memory tracker under a fixed tag, to be used with standard containers
+	*/
+
+	template<typename T, MemoryTag Tag>
+	template<typename U>
+	TaggedAllocator<T, Tag>::TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept
+	{
+	}
+
+	template<typename T, MemoryTag Tag>
+	T* TaggedAllocator<T, Tag>::allocate(std::size_t n)
+	{
+		static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+
+		void* ptr = MemoryTracker::Allocate(n * sizeof(T), Tag);
+		if (!ptr)
+			throw std::bad_alloc();
+
+		return static_cast<T*>(ptr);
+	}
+
+	template<typename T, MemoryTag Tag>
+	void TaggedAllocator<T, Tag>::deallocate(T* ptr, std::size_t /*n*/) noexcept
+	{
+		MemoryTracker::Free(ptr);
+	}
+
+	template<typename T, MemoryTag Tag>
+	template<typename U>
+	bool TaggedAllocator<T, Tag>::operator==(const TaggedAllocator<U, Tag>&) const noexcept
+	{
+		return true;
+	}
+
+	template<typename T, MemoryTag Tag>
+	template<typename U>
+	bool TaggedAllocator<T, Tag>::operator!=(const TaggedAllocator<U, Tag>&) const noexcept
+	{
+		return false;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -21,6 +21,7 @@ namespace Nz
 			MemoryView(MemoryView&&) = delete; ///TODO
 			~MemoryView() = default;
 
+			const void* GetMappedPointer() const override;
 			UInt64 GetSize() const override;
 
 			MemoryView& operator=(const MemoryView&) = delete;
@@ -0,0 +1,94 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_PACKEDARCHIVE_HPP
+#define NAZARA_CORE_PACKEDARCHIVE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/MappedFileStream.hpp>
+#include <filesystem>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace Nz
+{
+	class NAZARA_CORE_API PackedArchive
+	{
+		public:
+			PackedArchive();
+			PackedArchive(const std::filesystem::path& filePath);
+			PackedArchive(const PackedArchive&) = delete;
+			PackedArchive(PackedArchive&&) noexcept = default;
+			~PackedArchive() = default;
+
+			void Close();
+
+			std::size_t FindEntry(std::string_view path) const;
+			template<typename F> bool ForeachChild(std::size_t directoryIndex, F&& callback) const;
+
+			inline std::size_t GetEntryCount() const;
+			PackedArchiveCompression GetEntryCompression(std::size_t entryIndex) const;
+			const void* GetEntryData(std::size_t entryIndex) const;
+			std::string_view GetEntryName(std::size_t entryIndex) const;
+			std::string_view GetEntryPath(std::size_t entryIndex) const;
+			UInt64 GetEntrySize(std::size_t entryIndex) const;
+			inline std::filesystem::path GetFilePath() const;
+
+			bool IsDirectory(std::size_t entryIndex) const;
+			inline bool IsOpen() const;
+
+			bool Open(const std::filesystem::path& filePath);
+
+			bool ReadEntry(std::size_t entryIndex, void* buffer) const;
+
+			PackedArchive& operator=(const PackedArchive&) = delete;
+			PackedArchive& operator=(PackedArchive&&) noexcept = default;
+
+			static constexpr UInt64 ComputePathHash(std::string_view path);
+
+			static constexpr std::size_t BucketSize = 4;
+			static constexpr std::size_t EntrySize = 64;
+			static constexpr UInt32 EntryFlag_Directory = 1;
+			static constexpr std::size_t HeaderSize = 64;
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+			static constexpr char Magic[4] = { 'N', 'Z', 'P', 'K' };
+			static constexpr std::size_t RootIndex = 0;
+			static constexpr UInt32 Version = 1;
+
+		private:
+			struct EntryRecord
+			{
+				UInt64 pathHash;
+				UInt32 pathOffset;
+				UInt32 pathSize;
+				UInt32 nameOffset;
+				UInt32 flags;
+				UInt32 firstChild;
+				UInt32 childCount;
+				UInt64 dataOffset;
+				UInt64 dataSize;
+				UInt64 storedSize;
+				UInt32 compression;
+			};
+
+			EntryRecord ReadEntryRecord(std::size_t entryIndex) const;
+
+			MappedFileStream m_file;
+			const char* m_stringTable;
+			const UInt8* m_bucketTable;
+			const UInt8* m_entryTable;
+			const UInt8* m_fileData;
+			std::size_t m_bucketCount;
+			std::size_t m_entryCount;
+	};
+}
+
+#include <Nazara/Core/PackedArchive.inl>
+
+#endif // NAZARA_CORE_PACKEDARCHIVE_HPP
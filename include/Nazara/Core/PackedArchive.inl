@@ -0,0 +1,93 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/PackedArchive.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Calls a function for every direct child of a directory entry
+	*
+	* \param directoryIndex Index of the directory entry (RootIndex for the archive root)
+	* \param callback Function called with the child name (std::string_view) and index (std::size_t), it can return false to stop the iteration
+	*
+	* \return false if the iteration was stopped by the callback
+	*/
+	template<typename F>
+	bool PackedArchive::ForeachChild(std::size_t directoryIndex, F&& callback) const
+	{
+		NazaraAssert(directoryIndex < m_entryCount, "entry index out of range");
+
+		EntryRecord record = ReadEntryRecord(directoryIndex);
+		if ((record.flags & EntryFlag_Directory) == 0)
+			return true;
+
+		// Children of a directory are stored contiguously
+		for (std::size_t i = 0; i < record.childCount; ++i)
+		{
+			std::size_t childIndex = record.firstChild + i;
+
+			using Ret = decltype(callback(std::string_view{}, childIndex));
+			if constexpr (std::is_void_v<Ret>)
+				callback(GetEntryName(childIndex), childIndex);
+			else
+			{
+				static_assert(std::is_same_v<Ret, bool>, "callback must either return a boolean or nothing");
+				if (!callback(GetEntryName(childIndex), childIndex))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Gets the number of entries (files and directories, including the root) in the archive
+	* \return Entry count
+	*/
+	inline std::size_t PackedArchive::GetEntryCount() const
+	{
+		return m_entryCount;
+	}
+
+	/*!
+	* \brief Gets the path of the opened archive
+	* \return Archive file path
+	*/
+	inline std::filesystem::path PackedArchive::GetFilePath() const
+	{
+		return m_file.GetPath();
+	}
+
+	/*!
+	* \brief Checks whether an archive is opened
+	* \return true if the archive is opened
+	*/
+	inline bool PackedArchive::IsOpen() const
+	{
+		return m_file.IsOpen();
+	}
+
+	/*!
+	* \brief Computes the hash used to index entry paths
+	* \return 64-bit FNV-1a hash of the path
+	*
+	* \param path Entry path, using '/' as a separator without leading or trailing separators
+	*/
+	constexpr UInt64 PackedArchive::ComputePathHash(std::string_view path)
+	{
+		UInt64 hash = 0xCBF29CE484222325ULL;
+		for (char c : path)
+		{
+			hash ^= static_cast<UInt8>(c);
+			hash *= 0x100000001B3ULL;
+		}
+
+		return hash;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
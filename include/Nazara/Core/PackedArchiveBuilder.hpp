@@ -0,0 +1,60 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_PACKEDARCHIVEBUILDER_HPP
+#define NAZARA_CORE_PACKEDARCHIVEBUILDER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API PackedArchiveBuilder
+	{
+		public:
+			PackedArchiveBuilder() = default;
+			PackedArchiveBuilder(const PackedArchiveBuilder&) = delete;
+			PackedArchiveBuilder(PackedArchiveBuilder&&) noexcept = default;
+			~PackedArchiveBuilder() = default;
+
+			bool AddDirectory(std::string_view path, const std::filesystem::path& directoryPath, PackedArchiveCompression compression = PackedArchiveCompression::None);
+			bool AddFile(std::string_view path, std::filesystem::path filePath, PackedArchiveCompression compression = PackedArchiveCompression::None);
+			bool AddFile(std::string_view path, std::vector<UInt8> content, PackedArchiveCompression compression = PackedArchiveCompression::None);
+
+			inline void Clear();
+
+			inline std::size_t GetFileCount() const;
+
+			bool Save(const std::filesystem::path& filePath, std::size_t dataAlignment = DefaultDataAlignment) const;
+
+			PackedArchiveBuilder& operator=(const PackedArchiveBuilder&) = delete;
+			PackedArchiveBuilder& operator=(PackedArchiveBuilder&&) noexcept = default;
+
+			static constexpr std::size_t DefaultDataAlignment = 16;
+
+		private:
+			bool AddFileEntry(std::string_view path, std::variant<std::filesystem::path, std::vector<UInt8>> source, PackedArchiveCompression compression);
+
+			struct FileEntry
+			{
+				std::variant<std::filesystem::path, std::vector<UInt8>> source;
+				PackedArchiveCompression compression;
+			};
+
+			std::map<std::string, FileEntry, std::less<>> m_files;
+	};
+}
+
+#include <Nazara/Core/PackedArchiveBuilder.inl>
+
+#endif // NAZARA_CORE_PACKEDARCHIVEBUILDER_HPP
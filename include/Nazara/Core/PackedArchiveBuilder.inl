@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/PackedArchiveBuilder.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Removes every file added to the builder
+	*/
+	inline void PackedArchiveBuilder::Clear()
+	{
+		m_files.clear();
+	}
+
+	/*!
+	* \brief Gets the number of files which will be stored in the archive
+	* \return File count
+	*/
+	inline std::size_t PackedArchiveBuilder::GetFileCount() const
+	{
+		return m_files.size();
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,24 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_PARALLELALGORITHM_HPP
+#define NAZARA_CORE_PARALLELALGORITHM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+
+namespace Nz
+{
+	inline std::size_t ComputeParallelGrainSize(std::size_t count, std::size_t grainSize = 0);
+
+	template<typename F> void ParallelFor(std::size_t first, std::size_t last, F&& func, std::size_t grainSize = 0);
+	template<typename F> void ParallelForRange(std::size_t first, std::size_t last, F&& func, std::size_t grainSize = 0);
+	template<typename T, typename M, typename R> T ParallelReduce(std::size_t first, std::size_t last, T identity, M&& map, R&& reduce, std::size_t grainSize = 0);
+}
+
+#include <Nazara/Core/ParallelAlgorithm.inl>
+
+#endif // NAZARA_CORE_PARALLELALGORITHM_HPP
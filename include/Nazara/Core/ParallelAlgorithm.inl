@@ -0,0 +1,142 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utils/CallOnExit.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \brief Computes the number of indices processed by a single task when splitting a range
+	* \return Grain size to use
+	*
+	* \param count Number of indices in the range
+	* \param grainSize Requested grain size, zero means it will be deduced from the worker count (a few chunks per worker)
+	*/
+	inline std::size_t ComputeParallelGrainSize(std::size_t count, std::size_t grainSize)
+	{
+		if (grainSize > 0)
+			return grainSize;
+
+		constexpr std::size_t ChunkPerWorker = 4;
+
+		std::size_t chunkCount = std::size_t(TaskScheduler::GetWorkerCount()) * ChunkPerWorker;
+		return std::max<std::size_t>((count + chunkCount - 1) / chunkCount, 1);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Calls a function for every index of a range, splitting the range across the TaskScheduler workers
+	*
+	* \param first First index of the range
+	* \param last Index past the last index of the range
+	* \param func Function to call with each index (as a std::size_t), may be called concurrently
+	* \param grainSize Number of indices processed by a single task, zero means it will be deduced from the worker count
+	*
+	* \remark This function returns once every index has been processed, it can be called from a task
+	*
+	* \see ParallelForRange
+	*/
+	template<typename F>
+	void ParallelFor(std::size_t first, std::size_t last, F&& func, std::size_t grainSize)
+	{
+		ParallelForRange(first, last, [&](std::size_t rangeFirst, std::size_t rangeLast)
+		{
+			for (std::size_t i = rangeFirst; i < rangeLast; ++i)
+				func(i);
+		}, grainSize);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Splits a range in chunks and calls a function for each of them on the TaskScheduler workers
+	*
+	* \param first First index of the range
+	* \param last Index past the last index of the range
+	* \param func Function to call with each chunk bounds (first and past-the-last index), may be called concurrently
+	* \param grainSize Maximum size of a chunk, zero means it will be deduced from the worker count
+	*
+	* \remark The first chunk is processed by the calling thread, which then helps the workers until every chunk has been processed
+	* \remark If func throws on the calling thread, the exception is propagated once every spawned chunk has been processed
+	*/
+	template<typename F>
+	void ParallelForRange(std::size_t first, std::size_t last, F&& func, std::size_t grainSize)
+	{
+		if (first >= last)
+			return;
+
+		std::size_t count = last - first;
+		grainSize = ComputeParallelGrainSize(count, grainSize);
+		if (count <= grainSize)
+		{
+			func(first, last);
+			return;
+		}
+
+		TaskCounter counter;
+
+		// Spawned tasks reference the counter and the function, they must be done before leaving even if an exception is thrown
+		CallOnExit waitForTasks([&counter] { TaskScheduler::WaitForCounter(counter); });
+
+		for (std::size_t chunkFirst = first + grainSize; chunkFirst < last; chunkFirst += grainSize)
+		{
+			std::size_t chunkLast = std::min(chunkFirst + grainSize, last);
+			TaskScheduler::SpawnTask(counter, [&func, chunkFirst, chunkLast] { func(chunkFirst, chunkLast); });
+		}
+
+		func(first, first + grainSize);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Splits a range in chunks, computes a partial result for each one of them on the TaskScheduler workers and combines them
+	* \return Combined result of every chunk (or identity if the range is empty)
+	*
+	* \param first First index of the range
+	* \param last Index past the last index of the range
+	* \param identity Initial value of the reduction
+	* \param map Function computing the partial result of a chunk from its bounds (first and past-the-last index), may be called concurrently
+	* \param reduce Function combining two results into one
+	* \param grainSize Maximum size of a chunk, zero means it will be deduced from the worker count
+	*
+	* \remark Partial results are always combined in chunk order on the calling thread, making the reduction deterministic for a given grain size
+	* \remark As the default grain size depends on the worker count, an explicit grain size should be specified if the result has to be the same on every machine (e.g. floating-point sums)
+	*/
+	template<typename T, typename M, typename R>
+	T ParallelReduce(std::size_t first, std::size_t last, T identity, M&& map, R&& reduce, std::size_t grainSize)
+	{
+		if (first >= last)
+			return identity;
+
+		std::size_t count = last - first;
+		grainSize = ComputeParallelGrainSize(count, grainSize);
+
+		std::size_t chunkCount = (count + grainSize - 1) / grainSize;
+		std::vector<T> partialResults(chunkCount, identity);
+
+		ParallelForRange(0, chunkCount, [&](std::size_t firstChunk, std::size_t lastChunk)
+		{
+			for (std::size_t chunkIndex = firstChunk; chunkIndex < lastChunk; ++chunkIndex)
+			{
+				std::size_t chunkFirst = first + chunkIndex * grainSize;
+				std::size_t chunkLast = std::min(chunkFirst + grainSize, last);
+				partialResults[chunkIndex] = map(chunkFirst, chunkLast);
+			}
+		}, 1);
+
+		T result = std::move(identity);
+		for (T& partialResult : partialResults)
+			result = reduce(std::move(result), std::move(partialResult));
+
+		return result;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
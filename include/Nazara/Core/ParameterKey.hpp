@@ -0,0 +1,45 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_PARAMETERKEY_HPP
+#define NAZARA_CORE_PARAMETERKEY_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <string>
+#include <string_view>
+
+namespace Nz
+{
+	class ParameterKey
+	{
+		public:
+			constexpr ParameterKey(const char* name);
+			constexpr ParameterKey(std::string_view name);
+			inline ParameterKey(const std::string& name);
+			constexpr ParameterKey(const ParameterKey&) = default;
+			constexpr ParameterKey(ParameterKey&&) = default;
+			~ParameterKey() = default;
+
+			constexpr UInt64 GetHash() const;
+			constexpr std::string_view GetName() const;
+
+			constexpr ParameterKey& operator=(const ParameterKey&) = default;
+			constexpr ParameterKey& operator=(ParameterKey&&) = default;
+
+			constexpr bool operator==(const ParameterKey& key) const;
+			constexpr bool operator!=(const ParameterKey& key) const;
+
+			static constexpr UInt64 ComputeHash(std::string_view name);
+
+		private:
+			std::string_view m_name;
+			UInt64 m_hash;
+	};
+}
+
+#include <Nazara/Core/ParameterKey.inl>
+
+#endif // NAZARA_CORE_PARAMETERKEY_HPP
@@ -0,0 +1,110 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ParameterKey.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::ParameterKey
+	* \brief Core class that represents the name of a parameter along with its hash
+	*
+	* The hash is computed once when the key is built (at compile-time for constexpr keys) and is used to speed up lookups.
+	*
+	* \remark A key doesn't own its name, it must not outlive the string it was built from
+	*/
+
+	/*!
+	* \brief Constructs a ParameterKey object from a null-terminated string
+	*
+	* \param name Name of the parameter
+	*/
+	constexpr ParameterKey::ParameterKey(const char* name) :
+	ParameterKey(std::string_view(name))
+	{
+	}
+
+	/*!
+	* \brief Constructs a ParameterKey object from a string view
+	*
+	* \param name Name of the parameter
+	*/
+	constexpr ParameterKey::ParameterKey(std::string_view name) :
+	m_name(name),
+	m_hash(ComputeHash(name))
+	{
+	}
+
+	/*!
+	* \brief Constructs a ParameterKey object from a string
+	*
+	* \param name Name of the parameter
+	*/
+	inline ParameterKey::ParameterKey(const std::string& name) :
+	ParameterKey(std::string_view(name))
+	{
+	}
+
+	/*!
+	* \brief Gets the hash of the key name
+	* \return Hash as computed by ComputeHash
+	*/
+	constexpr UInt64 ParameterKey::GetHash() const
+	{
+		return m_hash;
+	}
+
+	/*!
+	* \brief Gets the name of the key
+	* \return Name of the parameter
+	*/
+	constexpr std::string_view ParameterKey::GetName() const
+	{
+		return m_name;
+	}
+
+	/*!
+	* \brief Checks whether two keys refer to the same parameter
+	* \return true if both names are equal
+	*
+	* \param key Other key
+	*/
+	constexpr bool ParameterKey::operator==(const ParameterKey& key) const
+	{
+		return m_hash == key.m_hash && m_name == key.m_name;
+	}
+
+	/*!
+	* \brief Checks whether two keys refer to different parameters
+	* \return true if names are different
+	*
+	* \param key Other key
+	*/
+	constexpr bool ParameterKey::operator!=(const ParameterKey& key) const
+	{
+		return !operator==(key);
+	}
+
+	/*!
+	* \brief Computes the hash of a parameter name
+	* \return 64-bit FNV-1a hash of the name
+	*
+	* \param name Name of the parameter
+	*/
+	constexpr UInt64 ParameterKey::ComputeHash(std::string_view name)
+	{
+		UInt64 hash = 14695981039346656037ULL;
+		for (char c : name)
+		{
+			hash ^= static_cast<UInt8>(c);
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
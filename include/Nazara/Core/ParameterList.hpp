@@ -9,11 +9,14 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/ParameterKey.hpp>
 #include <Nazara/Utils/MovablePtr.hpp>
 #include <Nazara/Utils/Result.hpp>
 #include <atomic>
+#include <functional>
+#include <limits>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -33,29 +36,29 @@ namespace Nz
 			inline void ForEach(const std::function<bool(const ParameterList& list, const std::string& name)>& callback);
 			inline void ForEach(const std::function<void(const ParameterList& list, const std::string& name)>& callback) const;
 
-			Result<bool, Error> GetBooleanParameter(const std::string& name, bool strict = true) const;
-			Result<Color, Error> GetColorParameter(const std::string& name, bool strict = true) const;
-			Result<double, Error> GetDoubleParameter(const std::string& name, bool strict = true) const;
-			Result<long long, Error> GetIntegerParameter(const std::string& name, bool strict = true) const;
-			Result<ParameterType, Error> GetParameterType(const std::string& name) const;
-			Result<void*, Error> GetPointerParameter(const std::string& name, bool strict = true) const;
-			Result<std::string, Error> GetStringParameter(const std::string& name, bool strict = true) const;
-			Result<std::string_view, Error> GetStringViewParameter(const std::string& name, bool strict = true) const;
-			Result<void*, Error> GetUserdataParameter(const std::string& name, bool strict = true) const;
-
-			bool HasParameter(const std::string& name) const;
-
-			void RemoveParameter(const std::string& name);
-
-			void SetParameter(const std::string& name);
-			void SetParameter(const std::string& name, const Color& value);
-			void SetParameter(const std::string& name, const std::string& value);
-			void SetParameter(const std::string& name, const char* value);
-			void SetParameter(const std::string& name, bool value);
-			void SetParameter(const std::string& name, double value);
-			void SetParameter(const std::string& name, long long value);
-			void SetParameter(const std::string& name, void* value);
-			void SetParameter(const std::string& name, void* value, Destructor destructor);
+			Result<bool, Error> GetBooleanParameter(const ParameterKey& key, bool strict = true) const;
+			Result<Color, Error> GetColorParameter(const ParameterKey& key, bool strict = true) const;
+			Result<double, Error> GetDoubleParameter(const ParameterKey& key, bool strict = true) const;
+			Result<long long, Error> GetIntegerParameter(const ParameterKey& key, bool strict = true) const;
+			Result<ParameterType, Error> GetParameterType(const ParameterKey& key) const;
+			Result<void*, Error> GetPointerParameter(const ParameterKey& key, bool strict = true) const;
+			Result<std::string, Error> GetStringParameter(const ParameterKey& key, bool strict = true) const;
+			Result<std::string_view, Error> GetStringViewParameter(const ParameterKey& key, bool strict = true) const;
+			Result<void*, Error> GetUserdataParameter(const ParameterKey& key, bool strict = true) const;
+
+			bool HasParameter(const ParameterKey& key) const;
+
+			void RemoveParameter(const ParameterKey& key);
+
+			void SetParameter(const ParameterKey& key);
+			void SetParameter(const ParameterKey& key, const Color& value);
+			void SetParameter(const ParameterKey& key, const std::string& value);
+			void SetParameter(const ParameterKey& key, const char* value);
+			void SetParameter(const ParameterKey& key, bool value);
+			void SetParameter(const ParameterKey& key, double value);
+			void SetParameter(const ParameterKey& key, long long value);
+			void SetParameter(const ParameterKey& key, void* value);
+			void SetParameter(const ParameterKey& key, void* value, Destructor destructor);
 
 			std::string ToString() const;
 
@@ -108,11 +111,32 @@ namespace Nz
 				Value value;
 			};
 
-			Parameter& CreateValue(const std::string& name);
-			void DestroyValue(Parameter& parameter);
+			struct Entry
+			{
+				inline Entry(std::string_view parameterName);
+				Entry(const Entry&) = delete;
+				inline Entry(Entry&& entry) noexcept;
+				inline ~Entry();
+
+				Entry& operator=(const Entry&) = delete;
+				inline Entry& operator=(Entry&& entry) noexcept;
+
+				std::string name;
+				Parameter parameter;
+			};
+
+			Parameter& CreateValue(const ParameterKey& key);
+			inline const Parameter* FindParameter(const ParameterKey& key) const;
+			inline std::size_t FindParameterIndex(const ParameterKey& key) const;
+
+			static void DestroyValue(Parameter& parameter);
+			static void MoveValue(Parameter& source, Parameter& destination);
+
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
 
-			using ParameterMap = std::unordered_map<std::string, Parameter>;
-			ParameterMap m_parameters;
+			// Hashes are kept apart from the parameters so lookups only scan a contiguous array of integers
+			std::vector<UInt64> m_parameterHashes;
+			std::vector<Entry> m_parameters;
 	};
 }
 
@@ -16,12 +16,15 @@ namespace Nz
 	*/
 	inline void ParameterList::ForEach(const std::function<bool(const ParameterList& list, const std::string& name)>& callback)
 	{
-		for (auto it = m_parameters.begin(); it != m_parameters.end();)
+		for (std::size_t i = 0; i < m_parameters.size();)
 		{
-			if (callback(*this, it->first))
-				it = m_parameters.erase(it);
+			if (callback(*this, m_parameters[i].name))
+			{
+				m_parameterHashes.erase(m_parameterHashes.begin() + i);
+				m_parameters.erase(m_parameters.begin() + i);
+			}
 			else
-				++it;
+				++i;
 		}
 	}
 
@@ -34,8 +37,68 @@ namespace Nz
 	*/
 	inline void ParameterList::ForEach(const std::function<void(const ParameterList& list, const std::string& name)>& callback) const
 	{
-		for (auto& pair : m_parameters)
-			callback(*this, pair.first);
+		for (const Entry& entry : m_parameters)
+			callback(*this, entry.name);
+	}
+
+	/*!
+	* \brief Finds a parameter
+	* \return Pointer to the parameter or nullptr if it doesn't exist
+	*
+	* \param key Key of the parameter
+	*/
+	inline auto ParameterList::FindParameter(const ParameterKey& key) const -> const Parameter*
+	{
+		std::size_t index = FindParameterIndex(key);
+		if (index == InvalidIndex)
+			return nullptr;
+
+		return &m_parameters[index].parameter;
+	}
+
+	/*!
+	* \brief Finds the index of a parameter
+	* \return Index of the parameter or InvalidIndex if it doesn't exist
+	*
+	* \param key Key of the parameter
+	*/
+	inline std::size_t ParameterList::FindParameterIndex(const ParameterKey& key) const
+	{
+		UInt64 hash = key.GetHash();
+		for (std::size_t i = 0; i < m_parameterHashes.size(); ++i)
+		{
+			if (m_parameterHashes[i] == hash && m_parameters[i].name == key.GetName())
+				return i;
+		}
+
+		return InvalidIndex;
+	}
+
+	inline ParameterList::Entry::Entry(std::string_view parameterName) :
+	name(parameterName)
+	{
+		parameter.type = ParameterType::None;
+	}
+
+	inline ParameterList::Entry::Entry(Entry&& entry) noexcept :
+	name(std::move(entry.name))
+	{
+		MoveValue(entry.parameter, parameter);
+	}
+
+	inline ParameterList::Entry::~Entry()
+	{
+		DestroyValue(parameter);
+	}
+
+	inline auto ParameterList::Entry::operator=(Entry&& entry) noexcept -> Entry&
+	{
+		DestroyValue(parameter);
+
+		name = std::move(entry.name);
+		MoveValue(entry.parameter, parameter);
+
+		return *this;
 	}
 }
 
@@ -0,0 +1,93 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_PROFILER_HPP
+#define NAZARA_CORE_PROFILER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <atomic>
+#include <filesystem>
+#include <string>
+
+#if NAZARA_CORE_PROFILER
+	#define NazaraProfileFrame() Nz::Profiler::MarkFrame()
+	#define NazaraProfileZone(zoneName) static constexpr Nz::ProfilerZoneInfo NazaraConcatMacro(nazaraProfilerZoneInfo, __LINE__) = { zoneName, NAZARA_FUNCTION, __FILE__, __LINE__ }; \
+	                                    Nz::ProfilerScopedZone NazaraConcatMacro(nazaraProfilerZone, __LINE__)(NazaraConcatMacro(nazaraProfilerZoneInfo, __LINE__))
+#else
+	#define NazaraProfileFrame() for (;;) break
+	#define NazaraProfileZone(zoneName) for (;;) break
+#endif
+
+namespace Nz
+{
+	struct ProfilerZoneInfo
+	{
+		const char* name;
+		const char* function;
+		const char* file;
+		unsigned int line;
+	};
+
+	class NAZARA_CORE_API Profiler
+	{
+		friend class ProfilerScopedZone;
+
+		public:
+			Profiler() = delete;
+			~Profiler() = delete;
+
+			static inline void BeginZone(const ProfilerZoneInfo& zone);
+			static inline void EndZone();
+
+			static std::size_t GetDroppedEventCount();
+
+			static inline bool IsCapturing();
+
+			static inline void MarkFrame();
+
+			static bool SaveChromeTrace(const std::filesystem::path& filePath);
+			static void SetThreadName(std::string threadName);
+			static void StartCapture(unsigned int frameCount = 0);
+			static void StopCapture();
+
+			static std::string ToChromeTrace();
+
+		private:
+			enum class EventType : UInt8
+			{
+				Frame,
+				ZoneBegin,
+				ZoneEnd
+			};
+
+			static inline unsigned int GetCaptureId();
+			static void PushEvent(EventType eventType, const ProfilerZoneInfo* zone, unsigned int captureId);
+
+			static std::atomic_bool s_isCapturing;
+			static std::atomic_uint s_captureId;
+	};
+
+	class ProfilerScopedZone
+	{
+		public:
+			inline ProfilerScopedZone(const ProfilerZoneInfo& zone);
+			ProfilerScopedZone(const ProfilerScopedZone&) = delete;
+			ProfilerScopedZone(ProfilerScopedZone&&) = delete;
+			inline ~ProfilerScopedZone();
+
+			ProfilerScopedZone& operator=(const ProfilerScopedZone&) = delete;
+			ProfilerScopedZone& operator=(ProfilerScopedZone&&) = delete;
+
+		private:
+			unsigned int m_captureId; //< 0 if the zone isn't recorded
+	};
+}
+
+#include <Nazara/Core/Profiler.inl>
+
+#endif // NAZARA_CORE_PROFILER_HPP
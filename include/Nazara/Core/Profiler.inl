@@ -0,0 +1,72 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Records the beginning of a zone on the calling thread
+	*
+	* \param zone Static information about the zone, must outlive the capture
+	*
+	* \remark Prefer using NazaraProfileZone which handles the zone lifetime
+	*/
+	inline void Profiler::BeginZone(const ProfilerZoneInfo& zone)
+	{
+		if (IsCapturing())
+			PushEvent(EventType::ZoneBegin, &zone, GetCaptureId());
+	}
+
+	/*!
+	* \brief Records the end of the last zone begun on the calling thread
+	*/
+	inline void Profiler::EndZone()
+	{
+		if (IsCapturing())
+			PushEvent(EventType::ZoneEnd, nullptr, GetCaptureId());
+	}
+
+	/*!
+	* \brief Checks if a capture is running
+	* \return True if events are currently recorded
+	*/
+	inline bool Profiler::IsCapturing()
+	{
+		return s_isCapturing.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Marks the end of a frame
+	*
+	* \remark If the capture was started for a limited number of frames, this stops it after the last one
+	*/
+	inline void Profiler::MarkFrame()
+	{
+		if (IsCapturing())
+			PushEvent(EventType::Frame, nullptr, GetCaptureId());
+	}
+
+	inline unsigned int Profiler::GetCaptureId()
+	{
+		return s_captureId.load(std::memory_order_acquire);
+	}
+
+	inline ProfilerScopedZone::ProfilerScopedZone(const ProfilerZoneInfo& zone) :
+	m_captureId((Profiler::IsCapturing()) ? Profiler::GetCaptureId() : 0)
+	{
+		if (m_captureId != 0)
+			Profiler::PushEvent(Profiler::EventType::ZoneBegin, &zone, m_captureId);
+	}
+
+	inline ProfilerScopedZone::~ProfilerScopedZone()
+	{
+		// Close zones opened during the capture even if it has been stopped meanwhile, but not if another capture has been started since
+		if (m_captureId != 0)
+			Profiler::PushEvent(Profiler::EventType::ZoneEnd, nullptr, m_captureId);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -13,6 +13,7 @@
 #include <Nazara/Utils/Result.hpp>
 #include <filesystem>
 #include <functional>
+#include <future>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -46,6 +47,7 @@ namespace Nz
 			bool IsExtensionSupported(const std::string_view& extension) const;
 
 			std::shared_ptr<Type> LoadFromFile(const std::filesystem::path& filePath, const Parameters& parameters = Parameters()) const;
+			std::shared_future<std::shared_ptr<Type>> LoadFromFileAsync(std::filesystem::path filePath, Parameters parameters = Parameters()) const;
 			std::shared_ptr<Type> LoadFromMemory(const void* data, std::size_t size, const Parameters& parameters = Parameters()) const;
 			std::shared_ptr<Type> LoadFromStream(Stream& stream, const Parameters& parameters = Parameters()) const;
 
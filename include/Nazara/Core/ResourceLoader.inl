@@ -5,10 +5,14 @@
 #include <Nazara/Core/ResourceLoader.hpp>
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFileStream.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -62,6 +66,8 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	std::shared_ptr<Type> ResourceLoader<Type, Parameters>::LoadFromFile(const std::filesystem::path& filePath, const Parameters& parameters) const
 	{
+		NazaraProfileZone("ResourceLoader::LoadFromFile");
+
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
 
 		std::string ext = ToLower(PathToString(filePath.extension()));
@@ -71,7 +77,31 @@ namespace Nz
 			return nullptr;
 		}
 
-		File file(filePath); // Open only if needed
+		// Stream loaders read regular files from a memory mapping, letting them parse data in place (see Stream::GetMappedPointer)
+		// Other files (pipes, procfs, ...) report a null size and can't be mapped, they are read using File
+		MappedFileStream mappedFile;
+		File file;
+		Stream* stream = nullptr; // Open only if needed
+
+		auto OpenStream = [&]() -> Stream*
+		{
+			std::error_code ec;
+			if (std::filesystem::is_regular_file(filePath, ec))
+			{
+				std::uintmax_t fileSize = std::filesystem::file_size(filePath, ec);
+				if (!ec && fileSize > 0)
+				{
+					ErrorFlags errFlags(ErrorMode::Silent | ErrorMode::ThrowExceptionDisabled);
+					if (mappedFile.Open(filePath))
+						return &mappedFile;
+				}
+			}
+
+			if (!file.Open(filePath, OpenMode::ReadOnly))
+				return nullptr;
+
+			return &file;
+		};
 
 		bool found = false;
 		for (auto& loaderPtr : m_loaders)
@@ -90,18 +120,19 @@ namespace Nz
 				result = loader.fileLoader(filePath, parameters);
 			else if (loader.streamLoader)
 			{
-				if (!file.IsOpen())
+				if (!stream)
 				{
-					if (!file.Open(OpenMode::ReadOnly))
+					stream = OpenStream();
+					if (!stream)
 					{
 						NazaraError("failed to load resource: unable to open \"" + PathToString(filePath) + '"');
 						return nullptr;
 					}
 				}
 				else
-					file.SetCursorPos(0);
+					stream->SetCursorPos(0);
 
-				result = loader.streamLoader(file, parameters);
+				result = loader.streamLoader(*stream, parameters);
 			}
 
 			if (!result)
@@ -129,6 +160,39 @@ namespace Nz
 		return nullptr;
 	}
 
+	/*!
+	* \brief Loads a resource from a file on a TaskScheduler worker
+	* \return Future holding the loaded resource, or a null pointer if loading failed
+	*
+	* \param filePath Path to the resource
+	* \param parameters Parameters for the load
+	*
+	* \remark The loader must outlive the load, and no loader should be registered or unregistered until it completes
+	* \remark Loaders are run from a worker thread, resources requiring the main thread (such as textures) should be created from the result afterwards
+	*
+	* \see LoadFromFile
+	*/
+	template<typename Type, typename Parameters>
+	std::shared_future<std::shared_ptr<Type>> ResourceLoader<Type, Parameters>::LoadFromFileAsync(std::filesystem::path filePath, Parameters parameters) const
+	{
+		auto promise = std::make_shared<std::promise<std::shared_ptr<Type>>>();
+		std::shared_future<std::shared_ptr<Type>> future = promise->get_future().share();
+
+		TaskScheduler::SpawnTask([this, filePath = std::move(filePath), parameters = std::move(parameters), promise]
+		{
+			try
+			{
+				promise->set_value(LoadFromFile(filePath, parameters));
+			}
+			catch (...)
+			{
+				promise->set_exception(std::current_exception());
+			}
+		});
+
+		return future;
+	}
+
 	/*!
 	* \brief Loads a resource from a raw memory, a size and parameters
 	* \return loaded resources or null pointer if failed
@@ -140,6 +204,8 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	std::shared_ptr<Type> ResourceLoader<Type, Parameters>::LoadFromMemory(const void* data, std::size_t size, const Parameters& parameters) const
 	{
+		NazaraProfileZone("ResourceLoader::LoadFromMemory");
+
 		NazaraAssert(data, "Invalid data pointer");
 		NazaraAssert(size, "No data to load");
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
@@ -197,6 +263,8 @@ namespace Nz
 	template<typename Type, typename Parameters>
 	std::shared_ptr<Type> ResourceLoader<Type, Parameters>::LoadFromStream(Stream& stream, const Parameters& parameters) const
 	{
+		NazaraProfileZone("ResourceLoader::LoadFromStream");
+
 		NazaraAssert(stream.GetCursorPos() < stream.GetSize(), "No data to load");
 		NazaraAssert(parameters.IsValid(), "Invalid parameters");
 
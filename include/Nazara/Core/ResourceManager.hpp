@@ -8,9 +8,16 @@
 #define NAZARA_CORE_RESOURCEMANAGER_HPP
 
 #include <Nazara/Core/ResourceLoader.hpp>
+#include <Nazara/Core/TaskCounter.hpp>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <limits>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -18,26 +25,85 @@ namespace Nz
 	class ResourceManager
 	{
 		public:
+			struct Stats;
+			using CompletionCallback = std::function<void(const std::shared_ptr<Type>& resource)>;
 			using Loader = ResourceLoader<Type, Parameters>;
+			using MemoryUsageFunction = std::function<std::size_t(const Type& resource)>;
 
 			ResourceManager(Loader& loader);
-			explicit ResourceManager(const ResourceManager&) = default;
+			explicit ResourceManager(const ResourceManager& manager);
 			ResourceManager(ResourceManager&&) noexcept = default;
 			~ResourceManager() = default;
 
 			void Clear();
 
+			std::size_t EvictUnused(std::size_t targetMemoryUsage = 0);
+
 			std::shared_ptr<Type> Get(const std::filesystem::path& filePath);
+			std::shared_future<std::shared_ptr<Type>> GetAsync(const std::filesystem::path& filePath, CompletionCallback callback = nullptr);
 			const Parameters& GetDefaultParameters();
+			std::size_t GetMemoryBudget() const;
+			std::size_t GetPendingLoadCount() const;
+			const Stats& GetStats() const;
+
+			void ProcessCompletedLoads();
 
 			void Register(const std::filesystem::path& filePath, std::shared_ptr<Type> resource);
+			void ResetStats();
+
 			void SetDefaultParameters(Parameters params);
+			void SetMemoryBudget(std::size_t memoryBudget);
+			void SetMemoryUsageFunction(MemoryUsageFunction memoryUsageFunc);
+
 			void Unregister(const std::filesystem::path& filePath);
 
 			ResourceManager& operator=(const ResourceManager&) = delete;
 			ResourceManager& operator=(ResourceManager&&) = delete;
 
+			static constexpr std::size_t NoMemoryBudget = std::numeric_limits<std::size_t>::max();
+
+			struct Stats
+			{
+				UInt64 evictedMemory = 0;
+				UInt64 evictionCount = 0;
+				UInt64 hitCount = 0;
+				UInt64 missCount = 0;
+				std::size_t memoryUsage = 0;
+				std::size_t resourceCount = 0;
+			};
+
 		private:
+			struct PendingLoad;
+			struct ResourceEntry;
+
+			void EnforceMemoryBudget();
+			std::shared_ptr<Type> FinishLoad(const std::shared_ptr<PendingLoad>& pendingLoad);
+			const std::shared_ptr<Type>& Insert(const std::filesystem::path& absolutePath, std::shared_ptr<Type> resource, bool replace);
+			void Remove(const std::filesystem::path& absolutePath);
+			const std::shared_ptr<Type>& Touch(ResourceEntry& entry);
+
+			struct AsyncState
+			{
+				std::mutex mutex;
+				std::vector<std::shared_ptr<PendingLoad>> completedLoads;
+			};
+
+			struct PendingLoad
+			{
+				std::filesystem::path filePath;
+				std::promise<std::shared_ptr<Type>> promise;
+				std::shared_future<std::shared_ptr<Type>> future;
+				std::vector<CompletionCallback> callbacks;
+				TaskCounter taskCounter;
+			};
+
+			struct ResourceEntry
+			{
+				std::shared_ptr<Type> resource;
+				std::list<std::filesystem::path>::iterator lruIt;
+				std::size_t memoryUsage;
+			};
+
 			// https://stackoverflow.com/questions/51065244/is-there-no-standard-hash-for-stdfilesystempath
 			struct PathHash
 			{
@@ -47,9 +113,15 @@ namespace Nz
 				}
 			};
 
-			std::unordered_map<std::filesystem::path, std::shared_ptr<Type>, PathHash> m_resources;
+			std::shared_ptr<AsyncState> m_asyncState;
+			std::unordered_map<std::filesystem::path, std::shared_ptr<PendingLoad>, PathHash> m_pendingLoads;
+			std::unordered_map<std::filesystem::path, ResourceEntry, PathHash> m_resources;
+			std::list<std::filesystem::path> m_lruList; //< most recently used first
+			std::size_t m_memoryBudget;
 			Loader& m_loader;
+			MemoryUsageFunction m_memoryUsageFunc;
 			Parameters m_defaultParameters;
+			Stats m_stats;
 	};
 }
 
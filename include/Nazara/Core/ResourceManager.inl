@@ -6,14 +6,32 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <type_traits>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
+	namespace Detail
+	{
+		template<typename, typename = void>
+		struct ResourceHasMemoryUsage : std::bool_constant<false> {};
+
+		template<typename T>
+		struct ResourceHasMemoryUsage<T, std::void_t<decltype(std::declval<const T&>().GetMemoryUsage())>> : std::bool_constant<true> {};
+	}
+
 	/*!
 	* \ingroup core
 	* \class Nz::ResourceManager
 	* \brief Core class that represents a resource manager
+	*
+	* Resources can be loaded asynchronously using GetAsync, their loading then happens on TaskScheduler workers
+	* and the manager registers them (and calls completion callbacks) when ProcessCompletedLoads is called.
+	*
+	* A memory budget can be set, in which case the least recently used resources are evicted when the resources memory usage exceeds it.
+	* Only resources which aren't used outside of the manager are evicted, the budget can thus be exceeded temporarily.
+	* Resources memory usage is computed using their GetMemoryUsage method if they have one (see SetMemoryUsageFunction).
 	*/
 
 
@@ -22,17 +40,94 @@ namespace Nz
 	*/
 	template<typename Type, typename Parameters>
 	ResourceManager<Type, Parameters>::ResourceManager(Loader& loader) :
+	m_asyncState(std::make_shared<AsyncState>()),
+	m_memoryBudget(NoMemoryBudget),
 	m_loader(loader)
 	{
 	}
 
+	/*!
+	* \brief Constructs a ResourceManager object by copying another one
+	*
+	* \param manager Manager to copy resources and parameters from
+	*
+	* \remark Resources being loaded asynchronously by the other manager are not copied
+	*/
+	template<typename Type, typename Parameters>
+	ResourceManager<Type, Parameters>::ResourceManager(const ResourceManager& manager) :
+	m_asyncState(std::make_shared<AsyncState>()),
+	m_memoryBudget(manager.m_memoryBudget),
+	m_loader(manager.m_loader),
+	m_memoryUsageFunc(manager.m_memoryUsageFunc),
+	m_defaultParameters(manager.m_defaultParameters),
+	m_stats(manager.m_stats)
+	{
+		// Entries reference their position in the LRU list, rebuild it in the same order
+		for (const std::filesystem::path& path : manager.m_lruList)
+		{
+			const ResourceEntry& otherEntry = manager.m_resources.find(path)->second;
+
+			ResourceEntry& entry = m_resources[path];
+			entry.resource = otherEntry.resource;
+			entry.lruIt = m_lruList.insert(m_lruList.end(), path);
+			entry.memoryUsage = otherEntry.memoryUsage;
+		}
+	}
+
 	/*!
 	* \brief Clears the content of the manager
+	*
+	* \remark Resources being loaded asynchronously will still be registered once loaded
 	*/
 	template<typename Type, typename Parameters>
 	void ResourceManager<Type, Parameters>::Clear()
 	{
+		m_lruList.clear();
 		m_resources.clear();
+
+		m_stats.memoryUsage = 0;
+		m_stats.resourceCount = 0;
+	}
+
+	/*!
+	* \brief Evicts least recently used resources until the memory usage is below a target
+	* \return Number of evicted resources
+	*
+	* \param targetMemoryUsage Memory usage to reach, zero evicts every unused resource
+	*
+	* \remark Resources used outside of the manager (whose shared pointer isn't only owned by the manager) are never evicted
+	*/
+	template<typename Type, typename Parameters>
+	std::size_t ResourceManager<Type, Parameters>::EvictUnused(std::size_t targetMemoryUsage)
+	{
+		std::size_t evictedCount = 0;
+
+		auto it = m_lruList.end();
+		while (it != m_lruList.begin() && (m_stats.memoryUsage > targetMemoryUsage || targetMemoryUsage == 0))
+		{
+			--it;
+
+			auto resourceIt = m_resources.find(*it);
+			NazaraAssert(resourceIt != m_resources.end(), "LRU list is out of sync");
+
+			ResourceEntry& entry = resourceIt->second;
+			if (entry.resource.use_count() > 1)
+				continue;
+
+			NazaraDebug("Evicting resource " + PathToString(*it));
+
+			m_stats.evictedMemory += entry.memoryUsage;
+			m_stats.evictionCount++;
+			m_stats.memoryUsage -= entry.memoryUsage;
+			m_stats.resourceCount--;
+
+			m_resources.erase(resourceIt);
+			it = m_lruList.erase(it);
+
+			evictedCount++;
+		}
+
+		return evictedCount;
 	}
 
 	/*!
@@ -46,21 +141,101 @@ namespace Nz
 	{
 		std::filesystem::path absolutePath = std::filesystem::canonical(filePath);
 		auto it = m_resources.find(absolutePath);
-		if (it == m_resources.end())
+		if (it != m_resources.end())
 		{
-			std::shared_ptr<Type> resource = m_loader.LoadFromFile(absolutePath, GetDefaultParameters());
-			if (!resource)
-			{
-				NazaraError("Failed to load resource from file: " + PathToString(absolutePath));
-				return std::shared_ptr<Type>();
-			}
+			m_stats.hitCount++;
+			return Touch(it->second);
+		}
+
+		m_stats.missCount++;
+
+		// Resource is being loaded asynchronously, wait for it instead of loading it twice
+		if (auto pendingIt = m_pendingLoads.find(absolutePath); pendingIt != m_pendingLoads.end())
+		{
+			std::shared_ptr<PendingLoad> pendingLoad = pendingIt->second;
+			TaskScheduler::WaitForCounter(pendingLoad->taskCounter);
+
+			return FinishLoad(pendingLoad);
+		}
+
+		std::shared_ptr<Type> resource = m_loader.LoadFromFile(absolutePath, GetDefaultParameters());
+		if (!resource)
+		{
+			NazaraError("Failed to load resource from file: " + PathToString(absolutePath));
+			return std::shared_ptr<Type>();
+		}
+
+		NazaraDebug("Loaded resource from file " + PathToString(absolutePath));
+
+		Insert(absolutePath, resource, false);
+		EnforceMemoryBudget();
 
-			NazaraDebug("Loaded resource from file " + PathToString(absolutePath));
+		return resource;
+	}
 
-			it = m_resources.insert(std::make_pair(absolutePath, resource)).first;
+	/*!
+	* \brief Gets the object loaded from file, loading it on a TaskScheduler worker if required
+	* \return Future holding the object (or a null pointer if loading failed)
+	*
+	* \param filePath Path to the asset that will be loaded
+	* \param callback Optional function called from ProcessCompletedLoads once the resource is loaded (with a null pointer if loading failed)
+	*
+	* \remark Requesting a resource which is already being loaded doesn't load it again but returns the same future
+	* \remark If the resource is already loaded, the callback is called immediately
+	* \remark Default parameters are copied, changing them afterwards doesn't affect pending loads
+	*
+	* \see ProcessCompletedLoads
+	*/
+	template<typename Type, typename Parameters>
+	std::shared_future<std::shared_ptr<Type>> ResourceManager<Type, Parameters>::GetAsync(const std::filesystem::path& filePath, CompletionCallback callback)
+	{
+		std::filesystem::path absolutePath = std::filesystem::canonical(filePath);
+		if (auto it = m_resources.find(absolutePath); it != m_resources.end())
+		{
+			m_stats.hitCount++;
+
+			std::shared_ptr<Type> resource = Touch(it->second);
+			if (callback)
+				callback(resource);
+
+			std::promise<std::shared_ptr<Type>> promise;
+			promise.set_value(std::move(resource));
+
+			return promise.get_future().share();
 		}
 
-		return it->second;
+		m_stats.missCount++;
+
+		auto pendingIt = m_pendingLoads.find(absolutePath);
+		if (pendingIt == m_pendingLoads.end())
+		{
+			std::shared_ptr<PendingLoad> pendingLoad = std::make_shared<PendingLoad>();
+			pendingLoad->filePath = absolutePath;
+			pendingLoad->future = pendingLoad->promise.get_future().share();
+
+			pendingIt = m_pendingLoads.emplace(std::move(absolutePath), pendingLoad).first;
+
+			TaskScheduler::SpawnTask(pendingLoad->taskCounter, [asyncState = m_asyncState, loader = &m_loader, parameters = GetDefaultParameters(), pendingLoad]
+			{
+				try
+				{
+					pendingLoad->promise.set_value(loader->LoadFromFile(pendingLoad->filePath, parameters));
+				}
+				catch (...)
+				{
+					pendingLoad->promise.set_exception(std::current_exception());
+				}
+
+				std::lock_guard<std::mutex> lock(asyncState->mutex);
+				asyncState->completedLoads.push_back(pendingLoad);
+			});
+		}
+
+		PendingLoad& pendingLoad = *pendingIt->second;
+		if (callback)
+			pendingLoad.callbacks.push_back(std::move(callback));
+
+		return pendingLoad.future;
 	}
 
 	/*!
@@ -73,6 +248,66 @@ namespace Nz
 		return m_defaultParameters;
 	}
 
+	/*!
+	* \brief Gets the memory budget of the manager
+	* \return Memory budget (in bytes), NoMemoryBudget if none
+	*/
+	template<typename Type, typename Parameters>
+	std::size_t ResourceManager<Type, Parameters>::GetMemoryBudget() const
+	{
+		return m_memoryBudget;
+	}
+
+	/*!
+	* \brief Gets the number of resources being loaded asynchronously
+	* \return Pending load count, including loads which completed but haven't been processed yet
+	*/
+	template<typename Type, typename Parameters>
+	std::size_t ResourceManager<Type, Parameters>::GetPendingLoadCount() const
+	{
+		return m_pendingLoads.size();
+	}
+
+	/*!
+	* \brief Gets the manager statistics (cache hits and misses, evictions and memory usage)
+	* \return Manager statistics
+	*/
+	template<typename Type, typename Parameters>
+	auto ResourceManager<Type, Parameters>::GetStats() const -> const Stats&
+	{
+		return m_stats;
+	}
+
+	/*!
+	* \brief Registers resources loaded asynchronously since last call and calls their completion callbacks
+	*
+	* This should be called regularly (once per frame for example) from the thread using the manager.
+	*
+	* \see GetAsync
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::ProcessCompletedLoads()
+	{
+		std::vector<std::shared_ptr<PendingLoad>> completedLoads;
+		{
+			std::lock_guard<std::mutex> lock(m_asyncState->mutex);
+			std::swap(completedLoads, m_asyncState->completedLoads);
+		}
+
+		for (const std::shared_ptr<PendingLoad>& pendingLoad : completedLoads)
+		{
+			// Load may have been finished by Get in the meantime
+			auto it = m_pendingLoads.find(pendingLoad->filePath);
+			if (it == m_pendingLoads.end() || it->second != pendingLoad)
+				continue;
+
+			FinishLoad(pendingLoad);
+		}
+
+		// Resources may have been released since the last eviction
+		EnforceMemoryBudget();
+	}
+
 	/*!
 	* \brief Registers the resource under the filePath
 	*
@@ -84,7 +319,20 @@ namespace Nz
 	{
 		std::filesystem::path absolutePath = std::filesystem::canonical(filePath);
 
-		m_resources[absolutePath] = resource;
+		Insert(absolutePath, std::move(resource), true);
+		EnforceMemoryBudget();
+	}
+
+	/*!
+	* \brief Resets hit, miss and eviction counters
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::ResetStats()
+	{
+		m_stats.evictedMemory = 0;
+		m_stats.evictionCount = 0;
+		m_stats.hitCount = 0;
+		m_stats.missCount = 0;
 	}
 
 	/*!
@@ -98,6 +346,34 @@ namespace Nz
 		m_defaultParameters = std::move(params);
 	}
 
+	/*!
+	* \brief Sets the memory budget of the manager, evicting unused resources if it is exceeded
+	*
+	* \param memoryBudget Maximum memory (in bytes) used by resources before evicting them, NoMemoryBudget disables eviction
+	*
+	* \see EvictUnused
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::SetMemoryBudget(std::size_t memoryBudget)
+	{
+		m_memoryBudget = memoryBudget;
+		EnforceMemoryBudget();
+	}
+
+	/*!
+	* \brief Sets the function used to compute the memory usage of resources
+	*
+	* \param memoryUsageFunc Function returning the memory usage of a resource (in bytes), a null function restores the default one
+	*
+	* \remark Memory usage of a resource is computed once, when it is registered by the manager
+	* \remark By default, GetMemoryUsage is called on resources having it and other resources are considered to use no memory
+	*/
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::SetMemoryUsageFunction(MemoryUsageFunction memoryUsageFunc)
+	{
+		m_memoryUsageFunc = std::move(memoryUsageFunc);
+	}
+
 	/*!
 	* \brief Unregisters the resource under the filePath
 	*
@@ -108,7 +384,106 @@ namespace Nz
 	{
 		std::filesystem::path absolutePath = std::filesystem::canonical(filePath);
 
-		m_resources.erase(absolutePath);
+		Remove(absolutePath);
+	}
+
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::EnforceMemoryBudget()
+	{
+		if (m_memoryBudget != NoMemoryBudget && m_stats.memoryUsage > m_memoryBudget)
+			EvictUnused(m_memoryBudget);
+	}
+
+	template<typename Type, typename Parameters>
+	std::shared_ptr<Type> ResourceManager<Type, Parameters>::FinishLoad(const std::shared_ptr<PendingLoad>& pendingLoad)
+	{
+		m_pendingLoads.erase(pendingLoad->filePath);
+
+		std::shared_ptr<Type> resource;
+		try
+		{
+			resource = pendingLoad->future.get();
+			if (!resource)
+				NazaraError("Failed to load resource from file: " + PathToString(pendingLoad->filePath));
+		}
+		catch (const std::exception& e)
+		{
+			NazaraError("Failed to load resource from file " + PathToString(pendingLoad->filePath) + ": " + e.what());
+		}
+		catch (...)
+		{
+			NazaraError("Failed to load resource from file " + PathToString(pendingLoad->filePath) + ": unknown exception");
+		}
+
+		if (resource)
+		{
+			NazaraDebug("Loaded resource from file " + PathToString(pendingLoad->filePath));
+
+			// A resource may have been registered under the same path during the load
+			resource = Insert(pendingLoad->filePath, std::move(resource), false);
+		}
+
+		for (CompletionCallback& callback : pendingLoad->callbacks)
+			callback(resource);
+
+		EnforceMemoryBudget();
+
+		return resource;
+	}
+
+	template<typename Type, typename Parameters>
+	auto ResourceManager<Type, Parameters>::Insert(const std::filesystem::path& absolutePath, std::shared_ptr<Type> resource, bool replace) -> const std::shared_ptr<Type>&
+	{
+		auto it = m_resources.find(absolutePath);
+		if (it != m_resources.end() && !replace)
+			return Touch(it->second);
+
+		std::size_t memoryUsage = 0;
+		if (resource)
+		{
+			if (m_memoryUsageFunc)
+				memoryUsage = m_memoryUsageFunc(*resource);
+			else if constexpr (Detail::ResourceHasMemoryUsage<Type>::value)
+				memoryUsage = static_cast<std::size_t>(resource->GetMemoryUsage());
+		}
+
+		if (it == m_resources.end())
+		{
+			it = m_resources.emplace(absolutePath, ResourceEntry{}).first;
+			it->second.lruIt = m_lruList.insert(m_lruList.begin(), absolutePath);
+			it->second.memoryUsage = 0;
+
+			m_stats.resourceCount++;
+		}
+
+		ResourceEntry& entry = it->second;
+		m_stats.memoryUsage = m_stats.memoryUsage - entry.memoryUsage + memoryUsage;
+
+		entry.memoryUsage = memoryUsage;
+		entry.resource = std::move(resource);
+
+		return Touch(entry);
+	}
+
+	template<typename Type, typename Parameters>
+	void ResourceManager<Type, Parameters>::Remove(const std::filesystem::path& absolutePath)
+	{
+		auto it = m_resources.find(absolutePath);
+		if (it == m_resources.end())
+			return;
+
+		m_stats.memoryUsage -= it->second.memoryUsage;
+		m_stats.resourceCount--;
+
+		m_lruList.erase(it->second.lruIt);
+		m_resources.erase(it);
+	}
+
+	template<typename Type, typename Parameters>
+	auto ResourceManager<Type, Parameters>::Touch(ResourceEntry& entry) -> const std::shared_ptr<Type>&
+	{
+		m_lruList.splice(m_lruList.begin(), m_lruList, entry.lruIt);
+		return entry.resource;
 	}
 }
 
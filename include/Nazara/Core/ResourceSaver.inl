@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/ResourceSaver.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
@@ -98,8 +99,19 @@ namespace Nz
 					return false;
 				}
 
-				if (saver.streamSaver(resource, extension, file, parameters))
+				// Savers tend to issue a lot of small writes, combine them before they reach the file
+				BufferedStream bufferedFile(file);
+				if (saver.streamSaver(resource, extension, bufferedFile, parameters))
+				{
+					if (!bufferedFile.FlushWriteBuffer())
+					{
+						NazaraError("failed to save to file: unable to write to \"" + PathToString(filePath) + '"');
+						return false;
+					}
+
+					file.Flush();
 					return true;
+				}
 			}
 
 			NazaraWarning("Saver failed");
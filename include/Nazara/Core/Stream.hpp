@@ -34,6 +34,7 @@ namespace Nz
 			inline void Flush();
 
 			virtual std::filesystem::path GetDirectory() const;
+			virtual const void* GetMappedPointer() const;
 			virtual std::filesystem::path GetPath() const;
 			inline OpenModeFlags GetOpenMode() const;
 			inline StreamOptionFlags GetStreamOptions() const;
@@ -45,6 +46,7 @@ namespace Nz
 			virtual std::string ReadLine(unsigned int lineSize = 0);
 
 			inline bool IsBufferingEnabled() const;
+			inline bool IsMemoryMapped() const;
 			inline bool IsReadable() const;
 			inline bool IsSequential() const;
 			inline bool IsTextModeEnabled() const;
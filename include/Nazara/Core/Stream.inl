@@ -106,6 +106,15 @@ namespace Nz
 		return (m_streamOptions & StreamOption::Unbuffered) == 0;
 	}
 
+	/*!
+	* \brief Checks whether the stream content is directly addressable in memory
+	* \return true if GetMappedPointer returns a pointer to the whole stream content
+	*/
+	inline bool Stream::IsMemoryMapped() const
+	{
+		return (m_streamOptions & StreamOption::MemoryMapped) != 0;
+	}
+
 	inline bool Stream::IsReadable() const
 	{
 		return (m_openMode & OpenMode::ReadOnly) != 0;
@@ -35,6 +35,7 @@ namespace Nz
 	NAZARA_CORE_API std::string_view GetWord(const std::string_view& str, std::size_t wordIndex, UnicodeAware);
 
 	inline bool IsNumber(std::string_view str);
+	NAZARA_CORE_API bool IsValidUtf8(const std::string_view& str);
 
 	NAZARA_CORE_API bool MatchPattern(const std::string_view& str, const std::string_view& pattern);
 
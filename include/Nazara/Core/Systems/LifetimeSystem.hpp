@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Components/LifetimeComponent.hpp>
 #include <Nazara/Utils/TypeList.hpp>
 #include <entt/entt.hpp>
 
@@ -19,7 +20,7 @@ namespace Nz
 		public:
 			static constexpr bool AllowConcurrent = false;
 			static constexpr Int64 ExecutionOrder = 1'000'000;
-			using Components = TypeList<class LifetimeComponent>;
+			using Components = TypeList<LifetimeComponent>;
 
 			inline LifetimeSystem(entt::registry& registry);
 			LifetimeSystem(const LifetimeSystem&) = delete;
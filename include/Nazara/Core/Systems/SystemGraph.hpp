@@ -12,12 +12,15 @@
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Utils/MovablePtr.hpp>
 #include <entt/entt.hpp>
+#include <atomic>
 #include <functional>
 #include <unordered_map>
 #include <vector>
 
 namespace Nz
 {
+	class TaskCounter;
+
 	class NAZARA_CORE_API SystemGraph
 	{
 		public:
@@ -28,8 +31,12 @@ namespace Nz
 
 			template<typename T, typename... Args> T& AddSystem(Args&&... args);
 
+			inline void EnableParallelUpdate(bool parallelUpdate);
+
 			template<typename T> T& GetSystem() const;
 
+			inline bool IsParallelUpdateEnabled() const;
+
 			void Update();
 			void Update(float elapsedTime);
 
@@ -43,7 +50,15 @@ namespace Nz
 
 				virtual void Update(float elapsedTime) = 0;
 
+				bool ConflictsWith(const NodeBase& node) const;
+
+				std::atomic_uint remainingDependencyCount;
+				std::vector<entt::id_type> readComponents;
+				std::vector<entt::id_type> writeComponents;
+				std::vector<NodeBase*> dependents;
 				Int64 executionOrder;
+				unsigned int dependencyCount;
+				bool allowConcurrent;
 			};
 
 			template<typename T>
@@ -56,11 +71,22 @@ namespace Nz
 				T system;
 			};
 
+			struct Stage
+			{
+				std::vector<NodeBase*> nodes;
+				bool exclusive;
+			};
+
+			void BuildStages();
+			static void SpawnNodeUpdate(TaskCounter& counter, NodeBase* node, float elapsedTime);
+
 			std::unordered_map<entt::id_type, std::size_t /*nodeIndex*/> m_systemToNodes;
 			std::vector<NodeBase*> m_orderedNodes;
 			std::vector<std::unique_ptr<NodeBase>> m_nodes;
+			std::vector<Stage> m_stages;
 			entt::registry& m_registry;
 			Nz::Clock m_clock;
+			bool m_parallelUpdate;
 			bool m_systemOrderUpdated;
 	};
 }
@@ -4,7 +4,9 @@
 
 #include <Nazara/Core/Systems/SystemGraph.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Utils/TypeList.hpp>
 #include <stdexcept>
+#include <type_traits>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -22,6 +24,26 @@ namespace Nz
 
 		template<typename T>
 		struct SystemGraphExecutionOrder<T, std::void_t<decltype(T::ExecutionOrder)>> : std::integral_constant<Int64, T::ExecutionOrder> {};
+
+		template<typename, typename = void>
+		struct SystemGraphHasComponents : std::bool_constant<false> {};
+
+		template<typename T>
+		struct SystemGraphHasComponents<T, std::void_t<typename T::Components>> : std::bool_constant<true> {};
+
+		template<typename... Components>
+		void SystemGraphAssureStorages(entt::registry& registry, TypeList<Components...>)
+		{
+			// Creating a component storage modifies the registry, which must not happen while systems are running concurrently
+			(registry.storage<std::remove_const_t<Components>>(), ...);
+		}
+
+		template<typename... Components>
+		void SystemGraphRegisterComponents(TypeList<Components...>, std::vector<entt::id_type>& readComponents, std::vector<entt::id_type>& writeComponents)
+		{
+			// const components are only read by the system
+			((std::is_const_v<Components> ? readComponents : writeComponents).push_back(entt::type_hash<std::remove_const_t<Components>>::value()), ...);
+		}
 	}
 
 	template<typename T>
@@ -39,6 +61,7 @@ namespace Nz
 
 	inline SystemGraph::SystemGraph(entt::registry& registry) :
 	m_registry(registry),
+	m_parallelUpdate(true),
 	m_systemOrderUpdated(true)
 	{
 	}
@@ -51,6 +74,16 @@ namespace Nz
 		auto nodePtr = std::make_unique<Node<T>>(m_registry, std::forward<Args>(args)...);
 		nodePtr->executionOrder = Detail::SystemGraphExecutionOrder<T>();
 
+		// Systems can only run concurrently if we know which components they access
+		if constexpr (Detail::SystemGraphHasComponents<T>())
+		{
+			nodePtr->allowConcurrent = Detail::SystemGraphAllowConcurrent<T>();
+			Detail::SystemGraphRegisterComponents(typename T::Components{}, nodePtr->readComponents, nodePtr->writeComponents);
+			Detail::SystemGraphAssureStorages(m_registry, typename T::Components{});
+		}
+		else
+			nodePtr->allowConcurrent = false;
+
 		T& system = nodePtr->system;
 
 		std::size_t nodeIndex = m_nodes.size();
@@ -62,6 +95,24 @@ namespace Nz
 		return system;
 	}
 
+	/*!
+	* \brief Enables or disables running independent systems concurrently on the TaskScheduler
+	*
+	* Systems can run concurrently if they declare the components they access through a Components TypeList (const components are considered read-only)
+	* and don't set AllowConcurrent to false. Two systems writing the same component (or reading a component the other one is writing) still run in ExecutionOrder.
+	* Other systems are considered exclusive, they act as a barrier and run on the thread calling Update.
+	*
+	* \remark Concurrent systems run on TaskScheduler workers and must only access the registry through the components they declare (storages of those are created by AddSystem),
+	*         creating entities or using undeclared component types from them is not thread-safe
+	* \remark Engine systems writing NodeComponent (VelocitySystem, physics systems) conflict with each other and exclusive systems (RenderSystem, SkeletonSystem, LifetimeSystem) still run serially
+	*
+	* \param parallelUpdate Whether systems should run concurrently (defaults to true)
+	*/
+	inline void SystemGraph::EnableParallelUpdate(bool parallelUpdate)
+	{
+		m_parallelUpdate = parallelUpdate;
+	}
+
 	template<typename T>
 	T& SystemGraph::GetSystem() const
 	{
@@ -72,6 +123,11 @@ namespace Nz
 		auto& node = static_cast<Node<T>&>(*m_nodes[it->second]);
 		return node.system;
 	}
+
+	inline bool SystemGraph::IsParallelUpdateEnabled() const
+	{
+		return m_parallelUpdate;
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
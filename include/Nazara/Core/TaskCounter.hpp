@@ -0,0 +1,40 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_TASKCOUNTER_HPP
+#define NAZARA_CORE_TASKCOUNTER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <atomic>
+
+namespace Nz
+{
+	class TaskCounter
+	{
+		public:
+			inline TaskCounter(unsigned int initialValue = 0);
+			TaskCounter(const TaskCounter&) = delete;
+			TaskCounter(TaskCounter&&) = delete;
+			~TaskCounter() = default;
+
+			inline void Decrement();
+
+			inline unsigned int GetValue() const;
+
+			inline void Increment(unsigned int count = 1);
+			inline bool IsDone() const;
+
+			TaskCounter& operator=(const TaskCounter&) = delete;
+			TaskCounter& operator=(TaskCounter&&) = delete;
+
+		private:
+			std::atomic_uint m_value;
+	};
+}
+
+#include <Nazara/Core/TaskCounter.inl>
+
+#endif // NAZARA_CORE_TASKCOUNTER_HPP
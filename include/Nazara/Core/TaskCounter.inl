@@ -0,0 +1,71 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/TaskCounter.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::TaskCounter
+	* \brief Core class that tracks a group of tasks spawned on the TaskScheduler
+	*
+	* A counter is incremented when a task is spawned with it and decremented once that task has been executed,
+	* it can be waited on (using TaskScheduler::WaitForCounter) to synchronize with a group of tasks (and their children tasks).
+	*
+	* \remark A counter must outlive the tasks referencing it
+	*/
+
+	/*!
+	* \brief Constructs a TaskCounter object with an initial value
+	*
+	* \param initialValue Initial number of tasks tracked by this counter
+	*/
+	inline TaskCounter::TaskCounter(unsigned int initialValue) :
+	m_value(initialValue)
+	{
+	}
+
+	/*!
+	* \brief Signals that a task tracked by this counter has been executed
+	*/
+	inline void TaskCounter::Decrement()
+	{
+		NazaraAssert(m_value.load(std::memory_order_relaxed) > 0, "counter underflow");
+
+		m_value.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	/*!
+	* \brief Gets the number of tasks still tracked by this counter
+	* \return Number of pending tasks
+	*/
+	inline unsigned int TaskCounter::GetValue() const
+	{
+		return m_value.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Adds tasks to this counter
+	*
+	* \param count Number of tasks to track
+	*/
+	inline void TaskCounter::Increment(unsigned int count)
+	{
+		m_value.fetch_add(count, std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Checks if every task tracked by this counter has been executed
+	* \return True if no task is pending
+	*/
+	inline bool TaskCounter::IsDone() const
+	{
+		return GetValue() == 0;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
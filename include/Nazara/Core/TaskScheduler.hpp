@@ -8,7 +8,9 @@
 #define NAZARA_CORE_TASKSCHEDULER_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Functor.hpp>
+#include <Nazara/Core/TaskCounter.hpp>
 
 namespace Nz
 {
@@ -23,13 +25,18 @@ namespace Nz
 			template<typename C> static void AddTask(void (C::*function)(), C* object);
 			static unsigned int GetWorkerCount();
 			static bool Initialize();
+			static bool IsWorkerThread();
 			static void Run();
 			static void SetWorkerCount(unsigned int workerCount);
+			template<typename F> static void SpawnTask(F function);
+			template<typename F> static void SpawnTask(TaskCounter& counter, F function);
 			static void Uninitialize();
+			static void WaitForCounter(const TaskCounter& counter);
 			static void WaitForTasks();
 
 		private:
 			static void AddTaskFunctor(Functor* taskFunctor);
+			static void SpawnTaskFunctor(Functor* taskFunctor);
 	};
 }
 
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/TaskScheduler.hpp>
+#include <utility>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -50,6 +51,41 @@ namespace Nz
 	{
 		AddTaskFunctor(new MemberWithoutArgs<C>(function, object));
 	}
+
+	/*!
+	* \brief Pushes a task to the workers without waiting for a call to Run
+	*
+	* When called from a worker thread, the task is pushed to the local queue of that worker (where it may be stolen by idle workers)
+	*
+	* \param function Task that the pool will execute
+	*/
+
+	template<typename F>
+	void TaskScheduler::SpawnTask(F function)
+	{
+		SpawnTaskFunctor(new FunctorWithoutArgs<F>(std::move(function)));
+	}
+
+	/*!
+	* \brief Pushes a task to the workers without waiting for a call to Run, and tracks it using a counter
+	*
+	* \param counter Counter which will be incremented now and decremented once the task has been executed
+	* \param function Task that the pool will execute
+	*
+	* \see WaitForCounter
+	*/
+
+	template<typename F>
+	void TaskScheduler::SpawnTask(TaskCounter& counter, F function)
+	{
+		counter.Increment();
+
+		SpawnTask([counterPtr = &counter, func = std::move(function)]() mutable
+		{
+			func();
+			counterPtr->Decrement();
+		});
+	}
 }
 
 #include <Nazara/Core/DebugOff.hpp>
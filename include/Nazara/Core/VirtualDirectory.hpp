@@ -18,6 +18,7 @@
 
 namespace Nz
 {
+	class PackedArchive;
 	class VirtualDirectory;
 
 	using VirtualDirectoryPtr = std::shared_ptr<VirtualDirectory>;
@@ -25,6 +26,8 @@ namespace Nz
 	class VirtualDirectory : public std::enable_shared_from_this<VirtualDirectory>
 	{
 		public:
+			struct ArchiveDirectoryEntry;
+			struct ArchiveFileEntry;
 			struct DataPointerEntry;
 			struct DirectoryEntry;
 			struct FileContentEntry;
@@ -32,10 +35,11 @@ namespace Nz
 			struct PhysicalFileEntry;
 			struct VirtualDirectoryEntry;
 
-			using Entry = std::variant<DataPointerEntry, FileContentEntry, PhysicalDirectoryEntry, PhysicalFileEntry, VirtualDirectoryEntry>;
+			using Entry = std::variant<ArchiveDirectoryEntry, ArchiveFileEntry, DataPointerEntry, FileContentEntry, PhysicalDirectoryEntry, PhysicalFileEntry, VirtualDirectoryEntry>;
 
 			inline VirtualDirectory(std::weak_ptr<VirtualDirectory> parentDirectory = {});
 			inline VirtualDirectory(std::filesystem::path physicalPath, std::weak_ptr<VirtualDirectory> parentDirectory = {});
+			inline VirtualDirectory(std::shared_ptr<PackedArchive> archive, std::size_t archiveEntryIndex, std::weak_ptr<VirtualDirectory> parentDirectory = {});
 			VirtualDirectory(const VirtualDirectory&) = delete;
 			VirtualDirectory(VirtualDirectory&&) = delete;
 			~VirtualDirectory() = default;
@@ -53,6 +57,7 @@ namespace Nz
 			inline bool IsUprootAllowed() const;
 
 			inline VirtualDirectoryEntry& StoreDirectory(std::string_view path, VirtualDirectoryPtr directory);
+			inline ArchiveDirectoryEntry& StoreDirectory(std::string_view path, std::shared_ptr<PackedArchive> archive);
 			inline PhysicalDirectoryEntry& StoreDirectory(std::string_view path, std::filesystem::path directoryPath);
 			inline FileContentEntry& StoreFile(std::string_view path, std::vector<UInt8> file);
 			inline PhysicalFileEntry& StoreFile(std::string_view path, std::filesystem::path filePath);
@@ -62,6 +67,12 @@ namespace Nz
 			VirtualDirectory& operator=(VirtualDirectory&&) = delete;
 
 			// File entries
+			struct ArchiveFileEntry
+			{
+				std::shared_ptr<PackedArchive> archive;
+				std::size_t entryIndex;
+			};
+
 			struct DataPointerEntry
 			{
 				const void* data;
@@ -84,6 +95,12 @@ namespace Nz
 				VirtualDirectoryPtr directory;
 			};
 
+			struct ArchiveDirectoryEntry : DirectoryEntry
+			{
+				std::shared_ptr<PackedArchive> archive;
+				std::size_t entryIndex;
+			};
+
 			struct PhysicalDirectoryEntry : DirectoryEntry
 			{
 				std::filesystem::path filePath;
@@ -95,6 +112,7 @@ namespace Nz
 
 		private:
 			template<typename F> bool GetEntryInternal(std::string_view name, F&& callback);
+			inline Entry BuildArchiveEntry(const std::shared_ptr<PackedArchive>& archive, std::size_t entryIndex);
 			inline bool CreateOrRetrieveDirectory(std::string_view path, std::shared_ptr<VirtualDirectory>& directory, std::string_view& entryName);
 
 			template<typename T> T& StoreInternal(std::string name, T value);
@@ -109,6 +127,8 @@ namespace Nz
 			};
 
 			std::optional<std::filesystem::path> m_physicalPath;
+			std::shared_ptr<PackedArchive> m_archive;
+			std::size_t m_archiveEntryIndex;
 			std::vector<ContentEntry> m_content;
 			std::weak_ptr<VirtualDirectory> m_parent;
 			bool m_isUprootAllowed;
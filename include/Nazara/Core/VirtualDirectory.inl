@@ -4,6 +4,7 @@
 
 #include <Nazara/Core/VirtualDirectory.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/PackedArchive.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <algorithm>
 #include <cassert>
@@ -12,6 +13,7 @@
 namespace Nz
 {
 	inline VirtualDirectory::VirtualDirectory(std::weak_ptr<VirtualDirectory> parentDirectory) :
+	m_archiveEntryIndex(0),
 	m_parent(std::move(parentDirectory)),
 	m_isUprootAllowed(false)
 	{
@@ -19,11 +21,21 @@ namespace Nz
 
 	inline VirtualDirectory::VirtualDirectory(std::filesystem::path physicalPath, std::weak_ptr<VirtualDirectory> parentDirectory) :
 	m_physicalPath(std::move(physicalPath)),
+	m_archiveEntryIndex(0),
 	m_parent(std::move(parentDirectory)),
 	m_isUprootAllowed(false)
 	{
 	}
 
+	inline VirtualDirectory::VirtualDirectory(std::shared_ptr<PackedArchive> archive, std::size_t archiveEntryIndex, std::weak_ptr<VirtualDirectory> parentDirectory) :
+	m_archive(std::move(archive)),
+	m_archiveEntryIndex(archiveEntryIndex),
+	m_parent(std::move(parentDirectory)),
+	m_isUprootAllowed(false)
+	{
+		assert(m_archive && m_archive->IsDirectory(m_archiveEntryIndex));
+	}
+
 	inline void VirtualDirectory::AllowUproot(bool uproot)
 	{
 		m_isUprootAllowed = uproot;
@@ -88,6 +100,23 @@ namespace Nz
 					return;
 			}
 		}
+
+		if (m_archive)
+		{
+			m_archive->ForeachChild(m_archiveEntryIndex, [&](std::string_view name, std::size_t entryIndex)
+			{
+				// Check if archived file/directory has been overridden by a virtual one
+				auto it = std::lower_bound(m_content.begin(), m_content.end(), name, [](const ContentEntry& entry, std::string_view name)
+				{
+					return entry.name < name;
+				});
+				if (it != m_content.end() && it->name == name)
+					return true;
+
+				Entry entry = BuildArchiveEntry(m_archive, entryIndex);
+				return CallbackReturn(callback, name, std::as_const(entry));
+			});
+		}
 	}
 	
 	template<typename F>
@@ -99,11 +128,11 @@ namespace Nz
 			{
 				using T = std::decay_t<decltype(entry)>;
 
-				if constexpr (std::is_same_v<T, VirtualDirectoryEntry> || std::is_same_v<T, PhysicalDirectoryEntry>)
+				if constexpr (std::is_same_v<T, ArchiveDirectoryEntry> || std::is_same_v<T, VirtualDirectoryEntry> || std::is_same_v<T, PhysicalDirectoryEntry>)
 				{
 					return CallbackReturn(callback, static_cast<const DirectoryEntry&>(entry));
 				}
-				else if constexpr (std::is_same_v<T, DataPointerEntry> || std::is_same_v<T, FileContentEntry> || std::is_same_v<T, PhysicalFileEntry>)
+				else if constexpr (std::is_same_v<T, ArchiveFileEntry> || std::is_same_v<T, DataPointerEntry> || std::is_same_v<T, FileContentEntry> || std::is_same_v<T, PhysicalFileEntry>)
 				{
 					NazaraError("entry is a file");
 					return false;
@@ -121,10 +150,38 @@ namespace Nz
 		VirtualDirectoryPtr currentDir = shared_from_this();
 		std::optional<std::filesystem::path> physicalPathBase;
 		std::vector<std::string> physicalDirectoryParts;
+		std::shared_ptr<PackedArchive> archive;
+		std::size_t archiveRootSize = 0;
+		std::string archivePath;
 		return SplitPath(path, [&](std::string_view dirName)
 		{
 			assert(!dirName.empty());
 
+			if (archive)
+			{
+				// Same as physical directories, archive paths are resolved by a single lookup once the whole path is known
+				if (dirName == "..")
+				{
+					// Don't allow to escape the archive directory we entered through
+					if (archivePath.size() > archiveRootSize)
+					{
+						std::size_t separatorPos = archivePath.find_last_of('/');
+						archivePath.resize((separatorPos != archivePath.npos) ? separatorPos : 0);
+					}
+					else
+						archive.reset();
+				}
+				else if (dirName != ".")
+				{
+					if (!archivePath.empty())
+						archivePath += '/';
+
+					archivePath += dirName;
+				}
+
+				return true;
+			}
+
 			if (physicalPathBase)
 			{
 				// Special case when traversing directory
@@ -157,13 +214,49 @@ namespace Nz
 					physicalPathBase = physDirEntry->filePath;
 					return true;
 				}
+				else if (auto archiveDirEntry = std::get_if<ArchiveDirectoryEntry>(&entry))
+				{
+					assert(!archive);
+
+					// We're traversing an archive directory
+					archive = archiveDirEntry->archive;
+					archivePath = archive->GetEntryPath(archiveDirEntry->entryIndex);
+					archiveRootSize = archivePath.size();
+					return true;
+				}
 
 				return false;
 			});
 		}, 
 		[&](std::string_view name)
 		{
-			if (physicalPathBase)
+			if (archive)
+			{
+				if (name == "..")
+				{
+					// Leaving the archive resolves to the directory it was entered from
+					if (archivePath.size() <= archiveRootSize)
+						return currentDir->GetEntryInternal(".", callback);
+
+					std::size_t separatorPos = archivePath.find_last_of('/');
+					archivePath.resize((separatorPos != archivePath.npos) ? separatorPos : 0);
+				}
+				else if (name != ".")
+				{
+					if (!archivePath.empty())
+						archivePath += '/';
+
+					archivePath += name;
+				}
+
+				std::size_t entryIndex = archive->FindEntry(archivePath);
+				if (entryIndex == PackedArchive::InvalidIndex)
+					return false;
+
+				Entry entry = BuildArchiveEntry(archive, entryIndex);
+				return CallbackReturn(callback, entry);
+			}
+			else if (physicalPathBase)
 			{
 				std::filesystem::path filePath = *physicalPathBase;
 				for (const auto& part : physicalDirectoryParts)
@@ -203,7 +296,21 @@ namespace Nz
 				using P1 = const void*;
 				using P2 = std::size_t;
 
-				if constexpr (std::is_same_v<T, DataPointerEntry>)
+				if constexpr (std::is_same_v<T, ArchiveFileEntry>)
+				{
+					std::size_t fileSize = SafeCast<std::size_t>(entry.archive->GetEntrySize(entry.entryIndex));
+
+					// Uncompressed files are directly read from the archive memory
+					if (const void* data = entry.archive->GetEntryData(entry.entryIndex); data || fileSize == 0)
+						return CallbackReturn(callback, static_cast<P1>(data), SafeCast<P2>(fileSize));
+
+					std::vector<UInt8> content(fileSize);
+					if (!entry.archive->ReadEntry(entry.entryIndex, content.data()))
+						return false;
+
+					return CallbackReturn(callback, static_cast<P1>(content.data()), SafeCast<P2>(content.size()));
+				}
+				else if constexpr (std::is_same_v<T, DataPointerEntry>)
 				{
 					return CallbackReturn(callback, static_cast<P1>(entry.data), SafeCast<P2>(entry.size));
 				}
@@ -219,7 +326,7 @@ namespace Nz
 
 					return CallbackReturn(callback, static_cast<P1>(source->data()), SafeCast<P2>(source->size()));
 				}
-				else if constexpr (std::is_same_v<T, VirtualDirectoryEntry> || std::is_same_v<T, PhysicalDirectoryEntry>)
+				else if constexpr (std::is_same_v<T, ArchiveDirectoryEntry> || std::is_same_v<T, VirtualDirectoryEntry> || std::is_same_v<T, PhysicalDirectoryEntry>)
 				{
 					NazaraError("entry is a directory");
 					return false;
@@ -250,6 +357,27 @@ namespace Nz
 		return dir->StoreInternal(std::string(entryName), VirtualDirectoryEntry{ { std::move(directory) } });
 	}
 
+	inline auto VirtualDirectory::StoreDirectory(std::string_view path, std::shared_ptr<PackedArchive> archive) -> ArchiveDirectoryEntry&
+	{
+		assert(!path.empty());
+		assert(archive && archive->IsOpen());
+
+		std::shared_ptr<VirtualDirectory> dir;
+		std::string_view entryName;
+		if (!CreateOrRetrieveDirectory(path, dir, entryName))
+			throw std::runtime_error("invalid path");
+
+		if (entryName == "." || entryName == "..")
+			throw std::runtime_error("invalid entry name");
+
+		ArchiveDirectoryEntry entry;
+		entry.directory = std::make_shared<VirtualDirectory>(archive, PackedArchive::RootIndex, dir);
+		entry.archive = std::move(archive);
+		entry.entryIndex = PackedArchive::RootIndex;
+
+		return dir->StoreInternal(std::string(entryName), std::move(entry));
+	}
+
 	inline auto VirtualDirectory::StoreDirectory(std::string_view path, std::filesystem::path directoryPath) -> PhysicalDirectoryEntry&
 	{
 		assert(!path.empty());
@@ -363,12 +491,40 @@ namespace Nz
 				return CallbackReturn(callback, entry);
 			}
 
+			// or an archived one
+			if (m_archive)
+			{
+				std::string entryPath(m_archive->GetEntryPath(m_archiveEntryIndex));
+				if (!entryPath.empty())
+					entryPath += '/';
+
+				entryPath += name;
+
+				std::size_t entryIndex = m_archive->FindEntry(entryPath);
+				if (entryIndex == PackedArchive::InvalidIndex)
+					return false;
+
+				Entry entry = BuildArchiveEntry(m_archive, entryIndex);
+				return CallbackReturn(callback, entry);
+			}
+
 			return false;
 		}
 
 		return CallbackReturn(callback, it->entry);
 	}
 
+	inline auto VirtualDirectory::BuildArchiveEntry(const std::shared_ptr<PackedArchive>& archive, std::size_t entryIndex) -> Entry
+	{
+		if (archive->IsDirectory(entryIndex))
+		{
+			VirtualDirectoryPtr virtualDir = std::make_shared<VirtualDirectory>(archive, entryIndex, weak_from_this());
+			return ArchiveDirectoryEntry{ { std::move(virtualDir) }, archive, entryIndex };
+		}
+		else
+			return ArchiveFileEntry{ archive, entryIndex };
+	}
+
 	inline bool VirtualDirectory::CreateOrRetrieveDirectory(std::string_view path, std::shared_ptr<VirtualDirectory>& directory, std::string_view& entryName)
 {
 		directory = shared_from_this();
@@ -93,6 +93,7 @@ namespace Nz
 	enum class EngineShaderBinding
 	{
 		InstanceDataUbo,
+		LightDataSsbo,
 		LightDataUbo,
 		OverlayTexture,
 		SkeletalDataUbo,
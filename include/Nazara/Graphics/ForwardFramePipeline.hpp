@@ -22,6 +22,8 @@
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Graphics/RenderQueueRegistry.hpp>
 #include <Nazara/Graphics/TransferInterface.hpp>
+#include <Nazara/Graphics/WorldInstance.hpp>
+#include <Nazara/Math/BoundingVolumeHierarchy.hpp>
 #include <Nazara/Renderer/ShaderBinding.hpp>
 #include <Nazara/Utils/MemoryPool.hpp>
 #include <memory>
@@ -70,12 +72,14 @@ namespace Nz
 
 			void RegisterMaterialInstance(MaterialInstance* materialPass);
 			void UnregisterMaterialInstance(MaterialInstance* material);
+			void UpdateLightBoundingVolume(std::size_t lightIndex);
 
 			struct ViewerData;
 
 			struct LightData
 			{
 				std::shared_ptr<Light> light;
+				std::size_t treeLeafIndex = BoundingVolumeHierarchyf::InvalidIndex;
 				UInt32 renderMask;
 
 				NazaraSlot(Light, OnLightDataInvalided, onLightInvalidated);
@@ -91,13 +95,17 @@ namespace Nz
 			struct RenderableData
 			{
 				std::size_t skeletonInstanceIndex;
+				std::size_t treeLeafIndex = BoundingVolumeHierarchyf::InvalidIndex;
 				std::size_t worldInstanceIndex;
 				const InstancedRenderable* renderable;
+				Boxf worldAABB;
 				Recti scissorBox;
 				UInt32 renderMask = 0;
 
+				NazaraSlot(InstancedRenderable, OnAABBUpdate, onAABBUpdate);
 				NazaraSlot(InstancedRenderable, OnElementInvalidated, onElementInvalidated);
 				NazaraSlot(InstancedRenderable, OnMaterialInvalidated, onMaterialInvalidated);
+				NazaraSlot(WorldInstance, OnWorldMatrixUpdate, onWorldMatrixUpdate);
 			};
 
 			struct RenderTargetData
@@ -145,9 +153,15 @@ namespace Nz
 			std::vector<const Light*> m_visibleLights;
 			robin_hood::unordered_set<TransferInterface*> m_transferSet;
 			BakedFrameGraph m_bakedFrameGraph;
+			Bitset<UInt64> m_infiniteLights;
+			Bitset<UInt64> m_invalidatedRenderables;
 			Bitset<UInt64> m_removedSkeletonInstances;
 			Bitset<UInt64> m_removedViewerInstances;
 			Bitset<UInt64> m_removedWorldInstances;
+			Bitset<UInt64> m_visibleLightIndices;
+			Bitset<UInt64> m_visibleRenderableIndices;
+			BoundingVolumeHierarchyf m_lightTree;
+			BoundingVolumeHierarchyf m_renderableTree;
 			ElementRendererRegistry& m_elementRegistry;
 			MemoryPool<RenderableData> m_renderablePool;
 			MemoryPool<LightData> m_lightPool;
@@ -12,6 +12,7 @@
 #include <Nazara/Graphics/ElementRenderer.hpp>
 #include <Nazara/Graphics/FramePipelinePass.hpp>
 #include <Nazara/Graphics/Light.hpp>
+#include <Nazara/Graphics/LightClusterGrid.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/MaterialPass.hpp>
 #include <Nazara/Graphics/RenderElement.hpp>
@@ -19,7 +20,8 @@
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Graphics/RenderQueueRegistry.hpp>
 #include <Nazara/Math/Frustum.hpp>
-#include <Nazara/Renderer/UploadPool.hpp>
+#include <memory>
+#include <vector>
 
 namespace Nz
 {
@@ -50,9 +52,10 @@ namespace Nz
 			ForwardPipelinePass& operator=(const ForwardPipelinePass&) = delete;
 			ForwardPipelinePass& operator=(ForwardPipelinePass&&) = delete;
 
-			static constexpr std::size_t MaxLightCountPerDraw = 3;
-
 		private:
+			void UpdateClusteredLightData(RenderFrame& renderFrame, const std::vector<const Light*>& visibleLights);
+			void UpdateLightData(RenderFrame& renderFrame, const std::vector<const Light*>& visibleLights);
+
 			struct MaterialPassEntry
 			{
 				std::size_t usedCount = 1;
@@ -61,36 +64,14 @@ namespace Nz
 				NazaraSlot(MaterialInstance, OnMaterialInstanceShaderBindingInvalidated, onMaterialInstanceShaderBindingInvalidated);
 			};
 
-			using LightKey = std::array<const Light*, MaxLightCountPerDraw>;
-
-			struct LightKeyHasher
-			{
-				inline std::size_t operator()(const LightKey& lightKey) const;
-			};
-
-			struct LightDataUbo
-			{
-				std::shared_ptr<RenderBuffer> renderBuffer;
-				std::size_t offset = 0;
-				UploadPool::Allocation* allocation = nullptr;
-			};
-
-			struct LightUboPool
-			{
-				std::vector<std::shared_ptr<RenderBuffer>> lightUboBuffers;
-			};
-
 			std::size_t m_forwardPassIndex;
 			std::size_t m_lastVisibilityHash;
-			std::shared_ptr<LightUboPool> m_lightUboPool;
+			std::shared_ptr<RenderBuffer> m_lightDataBuffer;
 			std::vector<std::unique_ptr<ElementRendererData>> m_elementRendererData;
 			std::vector<ElementRenderer::RenderStates> m_renderStates;
 			std::vector<RenderElementOwner> m_renderElements;
 			std::unordered_map<const MaterialInstance*, MaterialPassEntry> m_materialInstances;
-			std::unordered_map<const RenderElement*, RenderBufferView> m_lightPerRenderElement;
-			std::unordered_map<LightKey, RenderBufferView, LightKeyHasher> m_lightBufferPerLights;
-			std::vector<LightDataUbo> m_lightDataBuffers;
-			std::vector<const Light*> m_renderableLights;
+			LightClusterGrid m_lightClusterGrid;
 			RenderQueue<const RenderElement*> m_renderQueue;
 			RenderQueueRegistry m_renderQueueRegistry;
 			AbstractViewer* m_viewer;
@@ -98,6 +79,7 @@ namespace Nz
 			FramePipeline& m_pipeline;
 			bool m_rebuildCommandBuffer;
 			bool m_rebuildElements;
+			bool m_useLightClustering;
 	};
 }
 
@@ -16,21 +16,6 @@ namespace Nz
 	{
 		m_rebuildElements = true;
 	}
-
-	inline std::size_t ForwardPipelinePass::LightKeyHasher::operator()(const LightKey& lightKey) const
-	{
-		std::size_t lightHash = 5;
-		auto CombineHash = [](std::size_t currentHash, std::size_t newHash)
-		{
-			return currentHash * 23 + newHash;
-		};
-
-		std::hash<const Light*> lightPtrHasher;
-		for (std::size_t i = 0; i < lightKey.size(); ++i)
-			lightHash = CombineHash(lightHash, lightPtrHasher(lightKey[i]));
-
-		return lightHash;
-	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -0,0 +1,55 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_FRUSTUMCULLER_HPP
+#define NAZARA_GRAPHICS_FRUSTUMCULLER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Utils/Bitset.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_GRAPHICS_API FrustumCuller
+	{
+		public:
+			FrustumCuller();
+			FrustumCuller(const FrustumCuller&) = default;
+			FrustumCuller(FrustumCuller&&) noexcept = default;
+			~FrustumCuller() = default;
+
+			void Clear();
+
+			void Cull(const Frustumf& frustum, Bitset<UInt64>& visibleBoxes) const;
+
+			inline std::size_t GetBoxCount() const;
+
+			void RemoveBox(std::size_t boxIndex);
+
+			void UpdateBox(std::size_t boxIndex, const Boxf& box);
+
+			FrustumCuller& operator=(const FrustumCuller&) = default;
+			FrustumCuller& operator=(FrustumCuller&&) noexcept = default;
+
+		private:
+			// Boxes are stored as center/half-extents SoA so the distance to the positive vertex doesn't require any selection
+			std::vector<float> m_centerX;
+			std::vector<float> m_centerY;
+			std::vector<float> m_centerZ;
+			std::vector<float> m_extentX;
+			std::vector<float> m_extentY;
+			std::vector<float> m_extentZ;
+			std::size_t m_boxCount;
+			bool m_useAVX;
+	};
+}
+
+#include <Nazara/Graphics/FrustumCuller.inl>
+
+#endif // NAZARA_GRAPHICS_FRUSTUMCULLER_HPP
@@ -0,0 +1,16 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/FrustumCuller.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	inline std::size_t FrustumCuller::GetBoxCount() const
+	{
+		return m_boxCount;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_LIGHTCLUSTERGRID_HPP
+#define NAZARA_GRAPHICS_LIGHTCLUSTERGRID_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Utils/SparsePtr.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_GRAPHICS_API LightClusterGrid
+	{
+		public:
+			struct Cluster;
+
+			LightClusterGrid();
+			LightClusterGrid(const LightClusterGrid&) = default;
+			LightClusterGrid(LightClusterGrid&&) noexcept = default;
+			~LightClusterGrid() = default;
+
+			void Build(const Matrix4f& viewMatrix, const Matrix4f& invProjectionMatrix, SparsePtr<const Boxf> lightBoxes, std::size_t lightCount);
+
+			inline const std::vector<Cluster>& GetClusters() const;
+			inline const Vector2f& GetDepthRange() const;
+			inline std::size_t GetDroppedLightCount() const;
+			inline const std::vector<UInt32>& GetLightIndices() const;
+
+			LightClusterGrid& operator=(const LightClusterGrid&) = default;
+			LightClusterGrid& operator=(LightClusterGrid&&) noexcept = default;
+
+			static constexpr std::size_t MaxLightPerCluster = 64;
+
+			struct Cluster
+			{
+				UInt32 firstLightIndex;
+				UInt32 lightCount;
+			};
+
+		private:
+			void UpdateClusterBoxes(const Matrix4f& invProjectionMatrix);
+
+			std::vector<Boxf> m_clusterBoxes;
+			std::vector<Boxf> m_lightBoxes;
+			std::vector<Cluster> m_clusters;
+			std::vector<std::vector<UInt32>> m_sliceLightIndices;
+			std::vector<UInt32> m_clusterLightIndices;
+			std::vector<UInt32> m_lightIndices;
+			Matrix4f m_invProjectionMatrix;
+			Vector2f m_depthRange;
+			std::size_t m_droppedLightCount;
+	};
+}
+
+#include <Nazara/Graphics/LightClusterGrid.inl>
+
+#endif // NAZARA_GRAPHICS_LIGHTCLUSTERGRID_HPP
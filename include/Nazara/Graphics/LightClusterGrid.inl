@@ -0,0 +1,36 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/LightClusterGrid.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	inline auto LightClusterGrid::GetClusters() const -> const std::vector<Cluster>&
+	{
+		return m_clusters;
+	}
+
+	inline const Vector2f& LightClusterGrid::GetDepthRange() const
+	{
+		return m_depthRange;
+	}
+
+	/*!
+	* \brief Returns how many cluster light assignments were discarded by the last Build call
+	*
+	* Lights are discarded when a cluster holds more than MaxLightPerCluster of them or when the light index list is full.
+	*/
+	inline std::size_t LightClusterGrid::GetDroppedLightCount() const
+	{
+		return m_droppedLightCount;
+	}
+
+	inline const std::vector<UInt32>& LightClusterGrid::GetLightIndices() const
+	{
+		return m_lightIndices;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -32,11 +32,35 @@ namespace Nz
 		std::size_t totalSize;
 		Light lightMemberOffsets;
 
-		static constexpr std::size_t MaxLightCount = 3;
+		static constexpr std::size_t MaxLightCount = 16;
 
 		static PredefinedLightData GetOffsets();
 	};
 
+	struct NAZARA_GRAPHICS_API PredefinedClusteredLightData
+	{
+		std::size_t clusterDepthRangeOffset;
+		std::size_t clusterGridSizeOffset;
+		std::size_t clusterSize;
+		std::size_t clustersOffset;
+		std::size_t directionalLightCountOffset;
+		std::size_t lightCountOffset;
+		std::size_t lightIndexSize;
+		std::size_t lightIndicesOffset;
+		std::size_t lightSize;
+		std::size_t lightsOffset;
+		std::size_t totalSize;
+
+		static constexpr std::size_t ClusterGridSizeX = 16;
+		static constexpr std::size_t ClusterGridSizeY = 9;
+		static constexpr std::size_t ClusterGridSizeZ = 24;
+		static constexpr std::size_t ClusterCount = ClusterGridSizeX * ClusterGridSizeY * ClusterGridSizeZ;
+		static constexpr std::size_t MaxLightCount = 256;
+		static constexpr std::size_t MaxLightIndexCount = 16384;
+
+		static PredefinedClusteredLightData GetOffsets();
+	};
+
 	struct NAZARA_GRAPHICS_API PredefinedInstanceData
 	{
 		std::size_t invWorldMatrixOffset;
@@ -14,12 +14,14 @@
 #include <Nazara/Graphics/Components/LightComponent.hpp>
 #include <Nazara/Utility/Node.hpp>
 #include <Nazara/Utility/Skeleton.hpp>
+#include <Nazara/Utility/TransformHierarchy.hpp>
 #include <Nazara/Utils/MemoryPool.hpp>
 #include <entt/entt.hpp>
 #include <array>
 #include <memory>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Nz
 {
@@ -54,6 +56,7 @@ namespace Nz
 			void OnCameraDestroy(entt::registry& registry, entt::entity entity);
 			void OnGraphicsDestroy(entt::registry& registry, entt::entity entity);
 			void OnLightDestroy(entt::registry& registry, entt::entity entity);
+			void OnNodeConstruct(entt::registry& registry, entt::entity entity);
 			void OnNodeDestroy(entt::registry& registry, entt::entity entity);
 			void OnSharedSkeletonDestroy(entt::registry& registry, entt::entity entity);
 			void OnSkeletonDestroy(entt::registry& registry, entt::entity entity);
@@ -80,11 +83,11 @@ namespace Nz
 				std::size_t skeletonInstanceIndex;
 				std::size_t worldInstanceIndex;
 
+				NazaraSlot(Node, OnNodeInvalidation, onNodeInvalidation);
 				NazaraSlot(GraphicsComponent, OnRenderableAttached, onRenderableAttached);
 				NazaraSlot(GraphicsComponent, OnRenderableDetach, onRenderableDetach);
 				NazaraSlot(GraphicsComponent, OnScissorBoxUpdate, onScissorBoxUpdate);
 				NazaraSlot(GraphicsComponent, OnVisibilityUpdate, onVisibilityUpdate);
-				NazaraSlot(Node, OnNodeInvalidation, onNodeInvalidation);
 				NazaraSlot(Skeleton, OnSkeletonJointsInvalidated, onSkeletonJointsInvalidated); //< only connected for owned skeleton
 			};
 
@@ -94,10 +97,10 @@ namespace Nz
 				std::array<std::size_t, LightComponent::MaxLightCount> lightIndices;
 				std::size_t poolIndex;
 
+				NazaraSlot(Node, OnNodeInvalidation, onNodeInvalidation);
 				NazaraSlot(LightComponent, OnLightAttached, onLightAttached);
 				NazaraSlot(LightComponent, OnLightDetach, onLightDetach);
 				NazaraSlot(LightComponent, OnVisibilityUpdate, onVisibilityUpdate);
-				NazaraSlot(Node, OnNodeInvalidation, onNodeInvalidation);
 			};
 
 			struct SharedSkeleton
@@ -117,17 +120,18 @@ namespace Nz
 			entt::scoped_connection m_cameraDestroyConnection;
 			entt::scoped_connection m_graphicsDestroyConnection;
 			entt::scoped_connection m_lightDestroyConnection;
+			entt::scoped_connection m_nodeConstructConnection;
 			entt::scoped_connection m_nodeDestroyConnection;
 			entt::scoped_connection m_sharedSkeletonDestroyConnection;
 			entt::scoped_connection m_skeletonDestroyConnection;
-			std::set<CameraEntity*> m_invalidatedCameraNode;
-			std::set<GraphicsEntity*> m_invalidatedGfxWorldNode;
-			std::set<LightEntity*> m_invalidatedLightWorldNode;
 			std::unique_ptr<FramePipeline> m_pipeline;
 			std::unordered_map<entt::entity, CameraEntity*> m_cameraEntities;
 			std::unordered_map<entt::entity, GraphicsEntity*> m_graphicsEntities;
 			std::unordered_map<entt::entity, LightEntity*> m_lightEntities;
 			std::unordered_map<Skeleton*, SharedSkeleton> m_sharedSkeletonInstances;
+			std::set<CameraEntity*> m_invalidatedCameraNode;
+			std::set<GraphicsEntity*> m_invalidatedGfxWorldNode;
+			std::set<LightEntity*> m_invalidatedLightWorldNode;
 			std::unordered_set<GraphicsEntity*> m_newlyHiddenGfxEntities;
 			std::unordered_set<GraphicsEntity*> m_newlyVisibleGfxEntities;
 			std::unordered_set<LightEntity*> m_newlyHiddenLightEntities;
@@ -137,6 +141,7 @@ namespace Nz
 			MemoryPool<CameraEntity> m_cameraEntityPool;
 			MemoryPool<GraphicsEntity> m_graphicsEntityPool;
 			MemoryPool<LightEntity> m_lightEntityPool;
+			TransformHierarchy m_transformHierarchy;
 	};
 }
 
@@ -44,6 +44,8 @@ namespace Nz
 			WorldInstance& operator=(const WorldInstance&) = delete;
 			WorldInstance& operator=(WorldInstance&&) noexcept = default;
 
+			NazaraSignal(OnWorldMatrixUpdate, WorldInstance* /*worldInstance*/, const Matrix4f& /*worldMatrix*/);
+
 		private:
 			inline void InvalidateData();
 
@@ -35,6 +35,8 @@ namespace Nz
 			NazaraError("failed to inverse world matrix");
 
 		InvalidateData();
+
+		OnWorldMatrixUpdate(this, m_worldMatrix);
 	}
 
 	inline void WorldInstance::UpdateWorldMatrix(const Matrix4f& worldMatrix, const Matrix4f& invWorldMatrix)
@@ -43,6 +45,8 @@ namespace Nz
 		m_invWorldMatrix = invWorldMatrix;
 
 		InvalidateData();
+
+		OnWorldMatrixUpdate(this, m_worldMatrix);
 	}
 
 	void WorldInstance::InvalidateData()
@@ -32,7 +32,9 @@
 
 #include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Math/Angle.hpp>
+#include <Nazara/Math/BatchOperations.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
+#include <Nazara/Math/BoundingVolumeHierarchy.hpp>
 #include <Nazara/Math/Box.hpp>
 #include <Nazara/Math/Config.hpp>
 #include <Nazara/Math/Enums.hpp>
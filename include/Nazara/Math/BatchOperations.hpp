@@ -0,0 +1,28 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Math module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MATH_BATCHOPERATIONS_HPP
+#define NAZARA_MATH_BATCHOPERATIONS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Utils/SparsePtr.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	template<typename T> void ConcatenateMatrices(SparsePtr<const Matrix4<T>> left, SparsePtr<const Matrix4<T>> right, SparsePtr<Matrix4<T>> output, std::size_t count);
+	template<typename T> void SlerpQuaternions(SparsePtr<const Quaternion<T>> from, SparsePtr<const Quaternion<T>> to, SparsePtr<const T> interpolation, SparsePtr<Quaternion<T>> output, std::size_t count);
+	template<typename T> void TransformDirections(const Matrix4<T>& matrix, SparsePtr<const Vector3<T>> directions, SparsePtr<Vector3<T>> output, std::size_t count);
+	template<typename T> void TransformPositions(const Matrix4<T>& matrix, SparsePtr<const Vector3<T>> positions, SparsePtr<Vector3<T>> output, std::size_t count);
+	template<typename T> void TransformPositions(const Matrix4<T>& matrix, const T* inputX, const T* inputY, const T* inputZ, T* outputX, T* outputY, T* outputZ, std::size_t count);
+}
+
+#include <Nazara/Math/BatchOperations.inl>
+
+#endif // NAZARA_MATH_BATCHOPERATIONS_HPP
@@ -0,0 +1,372 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Math module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Math/BatchOperations.hpp>
+#include <algorithm>
+#include <type_traits>
+
+#if defined(NAZARA_PLATFORM_x64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_MATH_BATCH_SSE
+	#include <emmintrin.h>
+
+	// AVX can't be detected at runtime from a header, it's only used when the compiler is allowed to emit it (-mavx, /arch:AVX)
+	#ifdef __AVX__
+		#define NAZARA_MATH_BATCH_AVX
+		#include <immintrin.h>
+	#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#define NAZARA_MATH_BATCH_NEON
+	#include <arm_neon.h>
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace Detail
+	{
+#if defined(NAZARA_MATH_BATCH_SSE)
+		using BatchFloat4 = __m128;
+
+		inline BatchFloat4 BatchAdd(BatchFloat4 lhs, BatchFloat4 rhs) { return _mm_add_ps(lhs, rhs); }
+		inline BatchFloat4 BatchLoad(const float* ptr) { return _mm_loadu_ps(ptr); }
+		inline BatchFloat4 BatchMul(BatchFloat4 lhs, BatchFloat4 rhs) { return _mm_mul_ps(lhs, rhs); }
+		inline BatchFloat4 BatchSet(float value) { return _mm_set1_ps(value); }
+		inline BatchFloat4 BatchSignBits(BatchFloat4 value) { return _mm_and_ps(value, _mm_set1_ps(-0.f)); }
+		inline void BatchStore(float* ptr, BatchFloat4 value) { _mm_storeu_ps(ptr, value); }
+		inline BatchFloat4 BatchSub(BatchFloat4 lhs, BatchFloat4 rhs) { return _mm_sub_ps(lhs, rhs); }
+		inline BatchFloat4 BatchXor(BatchFloat4 lhs, BatchFloat4 rhs) { return _mm_xor_ps(lhs, rhs); }
+#elif defined(NAZARA_MATH_BATCH_NEON)
+		using BatchFloat4 = float32x4_t;
+
+		inline BatchFloat4 BatchAdd(BatchFloat4 lhs, BatchFloat4 rhs) { return vaddq_f32(lhs, rhs); }
+		inline BatchFloat4 BatchLoad(const float* ptr) { return vld1q_f32(ptr); }
+		inline BatchFloat4 BatchMul(BatchFloat4 lhs, BatchFloat4 rhs) { return vmulq_f32(lhs, rhs); }
+		inline BatchFloat4 BatchSet(float value) { return vdupq_n_f32(value); }
+		inline BatchFloat4 BatchSignBits(BatchFloat4 value) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(value), vdupq_n_u32(0x80000000))); }
+		inline void BatchStore(float* ptr, BatchFloat4 value) { vst1q_f32(ptr, value); }
+		inline BatchFloat4 BatchSub(BatchFloat4 lhs, BatchFloat4 rhs) { return vsubq_f32(lhs, rhs); }
+		inline BatchFloat4 BatchXor(BatchFloat4 lhs, BatchFloat4 rhs) { return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(lhs), vreinterpretq_u32_f32(rhs))); }
+#endif
+
+#if defined(NAZARA_MATH_BATCH_SSE) || defined(NAZARA_MATH_BATCH_NEON)
+		// Transforms four positions at a time, stored as SoA, the same way Matrix4::Transform does
+		inline void BatchTransformPositions(const Matrix4<float>& matrix, const float* inputX, const float* inputY, const float* inputZ, float* outputX, float* outputY, float* outputZ)
+		{
+			BatchFloat4 x = BatchLoad(inputX);
+			BatchFloat4 y = BatchLoad(inputY);
+			BatchFloat4 z = BatchLoad(inputZ);
+
+			BatchStore(outputX, BatchAdd(BatchAdd(BatchMul(x, BatchSet(matrix.m11)), BatchMul(y, BatchSet(matrix.m21))), BatchAdd(BatchMul(z, BatchSet(matrix.m31)), BatchSet(matrix.m41))));
+			BatchStore(outputY, BatchAdd(BatchAdd(BatchMul(x, BatchSet(matrix.m12)), BatchMul(y, BatchSet(matrix.m22))), BatchAdd(BatchMul(z, BatchSet(matrix.m32)), BatchSet(matrix.m42))));
+			BatchStore(outputZ, BatchAdd(BatchAdd(BatchMul(x, BatchSet(matrix.m13)), BatchMul(y, BatchSet(matrix.m23))), BatchAdd(BatchMul(z, BatchSet(matrix.m33)), BatchSet(matrix.m43))));
+		}
+#endif
+
+		// Slerp approximation by David Eberly ("A Fast and Accurate Algorithm for Computing SLERP"), which only relies on
+		// multiplications and additions and is therefore suitable for vectorization, with a maximal error around 1e-7
+		struct BatchSlerpCoefficients
+		{
+			static constexpr float OnePlusMu = 1.90110745351730037f;
+			static constexpr float U[8] = {
+				1.f / (1 * 3), 1.f / (2 * 5), 1.f / (3 * 7), 1.f / (4 * 9), 1.f / (5 * 11), 1.f / (6 * 13), 1.f / (7 * 15), OnePlusMu / (8 * 17)
+			};
+			static constexpr float V[8] = {
+				1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, OnePlusMu * 8 / 17
+			};
+		};
+
+#if defined(NAZARA_MATH_BATCH_SSE) || defined(NAZARA_MATH_BATCH_NEON)
+		// Interpolates four quaternions stored as SoA
+		inline void BatchSlerp(const float* from, const float* to, const float* interpolation, float* output)
+		{
+			BatchFloat4 fromW = BatchLoad(&from[0]);
+			BatchFloat4 fromX = BatchLoad(&from[4]);
+			BatchFloat4 fromY = BatchLoad(&from[8]);
+			BatchFloat4 fromZ = BatchLoad(&from[12]);
+
+			BatchFloat4 toW = BatchLoad(&to[0]);
+			BatchFloat4 toX = BatchLoad(&to[4]);
+			BatchFloat4 toY = BatchLoad(&to[8]);
+			BatchFloat4 toZ = BatchLoad(&to[12]);
+
+			BatchFloat4 cosOmega = BatchAdd(BatchAdd(BatchMul(fromW, toW), BatchMul(fromX, toX)), BatchAdd(BatchMul(fromY, toY), BatchMul(fromZ, toZ)));
+
+			// Take the shortest path by flipping the target quaternion when the dot product is negative
+			BatchFloat4 sign = BatchSignBits(cosOmega);
+			cosOmega = BatchXor(cosOmega, sign);
+			toW = BatchXor(toW, sign);
+			toX = BatchXor(toX, sign);
+			toY = BatchXor(toY, sign);
+			toZ = BatchXor(toZ, sign);
+
+			BatchFloat4 one = BatchSet(1.f);
+			BatchFloat4 t = BatchLoad(interpolation);
+			BatchFloat4 d = BatchSub(one, t);
+			BatchFloat4 sqrT = BatchMul(t, t);
+			BatchFloat4 sqrD = BatchMul(d, d);
+			BatchFloat4 cosOmegaMinusOne = BatchSub(cosOmega, one);
+
+			BatchFloat4 coefT = one;
+			BatchFloat4 coefD = one;
+			for (std::size_t i = 8; i-- > 0;)
+			{
+				BatchFloat4 u = BatchSet(BatchSlerpCoefficients::U[i]);
+				BatchFloat4 v = BatchSet(BatchSlerpCoefficients::V[i]);
+
+				BatchFloat4 bT = BatchMul(BatchSub(BatchMul(u, sqrT), v), cosOmegaMinusOne);
+				BatchFloat4 bD = BatchMul(BatchSub(BatchMul(u, sqrD), v), cosOmegaMinusOne);
+
+				coefT = BatchAdd(one, BatchMul(bT, coefT));
+				coefD = BatchAdd(one, BatchMul(bD, coefD));
+			}
+
+			coefT = BatchMul(coefT, t);
+			coefD = BatchMul(coefD, d);
+
+			BatchStore(&output[0], BatchAdd(BatchMul(fromW, coefD), BatchMul(toW, coefT)));
+			BatchStore(&output[4], BatchAdd(BatchMul(fromX, coefD), BatchMul(toX, coefT)));
+			BatchStore(&output[8], BatchAdd(BatchMul(fromY, coefD), BatchMul(toY, coefT)));
+			BatchStore(&output[12], BatchAdd(BatchMul(fromZ, coefD), BatchMul(toZ, coefT)));
+		}
+#endif
+	}
+
+	/*!
+	* \ingroup math
+	* \brief Concatenates pairs of matrices
+	*
+	* Computes output[i] = Matrix4::Concatenate(left[i], right[i]) for each pair
+	*
+	* \param left Left-hand side matrices
+	* \param right Right-hand side matrices
+	* \param output Concatenated matrices, can point to left or right
+	* \param count Number of matrix pairs
+	*
+	* \remark Uses SSE or NEON for float matrices when available
+	*/
+	template<typename T>
+	void ConcatenateMatrices(SparsePtr<const Matrix4<T>> left, SparsePtr<const Matrix4<T>> right, SparsePtr<Matrix4<T>> output, std::size_t count)
+	{
+#if defined(NAZARA_MATH_BATCH_SSE) || defined(NAZARA_MATH_BATCH_NEON)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			using namespace Detail;
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const float* lhs = &(left++)->m11;
+				const float* rhs = &(right++)->m11;
+
+#ifdef NAZARA_MATH_BATCH_AVX
+				// Compute two rows at once, each 128 bits lane broadcasting the elements of its own left-hand side row
+				__m256 rhsRows1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&rhs[0]));
+				__m256 rhsRows2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&rhs[4]));
+				__m256 rhsRows3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&rhs[8]));
+				__m256 rhsRows4 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&rhs[12]));
+
+				__m256 lhsRows12 = _mm256_loadu_ps(&lhs[0]);
+				__m256 lhsRows34 = _mm256_loadu_ps(&lhs[8]);
+
+				__m256 rows12 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(lhsRows12, lhsRows12, _MM_SHUFFLE(0, 0, 0, 0)), rhsRows1), _mm256_mul_ps(_mm256_shuffle_ps(lhsRows12, lhsRows12, _MM_SHUFFLE(1, 1, 1, 1)), rhsRows2)),
+				                              _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(lhsRows12, lhsRows12, _MM_SHUFFLE(2, 2, 2, 2)), rhsRows3), _mm256_mul_ps(_mm256_shuffle_ps(lhsRows12, lhsRows12, _MM_SHUFFLE(3, 3, 3, 3)), rhsRows4)));
+
+				__m256 rows34 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(lhsRows34, lhsRows34, _MM_SHUFFLE(0, 0, 0, 0)), rhsRows1), _mm256_mul_ps(_mm256_shuffle_ps(lhsRows34, lhsRows34, _MM_SHUFFLE(1, 1, 1, 1)), rhsRows2)),
+				                              _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(lhsRows34, lhsRows34, _MM_SHUFFLE(2, 2, 2, 2)), rhsRows3), _mm256_mul_ps(_mm256_shuffle_ps(lhsRows34, lhsRows34, _MM_SHUFFLE(3, 3, 3, 3)), rhsRows4)));
+
+				float* result = &(output++)->m11;
+				_mm256_storeu_ps(&result[0], rows12);
+				_mm256_storeu_ps(&result[8], rows34);
+#else
+				BatchFloat4 rhsRow1 = BatchLoad(&rhs[0]);
+				BatchFloat4 rhsRow2 = BatchLoad(&rhs[4]);
+				BatchFloat4 rhsRow3 = BatchLoad(&rhs[8]);
+				BatchFloat4 rhsRow4 = BatchLoad(&rhs[12]);
+
+				// Compute all rows before storing them as output is allowed to alias inputs
+				BatchFloat4 rows[4];
+				for (std::size_t row = 0; row < 4; ++row)
+				{
+					const float* lhsRow = &lhs[row * 4];
+					rows[row] = BatchAdd(BatchAdd(BatchMul(BatchSet(lhsRow[0]), rhsRow1), BatchMul(BatchSet(lhsRow[1]), rhsRow2)),
+					                     BatchAdd(BatchMul(BatchSet(lhsRow[2]), rhsRow3), BatchMul(BatchSet(lhsRow[3]), rhsRow4)));
+				}
+
+				float* result = &(output++)->m11;
+				for (std::size_t row = 0; row < 4; ++row)
+					BatchStore(&result[row * 4], rows[row]);
+#endif
+			}
+
+			return;
+		}
+#endif
+
+		for (std::size_t i = 0; i < count; ++i)
+			*output++ = Matrix4<T>::Concatenate(*left++, *right++);
+	}
+
+	/*!
+	* \ingroup math
+	* \brief Interpolates spherically pairs of quaternions
+	*
+	* \param from Initial quaternions
+	* \param to Target quaternions
+	* \param interpolation Factors of interpolation, a stride of zero can be used to share the same factor between all pairs
+	* \param output Interpolated quaternions, can point to from or to
+	* \param count Number of quaternion pairs
+	*
+	* \remark Float quaternions are interpolated four at a time with SSE or NEON using a polynomial approximation of slerp,
+	*         results may differ from Quaternion::Slerp by about 1e-6
+	* \remark interpolation is meant to be between 0 and 1, other values are potentially undefined behavior
+	*
+	* \see Quaternion::Slerp
+	*/
+	template<typename T>
+	void SlerpQuaternions(SparsePtr<const Quaternion<T>> from, SparsePtr<const Quaternion<T>> to, SparsePtr<const T> interpolation, SparsePtr<Quaternion<T>> output, std::size_t count)
+	{
+#if defined(NAZARA_MATH_BATCH_SSE) || defined(NAZARA_MATH_BATCH_NEON)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			alignas(16) float fromSoA[16];
+			alignas(16) float toSoA[16];
+			alignas(16) float interpolationSoA[4];
+			alignas(16) float outputSoA[16];
+
+			for (std::size_t i = 0; i < count; i += 4)
+			{
+				std::size_t batchSize = std::min<std::size_t>(count - i, 4);
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					// Pad the last batch with identity quaternions
+					Quaternion<float> fromQuat = (j < batchSize) ? *from++ : Quaternion<float>::Identity();
+					Quaternion<float> toQuat = (j < batchSize) ? *to++ : Quaternion<float>::Identity();
+
+					fromSoA[0 + j] = fromQuat.w;
+					fromSoA[4 + j] = fromQuat.x;
+					fromSoA[8 + j] = fromQuat.y;
+					fromSoA[12 + j] = fromQuat.z;
+
+					toSoA[0 + j] = toQuat.w;
+					toSoA[4 + j] = toQuat.x;
+					toSoA[8 + j] = toQuat.y;
+					toSoA[12 + j] = toQuat.z;
+
+					interpolationSoA[j] = (j < batchSize) ? *interpolation++ : 0.f;
+				}
+
+				Detail::BatchSlerp(fromSoA, toSoA, interpolationSoA, outputSoA);
+
+				for (std::size_t j = 0; j < batchSize; ++j)
+					(output++)->Set(outputSoA[0 + j], outputSoA[4 + j], outputSoA[8 + j], outputSoA[12 + j]);
+			}
+
+			return;
+		}
+#endif
+
+		for (std::size_t i = 0; i < count; ++i)
+			*output++ = Quaternion<T>::Slerp(*from++, *to++, *interpolation++);
+	}
+
+	/*!
+	* \ingroup math
+	* \brief Transforms directions by a matrix, ignoring its translation
+	*
+	* Computes output[i] = matrix.Transform(directions[i], 0) for each direction
+	*
+	* \param matrix Transformation matrix
+	* \param directions Directions to transform
+	* \param output Transformed directions, can point to directions
+	* \param count Number of directions
+	*/
+	template<typename T>
+	void TransformDirections(const Matrix4<T>& matrix, SparsePtr<const Vector3<T>> directions, SparsePtr<Vector3<T>> output, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			*output++ = matrix.Transform(*directions++, T(0.0));
+	}
+
+	/*!
+	* \ingroup math
+	* \brief Transforms positions by a matrix
+	*
+	* Computes output[i] = matrix.Transform(positions[i]) for each position
+	*
+	* \param matrix Transformation matrix
+	* \param positions Positions to transform
+	* \param output Transformed positions, can point to positions
+	* \param count Number of positions
+	*
+	* \remark Positions are transformed one at a time as they may be interleaved with other data, prefer the structure of arrays overload for large batches
+	*/
+	template<typename T>
+	void TransformPositions(const Matrix4<T>& matrix, SparsePtr<const Vector3<T>> positions, SparsePtr<Vector3<T>> output, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			*output++ = matrix.Transform(*positions++);
+	}
+
+	/*!
+	* \ingroup math
+	* \brief Transforms positions stored as structure of arrays by a matrix
+	*
+	* This is the fastest way to transform a large number of positions, as every SIMD lane does useful work
+	*
+	* \param matrix Transformation matrix
+	* \param inputX X coordinates of the positions
+	* \param inputY Y coordinates of the positions
+	* \param inputZ Z coordinates of the positions
+	* \param outputX X coordinates of the transformed positions, can point to inputX
+	* \param outputY Y coordinates of the transformed positions, can point to inputY
+	* \param outputZ Z coordinates of the transformed positions, can point to inputZ
+	* \param count Number of positions
+	*
+	* \remark Uses AVX (when enabled at compile time), SSE or NEON for float positions
+	*/
+	template<typename T>
+	void TransformPositions(const Matrix4<T>& matrix, const T* inputX, const T* inputY, const T* inputZ, T* outputX, T* outputY, T* outputZ, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#if defined(NAZARA_MATH_BATCH_SSE) || defined(NAZARA_MATH_BATCH_NEON)
+		if constexpr (std::is_same_v<T, float>)
+		{
+#ifdef NAZARA_MATH_BATCH_AVX
+			for (std::size_t batchEnd = count - count % 8; i < batchEnd; i += 8)
+			{
+				__m256 x = _mm256_loadu_ps(&inputX[i]);
+				__m256 y = _mm256_loadu_ps(&inputY[i]);
+				__m256 z = _mm256_loadu_ps(&inputZ[i]);
+
+				__m256 resultX = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(matrix.m11)), _mm256_mul_ps(y, _mm256_set1_ps(matrix.m21))), _mm256_add_ps(_mm256_mul_ps(z, _mm256_set1_ps(matrix.m31)), _mm256_set1_ps(matrix.m41)));
+				__m256 resultY = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(matrix.m12)), _mm256_mul_ps(y, _mm256_set1_ps(matrix.m22))), _mm256_add_ps(_mm256_mul_ps(z, _mm256_set1_ps(matrix.m32)), _mm256_set1_ps(matrix.m42)));
+				__m256 resultZ = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(matrix.m13)), _mm256_mul_ps(y, _mm256_set1_ps(matrix.m23))), _mm256_add_ps(_mm256_mul_ps(z, _mm256_set1_ps(matrix.m33)), _mm256_set1_ps(matrix.m43)));
+
+				_mm256_storeu_ps(&outputX[i], resultX);
+				_mm256_storeu_ps(&outputY[i], resultY);
+				_mm256_storeu_ps(&outputZ[i], resultZ);
+			}
+#endif
+
+			for (std::size_t batchEnd = count - count % 4; i < batchEnd; i += 4)
+				Detail::BatchTransformPositions(matrix, &inputX[i], &inputY[i], &inputZ[i], &outputX[i], &outputY[i], &outputZ[i]);
+		}
+#endif
+
+		for (; i < count; ++i)
+		{
+			Vector3<T> position = matrix.Transform(Vector3<T>(inputX[i], inputY[i], inputZ[i]));
+			outputX[i] = position.x;
+			outputY[i] = position.y;
+			outputZ[i] = position.z;
+		}
+	}
+}
+
+#undef NAZARA_MATH_BATCH_AVX
+#undef NAZARA_MATH_BATCH_NEON
+#undef NAZARA_MATH_BATCH_SSE
+
+#include <Nazara/Core/DebugOff.hpp>
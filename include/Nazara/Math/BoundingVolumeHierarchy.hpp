@@ -0,0 +1,92 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Math module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MATH_BOUNDINGVOLUMEHIERARCHY_HPP
+#define NAZARA_MATH_BOUNDINGVOLUMEHIERARCHY_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Enums.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Ray.hpp>
+#include <Nazara/Math/Sphere.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	template<typename T>
+	class BoundingVolumeHierarchy
+	{
+		public:
+			BoundingVolumeHierarchy(T margin = T(0.1));
+			BoundingVolumeHierarchy(const BoundingVolumeHierarchy&) = default;
+			BoundingVolumeHierarchy(BoundingVolumeHierarchy&&) noexcept = default;
+			~BoundingVolumeHierarchy() = default;
+
+			void Clear();
+
+			const Box<T>& GetFatBox(std::size_t leafIndex) const;
+			std::size_t GetHeight() const;
+			std::size_t GetLeafCount() const;
+			T GetMargin() const;
+			std::size_t GetUserData(std::size_t leafIndex) const;
+
+			std::size_t Insert(const Box<T>& box, std::size_t userData);
+
+			bool Move(std::size_t leafIndex, const Box<T>& box);
+
+			template<typename F> void QueryBox(const Box<T>& box, F&& callback) const;
+			template<typename F> void QueryFrustum(const Frustum<T>& frustum, F&& callback) const;
+			template<typename F> void QueryRay(const Ray<T>& ray, F&& callback) const;
+			template<typename F> void QuerySphere(const Sphere<T>& sphere, F&& callback) const;
+
+			void Remove(std::size_t leafIndex);
+
+			BoundingVolumeHierarchy& operator=(const BoundingVolumeHierarchy&) = default;
+			BoundingVolumeHierarchy& operator=(BoundingVolumeHierarchy&&) noexcept = default;
+
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+		private:
+			std::size_t AllocateNode();
+			std::size_t Balance(std::size_t nodeIndex);
+			Box<T> ComputeFatBox(const Box<T>& box) const;
+			void FreeNode(std::size_t nodeIndex);
+			void InsertLeaf(std::size_t leafIndex);
+			void RefitAncestors(std::size_t nodeIndex);
+			void RemoveLeaf(std::size_t leafIndex);
+			template<typename F> void ReportSubtree(std::size_t nodeIndex, F& callback) const;
+			template<typename Test, typename F> void Traverse(std::size_t nodeIndex, const Test& test, F& callback) const;
+
+			static Box<T> Merge(const Box<T>& lhs, const Box<T>& rhs);
+			static T SurfaceArea(const Box<T>& box);
+
+			struct Node
+			{
+				Box<T> box;
+				std::size_t children[2];
+				std::size_t parent; //< next free node when the node is not in use
+				std::size_t userData;
+				int height; //< 0 for leaves, -1 for free nodes
+
+				bool IsLeaf() const;
+			};
+
+			std::vector<Node> m_nodes;
+			std::size_t m_freeNode;
+			std::size_t m_leafCount;
+			std::size_t m_root;
+			T m_margin;
+	};
+
+	using BoundingVolumeHierarchyd = BoundingVolumeHierarchy<double>;
+	using BoundingVolumeHierarchyf = BoundingVolumeHierarchy<float>;
+}
+
+#include <Nazara/Math/BoundingVolumeHierarchy.inl>
+
+#endif // NAZARA_MATH_BOUNDINGVOLUMEHIERARCHY_HPP
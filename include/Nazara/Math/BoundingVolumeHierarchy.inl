@@ -0,0 +1,569 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Math module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Math/BoundingVolumeHierarchy.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup math
+	* \class Nz::BoundingVolumeHierarchy
+	* \brief Math class that represents a dynamic tree of axis-aligned boxes, used to query a set of moving objects in sublinear time
+	*
+	* Each inserted box is stored in a leaf as a "fat" box enlarged by a margin, so small movements don't change the tree.
+	* Leaves are inserted using the surface area heuristic and the tree is kept balanced by rotating nodes while refitting the ancestors of a modified leaf.
+	*
+	* \remark Leaf indices stay valid until the leaf is removed
+	*/
+
+	/*!
+	* \brief Constructs a BoundingVolumeHierarchy object
+	*
+	* \param margin Distance by which inserted boxes are enlarged in every direction
+	*/
+	template<typename T>
+	BoundingVolumeHierarchy<T>::BoundingVolumeHierarchy(T margin) :
+	m_freeNode(InvalidIndex),
+	m_leafCount(0),
+	m_root(InvalidIndex),
+	m_margin(margin)
+	{
+	}
+
+	/*!
+	* \brief Removes every leaf from the tree
+	*/
+	template<typename T>
+	void BoundingVolumeHierarchy<T>::Clear()
+	{
+		m_nodes.clear();
+		m_freeNode = InvalidIndex;
+		m_leafCount = 0;
+		m_root = InvalidIndex;
+	}
+
+	/*!
+	* \brief Gets the enlarged box stored in a leaf
+	* \return Fat box of the leaf, which contains the last box given to Insert or Move
+	*
+	* \param leafIndex Index of the leaf, as returned by Insert
+	*/
+	template<typename T>
+	const Box<T>& BoundingVolumeHierarchy<T>::GetFatBox(std::size_t leafIndex) const
+	{
+		NazaraAssert(leafIndex < m_nodes.size(), "leaf index out of range");
+		NazaraAssert(m_nodes[leafIndex].height >= 0, "leaf #" + std::to_string(leafIndex) + " has been removed");
+		NazaraAssert(m_nodes[leafIndex].IsLeaf(), "node #" + std::to_string(leafIndex) + " is not a leaf");
+		return m_nodes[leafIndex].box;
+	}
+
+	/*!
+	* \brief Gets the height of the tree
+	* \return Number of nodes between the root and the deepest leaf (zero if the tree has at most one leaf)
+	*/
+	template<typename T>
+	std::size_t BoundingVolumeHierarchy<T>::GetHeight() const
+	{
+		if (m_root == InvalidIndex)
+			return 0;
+
+		return static_cast<std::size_t>(m_nodes[m_root].height);
+	}
+
+	/*!
+	* \brief Gets the number of leaves in the tree
+	* \return Leaf count
+	*/
+	template<typename T>
+	std::size_t BoundingVolumeHierarchy<T>::GetLeafCount() const
+	{
+		return m_leafCount;
+	}
+
+	/*!
+	* \brief Gets the margin used to enlarge boxes
+	* \return Margin
+	*/
+	template<typename T>
+	T BoundingVolumeHierarchy<T>::GetMargin() const
+	{
+		return m_margin;
+	}
+
+	/*!
+	* \brief Gets the user data associated with a leaf
+	* \return User data given to Insert
+	*
+	* \param leafIndex Index of the leaf, as returned by Insert
+	*/
+	template<typename T>
+	std::size_t BoundingVolumeHierarchy<T>::GetUserData(std::size_t leafIndex) const
+	{
+		NazaraAssert(leafIndex < m_nodes.size(), "leaf index out of range");
+		NazaraAssert(m_nodes[leafIndex].height >= 0, "leaf #" + std::to_string(leafIndex) + " has been removed");
+		NazaraAssert(m_nodes[leafIndex].IsLeaf(), "node #" + std::to_string(leafIndex) + " is not a leaf");
+		return m_nodes[leafIndex].userData;
+	}
+
+	/*!
+	* \brief Inserts a box in the tree
+	* \return Index of the new leaf, to be used with Move and Remove
+	*
+	* \param box Box to insert
+	* \param userData Value reported by queries when this leaf matches
+	*/
+	template<typename T>
+	std::size_t BoundingVolumeHierarchy<T>::Insert(const Box<T>& box, std::size_t userData)
+	{
+		std::size_t leafIndex = AllocateNode();
+
+		Node& leaf = m_nodes[leafIndex];
+		leaf.box = ComputeFatBox(box);
+		leaf.height = 0;
+		leaf.userData = userData;
+
+		InsertLeaf(leafIndex);
+		m_leafCount++;
+
+		return leafIndex;
+	}
+
+	/*!
+	* \brief Updates the box of a leaf
+	* \return true if the leaf had to be reinserted, false if the new box was still contained in its fat box
+	*
+	* \param leafIndex Index of the leaf, as returned by Insert
+	* \param box New box of the leaf
+	*/
+	template<typename T>
+	bool BoundingVolumeHierarchy<T>::Move(std::size_t leafIndex, const Box<T>& box)
+	{
+		NazaraAssert(leafIndex < m_nodes.size(), "leaf index out of range");
+		NazaraAssert(m_nodes[leafIndex].height >= 0, "leaf #" + std::to_string(leafIndex) + " has been removed");
+		NazaraAssert(m_nodes[leafIndex].IsLeaf(), "node #" + std::to_string(leafIndex) + " is not a leaf");
+
+		if (m_nodes[leafIndex].box.Contains(box))
+			return false;
+
+		RemoveLeaf(leafIndex);
+		m_nodes[leafIndex].box = ComputeFatBox(box);
+		InsertLeaf(leafIndex);
+
+		return true;
+	}
+
+	/*!
+	* \brief Reports every leaf whose fat box intersects a box
+	*
+	* \param box Box to test
+	* \param callback Function called with the user data of every matching leaf
+	*/
+	template<typename T>
+	template<typename F>
+	void BoundingVolumeHierarchy<T>::QueryBox(const Box<T>& box, F&& callback) const
+	{
+		if (m_root == InvalidIndex)
+			return;
+
+		Traverse(m_root, [&](const Box<T>& nodeBox)
+		{
+			if (!box.Intersect(nodeBox))
+				return IntersectionSide::Outside;
+
+			return (box.Contains(nodeBox)) ? IntersectionSide::Inside : IntersectionSide::Intersecting;
+		}, callback);
+	}
+
+	/*!
+	* \brief Reports every leaf whose fat box intersects a frustum
+	*
+	* \param frustum Frustum to test
+	* \param callback Function called with the user data of every matching leaf
+	*
+	* \remark Subtrees fully inside the frustum are reported without testing their leaves
+	*/
+	template<typename T>
+	template<typename F>
+	void BoundingVolumeHierarchy<T>::QueryFrustum(const Frustum<T>& frustum, F&& callback) const
+	{
+		if (m_root == InvalidIndex)
+			return;
+
+		Traverse(m_root, [&](const Box<T>& nodeBox)
+		{
+			return frustum.Intersect(nodeBox);
+		}, callback);
+	}
+
+	/*!
+	* \brief Reports every leaf whose fat box is hit by a ray
+	*
+	* \param ray Ray to test
+	* \param callback Function called with the user data of every matching leaf
+	*/
+	template<typename T>
+	template<typename F>
+	void BoundingVolumeHierarchy<T>::QueryRay(const Ray<T>& ray, F&& callback) const
+	{
+		if (m_root == InvalidIndex)
+			return;
+
+		Traverse(m_root, [&](const Box<T>& nodeBox)
+		{
+			return (ray.Intersect(nodeBox)) ? IntersectionSide::Intersecting : IntersectionSide::Outside;
+		}, callback);
+	}
+
+	/*!
+	* \brief Reports every leaf whose fat box intersects a sphere
+	*
+	* \param sphere Sphere to test
+	* \param callback Function called with the user data of every matching leaf
+	*/
+	template<typename T>
+	template<typename F>
+	void BoundingVolumeHierarchy<T>::QuerySphere(const Sphere<T>& sphere, F&& callback) const
+	{
+		if (m_root == InvalidIndex)
+			return;
+
+		Traverse(m_root, [&](const Box<T>& nodeBox)
+		{
+			if (!sphere.Intersect(nodeBox))
+				return IntersectionSide::Outside;
+
+			return (sphere.Contains(nodeBox)) ? IntersectionSide::Inside : IntersectionSide::Intersecting;
+		}, callback);
+	}
+
+	/*!
+	* \brief Removes a leaf from the tree
+	*
+	* \param leafIndex Index of the leaf, as returned by Insert
+	*/
+	template<typename T>
+	void BoundingVolumeHierarchy<T>::Remove(std::size_t leafIndex)
+	{
+		NazaraAssert(leafIndex < m_nodes.size(), "leaf index out of range");
+		NazaraAssert(m_nodes[leafIndex].height >= 0, "leaf #" + std::to_string(leafIndex) + " has been removed");
+		NazaraAssert(m_nodes[leafIndex].IsLeaf(), "node #" + std::to_string(leafIndex) + " is not a leaf");
+
+		RemoveLeaf(leafIndex);
+		FreeNode(leafIndex);
+		m_leafCount--;
+	}
+
+	template<typename T>
+	std::size_t BoundingVolumeHierarchy<T>::AllocateNode()
+	{
+		std::size_t nodeIndex;
+		if (m_freeNode != InvalidIndex)
+		{
+			nodeIndex = m_freeNode;
+			m_freeNode = m_nodes[nodeIndex].parent;
+		}
+		else
+		{
+			nodeIndex = m_nodes.size();
+			m_nodes.emplace_back();
+		}
+
+		Node& node = m_nodes[nodeIndex];
+		node.children[0] = InvalidIndex;
+		node.children[1] = InvalidIndex;
+		node.parent = InvalidIndex;
+		node.userData = 0;
+		node.height = 0;
+
+		return nodeIndex;
+	}
+
+	template<typename T>
+	std::size_t BoundingVolumeHierarchy<T>::Balance(std::size_t nodeIndex)
+	{
+		// Rotates the highest grandchild in place of the node when its children heights differ by more than one
+		NazaraAssert(nodeIndex < m_nodes.size() && m_nodes[nodeIndex].height >= 0, "invalid node");
+
+		Node& a = m_nodes[nodeIndex];
+		if (a.IsLeaf() || a.height < 2)
+			return nodeIndex;
+
+		auto Rotate = [&](std::size_t childSlot)
+		{
+			std::size_t otherIndex = a.children[1 - childSlot];
+			std::size_t pivotIndex = a.children[childSlot];
+			Node& other = m_nodes[otherIndex];
+			Node& pivot = m_nodes[pivotIndex];
+			NazaraAssert(!pivot.IsLeaf(), "the highest child of an unbalanced node cannot be a leaf");
+
+			std::size_t firstIndex = pivot.children[0];
+			std::size_t secondIndex = pivot.children[1];
+			Node& first = m_nodes[firstIndex];
+			Node& second = m_nodes[secondIndex];
+
+			// Pivot takes the place of the node, which becomes one of its children
+			pivot.children[0] = nodeIndex;
+			pivot.parent = a.parent;
+			a.parent = pivotIndex;
+
+			if (pivot.parent != InvalidIndex)
+			{
+				Node& parent = m_nodes[pivot.parent];
+				if (parent.children[0] == nodeIndex)
+					parent.children[0] = pivotIndex;
+				else
+				{
+					NazaraAssert(parent.children[1] == nodeIndex, "node #" + std::to_string(nodeIndex) + " is not a child of its parent");
+					parent.children[1] = pivotIndex;
+				}
+			}
+			else
+				m_root = pivotIndex;
+
+			// Node keeps the lowest child of the pivot
+			std::size_t keptIndex = (first.height > second.height) ? secondIndex : firstIndex;
+			std::size_t movedIndex = (first.height > second.height) ? firstIndex : secondIndex;
+			Node& kept = m_nodes[keptIndex];
+			Node& moved = m_nodes[movedIndex];
+
+			pivot.children[1] = movedIndex;
+			a.children[childSlot] = keptIndex;
+			kept.parent = nodeIndex;
+
+			a.box = Merge(other.box, kept.box);
+			pivot.box = Merge(a.box, moved.box);
+
+			a.height = 1 + std::max(other.height, kept.height);
+			pivot.height = 1 + std::max(a.height, moved.height);
+
+			return pivotIndex;
+		};
+
+		int balance = m_nodes[a.children[1]].height - m_nodes[a.children[0]].height;
+		if (balance > 1)
+			return Rotate(1);
+		else if (balance < -1)
+			return Rotate(0);
+
+		return nodeIndex;
+	}
+
+	template<typename T>
+	Box<T> BoundingVolumeHierarchy<T>::ComputeFatBox(const Box<T>& box) const
+	{
+		return Box<T>(box.x - m_margin, box.y - m_margin, box.z - m_margin, box.width + T(2.0) * m_margin, box.height + T(2.0) * m_margin, box.depth + T(2.0) * m_margin);
+	}
+
+	template<typename T>
+	void BoundingVolumeHierarchy<T>::FreeNode(std::size_t nodeIndex)
+	{
+		Node& node = m_nodes[nodeIndex];
+		node.height = -1;
+		node.parent = m_freeNode;
+
+		m_freeNode = nodeIndex;
+	}
+
+	template<typename T>
+	void BoundingVolumeHierarchy<T>::InsertLeaf(std::size_t leafIndex)
+	{
+		if (m_root == InvalidIndex)
+		{
+			m_root = leafIndex;
+			m_nodes[leafIndex].parent = InvalidIndex;
+			return;
+		}
+
+		// Find the best sibling using the surface area heuristic: descend while it's cheaper than making a new parent here
+		Box<T> leafBox = m_nodes[leafIndex].box;
+
+		std::size_t siblingIndex = m_root;
+		while (!m_nodes[siblingIndex].IsLeaf())
+		{
+			const Node& node = m_nodes[siblingIndex];
+
+			T combinedArea = SurfaceArea(Merge(node.box, leafBox));
+
+			// Cost of creating a new parent for this node and the new leaf
+			T cost = T(2.0) * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree
+			T inheritanceCost = T(2.0) * (combinedArea - SurfaceArea(node.box));
+
+			auto ChildCost = [&](std::size_t childIndex)
+			{
+				const Node& child = m_nodes[childIndex];
+
+				T childCost = SurfaceArea(Merge(child.box, leafBox));
+				if (!child.IsLeaf())
+					childCost -= SurfaceArea(child.box);
+
+				return childCost + inheritanceCost;
+			};
+
+			T firstCost = ChildCost(node.children[0]);
+			T secondCost = ChildCost(node.children[1]);
+
+			if (cost < firstCost && cost < secondCost)
+				break;
+
+			siblingIndex = (firstCost < secondCost) ? node.children[0] : node.children[1];
+		}
+
+		// Create a new parent for the sibling and the leaf
+		std::size_t oldParentIndex = m_nodes[siblingIndex].parent;
+		std::size_t newParentIndex = AllocateNode(); //< may reallocate m_nodes
+
+		Node& newParent = m_nodes[newParentIndex];
+		Node& sibling = m_nodes[siblingIndex];
+
+		newParent.box = Merge(sibling.box, leafBox);
+		newParent.children[0] = siblingIndex;
+		newParent.children[1] = leafIndex;
+		newParent.height = sibling.height + 1;
+		newParent.parent = oldParentIndex;
+
+		if (oldParentIndex != InvalidIndex)
+		{
+			Node& oldParent = m_nodes[oldParentIndex];
+			if (oldParent.children[0] == siblingIndex)
+				oldParent.children[0] = newParentIndex;
+			else
+				oldParent.children[1] = newParentIndex;
+		}
+		else
+			m_root = newParentIndex;
+
+		sibling.parent = newParentIndex;
+		m_nodes[leafIndex].parent = newParentIndex;
+
+		RefitAncestors(newParentIndex);
+	}
+
+	template<typename T>
+	void BoundingVolumeHierarchy<T>::RefitAncestors(std::size_t nodeIndex)
+	{
+		while (nodeIndex != InvalidIndex)
+		{
+			nodeIndex = Balance(nodeIndex);
+
+			Node& node = m_nodes[nodeIndex];
+			const Node& firstChild = m_nodes[node.children[0]];
+			const Node& secondChild = m_nodes[node.children[1]];
+
+			node.box = Merge(firstChild.box, secondChild.box);
+			node.height = 1 + std::max(firstChild.height, secondChild.height);
+
+			nodeIndex = node.parent;
+		}
+	}
+
+	template<typename T>
+	void BoundingVolumeHierarchy<T>::RemoveLeaf(std::size_t leafIndex)
+	{
+		if (leafIndex == m_root)
+		{
+			m_root = InvalidIndex;
+			return;
+		}
+
+		// Replace the parent of the leaf by its sibling
+		std::size_t parentIndex = m_nodes[leafIndex].parent;
+		NazaraAssert(parentIndex != InvalidIndex, "leaf #" + std::to_string(leafIndex) + " is not in the tree");
+
+		const Node& parent = m_nodes[parentIndex];
+
+		std::size_t grandParentIndex = parent.parent;
+		std::size_t siblingIndex = (parent.children[0] == leafIndex) ? parent.children[1] : parent.children[0];
+
+		if (grandParentIndex != InvalidIndex)
+		{
+			Node& grandParent = m_nodes[grandParentIndex];
+			if (grandParent.children[0] == parentIndex)
+				grandParent.children[0] = siblingIndex;
+			else
+				grandParent.children[1] = siblingIndex;
+
+			m_nodes[siblingIndex].parent = grandParentIndex;
+			FreeNode(parentIndex);
+
+			RefitAncestors(grandParentIndex);
+		}
+		else
+		{
+			m_root = siblingIndex;
+			m_nodes[siblingIndex].parent = InvalidIndex;
+			FreeNode(parentIndex);
+		}
+
+		m_nodes[leafIndex].parent = InvalidIndex;
+	}
+
+	template<typename T>
+	template<typename F>
+	void BoundingVolumeHierarchy<T>::ReportSubtree(std::size_t nodeIndex, F& callback) const
+	{
+		const Node& node = m_nodes[nodeIndex];
+		if (node.IsLeaf())
+			callback(node.userData);
+		else
+		{
+			ReportSubtree(node.children[0], callback);
+			ReportSubtree(node.children[1], callback);
+		}
+	}
+
+	template<typename T>
+	template<typename Test, typename F>
+	void BoundingVolumeHierarchy<T>::Traverse(std::size_t nodeIndex, const Test& test, F& callback) const
+	{
+		// Recursion depth is bounded by the tree height, which balancing keeps logarithmic
+		const Node& node = m_nodes[nodeIndex];
+		switch (test(node.box))
+		{
+			case IntersectionSide::Inside:
+				ReportSubtree(nodeIndex, callback);
+				break;
+
+			case IntersectionSide::Intersecting:
+				if (node.IsLeaf())
+					callback(node.userData);
+				else
+				{
+					Traverse(node.children[0], test, callback);
+					Traverse(node.children[1], test, callback);
+				}
+				break;
+
+			case IntersectionSide::Outside:
+				break;
+		}
+	}
+
+	template<typename T>
+	Box<T> BoundingVolumeHierarchy<T>::Merge(const Box<T>& lhs, const Box<T>& rhs)
+	{
+		Box<T> box(lhs);
+		box.ExtendTo(rhs);
+
+		return box;
+	}
+
+	template<typename T>
+	T BoundingVolumeHierarchy<T>::SurfaceArea(const Box<T>& box)
+	{
+		return T(2.0) * (box.width * box.height + box.height * box.depth + box.depth * box.width);
+	}
+
+	template<typename T>
+	bool BoundingVolumeHierarchy<T>::Node::IsLeaf() const
+	{
+		return children[0] == InvalidIndex;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -97,7 +97,9 @@ namespace Nz
 	using Quaternionf = Quaternion<float>;
 
 	template<typename T> bool Serialize(SerializationContext& context, const Quaternion<T>& quat, TypeTag<Quaternion<T>>);
+	template<typename T> bool SerializeQuantized(SerializationContext& context, const Quaternion<T>& quat, unsigned int bitCount);
 	template<typename T> bool Unserialize(SerializationContext& context, Quaternion<T>* quat, TypeTag<Quaternion<T>>);
+	template<typename T> bool UnserializeQuantized(SerializationContext& context, Quaternion<T>* quat, unsigned int bitCount);
 }
 
 template<typename T> std::ostream& operator<<(std::ostream& out, const Nz::Quaternion<T>& quat);
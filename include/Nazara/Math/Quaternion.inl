@@ -8,6 +8,9 @@
 #include <Nazara/Math/Config.hpp>
 #include <Nazara/Math/EulerAngles.hpp>
 #include <Nazara/Math/Vector3.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstring>
 #include <limits>
 #include <sstream>
@@ -927,6 +930,84 @@ namespace Nz
 
 		return true;
 	}
+
+	/*!
+	* \brief Serializes a rotation Quaternion using the "smallest three" compression
+	* \return true if successfully serialized
+	*
+	* \param context Serialization context
+	* \param quat Input Quaternion, normalized before serialization
+	* \param bitCount Number of bits per component
+	*
+	* The index of the largest component is written on two bits, followed by the three other components quantized to [-1/sqrt(2), 1/sqrt(2)],
+	* the largest component is computed back from them (q and -q represent the same rotation, so its sign is not needed).
+	*
+	* \see SerializeQuantized
+	*/
+	template<typename T>
+	bool SerializeQuantized(SerializationContext& context, const Quaternion<T>& quat, unsigned int bitCount)
+	{
+		Quaternion<T> normalizedQuat = quat.GetNormal();
+		std::array<T, 4> components = { normalizedQuat.w, normalizedQuat.x, normalizedQuat.y, normalizedQuat.z };
+
+		std::size_t largestIndex = 0;
+		for (std::size_t i = 1; i < components.size(); ++i)
+		{
+			if (std::abs(components[i]) > std::abs(components[largestIndex]))
+				largestIndex = i;
+		}
+
+		if (!SerializeBits(context, largestIndex, 2))
+			return false;
+
+		T sign = (components[largestIndex] < T(0)) ? T(-1) : T(1);
+		T range = T(1) / std::sqrt(T(2));
+		for (std::size_t i = 0; i < components.size(); ++i)
+		{
+			if (i == largestIndex)
+				continue;
+
+			if (!SerializeQuantized(context, sign * components[i], -range, range, bitCount))
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Unserializes a Quaternion written by SerializeQuantized
+	* \return true if successfully unserialized
+	*
+	* \param context Serialization context
+	* \param quat Output Quaternion
+	* \param bitCount Number of bits per component
+	*/
+	template<typename T>
+	bool UnserializeQuantized(SerializationContext& context, Quaternion<T>* quat, unsigned int bitCount)
+	{
+		UInt64 largestIndex;
+		if (!UnserializeBits(context, &largestIndex, 2))
+			return false;
+
+		std::array<T, 4> components;
+		T range = T(1) / std::sqrt(T(2));
+		T squaredSum = T(0);
+		for (std::size_t i = 0; i < components.size(); ++i)
+		{
+			if (i == largestIndex)
+				continue;
+
+			if (!UnserializeQuantized(context, &components[i], -range, range, bitCount))
+				return false;
+
+			squaredSum += components[i] * components[i];
+		}
+
+		components[largestIndex] = std::sqrt(std::max(T(1) - squaredSum, T(0)));
+
+		quat->Set(components[0], components[1], components[2], components[3]);
+		return true;
+	}
 }
 
 /*!
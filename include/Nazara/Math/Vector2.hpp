@@ -116,7 +116,9 @@ namespace Nz
 	using Vector2ui64 = Vector2<UInt64>;
 
 	template<typename T> bool Serialize(SerializationContext& context, const Vector2<T>& vector, TypeTag<Vector2<T>>);
+	template<typename T> bool SerializeQuantized(SerializationContext& context, const Vector2<T>& vector, T min, T max, unsigned int bitCount);
 	template<typename T> bool Unserialize(SerializationContext& context, Vector2<T>* vector, TypeTag<Vector2<T>>);
+	template<typename T> bool UnserializeQuantized(SerializationContext& context, Vector2<T>* vector, T min, T max, unsigned int bitCount);
 }
 
 template<typename T> std::ostream& operator<<(std::ostream& out, const Nz::Vector2<T>& vec);
@@ -922,6 +922,52 @@ namespace Nz
 
 		return true;
 	}
+
+	/*!
+	* \brief Serializes a Vector2 using a fixed number of bits per component
+	* \return true if successfully serialized
+	*
+	* \param context Serialization context
+	* \param vector Input Vector2
+	* \param min Minimum value of every component
+	* \param max Maximum value of every component
+	* \param bitCount Number of bits per component
+	*
+	* \see SerializeQuantized
+	*/
+	template<typename T>
+	bool SerializeQuantized(SerializationContext& context, const Vector2<T>& vector, T min, T max, unsigned int bitCount)
+	{
+		if (!SerializeQuantized(context, vector.x, min, max, bitCount))
+			return false;
+
+		if (!SerializeQuantized(context, vector.y, min, max, bitCount))
+			return false;
+
+		return true;
+	}
+
+	/*!
+	* \brief Unserializes a Vector2 written by SerializeQuantized
+	* \return true if successfully unserialized
+	*
+	* \param context Serialization context
+	* \param vector Output Vector2
+	* \param min Minimum value of every component
+	* \param max Maximum value of every component
+	* \param bitCount Number of bits per component
+	*/
+	template<typename T>
+	bool UnserializeQuantized(SerializationContext& context, Vector2<T>* vector, T min, T max, unsigned int bitCount)
+	{
+		if (!UnserializeQuantized(context, &vector->x, min, max, bitCount))
+			return false;
+
+		if (!UnserializeQuantized(context, &vector->y, min, max, bitCount))
+			return false;
+
+		return true;
+	}
 }
 
 /*!
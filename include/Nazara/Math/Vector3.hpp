@@ -136,7 +136,9 @@ namespace Nz
 	using Vector3ui64 = Vector3<UInt64>;
 
 	template<typename T> bool Serialize(SerializationContext& context, const Vector3<T>& vector, TypeTag<Vector3<T>>);
+	template<typename T> bool SerializeQuantized(SerializationContext& context, const Vector3<T>& vector, T min, T max, unsigned int bitCount);
 	template<typename T> bool Unserialize(SerializationContext& context, Vector3<T>* vector, TypeTag<Vector3<T>>);
+	template<typename T> bool UnserializeQuantized(SerializationContext& context, Vector3<T>* vector, T min, T max, unsigned int bitCount);
 }
 
 template<typename T> std::ostream& operator<<(std::ostream& out, const Nz::Vector3<T>& vec);
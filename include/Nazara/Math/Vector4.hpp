@@ -112,7 +112,9 @@ namespace Nz
 	using Vector4ui64 = Vector4<UInt64>;
 
 	template<typename T> bool Serialize(SerializationContext& context, const Vector4<T>& vector, TypeTag<Vector4<T>>);
+	template<typename T> bool SerializeQuantized(SerializationContext& context, const Vector4<T>& vector, T min, T max, unsigned int bitCount);
 	template<typename T> bool Unserialize(SerializationContext& context, Vector4<T>* vector, TypeTag<Vector4<T>>);
+	template<typename T> bool UnserializeQuantized(SerializationContext& context, Vector4<T>* vector, T min, T max, unsigned int bitCount);
 }
 
 template<typename T> std::ostream& operator<<(std::ostream& out, const Nz::Vector4<T>& vec);
@@ -8,10 +8,11 @@
 #define NAZARA_NETWORK_NETPACKET_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArrayPool.hpp>
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
 #include <Nazara/Network/Config.hpp>
-#include <mutex>
+#include <memory>
 
 namespace Nz
 {
@@ -64,8 +65,7 @@ namespace Nz
 			MemoryStream m_memoryStream;
 			UInt16 m_netCode;
 
-			static std::mutex s_availableBuffersMutex;
-			static std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> s_availableBuffers;
+			static ByteArrayPool s_bufferPool;
 	};
 }
 
@@ -10,6 +10,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
 #include <Nazara/Physics2D/Components/RigidBody2DComponent.hpp>
+#include <Nazara/Utility/Components/NodeComponent.hpp>
 #include <Nazara/Utils/TypeList.hpp>
 #include <entt/entt.hpp>
 
@@ -19,7 +20,7 @@ namespace Nz
 	{
 		public:
 			static constexpr Int64 ExecutionOrder = 0;
-			using Components = TypeList<RigidBody2DComponent, class NodeComponent>;
+			using Components = TypeList<RigidBody2DComponent, NodeComponent>;
 
 			Physics2DSystem(entt::registry& registry);
 			Physics2DSystem(const Physics2DSystem&) = delete;
@@ -10,6 +10,7 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
 #include <Nazara/Physics3D/Components/RigidBody3DComponent.hpp>
+#include <Nazara/Utility/Components/NodeComponent.hpp>
 #include <Nazara/Utils/TypeList.hpp>
 #include <entt/entt.hpp>
 
@@ -19,7 +20,7 @@ namespace Nz
 	{
 		public:
 			static constexpr Int64 ExecutionOrder = 0;
-			using Components = TypeList<RigidBody3DComponent, class NodeComponent>;
+			using Components = TypeList<RigidBody3DComponent, NodeComponent>;
 
 			Physics3DSystem(entt::registry& registry);
 			Physics3DSystem(const Physics3DSystem&) = delete;
@@ -33,6 +33,7 @@ namespace Nz
 
 			inline std::size_t GetFramebufferIndex() const;
 			const Vector2ui& GetSize() const;
+			inline LinearArena& GetTransientArena();
 			UploadPool& GetUploadPool();
 
 			inline bool IsFramebufferInvalidated() const;
@@ -30,6 +30,14 @@ namespace Nz
 		return m_size;
 	}
 
+	inline LinearArena& RenderFrame::GetTransientArena()
+	{
+		if (!m_image)
+			throw std::runtime_error("frame is either invalid or has already been presented");
+
+		return m_image->GetTransientArena();
+	}
+
 	inline bool RenderFrame::IsFramebufferInvalidated() const
 	{
 		return m_framebufferInvalidation;
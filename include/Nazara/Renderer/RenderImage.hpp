@@ -8,6 +8,7 @@
 #define NAZARA_RENDERER_RENDERIMAGE_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/LinearArena.hpp>
 #include <Nazara/Renderer/Config.hpp>
 #include <Nazara/Renderer/Enums.hpp>
 #include <functional>
@@ -31,6 +32,7 @@ namespace Nz
 
 			inline void FlushReleaseQueue();
 
+			inline LinearArena& GetTransientArena();
 			virtual UploadPool& GetUploadPool() = 0;
 
 			virtual void Present() = 0;
@@ -51,6 +53,7 @@ namespace Nz
 
 			std::vector<Releasable*> m_releaseQueue;
 			std::vector<Block> m_releaseMemoryPool;
+			LinearArena m_transientArena;
 	};
 
 	class NAZARA_RENDERER_API RenderImage::Releasable
@@ -20,6 +20,13 @@ namespace Nz
 
 		for (auto& memoryblock : m_releaseMemoryPool)
 			memoryblock.clear();
+
+		m_transientArena.Reset();
+	}
+
+	inline LinearArena& RenderImage::GetTransientArena()
+	{
+		return m_transientArena;
 	}
 
 	template<typename F>
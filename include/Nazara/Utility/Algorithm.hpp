@@ -15,6 +15,7 @@
 #include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Math/Vector4.hpp>
+#include <Nazara/Utility/Enums.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
 #include <Nazara/Utils/SparsePtr.hpp>
 
@@ -68,7 +69,8 @@ namespace Nz
 
 	NAZARA_UTILITY_API void OptimizeIndices(IndexIterator indices, UInt32 indexCount);
 
-	NAZARA_UTILITY_API void SkinLinearBlend(const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
+	NAZARA_UTILITY_API void SkinDualQuaternionBlend(const SkinningData& data, UInt32 startVertex, UInt32 vertexCount);
+	NAZARA_UTILITY_API void SkinLinearBlend(const SkinningData& data, UInt32 startVertex, UInt32 vertexCount, SkinningImplementation implementation = SkinningImplementation::Auto);
 
 	inline Vector3f TransformPositionTRS(const Vector3f& transformTranslation, const Quaternionf& transformRotation, const Vector3f& transformScale, const Vector3f& position);
 	inline Vector3f TransformNormalTRS(const Quaternionf& transformRotation, const Vector3f& transformScale, const Vector3f& normal);
@@ -9,6 +9,7 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Utility/Node.hpp>
+#include <Nazara/Utility/TransformHierarchy.hpp>
 #include <entt/entt.hpp>
 
 namespace Nz
@@ -16,18 +17,35 @@ namespace Nz
 	class NAZARA_UTILITY_API NodeComponent : public Node
 	{
 		public:
-			NodeComponent() = default;
-			NodeComponent(const NodeComponent&) = default;
-			NodeComponent(NodeComponent&&) noexcept = default;
-			~NodeComponent() = default;
+			inline NodeComponent();
+			NodeComponent(const NodeComponent& node);
+			NodeComponent(NodeComponent&& node) noexcept;
+			~NodeComponent();
+
+			void AttachToHierarchy(TransformHierarchy& hierarchy);
+
+			void DetachFromHierarchy();
+
+			inline TransformHierarchy* GetHierarchy() const;
+			inline std::size_t GetHierarchyIndex() const;
+			NodeType GetNodeType() const override;
 
 			void SetParent(entt::handle entity, bool keepDerived = false);
 			void SetParentJoint(entt::handle entity, const std::string& jointName, bool keepDerived = false);
 			void SetParentJoint(entt::handle entity, std::size_t jointIndex, bool keepDerived = false);
 			using Node::SetParent;
 
-			NodeComponent& operator=(const NodeComponent&) = default;
-			NodeComponent& operator=(NodeComponent&&) noexcept = default;
+			NodeComponent& operator=(const NodeComponent& node);
+			NodeComponent& operator=(NodeComponent&& node) noexcept;
+
+		private:
+			const NodeComponent* GetHierarchyParent() const;
+			void InvalidateNode() override;
+			void UpdateHierarchyNode();
+
+			TransformHierarchy* m_hierarchy;
+			std::size_t m_hierarchyIndex;
+			bool m_isInvalidating;
 	};
 }
 
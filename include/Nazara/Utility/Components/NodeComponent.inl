@@ -7,6 +7,30 @@
 
 namespace Nz
 {
+	inline NodeComponent::NodeComponent() :
+	m_hierarchy(nullptr),
+	m_hierarchyIndex(TransformHierarchy::InvalidNodeIndex),
+	m_isInvalidating(false)
+	{
+	}
+
+	/*!
+	* \brief Gets the transform hierarchy this node is attached to
+	* \return Pointer to the hierarchy, or nullptr if the node isn't attached to any
+	*/
+	inline TransformHierarchy* NodeComponent::GetHierarchy() const
+	{
+		return m_hierarchy;
+	}
+
+	/*!
+	* \brief Gets the index of this node in its transform hierarchy
+	* \return Node index in the hierarchy, or TransformHierarchy::InvalidNodeIndex if the node isn't attached to any
+	*/
+	inline std::size_t NodeComponent::GetHierarchyIndex() const
+	{
+		return m_hierarchyIndex;
+	}
 }
 
 #include <Nazara/Utility/DebugOff.hpp>
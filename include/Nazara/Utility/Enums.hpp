@@ -177,11 +177,12 @@ namespace Nz
 
 	enum class NodeType
 	{
-		Default,  // Node
-		Scene,    // SceneNode (Graphics)
-		Skeletal, ///TODO
+		Default,   // Node
+		Scene,     // SceneNode (Graphics)
+		Skeletal,  ///TODO
+		Component, // NodeComponent (Utility)
 
-		Max = Skeletal
+		Max = Component
 	};
 
 	enum class PixelFormatContent
@@ -337,6 +338,16 @@ namespace Nz
 		Max = Repeat
 	};
 
+	enum class SkinningImplementation
+	{
+		Auto,   // Fastest implementation supported by the processor
+		AVX,    // x64 only, requires ProcessorCap::AVX
+		Scalar,
+		SSE,    // x64 only
+
+		Max = SSE
+	};
+
 	enum class StencilOperation
 	{
 		Decrement,
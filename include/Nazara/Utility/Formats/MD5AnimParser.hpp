@@ -68,8 +68,8 @@ namespace Nz
 			std::vector<float> m_animatedComponents;
 			std::vector<Frame> m_frames;
 			std::vector<Joint> m_joints;
+			Stream* m_currentStream;
 			Stream& m_stream;
-			StreamOptionFlags m_streamFlags;
 			std::string m_currentLine;
 			bool m_keepLastLine;
 			unsigned int m_frameIndex;
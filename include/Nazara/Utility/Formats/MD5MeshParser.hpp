@@ -74,8 +74,8 @@ namespace Nz
 
 			std::vector<Joint> m_joints;
 			std::vector<Mesh> m_meshes;
+			Stream* m_currentStream;
 			Stream& m_stream;
-			StreamOptionFlags m_streamFlags;
 			std::string m_currentLine;
 			bool m_keepLastLine;
 			unsigned int m_lineCount;
@@ -7,72 +7,75 @@
 #ifndef NAZARA_UTILITY_MATERIALDATA_HPP
 #define NAZARA_UTILITY_MATERIALDATA_HPP
 
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ParameterKey.hpp>
+
 namespace Nz
 {
 	struct MaterialData
 	{
-		static constexpr const char* AlphaTest                = "MatAlphaTest";
-		static constexpr const char* AlphaTexturePath         = "MatAlphaTexturePath";
-		static constexpr const char* AlphaWrap                = "MatAlphaWrap";
-		static constexpr const char* AlphaThreshold           = "MatAlphaThreshold";
-		static constexpr const char* AmbientColor             = "MatAmbientColor";
-		static constexpr const char* BackFaceStencilCompare   = "MatBackFaceStencilCompare";
-		static constexpr const char* BackFaceStencilFail      = "MatBackFaceStencilFail";
-		static constexpr const char* BackFaceStencilMask      = "MatBackFaceStencilMask";
-		static constexpr const char* BackFaceStencilPass      = "MatBackFaceStencilPass";
-		static constexpr const char* BackFaceStencilReference = "MatBackFaceStencilReference";
-		static constexpr const char* BackFaceStencilZFail     = "MatBackFaceStencilZFail";
-		static constexpr const char* BaseColor                = "MatBaseColor";
-		static constexpr const char* BaseColorTexturePath     = "MatBaseColorTexturePath";
-		static constexpr const char* BaseColorWrap            = "MatBaseColorWrap";
-		static constexpr const char* Blending                 = "MatBlending";
-		static constexpr const char* BlendModeAlpha           = "MatBlendModeAlpha";
-		static constexpr const char* BlendModeColor           = "MatBlendModeColor";
-		static constexpr const char* BlendDstAlpha            = "MatBlendDstAlpha";
-		static constexpr const char* BlendDstColor            = "MatBlendDstColor";
-		static constexpr const char* BlendSrcAlpha            = "MatBlendSrcAlpha";
-		static constexpr const char* BlendSrcColor            = "MatBlendSrcColor";
-		static constexpr const char* CullingSide              = "MatCullingSide";
-		static constexpr const char* ColorWrite               = "MatColorWrite";
-		static constexpr const char* DepthBuffer              = "MatDepthBuffer";
-		static constexpr const char* DepthFunc                = "MatDepthfunc";
-		static constexpr const char* DepthSorting             = "MatDepthSorting";
-		static constexpr const char* DepthWrite               = "MatDepthWrite";
-		static constexpr const char* DiffuseAnisotropyLevel   = "MatDiffuseAnisotropyLevel";
-		static constexpr const char* DiffuseFilter            = "MatDiffuseFilter";
-		static constexpr const char* EmissiveTexturePath      = "MatEmissiveTexturePath";
-		static constexpr const char* EmissiveWrap             = "MatEmissiveWrap";
-		static constexpr const char* FaceCulling              = "MatFaceCulling";
-		static constexpr const char* FaceFilling              = "MatFaceFilling";
-		static constexpr const char* FilePath                 = "MatFilePath";
-		static constexpr const char* HeightTexturePath        = "MatHeightTexturePath";
-		static constexpr const char* HeightWrap               = "MatHeightWrap";
-		static constexpr const char* Lighting                 = "MatLighting";
-		static constexpr const char* LineWidth                = "MatLineWidth";
-		static constexpr const char* MetallicTexturePath      = "MatMetallicTexturePath";
-		static constexpr const char* MetallicWrap             = "MatMetallicWrap";
-		static constexpr const char* Name                     = "MatName";
-		static constexpr const char* NormalTexturePath        = "MatNormalTexturePath";
-		static constexpr const char* NormalWrap               = "MatNormalTextureWrap";
-		static constexpr const char* PointSize                = "MatPointSize";
-		static constexpr const char* RoughnessTexturePath     = "MatRoughnessTexturePath";
-		static constexpr const char* RoughnessWrap            = "MatRoughnessWrap";
-		static constexpr const char* ScissorTest              = "MatScissorTest";
-		static constexpr const char* Shininess                = "MatShininess";
-		static constexpr const char* SpecularAnisotropyLevel  = "MatSpecularAnisotropyLevel";
-		static constexpr const char* SpecularColor            = "MatSpecularColor";
-		static constexpr const char* SpecularFilter           = "MatSpecularFilter";
-		static constexpr const char* SpecularTexturePath      = "MatSpecularTexturePath";
-		static constexpr const char* SpecularWrap             = "MatSpecularWrap";
-		static constexpr const char* StencilCompare           = "MatStencilCompare";
-		static constexpr const char* StencilFail              = "MatStencilFail";
-		static constexpr const char* StencilMask              = "MatStencilMask";
-		static constexpr const char* StencilPass              = "MatStencilPass";
-		static constexpr const char* StencilReference         = "MatStencilReference";
-		static constexpr const char* StencilTest              = "MatStencilTest";
-		static constexpr const char* StencilZFail             = "MatStencilZFail";
-		static constexpr const char* Transform                = "MatTransform";
-		static constexpr const char* VertexColor              = "MatVertexColor";
+		static constexpr ParameterKey AlphaTest                = "MatAlphaTest";
+		static constexpr ParameterKey AlphaTexturePath         = "MatAlphaTexturePath";
+		static constexpr ParameterKey AlphaWrap                = "MatAlphaWrap";
+		static constexpr ParameterKey AlphaThreshold           = "MatAlphaThreshold";
+		static constexpr ParameterKey AmbientColor             = "MatAmbientColor";
+		static constexpr ParameterKey BackFaceStencilCompare   = "MatBackFaceStencilCompare";
+		static constexpr ParameterKey BackFaceStencilFail      = "MatBackFaceStencilFail";
+		static constexpr ParameterKey BackFaceStencilMask      = "MatBackFaceStencilMask";
+		static constexpr ParameterKey BackFaceStencilPass      = "MatBackFaceStencilPass";
+		static constexpr ParameterKey BackFaceStencilReference = "MatBackFaceStencilReference";
+		static constexpr ParameterKey BackFaceStencilZFail     = "MatBackFaceStencilZFail";
+		static constexpr ParameterKey BaseColor                = "MatBaseColor";
+		static constexpr ParameterKey BaseColorTexturePath     = "MatBaseColorTexturePath";
+		static constexpr ParameterKey BaseColorWrap            = "MatBaseColorWrap";
+		static constexpr ParameterKey Blending                 = "MatBlending";
+		static constexpr ParameterKey BlendModeAlpha           = "MatBlendModeAlpha";
+		static constexpr ParameterKey BlendModeColor           = "MatBlendModeColor";
+		static constexpr ParameterKey BlendDstAlpha            = "MatBlendDstAlpha";
+		static constexpr ParameterKey BlendDstColor            = "MatBlendDstColor";
+		static constexpr ParameterKey BlendSrcAlpha            = "MatBlendSrcAlpha";
+		static constexpr ParameterKey BlendSrcColor            = "MatBlendSrcColor";
+		static constexpr ParameterKey CullingSide              = "MatCullingSide";
+		static constexpr ParameterKey ColorWrite               = "MatColorWrite";
+		static constexpr ParameterKey DepthBuffer              = "MatDepthBuffer";
+		static constexpr ParameterKey DepthFunc                = "MatDepthfunc";
+		static constexpr ParameterKey DepthSorting             = "MatDepthSorting";
+		static constexpr ParameterKey DepthWrite               = "MatDepthWrite";
+		static constexpr ParameterKey DiffuseAnisotropyLevel   = "MatDiffuseAnisotropyLevel";
+		static constexpr ParameterKey DiffuseFilter            = "MatDiffuseFilter";
+		static constexpr ParameterKey EmissiveTexturePath      = "MatEmissiveTexturePath";
+		static constexpr ParameterKey EmissiveWrap             = "MatEmissiveWrap";
+		static constexpr ParameterKey FaceCulling              = "MatFaceCulling";
+		static constexpr ParameterKey FaceFilling              = "MatFaceFilling";
+		static constexpr ParameterKey FilePath                 = "MatFilePath";
+		static constexpr ParameterKey HeightTexturePath        = "MatHeightTexturePath";
+		static constexpr ParameterKey HeightWrap               = "MatHeightWrap";
+		static constexpr ParameterKey Lighting                 = "MatLighting";
+		static constexpr ParameterKey LineWidth                = "MatLineWidth";
+		static constexpr ParameterKey MetallicTexturePath      = "MatMetallicTexturePath";
+		static constexpr ParameterKey MetallicWrap             = "MatMetallicWrap";
+		static constexpr ParameterKey Name                     = "MatName";
+		static constexpr ParameterKey NormalTexturePath        = "MatNormalTexturePath";
+		static constexpr ParameterKey NormalWrap               = "MatNormalTextureWrap";
+		static constexpr ParameterKey PointSize                = "MatPointSize";
+		static constexpr ParameterKey RoughnessTexturePath     = "MatRoughnessTexturePath";
+		static constexpr ParameterKey RoughnessWrap            = "MatRoughnessWrap";
+		static constexpr ParameterKey ScissorTest              = "MatScissorTest";
+		static constexpr ParameterKey Shininess                = "MatShininess";
+		static constexpr ParameterKey SpecularAnisotropyLevel  = "MatSpecularAnisotropyLevel";
+		static constexpr ParameterKey SpecularColor            = "MatSpecularColor";
+		static constexpr ParameterKey SpecularFilter           = "MatSpecularFilter";
+		static constexpr ParameterKey SpecularTexturePath      = "MatSpecularTexturePath";
+		static constexpr ParameterKey SpecularWrap             = "MatSpecularWrap";
+		static constexpr ParameterKey StencilCompare           = "MatStencilCompare";
+		static constexpr ParameterKey StencilFail              = "MatStencilFail";
+		static constexpr ParameterKey StencilMask              = "MatStencilMask";
+		static constexpr ParameterKey StencilPass              = "MatStencilPass";
+		static constexpr ParameterKey StencilReference         = "MatStencilReference";
+		static constexpr ParameterKey StencilTest              = "MatStencilTest";
+		static constexpr ParameterKey StencilZFail             = "MatStencilZFail";
+		static constexpr ParameterKey Transform                = "MatTransform";
+		static constexpr ParameterKey VertexColor              = "MatVertexColor";
 	};
 }
 
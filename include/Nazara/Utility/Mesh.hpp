@@ -119,6 +119,7 @@ namespace Nz
 			ParameterList& GetMaterialData(std::size_t index);
 			const ParameterList& GetMaterialData(std::size_t index) const;
 			std::size_t GetMaterialCount() const;
+			std::size_t GetMemoryUsage() const;
 			Skeleton* GetSkeleton();
 			const Skeleton* GetSkeleton() const;
 			const std::shared_ptr<SubMesh>& GetSubMesh(const std::string& identifier) const;
@@ -23,6 +23,7 @@ namespace Nz
 			const Boxf& GetAABB() const override;
 			AnimationType GetAnimationType() const final;
 			const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const override;
+			std::size_t GetMemoryUsage() const override;
 			const std::shared_ptr<VertexBuffer>& GetVertexBuffer() const;
 			UInt32 GetVertexCount() const override;
 
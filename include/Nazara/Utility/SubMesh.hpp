@@ -37,6 +37,7 @@ namespace Nz
 			virtual AnimationType GetAnimationType() const = 0;
 			virtual const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const = 0;
 			std::size_t GetMaterialIndex() const;
+			virtual std::size_t GetMemoryUsage() const;
 			PrimitiveMode GetPrimitiveMode() const;
 			UInt32 GetTriangleCount() const;
 			virtual UInt32 GetVertexCount() const = 0;
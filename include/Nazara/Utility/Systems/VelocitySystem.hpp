@@ -9,6 +9,8 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utility/Components/NodeComponent.hpp>
+#include <Nazara/Utility/Components/VelocityComponent.hpp>
 #include <Nazara/Utils/TypeList.hpp>
 #include <entt/entt.hpp>
 
@@ -17,7 +19,7 @@ namespace Nz
 	class NAZARA_UTILITY_API VelocitySystem
 	{
 		public:
-			using Components = TypeList<class NodeComponent, class VelocityComponent>;
+			using Components = TypeList<NodeComponent, const VelocityComponent>;
 
 			inline VelocitySystem(entt::registry& registry);
 			VelocitySystem(const VelocitySystem&) = delete;
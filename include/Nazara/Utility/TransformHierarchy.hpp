@@ -0,0 +1,119 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_TRANSFORMHIERARCHY_HPP
+#define NAZARA_UTILITY_TRANSFORMHIERARCHY_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Utility/Config.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	class Node;
+
+	class NAZARA_UTILITY_API TransformHierarchy
+	{
+		public:
+			TransformHierarchy() = default;
+			TransformHierarchy(const TransformHierarchy&) = default;
+			TransformHierarchy(TransformHierarchy&&) noexcept = default;
+			~TransformHierarchy() = default;
+
+			void Clear();
+
+			std::size_t CreateNode(std::size_t parentIndex = InvalidNodeIndex);
+			void DestroyNode(std::size_t nodeIndex);
+
+			inline std::size_t GetDepth(std::size_t nodeIndex) const;
+			inline const Vector3f& GetLocalPosition(std::size_t nodeIndex) const;
+			inline const Quaternionf& GetLocalRotation(std::size_t nodeIndex) const;
+			inline const Vector3f& GetLocalScale(std::size_t nodeIndex) const;
+			inline std::size_t GetNodeCount() const;
+			inline std::size_t GetParent(std::size_t nodeIndex) const;
+			inline const Matrix4f& GetWorldMatrix(std::size_t nodeIndex) const;
+			inline const Vector3f& GetWorldPosition(std::size_t nodeIndex) const;
+			inline const Quaternionf& GetWorldRotation(std::size_t nodeIndex) const;
+			inline const Vector3f& GetWorldScale(std::size_t nodeIndex) const;
+
+			inline void Invalidate(std::size_t nodeIndex);
+			inline bool IsValid(std::size_t nodeIndex) const;
+
+			void SetExternalTransform(std::size_t nodeIndex, const Node* node);
+			void SetInheritance(std::size_t nodeIndex, bool inheritPosition, bool inheritRotation, bool inheritScale);
+			inline void SetLocalPosition(std::size_t nodeIndex, const Vector3f& position);
+			inline void SetLocalRotation(std::size_t nodeIndex, const Quaternionf& rotation);
+			inline void SetLocalScale(std::size_t nodeIndex, const Vector3f& scale);
+			inline void SetLocalTransform(std::size_t nodeIndex, const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale);
+			void SetParent(std::size_t nodeIndex, std::size_t parentIndex);
+
+			void Update();
+
+			inline bool WasUpdated(std::size_t nodeIndex) const;
+
+			TransformHierarchy& operator=(const TransformHierarchy&) = default;
+			TransformHierarchy& operator=(TransformHierarchy&&) noexcept = default;
+
+			static constexpr std::size_t InvalidNodeIndex = std::numeric_limits<std::size_t>::max();
+			static constexpr std::size_t ParallelUpdateGrainSize = 1024;
+
+		private:
+			enum NodeFlags : UInt8
+			{
+				InheritPosition = 1 << 0,
+				InheritRotation = 1 << 1,
+				InheritScale    = 1 << 2,
+
+				AllInheritance = InheritPosition | InheritRotation | InheritScale
+			};
+
+			void LinkToParent(std::size_t nodeIndex);
+			void SortNodes();
+			void UnlinkFromParent(std::size_t nodeIndex);
+			void UpdateSlots(std::size_t firstSlot, std::size_t lastSlot);
+			void UpdateSubtreeDepth(std::size_t nodeIndex, std::size_t depth);
+
+			// Nodes are stored by slot, sorted by depth (a parent slot is always lower than its children slots) after SortNodes
+			std::vector<Matrix4f> m_worldMatrices;
+			std::vector<Quaternionf> m_localRotations;
+			std::vector<Quaternionf> m_worldRotations;
+			std::vector<Vector3f> m_localPositions;
+			std::vector<Vector3f> m_localScales;
+			std::vector<Vector3f> m_worldPositions;
+			std::vector<Vector3f> m_worldScales;
+			std::vector<std::size_t> m_parentSlots;
+			std::vector<std::size_t> m_slotNodes;
+			std::vector<UInt8> m_flags;
+			std::vector<UInt8> m_invalidated;
+			std::vector<UInt8> m_updated;
+
+			// Per node index data (slot is InvalidNodeIndex for free node indices), children are linked through their siblings
+			std::vector<const Node*> m_nodeExternalTransforms;
+			std::vector<std::size_t> m_freeNodeIndices;
+			std::vector<std::size_t> m_nodeDepths;
+			std::vector<std::size_t> m_nodeFirstChildren;
+			std::vector<std::size_t> m_nodeNextSiblings;
+			std::vector<std::size_t> m_nodeParents;
+			std::vector<std::size_t> m_nodePreviousSiblings;
+			std::vector<std::size_t> m_nodeSlots;
+
+			// Indices of the nodes following an external Node global transform
+			std::vector<std::size_t> m_externalTransformNodes;
+
+			// First slot of each depth level (plus the slot count)
+			std::vector<std::size_t> m_levelOffsets;
+			std::size_t m_nodeCount = 0;
+			bool m_sortRequired = false;
+	};
+}
+
+#include <Nazara/Utility/TransformHierarchy.inl>
+
+#endif // NAZARA_UTILITY_TRANSFORMHIERARCHY_HPP
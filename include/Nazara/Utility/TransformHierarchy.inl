@@ -0,0 +1,141 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	inline std::size_t TransformHierarchy::GetDepth(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_nodeDepths[nodeIndex];
+	}
+
+	inline const Vector3f& TransformHierarchy::GetLocalPosition(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_localPositions[m_nodeSlots[nodeIndex]];
+	}
+
+	inline const Quaternionf& TransformHierarchy::GetLocalRotation(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_localRotations[m_nodeSlots[nodeIndex]];
+	}
+
+	inline const Vector3f& TransformHierarchy::GetLocalScale(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_localScales[m_nodeSlots[nodeIndex]];
+	}
+
+	inline std::size_t TransformHierarchy::GetNodeCount() const
+	{
+		return m_nodeCount;
+	}
+
+	inline std::size_t TransformHierarchy::GetParent(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_nodeParents[nodeIndex];
+	}
+
+	/*!
+	* \brief Gets the world matrix of a node, as computed by the last Update call
+	* \return World matrix of the node
+	*
+	* \param nodeIndex Index of the node
+	*/
+	inline const Matrix4f& TransformHierarchy::GetWorldMatrix(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_worldMatrices[m_nodeSlots[nodeIndex]];
+	}
+
+	inline const Vector3f& TransformHierarchy::GetWorldPosition(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_worldPositions[m_nodeSlots[nodeIndex]];
+	}
+
+	inline const Quaternionf& TransformHierarchy::GetWorldRotation(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_worldRotations[m_nodeSlots[nodeIndex]];
+	}
+
+	inline const Vector3f& TransformHierarchy::GetWorldScale(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_worldScales[m_nodeSlots[nodeIndex]];
+	}
+
+	/*!
+	* \brief Flags a node so its world transform (and the ones of its descendants) will be recomputed on next update
+	*
+	* \param nodeIndex Index of the node
+	*/
+	inline void TransformHierarchy::Invalidate(std::size_t nodeIndex)
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		m_invalidated[m_nodeSlots[nodeIndex]] = 1;
+	}
+
+	inline bool TransformHierarchy::IsValid(std::size_t nodeIndex) const
+	{
+		return nodeIndex < m_nodeSlots.size() && m_nodeSlots[nodeIndex] != InvalidNodeIndex;
+	}
+
+	inline void TransformHierarchy::SetLocalPosition(std::size_t nodeIndex, const Vector3f& position)
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		m_localPositions[m_nodeSlots[nodeIndex]] = position;
+
+		Invalidate(nodeIndex);
+	}
+
+	inline void TransformHierarchy::SetLocalRotation(std::size_t nodeIndex, const Quaternionf& rotation)
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		m_localRotations[m_nodeSlots[nodeIndex]] = rotation;
+
+		Invalidate(nodeIndex);
+	}
+
+	inline void TransformHierarchy::SetLocalScale(std::size_t nodeIndex, const Vector3f& scale)
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		m_localScales[m_nodeSlots[nodeIndex]] = scale;
+
+		Invalidate(nodeIndex);
+	}
+
+	inline void TransformHierarchy::SetLocalTransform(std::size_t nodeIndex, const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale)
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+
+		std::size_t slot = m_nodeSlots[nodeIndex];
+		m_localPositions[slot] = position;
+		m_localRotations[slot] = rotation;
+		m_localScales[slot] = scale;
+
+		Invalidate(nodeIndex);
+	}
+
+	/*!
+	* \brief Checks if the world transform of a node was recomputed by the last Update call
+	* \return True if the node or one of its ancestors was invalidated before the last update
+	*
+	* \param nodeIndex Index of the node
+	*/
+	inline bool TransformHierarchy::WasUpdated(std::size_t nodeIndex) const
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		return m_updated[m_nodeSlots[nodeIndex]] != 0;
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
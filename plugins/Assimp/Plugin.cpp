@@ -587,7 +587,7 @@ std::shared_ptr<Nz::SubMesh> ProcessSubMesh(const std::filesystem::path& originP
 		Nz::ParameterList matData;
 		const aiMaterial* aiMat = scene->mMaterials[meshData->mMaterialIndex];
 
-		auto ConvertColor = [&] (const char* aiKey, unsigned int aiType, unsigned int aiIndex, const char* colorKey)
+		auto ConvertColor = [&] (const char* aiKey, unsigned int aiType, unsigned int aiIndex, const Nz::ParameterKey& colorKey)
 		{
 			aiColor4D color;
 			if (aiGetMaterialColor(aiMat, aiKey, aiType, aiIndex, &color) == aiReturn_SUCCESS)
@@ -665,7 +665,7 @@ std::shared_ptr<Nz::SubMesh> ProcessSubMesh(const std::filesystem::path& originP
 			}
 		};
 
-		auto ConvertTexture = [&] (aiTextureType aiType, const char* textureKey, const char* wrapKey = nullptr)
+		auto ConvertTexture = [&] (aiTextureType aiType, const Nz::ParameterKey& textureKey, const Nz::ParameterKey* wrapKey = nullptr)
 		{
 			aiString path;
 			aiTextureMapMode mapMode[3];
@@ -713,7 +713,7 @@ std::shared_ptr<Nz::SubMesh> ProcessSubMesh(const std::filesystem::path& originP
 							break;
 					}
 
-					matData.SetParameter(wrapKey, static_cast<long long>(wrap));
+					matData.SetParameter(*wrapKey, static_cast<long long>(wrap));
 				}
 
 				return true;
@@ -729,16 +729,16 @@ std::shared_ptr<Nz::SubMesh> ProcessSubMesh(const std::filesystem::path& originP
 
 		ConvertColor(AI_MATKEY_COLOR_SPECULAR, Nz::MaterialData::SpecularColor);
 
-		if (!ConvertTexture(aiTextureType_BASE_COLOR, Nz::MaterialData::BaseColorTexturePath, Nz::MaterialData::BaseColorWrap))
-			ConvertTexture(aiTextureType_DIFFUSE, Nz::MaterialData::BaseColorTexturePath, Nz::MaterialData::BaseColorWrap);
+		if (!ConvertTexture(aiTextureType_BASE_COLOR, Nz::MaterialData::BaseColorTexturePath, &Nz::MaterialData::BaseColorWrap))
+			ConvertTexture(aiTextureType_DIFFUSE, Nz::MaterialData::BaseColorTexturePath, &Nz::MaterialData::BaseColorWrap);
 
-		ConvertTexture(aiTextureType_DIFFUSE_ROUGHNESS, Nz::MaterialData::RoughnessTexturePath, Nz::MaterialData::RoughnessWrap);
-		ConvertTexture(aiTextureType_EMISSIVE,          Nz::MaterialData::EmissiveTexturePath,  Nz::MaterialData::EmissiveWrap);
-		ConvertTexture(aiTextureType_HEIGHT,            Nz::MaterialData::HeightTexturePath,    Nz::MaterialData::HeightWrap);
-		ConvertTexture(aiTextureType_METALNESS,         Nz::MaterialData::MetallicTexturePath,  Nz::MaterialData::MetallicWrap);
-		ConvertTexture(aiTextureType_NORMALS,           Nz::MaterialData::NormalTexturePath,    Nz::MaterialData::NormalWrap);
-		ConvertTexture(aiTextureType_OPACITY,           Nz::MaterialData::AlphaTexturePath,     Nz::MaterialData::AlphaWrap);
-		ConvertTexture(aiTextureType_SPECULAR,          Nz::MaterialData::SpecularTexturePath,  Nz::MaterialData::SpecularWrap);
+		ConvertTexture(aiTextureType_DIFFUSE_ROUGHNESS, Nz::MaterialData::RoughnessTexturePath, &Nz::MaterialData::RoughnessWrap);
+		ConvertTexture(aiTextureType_EMISSIVE,          Nz::MaterialData::EmissiveTexturePath,  &Nz::MaterialData::EmissiveWrap);
+		ConvertTexture(aiTextureType_HEIGHT,            Nz::MaterialData::HeightTexturePath,    &Nz::MaterialData::HeightWrap);
+		ConvertTexture(aiTextureType_METALNESS,         Nz::MaterialData::MetallicTexturePath,  &Nz::MaterialData::MetallicWrap);
+		ConvertTexture(aiTextureType_NORMALS,           Nz::MaterialData::NormalTexturePath,    &Nz::MaterialData::NormalWrap);
+		ConvertTexture(aiTextureType_OPACITY,           Nz::MaterialData::AlphaTexturePath,     &Nz::MaterialData::AlphaWrap);
+		ConvertTexture(aiTextureType_SPECULAR,          Nz::MaterialData::SpecularTexturePath,  &Nz::MaterialData::SpecularWrap);
 
 		aiString name;
 		if (aiGetMaterialString(aiMat, AI_MATKEY_NAME, &name) == aiReturn_SUCCESS)
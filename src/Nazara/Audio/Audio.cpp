@@ -16,6 +16,7 @@
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/MemoryTracker.hpp>
 #include <Nazara/Utils/CallOnExit.hpp>
 #include <stdexcept>
 #include <Nazara/Audio/Debug.hpp>
@@ -37,6 +38,8 @@ namespace Nz
 	ModuleBase("Audio", this),
 	m_hasDummyDevice(config.allowDummyDevice)
 	{
+		NazaraMemoryScope(MemoryTag::Audio, "Audio initialization");
+
 		// Load OpenAL
 		if (!config.noAudio)
 		{
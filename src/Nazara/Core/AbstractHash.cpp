@@ -15,6 +15,8 @@
 #include <Nazara/Core/Hash/SHA384.hpp>
 #include <Nazara/Core/Hash/SHA512.hpp>
 #include <Nazara/Core/Hash/Whirlpool.hpp>
+#include <Nazara/Core/Hash/XXH128.hpp>
+#include <Nazara/Core/Hash/XXH3.hpp>
 #include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Core/Debug.hpp>
 
@@ -74,6 +76,12 @@ namespace Nz
 
 			case HashType::Whirlpool:
 				return std::make_unique<WhirlpoolHash>();
+
+			case HashType::XXH3:
+				return std::make_unique<XXH3Hash>();
+
+			case HashType::XXH128:
+				return std::make_unique<XXH128Hash>();
 		}
 
 		NazaraInternalError("Hash type not handled (0x" + NumberToString(UnderlyingCast(type), 16) + ')');
@@ -0,0 +1,363 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		constexpr std::size_t MaxBatchSize = 64;
+		constexpr std::chrono::milliseconds IdleTimeout(100);
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::AsyncLogger
+	* \brief Core class that forwards messages to another logger from a background thread
+	*
+	* Messages are copied into a fixed-size lock-free queue by the threads writing them, and a logging thread
+	* writes them in batches to the wrapped logger, so writing a message never waits for I/O.
+	*
+	* Errors (other than warnings) are written synchronously: the calling thread waits until they (and every message before them)
+	* have been written, so they are not lost if the application crashes right after.
+	*/
+
+	/*!
+	* \brief Constructs an AsyncLogger object wrapping another logger
+	*
+	* \param logger Logger messages are forwarded to
+	* \param capacity Number of messages which can wait to be written, rounded up to a power of two
+	* \param overflowPolicy What happens when a message is written while the queue is full
+	*/
+	AsyncLogger::AsyncLogger(std::unique_ptr<AbstractLogger> logger, std::size_t capacity, LogOverflowPolicy overflowPolicy) :
+	m_isRunning(true),
+	m_isThreadSleeping(false),
+	m_overflowPolicy(overflowPolicy),
+	m_repeatInterval(1000),
+	m_dequeuePosition(0),
+	m_enqueuePosition(0),
+	m_processedCount(0),
+	m_droppedMessageCount(0),
+	m_repeatCount(0),
+	m_logger(std::move(logger)),
+	m_batch(NAZARA_ANONYMOUS_NAMESPACE_PREFIX(MaxBatchSize)),
+	m_hasLastMessage(false)
+	{
+		NazaraAssert(m_logger, "invalid logger");
+
+		std::size_t slotCount = 2;
+		while (slotCount < capacity)
+			slotCount *= 2;
+
+		m_capacityMask = slotCount - 1;
+		m_slots = std::make_unique<Slot[]>(slotCount);
+		for (std::size_t i = 0; i < slotCount; ++i)
+			m_slots[i].sequence.store(i, std::memory_order_relaxed);
+
+		m_thread = std::thread(&AsyncLogger::ThreadProc, this);
+	}
+
+	/*!
+	* \brief Destructs the object, after every pending message has been written
+	*/
+	AsyncLogger::~AsyncLogger()
+	{
+		m_isRunning.store(false, std::memory_order_release);
+		{
+			std::lock_guard<std::mutex> lock(m_threadMutex);
+			m_wakeCondition.notify_one();
+		}
+
+		m_thread.join();
+	}
+
+	/*!
+	* \brief Enables the replication to the stdout of the wrapped logger
+	*
+	* \param enable If true, enables the replication
+	*/
+	void AsyncLogger::EnableStdReplication(bool enable)
+	{
+		if (IsLoggingThread())
+			return m_logger->EnableStdReplication(enable);
+
+		std::lock_guard<std::mutex> lock(m_loggerMutex);
+		m_logger->EnableStdReplication(enable);
+	}
+
+	/*!
+	* \brief Waits until every message written before this call has been forwarded to the wrapped logger
+	*/
+	void AsyncLogger::Flush()
+	{
+		if (IsLoggingThread())
+			return;
+
+		std::size_t messageCount = m_enqueuePosition.load(std::memory_order_acquire);
+
+		std::unique_lock<std::mutex> lock(m_threadMutex);
+		m_flushCondition.wait(lock, [&] { return m_processedCount.load(std::memory_order_acquire) >= messageCount; });
+	}
+
+	/*!
+	* \brief Checks whether or not the replication to the stdout of the wrapped logger is enabled
+	* \return true If replication is enabled
+	*/
+	bool AsyncLogger::IsStdReplicationEnabled() const
+	{
+		if (IsLoggingThread())
+			return m_logger->IsStdReplicationEnabled();
+
+		std::lock_guard<std::mutex> lock(m_loggerMutex);
+		return m_logger->IsStdReplicationEnabled();
+	}
+
+	/*!
+	* \brief Queues a string to be written by the logging thread
+	*
+	* \param string String to log
+	*
+	* \remark If the queue is full, the message is dropped or the calling thread waits depending on the overflow policy
+	*
+	* \see WriteError
+	*/
+	void AsyncLogger::Write(const std::string_view& string)
+	{
+		// Messages logged by the wrapped logger itself (on the logging thread) must not wait for the queue
+		if (IsLoggingThread())
+			return m_logger->Write(string);
+
+		Push(string, false, ErrorType::Normal, GetOverflowPolicy() == LogOverflowPolicy::Drop);
+	}
+
+	/*!
+	* \brief Queues an error to be written by the logging thread
+	*
+	* \param type The error type
+	* \param error The error text
+	* \param line The line the error occurred
+	* \param file The file the error occurred
+	* \param function The function the error occurred
+	*
+	* \remark Only warnings are written asynchronously, other errors wait until they have been written
+	*
+	* \see Write
+	*/
+	void AsyncLogger::WriteError(ErrorType type, const std::string_view& error, unsigned int line, const char* file, const char* function)
+	{
+		if (IsLoggingThread())
+			return m_logger->WriteError(type, error, line, file, function);
+
+		// Location is appended here as file and function may not outlive this call, the wrapped logger adds the error type prefix
+		thread_local std::string message;
+		message.assign(error);
+
+		if (line != 0 && file && function)
+		{
+			message += " (";
+			message += file;
+			message += ':';
+			message += std::to_string(line);
+			message += ": ";
+			message += function;
+			message += ')';
+		}
+
+		bool isWarning = (type == ErrorType::Warning);
+		if (!Push(message, true, type, isWarning && GetOverflowPolicy() == LogOverflowPolicy::Drop))
+			return;
+
+		if (!isWarning)
+			Flush();
+	}
+
+	bool AsyncLogger::HasPendingMessage() const
+	{
+		std::size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+		const Slot& slot = m_slots[position & m_capacityMask];
+
+		return slot.sequence.load(std::memory_order_seq_cst) == position + 1;
+	}
+
+	bool AsyncLogger::IsLoggingThread() const
+	{
+		return std::this_thread::get_id() == m_thread.get_id();
+	}
+
+	bool AsyncLogger::Push(const std::string_view& string, bool isError, ErrorType errorType, bool canDrop)
+	{
+		// Bounded multi-producer queue: each slot sequence tells whether it is free for a given enqueue position
+		Slot* slot;
+		std::size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			slot = &m_slots[position & m_capacityMask];
+			std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - position);
+			if (diff == 0)
+			{
+				if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				// Queue is full
+				if (canDrop)
+				{
+					m_droppedMessageCount.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+
+				std::this_thread::yield();
+				position = m_enqueuePosition.load(std::memory_order_relaxed);
+			}
+			else
+				position = m_enqueuePosition.load(std::memory_order_relaxed);
+		}
+
+		// Assigning reuses the slot string capacity, no allocation happens once slots have been used
+		slot->message.content.assign(string);
+		slot->message.errorType = errorType;
+		slot->message.isError = isError;
+		slot->sequence.store(position + 1, std::memory_order_seq_cst);
+
+		if (m_isThreadSleeping.load(std::memory_order_seq_cst))
+		{
+			std::lock_guard<std::mutex> lock(m_threadMutex);
+			m_wakeCondition.notify_one();
+		}
+
+		return true;
+	}
+
+	bool AsyncLogger::Pop(Message& message)
+	{
+		std::size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+		Slot& slot = m_slots[position & m_capacityMask];
+		if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+			return false;
+
+		// Swap strings so both the slot and the batch keep their capacity
+		std::swap(message.content, slot.message.content);
+		message.errorType = slot.message.errorType;
+		message.isError = slot.message.isError;
+
+		slot.sequence.store(position + m_capacityMask + 1, std::memory_order_release);
+		m_dequeuePosition.store(position + 1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	void AsyncLogger::Process(const Message& message, std::chrono::steady_clock::time_point now)
+	{
+		std::chrono::milliseconds repeatInterval = GetRepeatInterval();
+		if (repeatInterval.count() > 0 && m_hasLastMessage)
+		{
+			if (message.isError == m_lastMessage.isError && message.errorType == m_lastMessage.errorType && message.content == m_lastMessage.content)
+			{
+				m_repeatCount++;
+				if (now - m_lastMessageTime >= repeatInterval)
+				{
+					WriteRepeatSummary();
+					m_lastMessageTime = now;
+				}
+
+				return;
+			}
+		}
+
+		if (m_repeatCount > 0)
+			WriteRepeatSummary();
+
+		WriteMessage(message);
+
+		if (repeatInterval.count() > 0)
+		{
+			m_lastMessage.content.assign(message.content);
+			m_lastMessage.errorType = message.errorType;
+			m_lastMessage.isError = message.isError;
+			m_lastMessageTime = now;
+			m_hasLastMessage = true;
+		}
+		else
+			m_hasLastMessage = false;
+	}
+
+	void AsyncLogger::ThreadProc()
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		for (;;)
+		{
+			std::size_t messageCount = 0;
+			while (messageCount < m_batch.size() && Pop(m_batch[messageCount]))
+				messageCount++;
+
+			if (messageCount > 0)
+			{
+				auto now = std::chrono::steady_clock::now();
+				{
+					std::lock_guard<std::mutex> lock(m_loggerMutex);
+					for (std::size_t i = 0; i < messageCount; ++i)
+						Process(m_batch[i], now);
+				}
+
+				m_processedCount.fetch_add(messageCount, std::memory_order_release);
+				{
+					std::lock_guard<std::mutex> lock(m_threadMutex);
+					m_flushCondition.notify_all();
+				}
+
+				continue;
+			}
+
+			if (m_repeatCount > 0)
+			{
+				auto now = std::chrono::steady_clock::now();
+				if (now - m_lastMessageTime >= GetRepeatInterval())
+				{
+					std::lock_guard<std::mutex> lock(m_loggerMutex);
+					WriteRepeatSummary();
+					m_lastMessageTime = now;
+				}
+			}
+
+			std::unique_lock<std::mutex> lock(m_threadMutex);
+			m_isThreadSleeping.store(true, std::memory_order_seq_cst);
+
+			if (!HasPendingMessage())
+			{
+				if (!m_isRunning.load(std::memory_order_acquire))
+					break;
+
+				m_wakeCondition.wait_for(lock, IdleTimeout);
+			}
+
+			m_isThreadSleeping.store(false, std::memory_order_relaxed);
+		}
+
+		std::lock_guard<std::mutex> lock(m_loggerMutex);
+		if (m_repeatCount > 0)
+			WriteRepeatSummary();
+	}
+
+	void AsyncLogger::WriteMessage(const Message& message)
+	{
+		if (message.isError)
+			m_logger->WriteError(message.errorType, message.content);
+		else
+			m_logger->Write(message.content);
+	}
+
+	void AsyncLogger::WriteRepeatSummary()
+	{
+		NazaraAssert(m_repeatCount > 0, "no repeated message");
+
+		m_logger->Write("Last message repeated " + std::to_string(m_repeatCount) + " time" + ((m_repeatCount > 1) ? "s" : ""));
+		m_repeatCount = 0;
+	}
+}
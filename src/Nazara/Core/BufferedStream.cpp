@@ -0,0 +1,349 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/BufferedStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::BufferedStream
+	* \brief Core class that wraps a stream to read ahead and combine writes
+	*
+	* Reads are served from a read-ahead buffer filled by large reads on the wrapped stream, and small writes are accumulated before being written as a single block.
+	* This turns the many small reads performed by text parsers (see ReadLine) into a few large ones, which is what makes parsing files fast.
+	* Line-based parsers (such as the OBJ, MTL and MD5 ones) should therefore wrap their input stream in a BufferedStream with text mode enabled, instead of reading lines from it directly.
+	*
+	* Buffering is handled by this class and not by the Stream base class, so the StreamOption::Unbuffered flag is always set on it.
+	*
+	* If the wrapped stream is memory mapped, reads are done directly from the mapping and no read buffer is allocated.
+	*
+	* \remark The wrapped stream must outlive this object and shouldn't be used directly while it's wrapped
+	* \remark Buffered writes are written to the wrapped stream when flushed, when reading or seeking out of the write buffer and when this object is destroyed
+	*/
+
+	/*!
+	* \brief Constructs a BufferedStream wrapping a stream
+	*
+	* \param stream Stream to wrap
+	* \param readBufferSize Size of the read-ahead buffer (zero to disable read buffering)
+	* \param writeBufferSize Size of the write-combining buffer (zero to disable write buffering)
+	*/
+	BufferedStream::BufferedStream(Stream& stream, std::size_t readBufferSize, std::size_t writeBufferSize) :
+	Stream(stream.GetStreamOptions() | StreamOption::Unbuffered, stream.GetOpenMode()),
+	m_readBufferCapacity(0),
+	m_readBufferSize(0),
+	m_writeBufferCapacity(0),
+	m_writeBufferSize(0),
+	m_stream(stream),
+	m_cursor(stream.GetCursorPos()),
+	m_readBufferPos(0),
+	m_streamCursor(m_cursor),
+	m_writeBufferPos(0)
+	{
+		if (stream.IsReadable() && !stream.IsMemoryMapped() && readBufferSize > 0)
+		{
+			m_readBuffer = std::make_unique<UInt8[]>(readBufferSize);
+			m_readBufferCapacity = readBufferSize;
+		}
+
+		if (stream.IsWritable() && writeBufferSize > 0)
+		{
+			m_writeBuffer = std::make_unique<UInt8[]>(writeBufferSize);
+			m_writeBufferCapacity = writeBufferSize;
+		}
+	}
+
+	/*!
+	* \brief Destructs the object, writing pending data and moving the wrapped stream cursor to the current position
+	*/
+	BufferedStream::~BufferedStream()
+	{
+		FlushWriteBuffer();
+
+		// Data read ahead can't be given back to sequential streams
+		if (!m_stream.IsSequential())
+			SeekWrappedStream(m_cursor);
+	}
+
+	/*!
+	* \brief Writes pending buffered data to the wrapped stream
+	* \return true if all buffered data was written, false otherwise
+	*
+	* \remark Unlike Flush, this doesn't flush the wrapped stream but reports write errors
+	*/
+	bool BufferedStream::FlushWriteBuffer()
+	{
+		if (m_writeBufferSize == 0)
+			return true;
+
+		std::size_t pendingSize = m_writeBufferSize;
+		m_writeBufferSize = 0;
+
+		if (!SeekWrappedStream(m_writeBufferPos))
+		{
+			NazaraError("failed to seek wrapped stream to write buffered data");
+			return false;
+		}
+
+		std::size_t writtenSize = m_stream.Write(m_writeBuffer.get(), pendingSize);
+		m_streamCursor += writtenSize;
+
+		if (writtenSize != pendingSize)
+		{
+			NazaraError("failed to write buffered data (" + std::to_string(writtenSize) + " out of " + std::to_string(pendingSize) + " bytes written)");
+			return false;
+		}
+
+		return true;
+	}
+
+	std::filesystem::path BufferedStream::GetDirectory() const
+	{
+		return m_stream.GetDirectory();
+	}
+
+	/*!
+	* \brief Gets the mapped pointer of the wrapped stream
+	* \return Pointer to the wrapped stream content, or nullptr if it's not memory mapped
+	*
+	* \remark Buffered writes are not visible through this pointer until they are flushed
+	*/
+	const void* BufferedStream::GetMappedPointer() const
+	{
+		return m_stream.GetMappedPointer();
+	}
+
+	std::filesystem::path BufferedStream::GetPath() const
+	{
+		return m_stream.GetPath();
+	}
+
+	UInt64 BufferedStream::GetSize() const
+	{
+		UInt64 size = m_stream.GetSize();
+		if (m_writeBufferSize > 0)
+			size = std::max<UInt64>(size, m_writeBufferPos + m_writeBufferSize);
+
+		return size;
+	}
+
+	/*!
+	* \brief Reads a line from the stream
+	*
+	* Unlike Stream::ReadLine, this looks for the line separator directly in the read buffer (or in the wrapped stream mapping) instead of reading small chunks and seeking back.
+	*
+	* \param lineSize Maximum number of characters to read, or zero for no limit
+	*
+	* \return Line read from the stream
+	*
+	* \see Stream::ReadLine
+	*/
+	std::string BufferedStream::ReadLine(unsigned int lineSize)
+	{
+		NazaraAssert(IsReadable(), "Stream is not readable");
+
+		if (lineSize != 0 || (m_readBufferCapacity == 0 && !m_stream.IsMemoryMapped()))
+			return Stream::ReadLine(lineSize);
+
+		if (!FlushWriteBuffer())
+			return {};
+
+		std::string line;
+		for (;;)
+		{
+			const UInt8* data;
+			std::size_t availableSize;
+			if (const UInt8* mappedPtr = static_cast<const UInt8*>(m_stream.GetMappedPointer()))
+			{
+				UInt64 streamSize = m_stream.GetSize();
+				if (m_cursor >= streamSize)
+					break;
+
+				data = &mappedPtr[m_cursor];
+				availableSize = static_cast<std::size_t>(streamSize - m_cursor);
+			}
+			else
+			{
+				if (m_cursor < m_readBufferPos || m_cursor >= m_readBufferPos + m_readBufferSize)
+				{
+					if (!FillReadBuffer())
+						break;
+				}
+
+				std::size_t offset = static_cast<std::size_t>(m_cursor - m_readBufferPos);
+				data = &m_readBuffer[offset];
+				availableSize = m_readBufferSize - offset;
+			}
+
+			if (const void* separator = std::memchr(data, '\n', availableSize))
+			{
+				std::size_t length = static_cast<const UInt8*>(separator) - data;
+				line.append(reinterpret_cast<const char*>(data), length);
+				m_cursor += length + 1;
+				break;
+			}
+
+			line.append(reinterpret_cast<const char*>(data), availableSize);
+			m_cursor += availableSize;
+		}
+
+		if (m_streamOptions & StreamOption::Text && !line.empty() && line.back() == '\r')
+			line.pop_back();
+
+		return line;
+	}
+
+	bool BufferedStream::FillReadBuffer()
+	{
+		m_readBufferPos = m_cursor;
+		m_readBufferSize = 0;
+
+		if (!SeekWrappedStream(m_cursor))
+			return false;
+
+		m_readBufferSize = m_stream.Read(m_readBuffer.get(), m_readBufferCapacity);
+		m_streamCursor += m_readBufferSize;
+
+		return m_readBufferSize > 0;
+	}
+
+	void BufferedStream::FlushStream()
+	{
+		FlushWriteBuffer();
+		m_stream.Flush();
+	}
+
+	std::size_t BufferedStream::ReadBlock(void* buffer, std::size_t size)
+	{
+		if (!FlushWriteBuffer())
+			return 0;
+
+		UInt8* ptr = static_cast<UInt8*>(buffer);
+
+		if (const UInt8* mappedPtr = static_cast<const UInt8*>(m_stream.GetMappedPointer()))
+		{
+			UInt64 streamSize = m_stream.GetSize();
+			if (m_cursor >= streamSize)
+				return 0;
+
+			std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, streamSize - m_cursor));
+			if (ptr)
+				std::memcpy(ptr, &mappedPtr[m_cursor], readSize);
+
+			m_cursor += readSize;
+			return readSize;
+		}
+
+		std::size_t readSize = 0;
+		while (size > 0)
+		{
+			if (m_cursor >= m_readBufferPos && m_cursor < m_readBufferPos + m_readBufferSize)
+			{
+				std::size_t offset = static_cast<std::size_t>(m_cursor - m_readBufferPos);
+				std::size_t availableSize = std::min(size, m_readBufferSize - offset);
+				if (ptr)
+				{
+					std::memcpy(ptr, &m_readBuffer[offset], availableSize);
+					ptr += availableSize;
+				}
+
+				m_cursor += availableSize;
+				readSize += availableSize;
+				size -= availableSize;
+			}
+			else if (size >= m_readBufferCapacity)
+			{
+				// Large reads don't benefit from buffering
+				if (!SeekWrappedStream(m_cursor))
+					break;
+
+				std::size_t blockSize = m_stream.Read(ptr, size);
+				m_cursor += blockSize;
+				m_streamCursor += blockSize;
+				readSize += blockSize;
+				break;
+			}
+			else if (!FillReadBuffer())
+				break;
+		}
+
+		return readSize;
+	}
+
+	bool BufferedStream::SeekStreamCursor(UInt64 offset)
+	{
+		// The wrapped stream cursor is only moved when it's accessed
+		m_cursor = offset;
+		return true;
+	}
+
+	bool BufferedStream::SeekWrappedStream(UInt64 offset)
+	{
+		if (m_streamCursor == offset)
+			return true;
+
+		if (!m_stream.SetCursorPos(offset))
+			return false;
+
+		m_streamCursor = offset;
+		return true;
+	}
+
+	UInt64 BufferedStream::TellStreamCursor() const
+	{
+		return m_cursor;
+	}
+
+	bool BufferedStream::TestStreamEnd() const
+	{
+		if (m_cursor >= m_readBufferPos && m_cursor < m_readBufferPos + m_readBufferSize)
+			return false;
+
+		if (m_stream.IsSequential())
+			return m_writeBufferSize == 0 && m_stream.EndOfStream();
+
+		return m_cursor >= GetSize();
+	}
+
+	std::size_t BufferedStream::WriteBlock(const void* buffer, std::size_t size)
+	{
+		// Read-ahead data may be overwritten
+		m_readBufferSize = 0;
+
+		if (m_writeBufferSize > 0 && (m_cursor != m_writeBufferPos + m_writeBufferSize || m_writeBufferSize + size > m_writeBufferCapacity))
+		{
+			if (!FlushWriteBuffer())
+				return 0;
+		}
+
+		if (size >= m_writeBufferCapacity)
+		{
+			// Large writes don't benefit from buffering
+			if (!SeekWrappedStream(m_cursor))
+				return 0;
+
+			std::size_t writtenSize = m_stream.Write(buffer, size);
+			m_cursor += writtenSize;
+			m_streamCursor += writtenSize;
+
+			return writtenSize;
+		}
+
+		NazaraAssert(buffer, "Invalid buffer");
+
+		if (m_writeBufferSize == 0)
+			m_writeBufferPos = m_cursor;
+
+		std::memcpy(&m_writeBuffer[m_writeBufferSize], buffer, size);
+		m_writeBufferSize += size;
+		m_cursor += size;
+
+		return size;
+	}
+}
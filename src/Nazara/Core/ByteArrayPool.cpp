@@ -0,0 +1,422 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ByteArrayPool.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <array>
+#include <atomic>
+#include <iterator>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		constexpr std::size_t ThreadCacheSlotCount = 4;
+
+		// Smallest bucket whose byte arrays all have at least the requested capacity
+		std::size_t GetAllocationBucket(std::size_t capacity)
+		{
+			std::size_t bucketIndex = 0;
+			std::size_t bucketCapacity = ByteArrayPool::MinPooledCapacity;
+			while (bucketCapacity < capacity)
+			{
+				bucketCapacity <<= 1;
+				bucketIndex++;
+			}
+
+			return bucketIndex;
+		}
+
+		// Largest bucket whose capacity is not greater than the byte array one
+		std::size_t GetReturnBucket(std::size_t capacity)
+		{
+			std::size_t bucketIndex = 0;
+			std::size_t bucketCapacity = ByteArrayPool::MinPooledCapacity;
+			while (bucketIndex + 1 < ByteArrayPool::BucketCount && (bucketCapacity << 1) <= capacity)
+			{
+				bucketCapacity <<= 1;
+				bucketIndex++;
+			}
+
+			return bucketIndex;
+		}
+	}
+
+	struct ByteArrayPool::State
+	{
+		struct Batch
+		{
+			std::vector<ByteArray> byteArrays;
+			Batch* next;
+		};
+
+		State() :
+		generation(0),
+		hitCount(0),
+		missCount(0),
+		peakPooledBytes(0),
+		pooledBytes(0)
+		{
+			for (auto& head : freeLists)
+				head.store(nullptr, std::memory_order_relaxed);
+		}
+
+		~State()
+		{
+			Drain();
+		}
+
+		void AddPooledBytes(std::size_t size)
+		{
+			std::size_t newPooledBytes = pooledBytes.fetch_add(size, std::memory_order_relaxed) + size;
+
+			std::size_t peak = peakPooledBytes.load(std::memory_order_relaxed);
+			while (newPooledBytes > peak && !peakPooledBytes.compare_exchange_weak(peak, newPooledBytes, std::memory_order_relaxed));
+		}
+
+		std::size_t Drain()
+		{
+			std::size_t freedBytes = 0;
+			for (auto& head : freeLists)
+			{
+				Batch* batch = head.exchange(nullptr, std::memory_order_acquire);
+				while (batch)
+				{
+					for (const ByteArray& byteArray : batch->byteArrays)
+						freedBytes += byteArray.GetCapacity();
+
+					Batch* next = batch->next;
+					delete batch;
+					batch = next;
+				}
+			}
+
+			return freedBytes;
+		}
+
+		Batch* Pop(std::size_t bucketIndex)
+		{
+			// Taking the whole list instead of its head only makes this immune to the ABA problem, the remaining batches are pushed back
+			Batch* batch = freeLists[bucketIndex].exchange(nullptr, std::memory_order_acquire);
+			if (!batch)
+				return nullptr;
+
+			if (Batch* remaining = batch->next)
+			{
+				batch->next = nullptr;
+				Push(bucketIndex, remaining);
+			}
+
+			return batch;
+		}
+
+		void Push(std::size_t bucketIndex, Batch* first)
+		{
+			Batch* last = first;
+			while (last->next)
+				last = last->next;
+
+			auto& head = freeLists[bucketIndex];
+			Batch* expected = head.load(std::memory_order_relaxed);
+			do
+			{
+				last->next = expected;
+			}
+			while (!head.compare_exchange_weak(expected, first, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		void RemovePooledBytes(std::size_t size)
+		{
+			pooledBytes.fetch_sub(size, std::memory_order_relaxed);
+		}
+
+		std::array<std::atomic<Batch*>, BucketCount> freeLists;
+		std::atomic<UInt64> generation;
+		std::atomic<UInt64> hitCount;
+		std::atomic<UInt64> missCount;
+		std::atomic_size_t peakPooledBytes;
+		std::atomic_size_t pooledBytes;
+	};
+
+	struct ByteArrayPool::ThreadCache
+	{
+		struct Slot
+		{
+			std::array<std::vector<ByteArray>, BucketCount> buckets;
+			std::shared_ptr<State> state;
+			UInt64 generation = 0;
+			UInt64 lastUse = 0;
+		};
+
+		~ThreadCache()
+		{
+			for (Slot& slot : slots)
+				Release(slot);
+		}
+
+		Slot& GetSlot(const std::shared_ptr<State>& state)
+		{
+			Slot* leastRecentlyUsed = &slots[0];
+			for (Slot& slot : slots)
+			{
+				if (slot.state == state)
+				{
+					// Byte arrays cached before the pool was cleared have to be released
+					UInt64 generation = state->generation.load(std::memory_order_acquire);
+					if (slot.generation != generation)
+					{
+						Discard(slot);
+						slot.generation = generation;
+					}
+
+					slot.lastUse = ++useCounter;
+					return slot;
+				}
+
+				if (slot.lastUse < leastRecentlyUsed->lastUse)
+					leastRecentlyUsed = &slot;
+			}
+
+			Release(*leastRecentlyUsed);
+
+			leastRecentlyUsed->state = state;
+			leastRecentlyUsed->generation = state->generation.load(std::memory_order_acquire);
+			leastRecentlyUsed->lastUse = ++useCounter;
+
+			return *leastRecentlyUsed;
+		}
+
+		void Release(const State* state)
+		{
+			for (Slot& slot : slots)
+			{
+				if (slot.state.get() == state)
+				{
+					Release(slot);
+					break;
+				}
+			}
+		}
+
+		static void Discard(Slot& slot)
+		{
+			for (auto& cache : slot.buckets)
+			{
+				for (const ByteArray& byteArray : cache)
+					slot.state->RemovePooledBytes(byteArray.GetCapacity());
+
+				cache.clear();
+			}
+		}
+
+		// Gives the cached byte arrays back to the pool freelists (unless it was cleared in-between) so other threads can use them
+		static void Release(Slot& slot)
+		{
+			if (!slot.state)
+				return;
+
+			if (slot.generation != slot.state->generation.load(std::memory_order_acquire))
+				Discard(slot);
+			else
+			{
+				for (std::size_t bucketIndex = 0; bucketIndex < BucketCount; ++bucketIndex)
+				{
+					auto& cache = slot.buckets[bucketIndex];
+					if (cache.empty())
+						continue;
+
+					State::Batch* batch = new State::Batch;
+					batch->byteArrays = std::move(cache);
+					batch->next = nullptr;
+
+					slot.state->Push(bucketIndex, batch);
+
+					cache.clear();
+				}
+			}
+
+			slot.state.reset();
+			slot.lastUse = 0;
+		}
+
+		std::array<Slot, NAZARA_ANONYMOUS_NAMESPACE_PREFIX(ThreadCacheSlotCount)> slots;
+		UInt64 useCounter = 0;
+	};
+
+	/*!
+	* \ingroup core
+	* \class Nz::ByteArrayPool
+	* \brief Core class that recycles byte arrays to avoid reallocating them
+	*
+	* Byte arrays are sorted in power-of-two size classes (from MinPooledCapacity to MaxPooledCapacity), a byte array taken
+	* from the pool always has at least the capacity of the size class the requested capacity is rounded up to.
+	*
+	* This class is thread-safe: each thread keeps a small cache of byte arrays per size class, and exchanges them in batches
+	* with lock-free freelists shared by every thread when its cache is empty or full.
+	*/
+
+	/*!
+	* \brief Constructs an empty ByteArrayPool object
+	*/
+	ByteArrayPool::ByteArrayPool() :
+	m_state(std::make_shared<State>())
+	{
+	}
+
+	/*!
+	* \brief Destructs the object and frees the byte arrays it holds
+	*
+	* \see Clear
+	*/
+	ByteArrayPool::~ByteArrayPool()
+	{
+		if (m_state)
+			Clear();
+	}
+
+	/*!
+	* \brief Frees the byte arrays held by the pool
+	*
+	* \remark Byte arrays cached by other threads are freed the next time these threads use the pool (or when they exit)
+	*/
+	void ByteArrayPool::Clear()
+	{
+		NazaraAssert(m_state, "invalid pool");
+
+		m_state->generation.fetch_add(1, std::memory_order_acq_rel);
+		GetThreadCache().Release(m_state.get());
+		m_state->RemovePooledBytes(m_state->Drain());
+	}
+
+	/*!
+	* \brief Takes a byte array from the pool, or allocates one if none is available
+	* \return Empty byte array with at least GetPooledCapacity(capacity) bytes of capacity
+	*
+	* \param capacity Minimum capacity of the byte array
+	*/
+	ByteArray ByteArrayPool::GetByteArray(std::size_t capacity)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(m_state, "invalid pool");
+
+		if (capacity > MaxPooledCapacity)
+		{
+			m_state->missCount.fetch_add(1, std::memory_order_relaxed);
+
+			ByteArray byteArray;
+			byteArray.Reserve(capacity);
+
+			return byteArray;
+		}
+
+		std::size_t bucketIndex = GetAllocationBucket(capacity);
+
+		auto& cache = GetThreadCache().GetSlot(m_state).buckets[bucketIndex];
+		if (cache.empty())
+		{
+			if (State::Batch* batch = m_state->Pop(bucketIndex))
+			{
+				cache = std::move(batch->byteArrays);
+				delete batch;
+			}
+		}
+
+		if (!cache.empty())
+		{
+			ByteArray byteArray = std::move(cache.back());
+			cache.pop_back();
+
+			m_state->hitCount.fetch_add(1, std::memory_order_relaxed);
+			m_state->RemovePooledBytes(byteArray.GetCapacity());
+
+			return byteArray;
+		}
+
+		m_state->missCount.fetch_add(1, std::memory_order_relaxed);
+
+		ByteArray byteArray;
+		byteArray.Reserve(MinPooledCapacity << bucketIndex);
+
+		return byteArray;
+	}
+
+	/*!
+	* \brief Gets the usage statistics of the pool
+	* \return Number of requests served by the pool (hits) or by an allocation (misses), and bytes held by the pool
+	*/
+	auto ByteArrayPool::GetStats() const -> Stats
+	{
+		NazaraAssert(m_state, "invalid pool");
+
+		Stats stats;
+		stats.hitCount = m_state->hitCount.load(std::memory_order_relaxed);
+		stats.missCount = m_state->missCount.load(std::memory_order_relaxed);
+		stats.peakPooledBytes = m_state->peakPooledBytes.load(std::memory_order_relaxed);
+		stats.pooledBytes = m_state->pooledBytes.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	/*!
+	* \brief Resets hit and miss counters, and peak pooled bytes to the current pooled bytes
+	*/
+	void ByteArrayPool::ResetStats()
+	{
+		NazaraAssert(m_state, "invalid pool");
+
+		m_state->hitCount.store(0, std::memory_order_relaxed);
+		m_state->missCount.store(0, std::memory_order_relaxed);
+		m_state->peakPooledBytes.store(m_state->pooledBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Gives a byte array back to the pool
+	*
+	* \param byteArray Byte array to recycle, its content is cleared but its buffer is kept
+	*
+	* \remark Byte arrays with a capacity lower than MinPooledCapacity or greater than MaxPooledCapacity are freed instead
+	*/
+	void ByteArrayPool::ReturnByteArray(ByteArray byteArray)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(m_state, "invalid pool");
+
+		std::size_t capacity = byteArray.GetCapacity();
+		if (capacity < MinPooledCapacity || capacity > MaxPooledCapacity)
+			return;
+
+		std::size_t bucketIndex = GetReturnBucket(capacity);
+
+		byteArray.Clear(true);
+
+		auto& cache = GetThreadCache().GetSlot(m_state).buckets[bucketIndex];
+		cache.push_back(std::move(byteArray));
+
+		m_state->AddPooledBytes(capacity);
+
+		if (cache.size() >= ThreadCacheCapacity)
+		{
+			// Move the oldest half of the cache to the shared freelist
+			constexpr std::size_t SpillCount = ThreadCacheCapacity / 2;
+
+			State::Batch* batch = new State::Batch;
+			batch->byteArrays.assign(std::make_move_iterator(cache.begin()), std::make_move_iterator(cache.begin() + SpillCount));
+			batch->next = nullptr;
+
+			cache.erase(cache.begin(), cache.begin() + SpillCount);
+
+			m_state->Push(bucketIndex, batch);
+		}
+	}
+
+	auto ByteArrayPool::GetThreadCache() -> ThreadCache&
+	{
+		thread_local ThreadCache threadCache;
+		return threadCache;
+	}
+}
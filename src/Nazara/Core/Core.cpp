@@ -7,6 +7,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/MemoryTracker.hpp>
 #include <Nazara/Core/PluginLoader.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Debug.hpp>
@@ -22,6 +23,8 @@ namespace Nz
 	Core::Core(Config /*config*/) :
 	ModuleBase("Core", this, ModuleBase::NoLog{})
 	{
+		NazaraMemoryScope(MemoryTag::Core, "Core initialization");
+
 		Log::Initialize();
 
 		LogInit();
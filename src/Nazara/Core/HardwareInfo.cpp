@@ -8,6 +8,8 @@
 #include <frozen/unordered_map.h>
 #include <algorithm>
 #include <cstring>
+#include <set>
+#include <utility>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 	#include <Nazara/Core/Win32/HardwareInfoImpl.hpp>
@@ -104,9 +106,28 @@ namespace Nz
 	HardwareInfo::HardwareInfo()
 	{
 		FetchCPUInfo();
+		FetchCPUTopology();
 		FetchMemoryInfo();
 	}
 
+	/*!
+	* \brief Returns the number of physical cores of a given type
+	* \return Physical core count
+	*
+	* \param coreType Core type, ProcessorCoreType::Unknown counts cores whose type couldn't be determined
+	*/
+	unsigned int HardwareInfo::GetCpuCoreCount(ProcessorCoreType coreType) const
+	{
+		std::set<unsigned int> cores;
+		for (const LogicalProcessor& logicalProcessor : m_cpuLogicalProcessors)
+		{
+			if (logicalProcessor.coreType == coreType)
+				cores.insert(logicalProcessor.coreIndex);
+		}
+
+		return static_cast<unsigned int>(cores.size());
+	}
+
 	std::string_view HardwareInfo::GetCpuVendorName() const
 	{
 		NAZARA_USE_ANONYMOUS_NAMESPACE
@@ -119,11 +140,124 @@ namespace Nz
 		return HardwareInfoImpl::Cpuid(functionId, subFunctionId, result);
 	}
 
+	/*!
+	* \brief Gets the logical processors the calling thread is allowed to run on
+	* \return Indices of the logical processors (see LogicalProcessor::index), empty if the affinity couldn't be retrieved or isn't supported by the platform (macOS)
+	*
+	* \remark On Windows, only logical processors of the current processor group are returned
+	*/
+	std::vector<unsigned int> HardwareInfo::GetCurrentThreadAffinity()
+	{
+		std::vector<unsigned int> logicalProcessorIndices;
+		if (!HardwareInfoImpl::GetCurrentThreadAffinity(logicalProcessorIndices))
+			return {};
+
+		return logicalProcessorIndices;
+	}
+
 	bool HardwareInfo::IsCpuidSupported()
 	{
 		return HardwareInfoImpl::IsCpuidSupported();
 	}
 
+	/*!
+	* \brief Restricts the calling thread to run on a single logical processor
+	* \return True on success
+	*
+	* \param logicalProcessorIndex Index of the logical processor (see LogicalProcessor::index)
+	*/
+	bool HardwareInfo::SetCurrentThreadAffinity(unsigned int logicalProcessorIndex)
+	{
+		return HardwareInfoImpl::SetCurrentThreadAffinity({ logicalProcessorIndex });
+	}
+
+	/*!
+	* \brief Restricts the calling thread to run on a set of logical processors
+	* \return True on success, false if the affinity couldn't be changed or isn't supported by the platform (macOS)
+	*
+	* \param logicalProcessorIndices Indices of the logical processors (see LogicalProcessor::index), must not be empty
+	*
+	* \remark On Windows, all logical processors must belong to the same processor group (64 logical processors)
+	*/
+	bool HardwareInfo::SetCurrentThreadAffinity(const std::vector<unsigned int>& logicalProcessorIndices)
+	{
+		NazaraAssert(!logicalProcessorIndices.empty(), "logical processor list must not be empty");
+
+		return HardwareInfoImpl::SetCurrentThreadAffinity(logicalProcessorIndices);
+	}
+
+	void HardwareInfo::FetchCPUCacheInfo()
+	{
+		if (!HardwareInfoImpl::IsCpuidSupported())
+			return;
+
+		std::array<UInt32, 4> registers;
+
+		UInt32& eax = registers[0];
+		UInt32& ebx = registers[1];
+		UInt32& ecx = registers[2];
+		UInt32& edx = registers[3];
+
+		HardwareInfoImpl::Cpuid(0, 0, registers.data());
+		UInt32 maxSupportedFunction = eax;
+
+		HardwareInfoImpl::Cpuid(0x80000000, 0, registers.data());
+		UInt32 maxSupportedExtendedFunction = eax;
+
+		bool hasTopologyExtensions = false;
+		if (maxSupportedExtendedFunction >= 0x80000001)
+		{
+			HardwareInfoImpl::Cpuid(0x80000001, 0, registers.data());
+			hasTopologyExtensions = (ecx & (1U << 22)) != 0;
+		}
+
+		// Deterministic cache parameters (function 4 on Intel, 0x8000001D on AMD), one subfunction per cache
+		UInt32 cacheFunction = 0;
+		if ((m_cpuVendor == ProcessorVendor::AMD || m_cpuVendor == ProcessorVendor::Hygon) && hasTopologyExtensions && maxSupportedExtendedFunction >= 0x8000001D)
+			cacheFunction = 0x8000001D;
+		else if (m_cpuVendor == ProcessorVendor::Intel && maxSupportedFunction >= 4)
+			cacheFunction = 4;
+
+		if (cacheFunction != 0)
+		{
+			for (UInt32 subFunction = 0; subFunction < 16; ++subFunction)
+			{
+				HardwareInfoImpl::Cpuid(cacheFunction, subFunction, registers.data());
+
+				UInt32 cacheType = eax & 0x1F;
+				if (cacheType == 0) //< no more caches
+					break;
+
+				UInt32 cacheLevel = (eax >> 5) & 0x7;
+				if ((cacheType != 1 && cacheType != 3) || cacheLevel < 1 || cacheLevel > MaxCacheLevel) //< keep data and unified caches
+					continue;
+
+				UInt32 lineSize = (ebx & 0xFFF) + 1;
+				UInt32 partitions = ((ebx >> 12) & 0x3FF) + 1;
+				UInt32 ways = ((ebx >> 22) & 0x3FF) + 1;
+				UInt32 sets = ecx + 1;
+
+				CacheInfo& cache = m_cpuCaches[cacheLevel - 1];
+				cache.size = UInt64(ways) * partitions * lineSize * sets;
+				cache.lineSize = lineSize;
+				cache.sharingThreadCount = ((eax >> 14) & 0xFFF) + 1; //< maximum, not the actual count
+			}
+		}
+		else if (m_cpuVendor == ProcessorVendor::AMD && maxSupportedExtendedFunction >= 0x80000006)
+		{
+			// Legacy AMD cache descriptors
+			HardwareInfoImpl::Cpuid(0x80000005, 0, registers.data());
+			m_cpuCaches[0].size = UInt64((ecx >> 24) & 0xFF) * 1024;
+			m_cpuCaches[0].lineSize = ecx & 0xFF;
+
+			HardwareInfoImpl::Cpuid(0x80000006, 0, registers.data());
+			m_cpuCaches[1].size = UInt64((ecx >> 16) & 0xFFFF) * 1024;
+			m_cpuCaches[1].lineSize = ecx & 0xFF;
+			m_cpuCaches[2].size = UInt64((edx >> 18) & 0x3FFF) * 512 * 1024;
+			m_cpuCaches[2].lineSize = (m_cpuCaches[2].size != 0) ? (edx & 0xFF) : 0;
+		}
+	}
+
 	void HardwareInfo::FetchCPUInfo()
 	{
 		NAZARA_USE_ANONYMOUS_NAMESPACE
@@ -158,7 +292,8 @@ namespace Nz
 		else
 			m_cpuVendor = ProcessorVendor::Unknown;
 
-		if (eax >= 1)
+		UInt32 maxSupportedFunction = eax;
+		if (maxSupportedFunction >= 1)
 		{
 			// Retrieval of certain capacities of the processor (ECX and EDX, function 1)
 			HardwareInfoImpl::Cpuid(1, 0, registers.data());
@@ -177,6 +312,14 @@ namespace Nz
 			m_cpuCapabilities[UnderlyingCast(ProcessorCap::SSE42)]  = (ecx & (1U << 20)) != 0;
 		}
 
+		if (maxSupportedFunction >= 7)
+		{
+			// Retrieval of extended features (EBX, function 7 subfunction 0)
+			HardwareInfoImpl::Cpuid(7, 0, registers.data());
+
+			m_cpuCapabilities[UnderlyingCast(ProcessorCap::SHA)] = (ebx & (1U << 29)) != 0;
+		}
+
 		// Retrieval of biggest extended function handled (EAX, function 0x80000000)
 		HardwareInfoImpl::Cpuid(0x80000000, 0, registers.data());
 
@@ -208,6 +351,62 @@ namespace Nz
 		}
 	}
 
+	void HardwareInfo::FetchCPUTopology()
+	{
+		m_cpuCaches.fill({});
+		m_cpuLogicalProcessors.clear();
+
+		if (!HardwareInfoImpl::FetchProcessorTopology(m_cpuLogicalProcessors, m_cpuCaches) || m_cpuLogicalProcessors.empty())
+		{
+			// Consider each logical processor to be a core of its own
+			m_cpuLogicalProcessors.clear();
+			for (unsigned int i = 0; i < m_cpuThreadCount; ++i)
+				m_cpuLogicalProcessors.push_back({ i, i, 0, 0, ProcessorCoreType::Unknown });
+		}
+
+		std::sort(m_cpuLogicalProcessors.begin(), m_cpuLogicalProcessors.end(), [](const LogicalProcessor& lhs, const LogicalProcessor& rhs)
+		{
+			return lhs.index < rhs.index;
+		});
+
+		bool hasEfficiencyCores = false;
+		bool hasPerformanceCores = false;
+		std::set<unsigned int> cores;
+		std::set<unsigned int> numaNodes;
+		for (const LogicalProcessor& logicalProcessor : m_cpuLogicalProcessors)
+		{
+			cores.insert(logicalProcessor.coreIndex);
+			numaNodes.insert(logicalProcessor.numaNode);
+
+			hasEfficiencyCores |= (logicalProcessor.coreType == ProcessorCoreType::Efficiency);
+			hasPerformanceCores |= (logicalProcessor.coreType == ProcessorCoreType::Performance);
+		}
+
+		m_cpuCoreCount = static_cast<unsigned int>(cores.size());
+		m_numaNodeCount = static_cast<unsigned int>(numaNodes.size());
+		m_isCpuHybrid = hasEfficiencyCores && hasPerformanceCores;
+
+		if (!m_isCpuHybrid && HardwareInfoImpl::IsCpuidSupported())
+		{
+			// CPUID reports hybrid processors (EDX bit 15, function 7) even when the OS didn't tell us which core is which
+			std::array<UInt32, 4> registers;
+			HardwareInfoImpl::Cpuid(0, 0, registers.data());
+			if (registers[0] >= 7)
+			{
+				HardwareInfoImpl::Cpuid(7, 0, registers.data());
+				if (registers[3] & (1U << 15))
+				{
+					m_isCpuHybrid = true;
+					for (LogicalProcessor& logicalProcessor : m_cpuLogicalProcessors)
+						logicalProcessor.coreType = ProcessorCoreType::Unknown;
+				}
+			}
+		}
+
+		if (m_cpuCaches[0].size == 0)
+			FetchCPUCacheInfo();
+	}
+
 	void HardwareInfo::FetchMemoryInfo()
 	{
 		m_systemTotalMemory = HardwareInfoImpl::GetTotalMemory();
@@ -3,7 +3,17 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Hash/CRC32.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Core.hpp>
 #include <Nazara/Utils/Endianness.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#ifdef NAZARA_PLATFORM_x64
+#include <nmmintrin.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -59,17 +69,76 @@ namespace Nz
 			0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
 			0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
 		};
+
+		constexpr std::size_t SliceCount = 8;
+
+		// Slicing-by-8: table k gives the CRC contribution of a byte followed by k zero bytes, letting us process 8 bytes per iteration
+		void crc32_build_slicing_tables(UInt32* tables)
+		{
+			for (std::size_t i = 0; i < 256; ++i)
+			{
+				for (std::size_t j = 1; j < SliceCount; ++j)
+				{
+					UInt32 previous = tables[(j - 1) * 256 + i];
+					tables[j * 256 + i] = (previous >> 8) ^ tables[previous & 0xFF];
+				}
+			}
+		}
+
+		const UInt32* crc32_default_tables()
+		{
+			static const std::array<UInt32, SliceCount * 256> tables = []
+			{
+				std::array<UInt32, SliceCount * 256> defaultTables;
+				std::copy(std::begin(crc32_table), std::end(crc32_table), defaultTables.begin());
+				crc32_build_slicing_tables(defaultTables.data());
+
+				return defaultTables;
+			}();
+
+			return tables.data();
+		}
+
+		UInt32 crc32_read_le32(const UInt8* data)
+		{
+			return UInt32(data[0]) | (UInt32(data[1]) << 8) | (UInt32(data[2]) << 16) | (UInt32(data[3]) << 24);
+		}
+
+#ifdef NAZARA_PLATFORM_x64
+		NAZARA_TARGET_FEATURES("sse4.2")
+		UInt32 crc32c_sse42(UInt32 crc, const UInt8* data, std::size_t len)
+		{
+			// The crc32 instruction (SSE 4.2) implements the Castagnoli polynomial
+			UInt64 crc64 = crc;
+			while (len >= 8)
+			{
+				UInt64 value;
+				std::memcpy(&value, data, sizeof(value));
+				crc64 = _mm_crc32_u64(crc64, value);
+
+				data += 8;
+				len -= 8;
+			}
+
+			crc = static_cast<UInt32>(crc64);
+			while (len--)
+				crc = _mm_crc32_u8(crc, *data++);
+
+			return crc;
+		}
+#endif
 	}
 
-	CRC32Hash::CRC32Hash(UInt32 polynomial)
+	CRC32Hash::CRC32Hash(UInt32 polynomial) :
+	m_hardwareAccelerated(false)
 	{
 		NAZARA_USE_ANONYMOUS_NAMESPACE
 
 		if (polynomial == DefaultPolynomial)
-			m_table = crc32_table;
+			m_table = crc32_default_tables();
 		else
 		{
-			UInt32* table = new UInt32[256];
+			UInt32* table = new UInt32[SliceCount * 256];
 
 			for (unsigned int i = 0; i < 256; ++i)
 			{
@@ -80,22 +149,63 @@ namespace Nz
 				table[i] = crc32_reflect(table[i], 32);
 			}
 
+			crc32_build_slicing_tables(table);
+
 			m_table = table;
 		}
+
+#ifdef NAZARA_PLATFORM_x64
+		if (polynomial == CastagnoliPolynomial)
+		{
+			const Core* core = Core::Instance();
+			m_hardwareAccelerated = (core && core->GetHardwareInfo().HasCapability(ProcessorCap::SSE42));
+		}
+#endif
 	}
 
 	CRC32Hash::~CRC32Hash()
 	{
 		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-		if (m_table != crc32_table)
+		if (m_table != crc32_default_tables())
 			delete[] m_table;
 	}
 
 	void CRC32Hash::Append(const UInt8* data, std::size_t len)
 	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+#ifdef NAZARA_PLATFORM_x64
+		if (m_hardwareAccelerated)
+		{
+			m_crc = crc32c_sse42(m_crc, data, len);
+			return;
+		}
+#endif
+
+		UInt32 crc = m_crc;
+		while (len >= 8)
+		{
+			UInt32 low = crc32_read_le32(data) ^ crc;
+			UInt32 high = crc32_read_le32(data + 4);
+
+			crc = m_table[7 * 256 + (low & 0xFF)] ^
+			      m_table[6 * 256 + ((low >> 8) & 0xFF)] ^
+			      m_table[5 * 256 + ((low >> 16) & 0xFF)] ^
+			      m_table[4 * 256 + (low >> 24)] ^
+			      m_table[3 * 256 + (high & 0xFF)] ^
+			      m_table[2 * 256 + ((high >> 8) & 0xFF)] ^
+			      m_table[1 * 256 + ((high >> 16) & 0xFF)] ^
+			      m_table[0 * 256 + (high >> 24)];
+
+			data += 8;
+			len -= 8;
+		}
+
 		while (len--)
-			m_crc = m_table[(m_crc ^ *data++) & 0xFF] ^ (m_crc >> 8);
+			crc = m_table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+
+		m_crc = crc;
 	}
 
 	void CRC32Hash::Begin()
@@ -38,8 +38,15 @@
  */
 
 #include <Nazara/Core/Hash/SHA/Internal.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Core.hpp>
 #include <Nazara/Utils/Endianness.hpp>
 #include <cstring>
+
+#ifdef NAZARA_PLATFORM_x64
+#include <immintrin.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -267,6 +274,121 @@ namespace Nz
 	};
 
 
+	/*** SHA EXTENSIONS (SHA-NI): *****************************************/
+	#ifdef NAZARA_PLATFORM_x64
+	namespace
+	{
+		bool SHA_HasHardwareSupport()
+		{
+			const Core* core = Core::Instance();
+			if (!core)
+				return false;
+
+			const HardwareInfo& hardwareInfo = core->GetHardwareInfo();
+			return hardwareInfo.HasCapability(ProcessorCap::SHA) && hardwareInfo.HasCapability(ProcessorCap::SSE41);
+		}
+
+		NAZARA_TARGET_FEATURES("sha,sse4.1,ssse3")
+		void SHA1_Internal_Transform_SHANI(UInt32* state, const UInt8* data, std::size_t blockCount)
+		{
+			/* Reverses the bytes of the whole register, giving us big-endian words with W0 in the highest lane */
+			const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+			__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+			__m128i e0 = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+
+			for (; blockCount > 0; --blockCount, data += 64)
+			{
+				/* Message schedule, four words per register */
+				__m128i w[20];
+				for (unsigned int i = 0; i < 4; ++i)
+					w[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)), mask);
+
+				for (unsigned int i = 4; i < 20; ++i)
+					w[i] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(w[i - 4], w[i - 3]), w[i - 2]), w[i - 1]);
+
+				__m128i abcdSave = abcd;
+				__m128i eSave = e0;
+
+				/* Each sha1rnds4 does four rounds, E is computed from the A value four rounds earlier */
+				__m128i e = _mm_add_epi32(e0, w[0]);
+				__m128i previousAbcd = abcd;
+				abcd = _mm_sha1rnds4_epu32(abcd, e, 0);
+
+				#define SHA1_SHANI_ROUNDS(i, f) \
+					e = _mm_sha1nexte_epu32(previousAbcd, w[i]); \
+					previousAbcd = abcd; \
+					abcd = _mm_sha1rnds4_epu32(abcd, e, f);
+
+				SHA1_SHANI_ROUNDS( 1, 0); SHA1_SHANI_ROUNDS( 2, 0); SHA1_SHANI_ROUNDS( 3, 0); SHA1_SHANI_ROUNDS( 4, 0);
+				SHA1_SHANI_ROUNDS( 5, 1); SHA1_SHANI_ROUNDS( 6, 1); SHA1_SHANI_ROUNDS( 7, 1); SHA1_SHANI_ROUNDS( 8, 1); SHA1_SHANI_ROUNDS( 9, 1);
+				SHA1_SHANI_ROUNDS(10, 2); SHA1_SHANI_ROUNDS(11, 2); SHA1_SHANI_ROUNDS(12, 2); SHA1_SHANI_ROUNDS(13, 2); SHA1_SHANI_ROUNDS(14, 2);
+				SHA1_SHANI_ROUNDS(15, 3); SHA1_SHANI_ROUNDS(16, 3); SHA1_SHANI_ROUNDS(17, 3); SHA1_SHANI_ROUNDS(18, 3); SHA1_SHANI_ROUNDS(19, 3);
+
+				#undef SHA1_SHANI_ROUNDS
+
+				/* Compute the current intermediate hash value */
+				e0 = _mm_sha1nexte_epu32(previousAbcd, eSave);
+				abcd = _mm_add_epi32(abcd, abcdSave);
+			}
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(abcd, 0x1B));
+			state[4] = static_cast<UInt32>(_mm_extract_epi32(e0, 3));
+		}
+
+		NAZARA_TARGET_FEATURES("sha,sse4.1,ssse3")
+		void SHA256_Internal_Transform_SHANI(UInt32* state, const UInt8* data, std::size_t blockCount)
+		{
+			/* Reverses the bytes of each word */
+			const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+			/* sha256rnds2 works on ABEF and CDGH registers */
+			__m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);    /* CDAB */
+			__m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B); /* EFGH */
+			__m128i state0 = _mm_alignr_epi8(tmp, state1, 8);    /* ABEF */
+			state1 = _mm_blend_epi16(state1, tmp, 0xF0);         /* CDGH */
+
+			for (; blockCount > 0; --blockCount, data += 64)
+			{
+				__m128i state0Save = state0;
+				__m128i state1Save = state1;
+
+				__m128i w[4];
+				for (unsigned int i = 0; i < 4; ++i)
+					w[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)), mask);
+
+				/* Four rounds per iteration, w[i % 4] is replaced by the schedule of the words used four iterations later */
+				for (unsigned int i = 0; i < 16; ++i)
+				{
+					__m128i message = _mm_add_epi32(w[i % 4], _mm_loadu_si128(reinterpret_cast<const __m128i*>(&K256[i * 4])));
+					state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+					state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(message, 0x0E));
+
+					if (i < 12)
+					{
+						__m128i next = _mm_sha256msg1_epu32(w[i % 4], w[(i + 1) % 4]);
+						next = _mm_add_epi32(next, _mm_alignr_epi8(w[(i + 3) % 4], w[(i + 2) % 4], 4));
+						w[i % 4] = _mm_sha256msg2_epu32(next, w[(i + 3) % 4]);
+					}
+				}
+
+				/* Compute the current intermediate hash value */
+				state0 = _mm_add_epi32(state0, state0Save);
+				state1 = _mm_add_epi32(state1, state1Save);
+			}
+
+			tmp = _mm_shuffle_epi32(state0, 0x1B);               /* FEBA */
+			state1 = _mm_shuffle_epi32(state1, 0xB1);            /* DCHG */
+			state0 = _mm_blend_epi16(tmp, state1, 0xF0);         /* DCBA */
+			state1 = _mm_alignr_epi8(state1, tmp, 8);            /* ABEF */
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+		}
+	}
+	#endif
+
+
 	/*** SHA-1: ***********************************************************/
 	void SHA1_Init(SHA_CTX* context)
 	{
@@ -467,6 +589,18 @@ namespace Nz
 			}
 		}
 
+	#ifdef NAZARA_PLATFORM_x64
+		if (len >= 64 && SHA_HasHardwareSupport())
+		{
+			/* Process as many complete blocks as we can using SHA extensions */
+			std::size_t blockCount = len / 64;
+			SHA1_Internal_Transform_SHANI(context->s1.state, data, blockCount);
+			context->s1.bitcount += static_cast<UInt64>(blockCount) * 512;
+			len -= blockCount * 64;
+			data += blockCount * 64;
+		}
+	#endif
+
 		while (len >= 64)
 		{
 			/* Process as many complete blocks as we can */
@@ -679,6 +813,18 @@ namespace Nz
 			}
 		}
 
+	#ifdef NAZARA_PLATFORM_x64
+		if (len >= 64 && SHA_HasHardwareSupport())
+		{
+			/* Process as many complete blocks as we can using SHA extensions */
+			std::size_t blockCount = len / 64;
+			SHA256_Internal_Transform_SHANI(context->s256.state, data, blockCount);
+			context->s256.bitcount += static_cast<UInt64>(blockCount) * 512;
+			len -= blockCount * 64;
+			data += blockCount * 64;
+		}
+	#endif
+
 		while (len >= 64)
 		{
 			/* Process as many complete blocks as we can */
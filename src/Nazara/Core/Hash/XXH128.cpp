@@ -0,0 +1,48 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Hash/XXH128.hpp>
+#include <xxhash.h>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	XXH128Hash::XXH128Hash()
+	{
+		m_state = XXH3_createState();
+	}
+
+	XXH128Hash::~XXH128Hash()
+	{
+		XXH3_freeState(m_state);
+	}
+
+	void XXH128Hash::Append(const UInt8* data, std::size_t len)
+	{
+		XXH3_128bits_update(m_state, data, len);
+	}
+
+	void XXH128Hash::Begin()
+	{
+		XXH3_128bits_reset(m_state);
+	}
+
+	ByteArray XXH128Hash::End()
+	{
+		XXH128_canonical_t digest;
+		XXH128_canonicalFromHash(&digest, XXH3_128bits_digest(m_state));
+
+		return ByteArray(digest.digest, sizeof(digest.digest));
+	}
+
+	std::size_t XXH128Hash::GetDigestLength() const
+	{
+		return 16;
+	}
+
+	const char* XXH128Hash::GetHashName() const
+	{
+		return "XXH128";
+	}
+}
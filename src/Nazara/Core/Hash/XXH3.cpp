@@ -0,0 +1,48 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Hash/XXH3.hpp>
+#include <xxhash.h>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	XXH3Hash::XXH3Hash()
+	{
+		m_state = XXH3_createState();
+	}
+
+	XXH3Hash::~XXH3Hash()
+	{
+		XXH3_freeState(m_state);
+	}
+
+	void XXH3Hash::Append(const UInt8* data, std::size_t len)
+	{
+		XXH3_64bits_update(m_state, data, len);
+	}
+
+	void XXH3Hash::Begin()
+	{
+		XXH3_64bits_reset(m_state);
+	}
+
+	ByteArray XXH3Hash::End()
+	{
+		XXH64_canonical_t digest;
+		XXH64_canonicalFromHash(&digest, XXH3_64bits_digest(m_state));
+
+		return ByteArray(digest.digest, sizeof(digest.digest));
+	}
+
+	std::size_t XXH3Hash::GetDigestLength() const
+	{
+		return 8;
+	}
+
+	const char* XXH3Hash::GetHashName() const
+	{
+		return "XXH3";
+	}
+}
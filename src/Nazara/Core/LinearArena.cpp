@@ -0,0 +1,135 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/LinearArena.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		std::size_t ComputeAlignmentPadding(const UInt8* ptr, std::size_t alignment)
+		{
+			std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr);
+			return static_cast<std::size_t>((alignment - (address & (alignment - 1))) & (alignment - 1));
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::LinearArena
+	* \brief Core class that represents a bump allocator whose memory is reclaimed all at once
+	*
+	* Allocations only advance an offset inside the current memory block and individual deallocation is not possible.
+	* When the arena runs out of space, a new block is allocated. On Reset, blocks are merged into a single block
+	* large enough to hold everything allocated since the previous reset, which means that once the peak usage has been
+	* reached, allocating from the arena and resetting it never hits the system allocator again.
+	*/
+
+	/*!
+	* \brief Constructs a LinearArena object
+	*
+	* \param blockSize Minimal size of the memory blocks, no memory is allocated until the first allocation
+	*/
+	LinearArena::LinearArena(std::size_t blockSize) :
+	m_allocatedSize(0),
+	m_blockSize(blockSize),
+	m_capacity(0),
+	m_currentOffset(0)
+	{
+		NazaraAssert(blockSize > 0, "block size must be greater than zero");
+	}
+
+	/*!
+	* \brief Allocates uninitialized memory from the arena
+	* \return Pointer to the allocated memory, valid until the next call to Reset or Release
+	*
+	* \param size Size of the allocation in bytes
+	* \param alignment Alignment of the allocation, must be a power of two
+	*/
+	void* LinearArena::Allocate(std::size_t size, std::size_t alignment)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(alignment > 0 && (alignment & (alignment - 1)) == 0, "alignment must be a power of two");
+
+		if (!m_blocks.empty())
+		{
+			Block& block = m_blocks.back();
+			UInt8* freePtr = block.memory.get() + m_currentOffset;
+			std::size_t padding = ComputeAlignmentPadding(freePtr, alignment);
+
+			if (padding <= block.size - m_currentOffset && size <= block.size - m_currentOffset - padding)
+			{
+				m_currentOffset += padding + size;
+				m_allocatedSize += padding + size;
+
+				return freePtr + padding;
+			}
+		}
+
+		return AllocateFromNewBlock(size, alignment);
+	}
+
+	/*!
+	* \brief Frees all memory blocks owned by the arena
+	*
+	* \remark All memory previously allocated from the arena becomes invalid
+	*/
+	void LinearArena::Release()
+	{
+		m_blocks.clear();
+		m_allocatedSize = 0;
+		m_capacity = 0;
+		m_currentOffset = 0;
+	}
+
+	/*!
+	* \brief Reclaims all memory allocated from the arena, keeping its blocks for future allocations
+	*
+	* If the arena had to allocate more than one block since the last reset, they are replaced by a single block
+	* big enough to hold all of them so the next cycle doesn't have to allocate.
+	*
+	* \remark All memory previously allocated from the arena becomes invalid
+	*/
+	void LinearArena::Reset()
+	{
+		if (m_blocks.size() > 1)
+		{
+			std::size_t capacity = m_capacity;
+
+			m_blocks.clear();
+
+			auto& block = m_blocks.emplace_back();
+			block.memory = std::unique_ptr<UInt8[]>(new UInt8[capacity]);
+			block.size = capacity;
+		}
+
+		m_allocatedSize = 0;
+		m_currentOffset = 0;
+	}
+
+	void* LinearArena::AllocateFromNewBlock(std::size_t size, std::size_t alignment)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		// Leave room for alignment, as block memory is only guaranteed to be aligned to the default new alignment
+		std::size_t blockSize = std::max(m_blockSize, size + alignment - 1);
+
+		auto& block = m_blocks.emplace_back();
+		block.memory = std::unique_ptr<UInt8[]>(new UInt8[blockSize]);
+		block.size = blockSize;
+
+		m_capacity += blockSize;
+
+		std::size_t padding = ComputeAlignmentPadding(block.memory.get(), alignment);
+		m_currentOffset = padding + size;
+		m_allocatedSize += padding + size;
+
+		return block.memory.get() + padding;
+	}
+}
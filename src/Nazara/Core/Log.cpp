@@ -4,6 +4,7 @@
 
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Core/AbstractLogger.hpp>
+#include <Nazara/Core/AsyncLogger.hpp>
 #include <Nazara/Core/FileLogger.hpp>
 #include <Nazara/Core/StdLogger.hpp>
 #include <Nazara/Core/Debug.hpp>
@@ -116,7 +117,13 @@ namespace Nz
 		NAZARA_USE_ANONYMOUS_NAMESPACE
 
 		if (s_logger == &s_stdLogger)
+		{
+			#if NAZARA_CORE_LOG_ASYNC
+			SetLogger(new AsyncLogger(std::make_unique<FileLogger>(), NAZARA_CORE_LOG_ASYNC_CAPACITY));
+			#else
 			SetLogger(new FileLogger());
+			#endif
+		}
 
 		return true;
 	}
@@ -0,0 +1,213 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MappedFileStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstring>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#else
+	#error OS not handled
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::MappedFileStream
+	* \brief Core class that represents a read-only file mapped in memory
+	*
+	* Unlike File, reading doesn't go through system calls: the file content is paged in by the OS on access,
+	* and GetMappedPointer gives direct access to it so parsers can work in place without copying it first.
+	*/
+
+	/*!
+	* \brief Constructs a MappedFileStream object by default
+	*/
+	MappedFileStream::MappedFileStream() :
+	m_cursor(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a MappedFileStream object and maps a file
+	*
+	* \param filePath Path to the file
+	*
+	* \see Open
+	*/
+	MappedFileStream::MappedFileStream(const std::filesystem::path& filePath) :
+	MappedFileStream()
+	{
+		Open(filePath);
+	}
+
+	MappedFileStream::MappedFileStream(MappedFileStream&&) noexcept = default;
+
+	/*!
+	* \brief Destructs the object and unmaps the file
+	*/
+	MappedFileStream::~MappedFileStream() = default;
+
+	/*!
+	* \brief Unmaps the file
+	*
+	* \remark Pointers returned by GetMappedPointer are invalidated
+	*/
+	void MappedFileStream::Close()
+	{
+		m_impl.reset();
+		m_cursor = 0;
+		m_openMode = OpenMode::NotOpen;
+		m_streamOptions &= ~StreamOption::MemoryMapped;
+	}
+
+	/*!
+	* \brief Gets the directory of the file
+	* \return Directory of the file
+	*/
+	std::filesystem::path MappedFileStream::GetDirectory() const
+	{
+		return m_filePath.parent_path();
+	}
+
+	/*!
+	* \brief Gets a pointer to the file content
+	* \return Pointer to the first byte of the file, or nullptr if the file is not open or empty
+	*/
+	const void* MappedFileStream::GetMappedPointer() const
+	{
+		return (m_impl) ? m_impl->GetPointer() : nullptr;
+	}
+
+	/*!
+	* \brief Gets the path of the file
+	* \return Path of the file
+	*/
+	std::filesystem::path MappedFileStream::GetPath() const
+	{
+		return m_filePath;
+	}
+
+	/*!
+	* \brief Gets the size of the file
+	* \return Size of the file, or zero if it's not open
+	*/
+	UInt64 MappedFileStream::GetSize() const
+	{
+		return (m_impl) ? m_impl->GetSize() : 0;
+	}
+
+	/*!
+	* \brief Checks whether the file is mapped
+	* \return true if the file is mapped
+	*/
+	bool MappedFileStream::IsOpen() const
+	{
+		return m_impl != nullptr;
+	}
+
+	/*!
+	* \brief Maps a file in memory, closing the previous one
+	* \return true if the file was successfully mapped
+	*
+	* \param filePath Path to the file
+	*
+	* \remark Produces a NazaraError if the file could not be opened or mapped
+	*/
+	bool MappedFileStream::Open(const std::filesystem::path& filePath)
+	{
+		Close();
+
+		std::unique_ptr<MappedFileImpl> impl = std::make_unique<MappedFileImpl>();
+		if (!impl->Open(filePath))
+			return false;
+
+		m_filePath = filePath;
+		m_impl = std::move(impl);
+		m_openMode = OpenMode::ReadOnly;
+		m_streamOptions |= StreamOption::MemoryMapped;
+
+		return true;
+	}
+
+	MappedFileStream& MappedFileStream::operator=(MappedFileStream&&) noexcept = default;
+
+	/*!
+	* \brief Flushes the stream
+	*/
+	void MappedFileStream::FlushStream()
+	{
+		// Nothing to do
+	}
+
+	/*!
+	* \brief Reads blocks
+	* \return Number of blocks read
+	*
+	* \param buffer Preallocated buffer to contain information read
+	* \param size Size of the read and thus of the buffer
+	*/
+	std::size_t MappedFileStream::ReadBlock(void* buffer, std::size_t size)
+	{
+		NazaraAssert(IsOpen(), "File is not open");
+
+		std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, m_impl->GetSize() - m_cursor));
+		if (buffer && readSize > 0)
+			std::memcpy(buffer, static_cast<const UInt8*>(m_impl->GetPointer()) + m_cursor, readSize);
+
+		m_cursor += readSize;
+		return readSize;
+	}
+
+	/*!
+	* \brief Sets the position of the cursor
+	* \return true
+	*
+	* \param offset Offset according to the beginning of the file
+	*/
+	bool MappedFileStream::SeekStreamCursor(UInt64 offset)
+	{
+		NazaraAssert(IsOpen(), "File is not open");
+
+		m_cursor = std::min(offset, m_impl->GetSize());
+		return true;
+	}
+
+	/*!
+	* \brief Gets the position of the cursor
+	* \return Position of the cursor
+	*/
+	UInt64 MappedFileStream::TellStreamCursor() const
+	{
+		return m_cursor;
+	}
+
+	/*!
+	* \brief Checks whether the end of the file is reached
+	* \return true if cursor is at the end of the file
+	*/
+	bool MappedFileStream::TestStreamEnd() const
+	{
+		return m_cursor >= GetSize();
+	}
+
+	/*!
+	* \brief Writes blocks
+	* \return Number of blocks written
+	*
+	* \remark Mapped files are read-only, this always fails
+	*/
+	std::size_t MappedFileStream::WriteBlock(const void* /*buffer*/, std::size_t /*size*/)
+	{
+		NazaraError("Mapped files are read-only");
+		return 0;
+	}
+}
@@ -0,0 +1,492 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MemoryTracker.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Every tracked allocation is preceded by this header, which remembers where its bytes have to be removed from when it's freed
+		struct AllocationHeader
+		{
+			UInt64 size;
+			UInt32 callSiteIndex;
+			UInt8 tag;
+		};
+
+		constexpr std::size_t HeaderSize = std::max(sizeof(AllocationHeader), alignof(std::max_align_t));
+		constexpr UInt32 InvalidCallSite = std::numeric_limits<UInt32>::max();
+
+		// Everything below is zero-initialized (the global operator new may be called before any dynamic initialization)
+		// and only relies on atomics, so recording an allocation never allocates nor locks
+		struct Counters
+		{
+			void Add(UInt64 size)
+			{
+				allocationCount.fetch_add(1, std::memory_order_relaxed);
+				allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+				liveAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+				UInt64 newLiveBytes = liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+
+				UInt64 peak = peakBytes.load(std::memory_order_relaxed);
+				while (newLiveBytes > peak && !peakBytes.compare_exchange_weak(peak, newLiveBytes, std::memory_order_relaxed));
+			}
+
+			void Remove(UInt64 size)
+			{
+				liveAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+				liveBytes.fetch_sub(size, std::memory_order_relaxed);
+			}
+
+			std::atomic<UInt64> allocatedBytes;
+			std::atomic<UInt64> allocationCount;
+			std::atomic<UInt64> liveAllocationCount;
+			std::atomic<UInt64> liveBytes;
+			std::atomic<UInt64> peakBytes;
+		};
+
+		struct CallSiteEntry
+		{
+			std::atomic<const MemoryCallSite*> callSite;
+			std::atomic<UInt8> tag;
+			std::atomic<UInt64> allocatedBytes;
+			std::atomic<UInt64> allocationCount;
+			std::atomic<UInt64> liveBytes;
+		};
+
+		std::array<CallSiteEntry, NAZARA_CORE_MEMORY_TRACKER_CALLSITES> s_callSites;
+		std::array<Counters, MemoryTagCount> s_tagCounters;
+		std::atomic<Int64> s_resetTime;
+		Counters s_totalCounters;
+
+		thread_local UInt32 s_currentCallSiteIndex = InvalidCallSite;
+		thread_local MemoryTag s_currentTag = MemoryTag::Other;
+
+		Int64 GetTimestamp()
+		{
+			// Zero is reserved for "not started yet"
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() | 1;
+		}
+
+		UInt32 RegisterCallSite(const MemoryCallSite& callSite, MemoryTag tag)
+		{
+			// Open addressing on the call site address, entries are never removed
+			std::size_t index = (reinterpret_cast<std::uintptr_t>(&callSite) >> 3) % s_callSites.size();
+			for (std::size_t i = 0; i < s_callSites.size(); ++i)
+			{
+				CallSiteEntry& entry = s_callSites[index];
+
+				const MemoryCallSite* entryCallSite = entry.callSite.load(std::memory_order_acquire);
+				if (!entryCallSite && entry.callSite.compare_exchange_strong(entryCallSite, &callSite, std::memory_order_acq_rel))
+				{
+					entry.tag.store(static_cast<UInt8>(tag), std::memory_order_relaxed);
+					return static_cast<UInt32>(index);
+				}
+
+				if (entryCallSite == &callSite)
+					return static_cast<UInt32>(index);
+
+				index = (index + 1) % s_callSites.size();
+			}
+
+			return InvalidCallSite;
+		}
+
+		MemoryTracker::Stats BuildStats(const Counters& counters)
+		{
+			MemoryTracker::Stats stats;
+			stats.allocatedBytes = counters.allocatedBytes.load(std::memory_order_relaxed);
+			stats.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+			stats.liveAllocationCount = counters.liveAllocationCount.load(std::memory_order_relaxed);
+			stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+			stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+
+			stats.allocationRate = 0.0;
+			if (Int64 resetTime = s_resetTime.load(std::memory_order_relaxed); resetTime != 0)
+			{
+				double elapsedTime = (GetTimestamp() - resetTime) / 1'000'000'000.0;
+				if (elapsedTime > 0.0)
+					stats.allocationRate = stats.allocationCount / elapsedTime;
+			}
+
+			return stats;
+		}
+
+		std::string FormatSize(UInt64 size)
+		{
+			constexpr std::array<const char*, 4> units = { "B", "KiB", "MiB", "GiB" };
+
+			double value = static_cast<double>(size);
+			std::size_t unitIndex = 0;
+			while (value >= 1024.0 && unitIndex + 1 < units.size())
+			{
+				value /= 1024.0;
+				unitIndex++;
+			}
+
+			std::ostringstream ss;
+			if (unitIndex == 0)
+				ss << size << ' ' << units[unitIndex];
+			else
+				ss << std::fixed << std::setprecision(2) << value << ' ' << units[unitIndex];
+
+			return ss.str();
+		}
+
+		const char* GetTagName(MemoryTag tag)
+		{
+			switch (tag)
+			{
+				case MemoryTag::Audio:    return "Audio";
+				case MemoryTag::Core:     return "Core";
+				case MemoryTag::Graphics: return "Graphics";
+				case MemoryTag::Network:  return "Network";
+				case MemoryTag::Other:    return "Other";
+				case MemoryTag::Physics:  return "Physics";
+				case MemoryTag::Utility:  return "Utility";
+			}
+
+			return "<unhandled tag>";
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::MemoryTracker
+	* \brief Core class that keeps track of the memory allocated by each subsystem of the engine
+	*
+	* Allocations are attributed to a MemoryTag and, when made inside a NazaraMemoryScope, to the call site of that scope.
+	* Memory allocated with Allocate (or TaggedAllocator) is always tracked, while allocations made through the global operators
+	* new and delete are only tracked when NAZARA_CORE_MEMORY_TRACKER is enabled, in which case they're attributed to the tag
+	* of the innermost scope of their thread (MemoryTag::Other if none).
+	*
+	* Recording an allocation only updates a few atomic counters and never locks.
+	*
+	* \remark Global operators new and delete are replaced when loading the Core module, which means it must not be loaded at runtime (as a plugin) when NAZARA_CORE_MEMORY_TRACKER is enabled
+	*/
+
+	/*!
+	* \brief Allocates memory and tracks it under a tag
+	* \return Pointer to the memory block (aligned like std::max_align_t) or nullptr if the allocation failed
+	*
+	* \param size Size of the memory block
+	* \param tag Subsystem the memory block belongs to
+	*
+	* \remark The memory block must be freed using Free
+	*/
+	void* MemoryTracker::Allocate(std::size_t size, MemoryTag tag)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		UInt8* ptr = static_cast<UInt8*>(std::malloc(HeaderSize + size));
+		if (!ptr)
+			return nullptr;
+
+		UInt32 callSiteIndex = s_currentCallSiteIndex;
+
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(ptr);
+		header->size = size;
+		header->callSiteIndex = callSiteIndex;
+		header->tag = static_cast<UInt8>(tag);
+
+		if (s_resetTime.load(std::memory_order_relaxed) == 0)
+		{
+			Int64 expected = 0;
+			s_resetTime.compare_exchange_strong(expected, GetTimestamp(), std::memory_order_relaxed);
+		}
+
+		s_tagCounters[static_cast<std::size_t>(tag)].Add(size);
+		s_totalCounters.Add(size);
+
+		if (callSiteIndex != InvalidCallSite)
+		{
+			CallSiteEntry& callSite = s_callSites[callSiteIndex];
+			callSite.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+			callSite.allocationCount.fetch_add(1, std::memory_order_relaxed);
+			callSite.liveBytes.fetch_add(size, std::memory_order_relaxed);
+		}
+
+		return ptr + HeaderSize;
+	}
+
+	/*!
+	* \brief Frees memory allocated by Allocate
+	*
+	* \param ptr Pointer to the memory block, can be null
+	*/
+	void MemoryTracker::Free(void* ptr)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (!ptr)
+			return;
+
+		UInt8* blockPtr = static_cast<UInt8*>(ptr) - HeaderSize;
+
+		const AllocationHeader* header = reinterpret_cast<const AllocationHeader*>(blockPtr);
+		s_tagCounters[header->tag].Remove(header->size);
+		s_totalCounters.Remove(header->size);
+
+		if (header->callSiteIndex != InvalidCallSite)
+			s_callSites[header->callSiteIndex].liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+
+		std::free(blockPtr);
+	}
+
+	/*!
+	* \brief Gets the tag allocations of the calling thread are currently attributed to
+	* \return Tag of the innermost memory scope of the thread, or MemoryTag::Other
+	*/
+	MemoryTag MemoryTracker::GetCurrentTag()
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		return s_currentTag;
+	}
+
+	/*!
+	* \brief Gets the memory statistics of a subsystem
+	* \return Statistics of the tag
+	*
+	* \param tag Subsystem tag
+	*/
+	auto MemoryTracker::GetStats(MemoryTag tag) -> Stats
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		return BuildStats(s_tagCounters[static_cast<std::size_t>(tag)]);
+	}
+
+	/*!
+	* \brief Gets the call sites (see NazaraMemoryScope) which allocated the most bytes since the last ResetStats
+	* \return Call sites statistics, sorted by allocated bytes in decreasing order
+	*
+	* \param maxCount Maximum number of call sites to return
+	*
+	* \remark Call sites are sorted by allocated bytes rather than live bytes as they are a better indicator of allocation churn
+	*/
+	auto MemoryTracker::GetTopCallSites(std::size_t maxCount) -> std::vector<CallSiteStats>
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		std::vector<CallSiteStats> callSites;
+		for (const CallSiteEntry& entry : s_callSites)
+		{
+			const MemoryCallSite* callSite = entry.callSite.load(std::memory_order_acquire);
+			if (!callSite)
+				continue;
+
+			auto& callSiteStats = callSites.emplace_back();
+			callSiteStats.allocatedBytes = entry.allocatedBytes.load(std::memory_order_relaxed);
+			callSiteStats.allocationCount = entry.allocationCount.load(std::memory_order_relaxed);
+			callSiteStats.callSite = callSite;
+			callSiteStats.liveBytes = entry.liveBytes.load(std::memory_order_relaxed);
+			callSiteStats.tag = static_cast<MemoryTag>(entry.tag.load(std::memory_order_relaxed));
+		}
+
+		std::size_t count = std::min(maxCount, callSites.size());
+		std::partial_sort(callSites.begin(), callSites.begin() + count, callSites.end(), [](const CallSiteStats& lhs, const CallSiteStats& rhs)
+		{
+			return lhs.allocatedBytes > rhs.allocatedBytes;
+		});
+		callSites.resize(count);
+
+		return callSites;
+	}
+
+	/*!
+	* \brief Gets the memory statistics of every subsystem combined
+	* \return Total statistics
+	*/
+	auto MemoryTracker::GetTotalStats() -> Stats
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		return BuildStats(s_totalCounters);
+	}
+
+	/*!
+	* \brief Resets allocation counters and rates, peaks are reset to the current live bytes
+	*
+	* \remark Live bytes and allocations are never reset
+	*/
+	void MemoryTracker::ResetStats()
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		auto ResetCounters = [](Counters& counters)
+		{
+			counters.allocatedBytes.store(0, std::memory_order_relaxed);
+			counters.allocationCount.store(0, std::memory_order_relaxed);
+			counters.peakBytes.store(counters.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		};
+
+		for (Counters& counters : s_tagCounters)
+			ResetCounters(counters);
+
+		ResetCounters(s_totalCounters);
+
+		for (CallSiteEntry& entry : s_callSites)
+		{
+			entry.allocatedBytes.store(0, std::memory_order_relaxed);
+			entry.allocationCount.store(0, std::memory_order_relaxed);
+		}
+
+		s_resetTime.store(GetTimestamp(), std::memory_order_relaxed);
+	}
+
+	/*!
+	* \brief Saves a memory report to a file
+	* \return True if the file has been written
+	*
+	* \param filePath Path of the output file
+	*
+	* \see ToReport
+	*/
+	bool MemoryTracker::SaveReport(const std::filesystem::path& filePath)
+	{
+		File file(filePath, OpenMode::WriteOnly | OpenMode::Truncate);
+		if (!file.IsOpen())
+		{
+			NazaraError("failed to open \"" + PathToString(filePath) + '"');
+			return false;
+		}
+
+		std::string report = ToReport();
+		if (file.Write(report.data(), report.size()) != report.size())
+		{
+			NazaraError("failed to write memory report to \"" + PathToString(filePath) + '"');
+			return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Generates a human-readable memory report, with statistics of every tag and the top call sites
+	* \return A string holding the report
+	*
+	* \param maxCallSiteCount Maximum number of call sites to include in the report
+	*/
+	std::string MemoryTracker::ToReport(std::size_t maxCallSiteCount)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		std::ostringstream ss;
+		ss << "Memory report (global allocations are " << ((IsTrackingGlobalAllocations()) ? "tracked" : "not tracked") << ")\n\n";
+
+		ss << std::left << std::setw(10) << "Tag" << std::right
+		   << std::setw(14) << "Live" << std::setw(14) << "Peak" << std::setw(14) << "Live allocs"
+		   << std::setw(14) << "Allocs" << std::setw(14) << "Allocated" << std::setw(14) << "Allocs/s" << '\n';
+
+		auto AppendStats = [&](const char* name, const Stats& stats)
+		{
+			ss << std::left << std::setw(10) << name << std::right
+			   << std::setw(14) << FormatSize(stats.liveBytes) << std::setw(14) << FormatSize(stats.peakBytes) << std::setw(14) << stats.liveAllocationCount
+			   << std::setw(14) << stats.allocationCount << std::setw(14) << FormatSize(stats.allocatedBytes)
+			   << std::setw(14) << std::fixed << std::setprecision(1) << stats.allocationRate << '\n';
+		};
+
+		for (std::size_t i = 0; i < MemoryTagCount; ++i)
+			AppendStats(GetTagName(static_cast<MemoryTag>(i)), GetStats(static_cast<MemoryTag>(i)));
+
+		AppendStats("Total", GetTotalStats());
+
+		std::vector<CallSiteStats> callSites = GetTopCallSites(maxCallSiteCount);
+		if (!callSites.empty())
+		{
+			ss << "\nTop call sites by allocated bytes:\n";
+			for (const CallSiteStats& callSiteStats : callSites)
+			{
+				const MemoryCallSite& callSite = *callSiteStats.callSite;
+				ss << "  [" << GetTagName(callSiteStats.tag) << "] " << callSite.name << ": "
+				   << FormatSize(callSiteStats.allocatedBytes) << " in " << callSiteStats.allocationCount << " allocations, "
+				   << FormatSize(callSiteStats.liveBytes) << " live (" << callSite.function << " at " << callSite.file << ':' << callSite.line << ")\n";
+			}
+		}
+
+		return ss.str();
+	}
+
+	auto MemoryTracker::PushScope(MemoryTag tag, const MemoryCallSite& callSite) -> ScopeState
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		ScopeState previousState;
+		previousState.callSiteIndex = s_currentCallSiteIndex;
+		previousState.tag = s_currentTag;
+
+		s_currentCallSiteIndex = RegisterCallSite(callSite, tag);
+		s_currentTag = tag;
+
+		return previousState;
+	}
+
+	void MemoryTracker::PopScope(const ScopeState& previousState)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		s_currentCallSiteIndex = previousState.callSiteIndex;
+		s_currentTag = previousState.tag;
+	}
+}
+
+#if NAZARA_CORE_MEMORY_TRACKER
+
+NAZARA_EXPORT void* operator new(std::size_t size)
+{
+	for (;;)
+	{
+		if (void* ptr = Nz::MemoryTracker::Allocate(size, Nz::MemoryTracker::GetCurrentTag()))
+			return ptr;
+
+		std::new_handler handler = std::get_new_handler();
+		if (!handler)
+			throw std::bad_alloc();
+
+		handler();
+	}
+}
+
+NAZARA_EXPORT void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+NAZARA_EXPORT void operator delete(void* ptr) noexcept
+{
+	Nz::MemoryTracker::Free(ptr);
+}
+
+NAZARA_EXPORT void operator delete[](void* ptr) noexcept
+{
+	Nz::MemoryTracker::Free(ptr);
+}
+
+NAZARA_EXPORT void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+	Nz::MemoryTracker::Free(ptr);
+}
+
+NAZARA_EXPORT void operator delete[](void* ptr, std::size_t /*size*/) noexcept
+{
+	Nz::MemoryTracker::Free(ptr);
+}
+
+#endif
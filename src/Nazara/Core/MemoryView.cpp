@@ -25,7 +25,7 @@ namespace Nz
 	*/
 
 	MemoryView::MemoryView(void* ptr, UInt64 size) :
-	Stream(StreamOption::None, OpenMode_ReadWrite),
+	Stream(StreamOption::MemoryMapped, OpenMode_ReadWrite),
 	m_ptr(static_cast<UInt8*>(ptr)), 
 	m_pos(0),
 	m_size(size)
@@ -42,13 +42,23 @@ namespace Nz
 	*/
 
 	MemoryView::MemoryView(const void* ptr, UInt64 size) :
-	Stream(StreamOption::None, OpenMode::ReadOnly),
+	Stream(StreamOption::MemoryMapped, OpenMode::ReadOnly),
 	m_ptr(static_cast<UInt8*>(const_cast<void*>(ptr))), //< Okay, right, const_cast is bad, but this pointer is still read-only
 	m_pos(0),
 	m_size(size)
 	{
 	}
 
+	/*!
+	* \brief Gets the raw memory pointer
+	* \return Pointer given at construction
+	*/
+
+	const void* MemoryView::GetMappedPointer() const
+	{
+		return m_ptr;
+	}
+
 	/*!
 	* \brief Gets the size of the raw memory
 	* \return Size of the memory
@@ -0,0 +1,386 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/PackedArchive.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Utils/Endianness.hpp>
+#include <lz4.h>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Archives are stored in little-endian
+		template<typename T>
+		T ReadValue(const UInt8* ptr)
+		{
+			T value;
+			std::memcpy(&value, ptr, sizeof(T));
+
+#ifdef NAZARA_BIG_ENDIAN
+			SwapBytes(&value, sizeof(T));
+#endif
+
+			return value;
+		}
+
+		std::string_view TrimSeparators(std::string_view path)
+		{
+			while (!path.empty() && path.front() == '/')
+				path.remove_prefix(1);
+
+			while (!path.empty() && path.back() == '/')
+				path.remove_suffix(1);
+
+			return path;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::PackedArchive
+	* \brief Core class that gives access to the entries of a packed archive file
+	*
+	* A packed archive stores many files in a single file mapped in memory: a table of content (with a hashed path index)
+	* followed by the file contents, each one aligned and optionally compressed.
+	* Opening an archive only maps it and validates its table of content, looking an entry up is a hash table lookup
+	* and uncompressed entries are accessed in place.
+	*
+	* Archives are built using PackedArchiveBuilder (or the NazaraPacker tool).
+	*
+	* \see PackedArchiveBuilder
+	*/
+
+	/*!
+	* \brief Constructs a PackedArchive object by default
+	*/
+	PackedArchive::PackedArchive() :
+	m_stringTable(nullptr),
+	m_bucketTable(nullptr),
+	m_entryTable(nullptr),
+	m_fileData(nullptr),
+	m_bucketCount(0),
+	m_entryCount(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a PackedArchive object and opens an archive
+	*
+	* \param filePath Path to the archive
+	*
+	* \see Open
+	*/
+	PackedArchive::PackedArchive(const std::filesystem::path& filePath) :
+	PackedArchive()
+	{
+		Open(filePath);
+	}
+
+	/*!
+	* \brief Closes the archive
+	*
+	* \remark Pointers returned by GetEntryData are invalidated
+	*/
+	void PackedArchive::Close()
+	{
+		m_file.Close();
+		m_stringTable = nullptr;
+		m_bucketTable = nullptr;
+		m_entryTable = nullptr;
+		m_fileData = nullptr;
+		m_bucketCount = 0;
+		m_entryCount = 0;
+	}
+
+	/*!
+	* \brief Looks an entry up by its path
+	* \return Index of the entry or InvalidIndex if no entry has this path
+	*
+	* \param path Path of the entry, using '/' as a separator (leading and trailing separators are ignored)
+	*/
+	std::size_t PackedArchive::FindEntry(std::string_view path) const
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (!IsOpen())
+			return InvalidIndex;
+
+		path = TrimSeparators(path);
+
+		UInt64 pathHash = ComputePathHash(path);
+		std::size_t bucketMask = m_bucketCount - 1;
+		std::size_t bucketIndex = static_cast<std::size_t>(pathHash) & bucketMask;
+
+		// Open addressing with linear probing, an empty bucket ends the search
+		for (std::size_t i = 0; i < m_bucketCount; ++i)
+		{
+			UInt32 bucketValue = ReadValue<UInt32>(&m_bucketTable[bucketIndex * BucketSize]);
+			if (bucketValue == 0)
+				break;
+
+			std::size_t entryIndex = bucketValue - 1;
+			if (ReadValue<UInt64>(&m_entryTable[entryIndex * EntrySize]) == pathHash && GetEntryPath(entryIndex) == path)
+				return entryIndex;
+
+			bucketIndex = (bucketIndex + 1) & bucketMask;
+		}
+
+		return InvalidIndex;
+	}
+
+	/*!
+	* \brief Gets how an entry is stored
+	* \return Entry compression
+	*
+	* \param entryIndex Index of the entry
+	*/
+	PackedArchiveCompression PackedArchive::GetEntryCompression(std::size_t entryIndex) const
+	{
+		return static_cast<PackedArchiveCompression>(ReadEntryRecord(entryIndex).compression);
+	}
+
+	/*!
+	* \brief Gets a pointer to an entry content, in place
+	* \return Pointer to the entry content or nullptr if the entry is a directory, empty or compressed (see ReadEntry)
+	*
+	* \param entryIndex Index of the entry
+	*/
+	const void* PackedArchive::GetEntryData(std::size_t entryIndex) const
+	{
+		EntryRecord record = ReadEntryRecord(entryIndex);
+		if (record.flags & EntryFlag_Directory || static_cast<PackedArchiveCompression>(record.compression) != PackedArchiveCompression::None || record.dataSize == 0)
+			return nullptr;
+
+		return &m_fileData[record.dataOffset];
+	}
+
+	/*!
+	* \brief Gets the name of an entry (the last part of its path)
+	* \return Entry name, empty for the root
+	*
+	* \param entryIndex Index of the entry
+	*/
+	std::string_view PackedArchive::GetEntryName(std::size_t entryIndex) const
+	{
+		EntryRecord record = ReadEntryRecord(entryIndex);
+		return std::string_view(&m_stringTable[record.pathOffset + record.nameOffset], record.pathSize - record.nameOffset);
+	}
+
+	/*!
+	* \brief Gets the full path of an entry
+	* \return Entry path, empty for the root
+	*
+	* \param entryIndex Index of the entry
+	*/
+	std::string_view PackedArchive::GetEntryPath(std::size_t entryIndex) const
+	{
+		EntryRecord record = ReadEntryRecord(entryIndex);
+		return std::string_view(&m_stringTable[record.pathOffset], record.pathSize);
+	}
+
+	/*!
+	* \brief Gets the size of an entry content
+	* \return Uncompressed size of the entry, zero for directories
+	*
+	* \param entryIndex Index of the entry
+	*/
+	UInt64 PackedArchive::GetEntrySize(std::size_t entryIndex) const
+	{
+		return ReadEntryRecord(entryIndex).dataSize;
+	}
+
+	/*!
+	* \brief Checks whether an entry is a directory
+	* \return true if the entry is a directory
+	*
+	* \param entryIndex Index of the entry
+	*/
+	bool PackedArchive::IsDirectory(std::size_t entryIndex) const
+	{
+		return (ReadEntryRecord(entryIndex).flags & EntryFlag_Directory) != 0;
+	}
+
+	/*!
+	* \brief Opens an archive, closing the previous one
+	* \return true if the archive was successfully opened
+	*
+	* \param filePath Path to the archive
+	*
+	* \remark Produces a NazaraError if the file could not be mapped or is not a valid archive
+	*/
+	bool PackedArchive::Open(const std::filesystem::path& filePath)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		Close();
+
+		if (!m_file.Open(filePath))
+			return false;
+
+		auto Fail = [&](const std::string& reason)
+		{
+			NazaraError("invalid archive \"" + PathToString(filePath) + "\": " + reason);
+			Close();
+
+			return false;
+		};
+
+		UInt64 fileSize = m_file.GetSize();
+		const UInt8* fileData = static_cast<const UInt8*>(m_file.GetMappedPointer());
+		if (fileSize < HeaderSize)
+			return Fail("file is too small");
+
+		if (std::memcmp(fileData, Magic, sizeof(Magic)) != 0)
+			return Fail("not a packed archive");
+
+		UInt32 version = ReadValue<UInt32>(&fileData[4]);
+		if (version != Version)
+			return Fail("unsupported version " + std::to_string(version));
+
+		UInt32 entryCount = ReadValue<UInt32>(&fileData[8]);
+		UInt32 bucketCount = ReadValue<UInt32>(&fileData[12]);
+		UInt64 entryTableOffset = ReadValue<UInt64>(&fileData[16]);
+		UInt64 bucketTableOffset = ReadValue<UInt64>(&fileData[24]);
+		UInt64 stringTableOffset = ReadValue<UInt64>(&fileData[32]);
+		UInt64 stringTableSize = ReadValue<UInt64>(&fileData[40]);
+
+		if (entryCount == 0)
+			return Fail("archive has no root entry");
+
+		if (bucketCount < entryCount || (bucketCount & (bucketCount - 1)) != 0)
+			return Fail("invalid bucket count");
+
+		auto IsRangeValid = [&](UInt64 offset, UInt64 size)
+		{
+			return offset <= fileSize && size <= fileSize - offset;
+		};
+
+		if (!IsRangeValid(entryTableOffset, UInt64(entryCount) * EntrySize) || !IsRangeValid(bucketTableOffset, UInt64(bucketCount) * BucketSize) || !IsRangeValid(stringTableOffset, stringTableSize))
+			return Fail("table of content is out of bounds");
+
+		m_stringTable = reinterpret_cast<const char*>(&fileData[stringTableOffset]);
+		m_bucketTable = &fileData[bucketTableOffset];
+		m_entryTable = &fileData[entryTableOffset];
+		m_fileData = fileData;
+		m_bucketCount = bucketCount;
+		m_entryCount = entryCount;
+
+		// Validate entries once so accessors don't have to
+		for (std::size_t i = 0; i < m_entryCount; ++i)
+		{
+			EntryRecord record = ReadEntryRecord(i);
+			if (UInt64(record.pathOffset) + record.pathSize > stringTableSize || record.nameOffset > record.pathSize)
+				return Fail("entry #" + std::to_string(i) + " has an invalid path");
+
+			if (record.flags & EntryFlag_Directory)
+			{
+				if (UInt64(record.firstChild) + record.childCount > m_entryCount)
+					return Fail("entry #" + std::to_string(i) + " has invalid children");
+			}
+			else
+			{
+				if (record.compression >= PackedArchiveCompressionCount)
+					return Fail("entry #" + std::to_string(i) + " has an unknown compression");
+
+				if (static_cast<PackedArchiveCompression>(record.compression) == PackedArchiveCompression::None && record.storedSize != record.dataSize)
+					return Fail("entry #" + std::to_string(i) + " has an invalid size");
+
+				if (!IsRangeValid(record.dataOffset, record.storedSize))
+					return Fail("entry #" + std::to_string(i) + " data is out of bounds");
+			}
+		}
+
+		// Lookups index the entry table with bucket values, which must reference existing entries (0 being an empty bucket)
+		for (std::size_t i = 0; i < m_bucketCount; ++i)
+		{
+			UInt32 bucketValue = ReadValue<UInt32>(&m_bucketTable[i * BucketSize]);
+			if (bucketValue > m_entryCount)
+				return Fail("bucket #" + std::to_string(i) + " references an invalid entry");
+		}
+
+		if (!IsDirectory(RootIndex))
+			return Fail("root entry is not a directory");
+
+		return true;
+	}
+
+	/*!
+	* \brief Copies (or decompresses) an entry content to a buffer
+	* \return true if the content was successfully read
+	*
+	* \param entryIndex Index of the entry
+	* \param buffer Buffer of at least GetEntrySize(entryIndex) bytes
+	*
+	* \remark Produces a NazaraError if decompression failed
+	*/
+	bool PackedArchive::ReadEntry(std::size_t entryIndex, void* buffer) const
+	{
+		EntryRecord record = ReadEntryRecord(entryIndex);
+		if (record.flags & EntryFlag_Directory)
+		{
+			NazaraError("entry is a directory");
+			return false;
+		}
+
+		if (record.dataSize == 0)
+			return true;
+
+		switch (static_cast<PackedArchiveCompression>(record.compression))
+		{
+			case PackedArchiveCompression::None:
+				std::memcpy(buffer, &m_fileData[record.dataOffset], static_cast<std::size_t>(record.dataSize));
+				return true;
+
+			case PackedArchiveCompression::LZ4:
+			{
+				constexpr UInt64 maxSize = static_cast<UInt64>(std::numeric_limits<int>::max());
+				if (record.storedSize > maxSize || record.dataSize > maxSize)
+				{
+					NazaraError("entry is too big to be decompressed");
+					return false;
+				}
+
+				int decompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(&m_fileData[record.dataOffset]), static_cast<char*>(buffer), static_cast<int>(record.storedSize), static_cast<int>(record.dataSize));
+				if (decompressedSize < 0 || static_cast<UInt64>(decompressedSize) != record.dataSize)
+				{
+					NazaraError("failed to decompress entry " + std::string(GetEntryPath(entryIndex)));
+					return false;
+				}
+
+				return true;
+			}
+		}
+
+		NazaraError("unhandled compression " + std::to_string(record.compression));
+		return false;
+	}
+
+	auto PackedArchive::ReadEntryRecord(std::size_t entryIndex) const -> EntryRecord
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(entryIndex < m_entryCount, "entry index out of range");
+
+		const UInt8* entryData = &m_entryTable[entryIndex * EntrySize];
+
+		EntryRecord record;
+		record.pathHash = ReadValue<UInt64>(&entryData[0]);
+		record.pathOffset = ReadValue<UInt32>(&entryData[8]);
+		record.pathSize = ReadValue<UInt32>(&entryData[12]);
+		record.nameOffset = ReadValue<UInt32>(&entryData[16]);
+		record.flags = ReadValue<UInt32>(&entryData[20]);
+		record.firstChild = ReadValue<UInt32>(&entryData[24]);
+		record.childCount = ReadValue<UInt32>(&entryData[28]);
+		record.dataOffset = ReadValue<UInt64>(&entryData[32]);
+		record.dataSize = ReadValue<UInt64>(&entryData[40]);
+		record.storedSize = ReadValue<UInt64>(&entryData[48]);
+		record.compression = ReadValue<UInt32>(&entryData[56]);
+
+		return record;
+	}
+}
@@ -0,0 +1,413 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/PackedArchiveBuilder.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/PackedArchive.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Utils/Algorithm.hpp>
+#include <lz4hc.h>
+#include <algorithm>
+#include <optional>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		std::optional<std::string> NormalizePath(std::string_view path)
+		{
+			std::string normalizedPath;
+			normalizedPath.reserve(path.size());
+
+			bool isValid = SplitStringAny(path, R"(\/)", [&](std::string_view part)
+			{
+				if (part.empty())
+					return true; //< "a//b" == "a/b"
+
+				if (part == "." || part == "..")
+					return false;
+
+				if (!normalizedPath.empty())
+					normalizedPath += '/';
+
+				normalizedPath += part;
+				return true;
+			});
+
+			if (!isValid || normalizedPath.empty())
+				return std::nullopt;
+
+			return normalizedPath;
+		}
+
+		std::string_view GetParentPath(std::string_view path)
+		{
+			std::size_t separatorPos = path.find_last_of('/');
+			if (separatorPos == path.npos)
+				return {};
+
+			return path.substr(0, separatorPos);
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::PackedArchiveBuilder
+	* \brief Core class that builds packed archive files, readable using PackedArchive
+	*
+	* \see PackedArchive
+	*/
+
+	/*!
+	* \brief Adds every file of a physical directory (recursively) to the archive
+	* \return true if the directory was successfully added
+	*
+	* \param path Path of the directory in the archive (empty for the archive root)
+	* \param directoryPath Path to the physical directory
+	* \param compression Compression used for the files
+	*/
+	bool PackedArchiveBuilder::AddDirectory(std::string_view path, const std::filesystem::path& directoryPath, PackedArchiveCompression compression)
+	{
+		std::error_code errorCode;
+		std::filesystem::recursive_directory_iterator it(directoryPath, errorCode);
+		if (errorCode)
+		{
+			NazaraError("failed to iterate \"" + PathToString(directoryPath) + "\": " + errorCode.message());
+			return false;
+		}
+
+		for (const std::filesystem::directory_entry& entry : it)
+		{
+			if (!entry.is_regular_file())
+				continue;
+
+			std::string filePath(path);
+			if (!filePath.empty())
+				filePath += '/';
+
+			filePath += PathToString(entry.path().lexically_relative(directoryPath));
+
+			if (!AddFile(filePath, entry.path(), compression))
+				return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Adds a physical file to the archive, it will be read when saving the archive
+	* \return true if the file was successfully added
+	*
+	* \param path Path of the file in the archive
+	* \param filePath Path to the physical file
+	* \param compression How the file should be compressed
+	*
+	* \remark If compression doesn't make the file smaller, it is stored uncompressed
+	*/
+	bool PackedArchiveBuilder::AddFile(std::string_view path, std::filesystem::path filePath, PackedArchiveCompression compression)
+	{
+		return AddFileEntry(path, std::move(filePath), compression);
+	}
+
+	/*!
+	* \brief Adds a file content to the archive
+	* \return true if the file was successfully added
+	*
+	* \param path Path of the file in the archive
+	* \param content File content
+	* \param compression How the file should be compressed
+	*
+	* \remark If compression doesn't make the file smaller, it is stored uncompressed
+	*/
+	bool PackedArchiveBuilder::AddFile(std::string_view path, std::vector<UInt8> content, PackedArchiveCompression compression)
+	{
+		return AddFileEntry(path, std::move(content), compression);
+	}
+
+	/*!
+	* \brief Writes the archive
+	* \return true if the archive was successfully written
+	*
+	* \param filePath Path of the archive file
+	* \param dataAlignment Alignment (in bytes) of each file content in the archive, must be a power of two
+	*/
+	bool PackedArchiveBuilder::Save(const std::filesystem::path& filePath, std::size_t dataAlignment) const
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssert(dataAlignment > 0 && (dataAlignment & (dataAlignment - 1)) == 0, "data alignment must be a power of two");
+
+		// Build the directory tree, every directory (including the root) has its children sorted by path
+		std::map<std::string, std::vector<std::string>, std::less<>> directories;
+		directories[""]; //< root
+
+		for (auto&& [path, fileEntry] : m_files)
+		{
+			std::string_view childPath = path;
+			for (;;)
+			{
+				std::string_view parentPath = GetParentPath(childPath);
+				if (m_files.find(parentPath) != m_files.end())
+				{
+					NazaraError("\"" + std::string(parentPath) + "\" is both a file and a directory");
+					return false;
+				}
+
+				auto it = directories.find(parentPath);
+				bool isNewDirectory = (it == directories.end());
+				if (isNewDirectory)
+					it = directories.emplace(std::string(parentPath), std::vector<std::string>{}).first;
+
+				it->second.emplace_back(childPath);
+
+				if (!isNewDirectory || parentPath.empty())
+					break;
+
+				childPath = parentPath;
+			}
+		}
+
+		// Breadth-first ordering so the children of a directory have contiguous indices
+		struct Node
+		{
+			std::string_view path;
+			const FileEntry* file;
+			UInt32 firstChild = 0;
+			UInt32 childCount = 0;
+			UInt64 dataOffset = 0;
+			UInt64 dataSize = 0;
+			UInt64 storedSize = 0;
+			PackedArchiveCompression compression = PackedArchiveCompression::None;
+		};
+
+		std::vector<Node> nodes;
+		nodes.push_back({ std::string_view{}, nullptr });
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			if (nodes[i].file)
+				continue;
+
+			std::vector<std::string>& children = directories.find(nodes[i].path)->second;
+			std::sort(children.begin(), children.end());
+
+			nodes[i].firstChild = SafeCast<UInt32>(nodes.size());
+			nodes[i].childCount = SafeCast<UInt32>(children.size());
+
+			for (const std::string& childPath : children)
+			{
+				auto fileIt = m_files.find(childPath);
+
+				Node& node = nodes.emplace_back();
+				node.path = childPath;
+				node.file = (fileIt != m_files.end()) ? &fileIt->second : nullptr;
+			}
+		}
+
+		if (nodes.size() > std::numeric_limits<UInt32>::max() - 1)
+		{
+			NazaraError("too many entries");
+			return false;
+		}
+
+		// Hashed path index (open addressing, at most half full)
+		std::size_t bucketCount = 2;
+		while (bucketCount < nodes.size() * 2)
+			bucketCount *= 2;
+
+		std::vector<UInt32> buckets(bucketCount, 0);
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			std::size_t bucketIndex = static_cast<std::size_t>(PackedArchive::ComputePathHash(nodes[i].path)) & (bucketCount - 1);
+			while (buckets[bucketIndex] != 0)
+				bucketIndex = (bucketIndex + 1) & (bucketCount - 1);
+
+			buckets[bucketIndex] = SafeCast<UInt32>(i + 1);
+		}
+
+		UInt64 stringTableSize = 0;
+		for (const Node& node : nodes)
+			stringTableSize += node.path.size();
+
+		UInt64 entryTableOffset = PackedArchive::HeaderSize;
+		UInt64 bucketTableOffset = entryTableOffset + nodes.size() * PackedArchive::EntrySize;
+		UInt64 stringTableOffset = bucketTableOffset + bucketCount * PackedArchive::BucketSize;
+		UInt64 dataOffset = Align(stringTableOffset + stringTableSize, UInt64(dataAlignment));
+
+		if (stringTableSize > std::numeric_limits<UInt32>::max())
+		{
+			NazaraError("paths are too long");
+			return false;
+		}
+
+		File file(filePath, OpenMode::WriteOnly | OpenMode::Truncate);
+		if (!file.IsOpen())
+		{
+			NazaraError("failed to open \"" + PathToString(filePath) + "\"");
+			return false;
+		}
+
+		// Write file contents first, the table of content is written afterwards once their offsets are known
+		std::vector<UInt8> padding(static_cast<std::size_t>(dataOffset), 0);
+		if (file.Write(padding.data(), padding.size()) != padding.size())
+		{
+			NazaraError("failed to write archive");
+			return false;
+		}
+
+		std::vector<UInt8> compressedContent;
+		for (Node& node : nodes)
+		{
+			if (!node.file)
+				continue;
+
+			std::vector<UInt8> loadedContent;
+			const std::vector<UInt8>* content = std::visit([&](auto&& source) -> const std::vector<UInt8>*
+			{
+				using T = std::decay_t<decltype(source)>;
+
+				if constexpr (std::is_same_v<T, std::filesystem::path>)
+				{
+					std::optional<std::vector<UInt8>> fileContent = File::ReadWhole(source);
+					if (!fileContent)
+						return nullptr;
+
+					loadedContent = std::move(*fileContent);
+					return &loadedContent;
+				}
+				else if constexpr (std::is_same_v<T, std::vector<UInt8>>)
+					return &source;
+				else
+					static_assert(AlwaysFalse<T>(), "incomplete visitor");
+			}, node.file->source);
+
+			if (!content)
+			{
+				NazaraError("failed to read \"" + std::string(node.path) + "\" content");
+				return false;
+			}
+
+			const UInt8* storedData = content->data();
+			node.dataSize = content->size();
+			node.storedSize = content->size();
+			node.compression = PackedArchiveCompression::None;
+
+			if (node.file->compression == PackedArchiveCompression::LZ4 && !content->empty() && content->size() <= std::numeric_limits<int>::max())
+			{
+				int sourceSize = static_cast<int>(content->size());
+				compressedContent.resize(LZ4_compressBound(sourceSize));
+
+				int compressedSize = LZ4_compress_HC(reinterpret_cast<const char*>(content->data()), reinterpret_cast<char*>(compressedContent.data()), sourceSize, static_cast<int>(compressedContent.size()), LZ4HC_CLEVEL_DEFAULT);
+				if (compressedSize > 0 && static_cast<std::size_t>(compressedSize) < content->size())
+				{
+					storedData = compressedContent.data();
+					node.storedSize = compressedSize;
+					node.compression = PackedArchiveCompression::LZ4;
+				}
+			}
+
+			UInt64 alignedOffset = Align(dataOffset, UInt64(dataAlignment));
+			padding.assign(static_cast<std::size_t>(alignedOffset - dataOffset), 0);
+			if (file.Write(padding.data(), padding.size()) != padding.size() || file.Write(storedData, static_cast<std::size_t>(node.storedSize)) != node.storedSize)
+			{
+				NazaraError("failed to write archive");
+				return false;
+			}
+
+			node.dataOffset = alignedOffset;
+			dataOffset = alignedOffset + node.storedSize;
+		}
+
+		if (!file.SetCursorPos(0))
+		{
+			NazaraError("failed to write archive");
+			return false;
+		}
+
+		ByteStream stream(&file);
+		stream.SetDataEndianness(Endianness::LittleEndian);
+
+		// Header
+		stream.Write(PackedArchive::Magic, sizeof(PackedArchive::Magic));
+		stream << PackedArchive::Version;
+		stream << SafeCast<UInt32>(nodes.size());
+		stream << SafeCast<UInt32>(bucketCount);
+		stream << entryTableOffset;
+		stream << bucketTableOffset;
+		stream << stringTableOffset;
+		stream << stringTableSize;
+		for (std::size_t i = 48; i < PackedArchive::HeaderSize; ++i)
+			stream << UInt8(0);
+
+		// Entry table
+		UInt32 pathOffset = 0;
+		for (const Node& node : nodes)
+		{
+			std::string_view parentPath = GetParentPath(node.path);
+			UInt32 nameOffset = (parentPath.empty()) ? 0 : SafeCast<UInt32>(parentPath.size() + 1);
+
+			stream << PackedArchive::ComputePathHash(node.path);
+			stream << pathOffset;
+			stream << SafeCast<UInt32>(node.path.size());
+			stream << nameOffset;
+			stream << ((node.file) ? UInt32(0) : PackedArchive::EntryFlag_Directory);
+			stream << node.firstChild;
+			stream << node.childCount;
+			stream << node.dataOffset;
+			stream << node.dataSize;
+			stream << node.storedSize;
+			stream << static_cast<UInt32>(node.compression);
+			stream << UInt32(0); //< reserved
+
+			pathOffset += SafeCast<UInt32>(node.path.size());
+		}
+
+		// Bucket table
+		for (UInt32 bucket : buckets)
+			stream << bucket;
+
+		// String table
+		for (const Node& node : nodes)
+			stream.Write(node.path.data(), node.path.size());
+
+		return true;
+	}
+
+	bool PackedArchiveBuilder::AddFileEntry(std::string_view path, std::variant<std::filesystem::path, std::vector<UInt8>> source, PackedArchiveCompression compression)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		std::optional<std::string> normalizedPath = NormalizePath(path);
+		if (!normalizedPath)
+		{
+			NazaraError("invalid path \"" + std::string(path) + "\"");
+			return false;
+		}
+
+		// A path can't be used both as a file and as a directory
+		for (std::string_view parentPath = GetParentPath(*normalizedPath); !parentPath.empty(); parentPath = GetParentPath(parentPath))
+		{
+			if (m_files.find(parentPath) != m_files.end())
+			{
+				NazaraError("\"" + std::string(parentPath) + "\" is already a file");
+				return false;
+			}
+		}
+
+		std::string directoryPrefix = *normalizedPath + '/';
+		if (auto it = m_files.lower_bound(directoryPrefix); it != m_files.end() && StartsWith(it->first, directoryPrefix))
+		{
+			NazaraError("\"" + *normalizedPath + "\" is already a directory");
+			return false;
+		}
+
+		FileEntry& fileEntry = m_files[std::move(*normalizedPath)];
+		fileEntry.source = std::move(source);
+		fileEntry.compression = compression;
+
+		return true;
+	}
+}
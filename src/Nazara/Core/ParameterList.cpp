@@ -15,6 +15,11 @@ namespace Nz
 	* \ingroup core
 	* \class Nz::ParameterList
 	* \brief Core class that represents a list of parameters
+	*
+	* Parameters are stored contiguously in insertion order, and looked up by comparing the hash of their key before their name.
+	* Parameters are usually few, which makes this faster than a hash map while sparing an allocation per parameter.
+	*
+	* \see ParameterKey
 	*/
 
 	/*!
@@ -38,9 +43,7 @@ namespace Nz
 	*/
 	void ParameterList::Clear()
 	{
-		for (auto& parameter : m_parameters)
-			DestroyValue(parameter.second);
-
+		m_parameterHashes.clear();
 		m_parameters.clear();
 	}
 
@@ -48,38 +51,38 @@ namespace Nz
 	* \brief Gets a parameter as a boolean
 	* \return result containing the value or an error
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param strict If true, prevent conversions from compatible types
 	*
 	* \remark If the parameter is not a boolean, a conversion may be performed if strict parameter is set to false, compatibles types are:
 	          Integer: 0 is interpreted as false, any other value is interpreted as true
 	          std::string:  Conversion obeys the rule as described by std::string::ToBool
 	*/
-	auto ParameterList::GetBooleanParameter(const std::string& name, bool strict) const -> Result<bool, Error>
+	auto ParameterList::GetBooleanParameter(const ParameterKey& key, bool strict) const -> Result<bool, Error>
 	{
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return Err(Error::MissingValue);
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType::Boolean:
-				return it->second.value.boolVal;
+				return parameter->value.boolVal;
 
 			case ParameterType::Integer:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return (it->second.value.intVal != 0);
+				return (parameter->value.intVal != 0);
 
 			case ParameterType::String:
 			{
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				if (it->second.value.stringVal == "1" || it->second.value.stringVal == "yes" || it->second.value.stringVal == "true")
+				if (parameter->value.stringVal == "1" || parameter->value.stringVal == "yes" || parameter->value.stringVal == "true")
 					return true;
-				else if (it->second.value.stringVal == "0" || it->second.value.stringVal == "no" || it->second.value.stringVal == "false")
+				else if (parameter->value.stringVal == "0" || parameter->value.stringVal == "no" || parameter->value.stringVal == "false")
 					return false;
 
 				return Err(Error::ConversionFailed);
@@ -100,21 +103,21 @@ namespace Nz
 	* \brief Gets a parameter as a color
 	* \return result containing the value or an error
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param strict If true, prevent conversions from compatible types
 	*
 	* \remark If the parameter is not a color, the function fails
 	*/
-	auto ParameterList::GetColorParameter(const std::string& name, bool /*strict*/) const -> Result<Color, Error>
+	auto ParameterList::GetColorParameter(const ParameterKey& key, bool /*strict*/) const -> Result<Color, Error>
 	{
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return Err(Error::MissingValue);
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType::Color:
-				return it->second.value.colorVal;
+				return parameter->value.colorVal;
 
 			case ParameterType::Boolean:
 			case ParameterType::Double:
@@ -133,36 +136,36 @@ namespace Nz
 	* \brief Gets a parameter as a double
 	* \return result containing the value or an error
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param strict If true, prevent conversions from compatible types
 	*
 	* \remark If the parameter is not a double, a conversion may be performed if strict parameter is set to false, compatibles types are:
 	          Integer: The integer value is converted to its double representation
 	          std::string:  Conversion obeys the rule as described by std::string::ToDouble
 	*/
-	auto ParameterList::GetDoubleParameter(const std::string& name, bool strict) const -> Result<double, Error>
+	auto ParameterList::GetDoubleParameter(const ParameterKey& key, bool strict) const -> Result<double, Error>
 	{
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return Err(Error::MissingValue);
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType::Double:
-				return it->second.value.doubleVal;
+				return parameter->value.doubleVal;
 
 			case ParameterType::Integer:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return static_cast<double>(it->second.value.intVal);
+				return static_cast<double>(parameter->value.intVal);
 
 			case ParameterType::String:
 			{
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				const std::string& str = it->second.value.stringVal;
+				const std::string& str = parameter->value.stringVal;
 
 				int& err = errno;
 				err = 0;
@@ -191,7 +194,7 @@ namespace Nz
 	* \brief Gets a parameter as an integer
 	* \return result containing the value or an error
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param strict If true, prevent conversions from compatible types
 	*
 	* \remark If the parameter is not an integer, a conversion may be performed if strict parameter is set to false, compatibles types are:
@@ -199,35 +202,35 @@ namespace Nz
 	          Double:  The floating-point value is truncated and converted to a integer
 	          std::string:  Conversion obeys the rule as described by std::string::ToInteger
 	*/
-	auto ParameterList::GetIntegerParameter(const std::string& name, bool strict) const -> Result<long long, Error>
+	auto ParameterList::GetIntegerParameter(const ParameterKey& key, bool strict) const -> Result<long long, Error>
 	{
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return Err(Error::MissingValue);
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType::Boolean:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return (it->second.value.boolVal) ? 1LL : 0LL;
+				return (parameter->value.boolVal) ? 1LL : 0LL;
 
 			case ParameterType::Double:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return static_cast<long long>(it->second.value.doubleVal);
+				return static_cast<long long>(parameter->value.doubleVal);
 
 			case ParameterType::Integer:
-				return it->second.value.intVal;
+				return parameter->value.intVal;
 
 			case ParameterType::String:
 			{
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				const std::string& str = it->second.value.stringVal;
+				const std::string& str = parameter->value.stringVal;
 
 				int& err = errno;
 				err = 0;
@@ -255,45 +258,45 @@ namespace Nz
 	* \brief Gets a parameter type
 	* \return result containing the parameter type or an error
 	*
-	* \param name Name of the variable
+	* \param key Key of the parameter
 	*
 	* \remark type must be a valid pointer to a ParameterType variable
 	*/
-	auto ParameterList::GetParameterType(const std::string& name) const -> Result<ParameterType, Error>
+	auto ParameterList::GetParameterType(const ParameterKey& key) const -> Result<ParameterType, Error>
 	{
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return Err(Error::MissingValue);
 
-		return it->second.type;
+		return parameter->type;
 	}
 
 	/*!
 	* \brief Gets a parameter as a pointer
 	* \return result containing the value or an error
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param strict If true, prevent conversions from compatible types
 	*
 	* \remark If the parameter is not a pointer, a conversion may be performed if strict parameter is set to false, compatibles types are:
 	          Userdata: The pointer part of the userdata is returned
 	*/
-	auto ParameterList::GetPointerParameter(const std::string& name, bool strict) const -> Result<void*, Error>
+	auto ParameterList::GetPointerParameter(const ParameterKey& key, bool strict) const -> Result<void*, Error>
 	{
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return Err(Error::MissingValue);
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType::Pointer:
-				return it->second.value.ptrVal;
+				return parameter->value.ptrVal;
 
 			case ParameterType::Userdata:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return it->second.value.userdataVal->ptr.Get();
+				return parameter->value.userdataVal->ptr.Get();
 
 			case ParameterType::Boolean:
 			case ParameterType::Color:
@@ -311,7 +314,7 @@ namespace Nz
 	* \brief Gets a parameter as a string
 	* \return result containing the value or an error
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param strict If true, prevent conversions from compatible types
 	*
 	* \remark If the parameter is not a string, a conversion may be performed if strict parameter is set to false, all types are compatibles:
@@ -323,52 +326,52 @@ namespace Nz
 	          Pointer:  Conversion obeys the rules of PointerToString
 	          Userdata: Conversion obeys the rules of PointerToString
 	*/
-	auto ParameterList::GetStringParameter(const std::string& name, bool strict) const -> Result<std::string, Error>
+	auto ParameterList::GetStringParameter(const ParameterKey& key, bool strict) const -> Result<std::string, Error>
 	{
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return Err(Error::MissingValue);
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType::Boolean:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return std::string{ (it->second.value.boolVal) ? "true" : "false" };
+				return std::string{ (parameter->value.boolVal) ? "true" : "false" };
 
 			case ParameterType::Color:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return it->second.value.colorVal.ToString();
+				return parameter->value.colorVal.ToString();
 
 			case ParameterType::Double:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return std::to_string(it->second.value.doubleVal);
+				return std::to_string(parameter->value.doubleVal);
 
 			case ParameterType::Integer:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return std::to_string(it->second.value.intVal);
+				return std::to_string(parameter->value.intVal);
 
 			case ParameterType::String:
-				return it->second.value.stringVal;
+				return parameter->value.stringVal;
 
 			case ParameterType::Pointer:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return PointerToString(it->second.value.ptrVal);
+				return PointerToString(parameter->value.ptrVal);
 
 			case ParameterType::Userdata:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return PointerToString(it->second.value.userdataVal->ptr);
+				return PointerToString(parameter->value.userdataVal->ptr);
 
 			case ParameterType::None:
 				if (strict)
@@ -384,29 +387,29 @@ namespace Nz
 	* \brief Gets a parameter as a string view
 	* \return result containing the value or an error
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param strict If true, prevent conversions from compatible types
 	*
 	* \remark If the parameter is not a string, a conversion may be performed if strict parameter is set to false, the following types are compatibles:
 			  Boolean:  A string view containing true or false
 			  None:     An empty string view is returned
 	*/
-	auto ParameterList::GetStringViewParameter(const std::string& name, bool strict) const -> Result<std::string_view, Error>
+	auto ParameterList::GetStringViewParameter(const ParameterKey& key, bool strict) const -> Result<std::string_view, Error>
 	{
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return Err(Error::MissingValue);
 
-		switch (it->second.type)
+		switch (parameter->type)
 		{
 			case ParameterType::Boolean:
 				if (strict)
 					return Err(Error::WouldRequireConversion);
 
-				return std::string_view{ (it->second.value.boolVal) ? "true" : "false" };
+				return std::string_view{ (parameter->value.boolVal) ? "true" : "false" };
 
 			case ParameterType::String:
-				return std::string_view{ it->second.value.stringVal };
+				return std::string_view{ parameter->value.stringVal };
 
 			case ParameterType::None:
 				if (strict)
@@ -429,176 +432,174 @@ namespace Nz
 	* \brief Gets a parameter as an userdata
 	* \return result containing the value or an error
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param strict If true, prevent conversions from compatible types
 	*
 	* \remark If the parameter is not an userdata, the function fails
 	*
 	* \see GetPointerParameter
 	*/
-	auto ParameterList::GetUserdataParameter(const std::string& name, bool /*strict*/) const -> Result<void*, Error>
+	auto ParameterList::GetUserdataParameter(const ParameterKey& key, bool /*strict*/) const -> Result<void*, Error>
 	{
-		auto it = m_parameters.find(name);
-		if (it == m_parameters.end())
+		const Parameter* parameter = FindParameter(key);
+		if (!parameter)
 			return Err(Error::MissingValue);
 
-		const auto& parameter = it->second;
-
-		if (parameter.type != ParameterType::Userdata)
+		if (parameter->type != ParameterType::Userdata)
 			return Err(Error::WrongType);
 
-		return parameter.value.userdataVal->ptr.Get();
+		return parameter->value.userdataVal->ptr.Get();
 	}
 
 	/*!
-	* \brief Checks whether the parameter list contains a parameter named `name`
+	* \brief Checks whether the parameter list contains a parameter named by `key`
 	* \return true if found
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	*/
-	bool ParameterList::HasParameter(const std::string& name) const
+	bool ParameterList::HasParameter(const ParameterKey& key) const
 	{
-		return m_parameters.find(name) != m_parameters.end();
+		return FindParameterIndex(key) != InvalidIndex;
 	}
 
 	/*!
-	* \brief Removes the parameter named `name`
+	* \brief Removes the parameter named by `key`
 	*
-	* Search for a parameter named `name` and remove it from the parameter list, freeing up its memory
+	* Search for a parameter named by `key` and remove it from the parameter list, freeing up its memory
 	* Nothing is done if the parameter is not present in the parameter list
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	*/
-	void ParameterList::RemoveParameter(const std::string& name)
+	void ParameterList::RemoveParameter(const ParameterKey& key)
 	{
-		auto it = m_parameters.find(name);
-		if (it != m_parameters.end())
+		std::size_t index = FindParameterIndex(key);
+		if (index != InvalidIndex)
 		{
-			DestroyValue(it->second);
-			m_parameters.erase(it);
+			m_parameterHashes.erase(m_parameterHashes.begin() + index);
+			m_parameters.erase(m_parameters.begin() + index);
 		}
 	}
 
 	/*!
-	* \brief Sets a null parameter named `name`
+	* \brief Sets a null parameter named by `key`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	*/
-	void ParameterList::SetParameter(const std::string& name)
+	void ParameterList::SetParameter(const ParameterKey& key)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType::None;
 	}
 
 	/*!
-	* \brief Sets a color parameter named `name`
+	* \brief Sets a color parameter named by `key`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The color value
 	*/
-	void ParameterList::SetParameter(const std::string& name, const Color& value)
+	void ParameterList::SetParameter(const ParameterKey& key, const Color& value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType::Color;
 
 		PlacementNew(&parameter.value.colorVal, value);
 	}
 
 	/*!
-	* \brief Sets a string parameter named `name`
+	* \brief Sets a string parameter named by `key`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The string value
 	*/
-	void ParameterList::SetParameter(const std::string& name, const std::string& value)
+	void ParameterList::SetParameter(const ParameterKey& key, const std::string& value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType::String;
 
 		PlacementNew(&parameter.value.stringVal, value);
 	}
 
 	/*!
-	* \brief Sets a string parameter named `name`
+	* \brief Sets a string parameter named by `key`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The string value
 	*/
-	void ParameterList::SetParameter(const std::string& name, const char* value)
+	void ParameterList::SetParameter(const ParameterKey& key, const char* value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType::String;
 
 		PlacementNew(&parameter.value.stringVal, value);
 	}
 
 	/*!
-	* \brief Sets a boolean parameter named `name`
+	* \brief Sets a boolean parameter named by `key`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The boolean value
 	*/
-	void ParameterList::SetParameter(const std::string& name, bool value)
+	void ParameterList::SetParameter(const ParameterKey& key, bool value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType::Boolean;
 		parameter.value.boolVal = value;
 	}
 
 	/*!
-	* \brief Sets a double parameter named `name`
+	* \brief Sets a double parameter named by `key`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The double value
 	*/
-	void ParameterList::SetParameter(const std::string& name, double value)
+	void ParameterList::SetParameter(const ParameterKey& key, double value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType::Double;
 		parameter.value.doubleVal = value;
 	}
 
 	/*!
-	* \brief Sets an integer parameter named `name`
+	* \brief Sets an integer parameter named by `key`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The integer value
 	*/
-	void ParameterList::SetParameter(const std::string& name, long long value)
+	void ParameterList::SetParameter(const ParameterKey& key, long long value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType::Integer;
 		parameter.value.intVal = value;
 	}
 
 	/*!
-	* \brief Sets a pointer parameter named `name`
+	* \brief Sets a pointer parameter named by `key`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The pointer value
 	*
 	* \remark This sets a raw pointer, this class takes no responsibility toward it,
 	          if you wish to destroy the pointed variable along with the parameter list, you should set a userdata
 	*/
-	void ParameterList::SetParameter(const std::string& name, void* value)
+	void ParameterList::SetParameter(const ParameterKey& key, void* value)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType::Pointer;
 		parameter.value.ptrVal = value;
 	}
@@ -615,10 +616,10 @@ namespace Nz
 		ss << "ParameterList(";
 		for (auto it = m_parameters.cbegin(); it != m_parameters.cend();)
 		{
-			const auto& parameter = it->second;
+			const auto& parameter = it->parameter;
 
-			ss << it->first << ": ";
-			switch (it->second.type)
+			ss << it->name << ": ";
+			switch (parameter.type)
 			{
 				case ParameterType::Boolean:
 					ss << "Boolean(" << parameter.value.boolVal << ")";
@@ -655,20 +656,20 @@ namespace Nz
 	}
 
 	/*!
-	* \brief Sets a userdata parameter named `name`
+	* \brief Sets a userdata parameter named by `key`
 	*
 	* If a parameter already exists with that name, it is destroyed and replaced by this call
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	* \param value The pointer value
 	* \param destructor The destructor function to be called upon parameter suppression
 	*
 	* \remark The destructor is called once when all copies of the userdata are destroyed, which means
 	          you can safely copy the parameter list around.
 	*/
-	void ParameterList::SetParameter(const std::string& name, void* value, Destructor destructor)
+	void ParameterList::SetParameter(const ParameterKey& key, void* value, Destructor destructor)
 	{
-		Parameter& parameter = CreateValue(name);
+		Parameter& parameter = CreateValue(key);
 		parameter.type = ParameterType::Userdata;
 		parameter.value.userdataVal = new Parameter::UserdataValue(destructor, value);
 	}
@@ -683,29 +684,32 @@ namespace Nz
 	{
 		Clear();
 
-		for (auto it = list.m_parameters.begin(); it != list.m_parameters.end(); ++it)
+		m_parameterHashes = list.m_parameterHashes;
+		m_parameters.reserve(list.m_parameters.size());
+
+		for (const Entry& entry : list.m_parameters)
 		{
-			Parameter& parameter = m_parameters[it->first];
+			Parameter& parameter = m_parameters.emplace_back(entry.name).parameter;
 
-			switch (it->second.type)
+			switch (entry.parameter.type)
 			{
 				case ParameterType::Boolean:
 				case ParameterType::Color:
 				case ParameterType::Double:
 				case ParameterType::Integer:
 				case ParameterType::Pointer:
-					std::memcpy(&parameter, &it->second, sizeof(Parameter));
+					std::memcpy(&parameter, &entry.parameter, sizeof(Parameter));
 					break;
 
 				case ParameterType::String:
 					parameter.type = ParameterType::String;
 
-					PlacementNew(&parameter.value.stringVal, it->second.value.stringVal);
+					PlacementNew(&parameter.value.stringVal, entry.parameter.value.stringVal);
 					break;
 
 				case ParameterType::Userdata:
 					parameter.type = ParameterType::Userdata;
-					parameter.value.userdataVal = it->second.value.userdataVal;
+					parameter.value.userdataVal = entry.parameter.value.userdataVal;
 					++(parameter.value.userdataVal->counter);
 					break;
 
@@ -721,25 +725,31 @@ namespace Nz
 	/*!
 	* \brief Create an uninitialized value of a set name
 	*
-	* \param name Name of the parameter
+	* \param key Key of the parameter
 	*
 	* \remark The previous value if any gets destroyed
 	*/
-	ParameterList::Parameter& ParameterList::CreateValue(const std::string& name)
+	ParameterList::Parameter& ParameterList::CreateValue(const ParameterKey& key)
 	{
-		std::pair<ParameterMap::iterator, bool> pair = m_parameters.insert(std::make_pair(name, Parameter()));
-		Parameter& parameter = pair.first->second;
-
-		if (!pair.second)
+		std::size_t index = FindParameterIndex(key);
+		if (index != InvalidIndex)
+		{
+			Parameter& parameter = m_parameters[index].parameter;
 			DestroyValue(parameter);
 
-		return parameter;
+			return parameter;
+		}
+
+		m_parameterHashes.push_back(key.GetHash());
+		return m_parameters.emplace_back(key.GetName()).parameter;
 	}
 
 	/*!
 	* \brief Destroys the value for the parameter
 	*
 	* \param parameter Parameter to destroy
+	*
+	* \remark The parameter type is reset to None
 	*/
 	void ParameterList::DestroyValue(Parameter& parameter)
 	{
@@ -768,6 +778,42 @@ namespace Nz
 			case ParameterType::Pointer:
 				break;
 		}
+
+		parameter.type = ParameterType::None;
+	}
+
+	/*!
+	* \brief Moves the value of a parameter to another (uninitialized) one
+	*
+	* \param source Parameter to move the value from, its type is reset to None
+	* \param destination Parameter to move the value to
+	*/
+	void ParameterList::MoveValue(Parameter& source, Parameter& destination)
+	{
+		switch (source.type)
+		{
+			case ParameterType::Boolean:
+			case ParameterType::Color:
+			case ParameterType::Double:
+			case ParameterType::Integer:
+			case ParameterType::Pointer:
+			case ParameterType::Userdata:
+				std::memcpy(&destination, &source, sizeof(Parameter));
+				break;
+
+			case ParameterType::String:
+				destination.type = ParameterType::String;
+
+				PlacementNew(&destination.value.stringVal, std::move(source.value.stringVal));
+				PlacementDestroy(&source.value.stringVal);
+				break;
+
+			case ParameterType::None:
+				destination.type = ParameterType::None;
+				break;
+		}
+
+		source.type = ParameterType::None;
 	}
 }
 
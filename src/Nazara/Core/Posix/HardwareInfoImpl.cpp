@@ -3,11 +3,104 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Posix/HardwareInfoImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
 #include <unistd.h>
+
+#if defined(NAZARA_PLATFORM_LINUX)
+	#include <sched.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
+#if defined(NAZARA_PLATFORM_LINUX)
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		bool ReadSysFile(const std::filesystem::path& path, std::string& content)
+		{
+			std::ifstream file(path);
+			if (!file || !std::getline(file, content))
+				return false;
+
+			return true;
+		}
+
+		bool ReadSysFileValue(const std::filesystem::path& path, long long& value)
+		{
+			std::string content;
+			if (!ReadSysFile(path, content))
+				return false;
+
+			char* end;
+			value = std::strtoll(content.c_str(), &end, 10);
+			return end != content.c_str();
+		}
+
+		// Parses kernel CPU lists such as "0-3,8,10-11"
+		std::vector<unsigned int> ParseCpuList(const std::string& cpuList)
+		{
+			std::vector<unsigned int> cpus;
+
+			const char* ptr = cpuList.c_str();
+			while (*ptr != '\0')
+			{
+				char* end;
+				unsigned long first = std::strtoul(ptr, &end, 10);
+				if (end == ptr)
+					break;
+
+				unsigned long last = first;
+				ptr = end;
+				if (*ptr == '-')
+				{
+					last = std::strtoul(ptr + 1, &end, 10);
+					ptr = end;
+				}
+
+				for (unsigned long cpu = first; cpu <= last; ++cpu)
+					cpus.push_back(static_cast<unsigned int>(cpu));
+
+				if (*ptr == ',')
+					ptr++;
+			}
+
+			return cpus;
+		}
+
+		bool ReadCpuList(const std::filesystem::path& path, std::vector<unsigned int>& cpus)
+		{
+			std::string content;
+			if (!ReadSysFile(path, content))
+				return false;
+
+			cpus = ParseCpuList(content);
+			return true;
+		}
+
+		// Parses cache sizes such as "32K" or "8M"
+		UInt64 ParseCacheSize(const std::string& size)
+		{
+			char* end;
+			UInt64 value = std::strtoull(size.c_str(), &end, 10);
+			switch (*end)
+			{
+				case 'K': return value * 1024;
+				case 'M': return value * 1024 * 1024;
+				case 'G': return value * 1024 * 1024 * 1024;
+				default:  return value;
+			}
+		}
+	}
+#endif
+
 	void HardwareInfoImpl::Cpuid(UInt32 functionId, UInt32 subFunctionId, UInt32 registers[4])
 	{
 	#if defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_INTEL)
@@ -32,6 +125,167 @@ namespace Nz
 	#endif
 	}
 
+	bool HardwareInfoImpl::FetchProcessorTopology(std::vector<HardwareInfo::LogicalProcessor>& logicalProcessors, std::array<HardwareInfo::CacheInfo, HardwareInfo::MaxCacheLevel>& caches)
+	{
+	#if defined(NAZARA_PLATFORM_LINUX)
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		const std::filesystem::path cpuFolder = "/sys/devices/system/cpu";
+
+		std::vector<unsigned int> cpus;
+		// Only list processors the OS can schedule threads on (some may be present but offline)
+		if (!ReadCpuList(cpuFolder / "online", cpus) || cpus.empty())
+			return false;
+
+		// Core ids are only unique in their package, make them global
+		std::map<std::pair<long long, long long>, unsigned int> coreIndices;
+
+		std::vector<long long> cpuCapacities;
+		long long maxCpuCapacity = 0;
+
+		for (unsigned int cpu : cpus)
+		{
+			std::filesystem::path topologyFolder = cpuFolder / ("cpu" + std::to_string(cpu)) / "topology";
+
+			long long coreId;
+			if (!ReadSysFileValue(topologyFolder / "core_id", coreId))
+				coreId = cpu;
+
+			long long packageId;
+			if (!ReadSysFileValue(topologyFolder / "physical_package_id", packageId) || packageId < 0)
+				packageId = 0;
+
+			auto coreIt = coreIndices.emplace(std::make_pair(packageId, coreId), static_cast<unsigned int>(coreIndices.size())).first;
+
+			auto& logicalProcessor = logicalProcessors.emplace_back();
+			logicalProcessor.index = cpu;
+			logicalProcessor.coreIndex = coreIt->second;
+			logicalProcessor.numaNode = 0;
+			logicalProcessor.packageIndex = static_cast<unsigned int>(packageId);
+			logicalProcessor.coreType = ProcessorCoreType::Performance;
+
+			// Relative performance of the core, only exposed on heterogeneous (ARM big.LITTLE) systems
+			long long capacity;
+			if (ReadSysFileValue(cpuFolder / ("cpu" + std::to_string(cpu)) / "cpu_capacity", capacity))
+			{
+				cpuCapacities.push_back(capacity);
+				maxCpuCapacity = std::max(maxCpuCapacity, capacity);
+			}
+		}
+
+		auto FindProcessor = [&](unsigned int cpu) -> HardwareInfo::LogicalProcessor*
+		{
+			auto it = std::find_if(logicalProcessors.begin(), logicalProcessors.end(), [&](const HardwareInfo::LogicalProcessor& processor) { return processor.index == cpu; });
+			return (it != logicalProcessors.end()) ? &*it : nullptr;
+		};
+
+		// Intel hybrid processors register one PMU per core type
+		std::vector<unsigned int> efficiencyCpus;
+		if (ReadCpuList("/sys/devices/cpu_atom/cpus", efficiencyCpus))
+		{
+			for (unsigned int cpu : efficiencyCpus)
+			{
+				if (HardwareInfo::LogicalProcessor* logicalProcessor = FindProcessor(cpu))
+					logicalProcessor->coreType = ProcessorCoreType::Efficiency;
+			}
+		}
+		else if (cpuCapacities.size() == logicalProcessors.size())
+		{
+			for (std::size_t i = 0; i < logicalProcessors.size(); ++i)
+			{
+				if (cpuCapacities[i] < maxCpuCapacity)
+					logicalProcessors[i].coreType = ProcessorCoreType::Efficiency;
+			}
+		}
+
+		std::error_code ec;
+		for (const auto& entry : std::filesystem::directory_iterator("/sys/devices/system/node", ec))
+		{
+			std::string folderName = entry.path().filename().string();
+			if (folderName.compare(0, 4, "node") != 0 || folderName.size() == 4)
+				continue;
+
+			char* end;
+			unsigned long nodeIndex = std::strtoul(folderName.c_str() + 4, &end, 10);
+			if (*end != '\0')
+				continue;
+
+			std::vector<unsigned int> nodeCpus;
+			if (!ReadCpuList(entry.path() / "cpulist", nodeCpus))
+				continue;
+
+			for (unsigned int cpu : nodeCpus)
+			{
+				if (HardwareInfo::LogicalProcessor* logicalProcessor = FindProcessor(cpu))
+					logicalProcessor->numaNode = static_cast<unsigned int>(nodeIndex);
+			}
+		}
+
+		// Caches of the first processor (performance core on hybrid systems)
+		const std::filesystem::path cacheFolder = cpuFolder / ("cpu" + std::to_string(cpus.front())) / "cache";
+		for (const auto& entry : std::filesystem::directory_iterator(cacheFolder, ec))
+		{
+			if (entry.path().filename().string().compare(0, 5, "index") != 0)
+				continue;
+
+			std::string type;
+			if (!ReadSysFile(entry.path() / "type", type) || (type != "Data" && type != "Unified"))
+				continue;
+
+			long long level;
+			if (!ReadSysFileValue(entry.path() / "level", level) || level < 1 || level > HardwareInfo::MaxCacheLevel)
+				continue;
+
+			HardwareInfo::CacheInfo& cache = caches[level - 1];
+
+			std::string size;
+			if (ReadSysFile(entry.path() / "size", size))
+				cache.size = ParseCacheSize(size);
+
+			long long lineSize;
+			if (ReadSysFileValue(entry.path() / "coherency_line_size", lineSize) && lineSize > 0)
+				cache.lineSize = static_cast<unsigned int>(lineSize);
+
+			std::vector<unsigned int> sharingCpus;
+			if (ReadCpuList(entry.path() / "shared_cpu_list", sharingCpus))
+				cache.sharingThreadCount = static_cast<unsigned int>(sharingCpus.size());
+		}
+
+		return true;
+	#else
+		NazaraUnused(logicalProcessors);
+		NazaraUnused(caches);
+
+		return false;
+	#endif
+	}
+
+	bool HardwareInfoImpl::GetCurrentThreadAffinity(std::vector<unsigned int>& logicalProcessorIndices)
+	{
+	#if defined(NAZARA_PLATFORM_LINUX)
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+
+		if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+		{
+			NazaraError("failed to get thread affinity: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		for (unsigned int processorIndex = 0; processorIndex < CPU_SETSIZE; ++processorIndex)
+		{
+			if (CPU_ISSET(processorIndex, &cpuSet))
+				logicalProcessorIndices.push_back(processorIndex);
+		}
+
+		return true;
+	#else
+		NazaraUnused(logicalProcessorIndices);
+
+		return false;
+	#endif
+	}
+
 	unsigned int HardwareInfoImpl::GetProcessorCount()
 	{
 		// Simpler (and more portable) than using CPUID
@@ -75,4 +329,36 @@ namespace Nz
 		#endif
 	#endif
 	}
+
+	bool HardwareInfoImpl::SetCurrentThreadAffinity(const std::vector<unsigned int>& logicalProcessorIndices)
+	{
+	#if defined(NAZARA_PLATFORM_LINUX)
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+
+		for (unsigned int processorIndex : logicalProcessorIndices)
+		{
+			if (processorIndex >= CPU_SETSIZE)
+			{
+				NazaraError("logical processor index " + std::to_string(processorIndex) + " is out of range");
+				return false;
+			}
+
+			CPU_SET(processorIndex, &cpuSet);
+		}
+
+		if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+		{
+			NazaraError("failed to set thread affinity: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		return true;
+	#else
+		// macOS only supports affinity hints between threads (thread_policy_set), not pinning
+		NazaraUnused(logicalProcessorIndices);
+
+		return false;
+	#endif
+	}
 }
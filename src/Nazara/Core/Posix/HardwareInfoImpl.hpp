@@ -8,6 +8,9 @@
 #define NAZARA_CORE_POSIX_HARDWAREINFOIMPL_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <array>
+#include <vector>
 
 namespace Nz
 {
@@ -15,9 +18,12 @@ namespace Nz
 	{
 		public:
 			static void Cpuid(UInt32 functionId, UInt32 subFunctionId, UInt32 registers[4]);
+			static bool FetchProcessorTopology(std::vector<HardwareInfo::LogicalProcessor>& logicalProcessors, std::array<HardwareInfo::CacheInfo, HardwareInfo::MaxCacheLevel>& caches);
+			static bool GetCurrentThreadAffinity(std::vector<unsigned int>& logicalProcessorIndices);
 			static unsigned int GetProcessorCount();
 			static UInt64 GetTotalMemory();
 			static bool IsCpuidSupported();
+			static bool SetCurrentThreadAffinity(const std::vector<unsigned int>& logicalProcessorIndices);
 	};
 }
 
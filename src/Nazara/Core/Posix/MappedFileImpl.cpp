@@ -0,0 +1,85 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Utils/CallOnExit.hpp>
+#include <fcntl.h>
+#include <limits>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	MappedFileImpl::MappedFileImpl() :
+	m_mappedPtr(nullptr),
+	m_size(0)
+	{
+	}
+
+	MappedFileImpl::~MappedFileImpl()
+	{
+		if (m_mappedPtr)
+			munmap(m_mappedPtr, static_cast<std::size_t>(m_size));
+	}
+
+	const void* MappedFileImpl::GetPointer() const
+	{
+		return m_mappedPtr;
+	}
+
+	UInt64 MappedFileImpl::GetSize() const
+	{
+		return m_size;
+	}
+
+	bool MappedFileImpl::Open(const std::filesystem::path& filePath)
+	{
+		int fileDescriptor = open(filePath.generic_u8string().data(), O_RDONLY);
+		if (fileDescriptor == -1)
+		{
+			NazaraError("Failed to open \"" + filePath.generic_u8string() + "\" : " + Error::GetLastSystemError());
+			return false;
+		}
+
+		// The mapping stays valid once the file descriptor is closed
+		CallOnExit closeOnExit([&]
+		{
+			close(fileDescriptor);
+		});
+
+		struct stat fileInfo;
+		if (fstat(fileDescriptor, &fileInfo) == -1)
+		{
+			NazaraError("Failed to get \"" + filePath.generic_u8string() + "\" size: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		m_size = static_cast<UInt64>(fileInfo.st_size);
+		if (m_size == 0)
+			return true; //< mmap doesn't support empty mappings
+
+		if (m_size > std::numeric_limits<std::size_t>::max())
+		{
+			NazaraError("\"" + filePath.generic_u8string() + "\" is too big to be mapped");
+			return false;
+		}
+
+		void* mappedPtr = mmap(nullptr, static_cast<std::size_t>(m_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		if (mappedPtr == MAP_FAILED)
+		{
+			NazaraError("Failed to map \"" + filePath.generic_u8string() + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		// Files are mostly parsed from start to end, let the kernel read ahead aggressively
+		posix_madvise(mappedPtr, static_cast<std::size_t>(m_size), POSIX_MADV_SEQUENTIAL);
+
+		m_mappedPtr = mappedPtr;
+		return true;
+	}
+}
@@ -3,7 +3,10 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Posix/TaskSchedulerImpl.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Functor.hpp>
+#include <cstdint>
 #include <Nazara/Core/Debug.hpp>
 
 #if defined(NAZARA_PLATFORM_MACOS)
@@ -12,10 +15,24 @@
 
 namespace Nz
 {
+	void TaskSchedulerImpl::AddTask(Functor* task)
+	{
+		// Tasks spawned by a worker are kept local to that worker (until another worker steals them)
+		unsigned int workerIndex = s_currentWorkerIndex;
+		if (workerIndex == InvalidWorkerIndex)
+			workerIndex = s_nextWorkerIndex.fetch_add(1, std::memory_order_relaxed) % s_workerCount;
+
+		PushTask(workerIndex, task);
+
+		pthread_mutex_lock(&s_mutexSleep);
+		pthread_cond_signal(&s_cvNotEmpty);
+		pthread_mutex_unlock(&s_mutexSleep);
+	}
+
 	bool TaskSchedulerImpl::Initialize(unsigned int workerCount)
 	{
 		if (IsInitialized())
-			return true; // Déjà initialisé
+			return true; // Already initialized
 
 		#if NAZARA_CORE_SAFE
 		if (workerCount == 0)
@@ -26,25 +43,28 @@ namespace Nz
 		#endif
 
 		s_workerCount = workerCount;
-		s_isDone = false;
-		s_isWaiting = false;
+		s_nextWorkerIndex = 0;
+		s_pendingTaskCount = 0;
+		s_queuedTaskCount = 0;
 		s_shouldFinish = false;
 
-		s_threads.reset(new pthread_t[workerCount]);
+		s_workers.reset(new Worker[workerCount]);
 
-		// On initialise les conditions variables, mutex et barrière.
 		pthread_cond_init(&s_cvEmpty, nullptr);
 		pthread_cond_init(&s_cvNotEmpty, nullptr);
-		pthread_mutex_init(&s_mutexQueue, nullptr);
+		pthread_mutex_init(&s_mutexSleep, nullptr);
 		pthread_barrier_init(&s_barrier, nullptr, workerCount + 1);
 
+		for (unsigned int i = 0; i < s_workerCount; ++i)
+			pthread_mutex_init(&s_workers[i].queueMutex, nullptr);
+
 		for (unsigned int i = 0; i < s_workerCount; ++i)
 		{
-			// Le thread va se lancer, attendre que tous se créent et attendre d'être réveillé.
-			pthread_create(&s_threads[i], nullptr, WorkerProc, nullptr);
+			// The thread will start, wait for every other worker to be created and then wait for tasks
+			pthread_create(&s_workers[i].thread, nullptr, WorkerProc, reinterpret_cast<void*>(static_cast<std::uintptr_t>(i)));
 		}
 
-		pthread_barrier_wait(&s_barrier); // On attend que les enfants soient bien créés.
+		pthread_barrier_wait(&s_barrier); // Wait for every worker to be started
 
 		return true;
 	}
@@ -54,19 +74,39 @@ namespace Nz
 		return s_workerCount > 0;
 	}
 
-	void TaskSchedulerImpl::Run(Functor** tasks, unsigned int count)
+	bool TaskSchedulerImpl::IsWorkerThread()
 	{
-		// On s'assure que des tâches ne sont pas déjà en cours
-		Wait();
-
-		pthread_mutex_lock(&s_mutexQueue);
-		s_isDone = false;
+		return s_currentWorkerIndex != InvalidWorkerIndex;
+	}
 
+	void TaskSchedulerImpl::Run(Functor** tasks, std::size_t count)
+	{
+		// Distribute the tasks evenly between workers, load will then be balanced by work-stealing
+		unsigned int workerIndex = s_nextWorkerIndex.fetch_add(1, std::memory_order_relaxed);
 		while (count--)
-			s_tasks.push(*tasks++);
+			PushTask(workerIndex++ % s_workerCount, *tasks++);
 
-		pthread_cond_signal(&s_cvNotEmpty);
-		pthread_mutex_unlock(&s_mutexQueue);
+		pthread_mutex_lock(&s_mutexSleep);
+		pthread_cond_broadcast(&s_cvNotEmpty);
+		pthread_mutex_unlock(&s_mutexSleep);
+	}
+
+	bool TaskSchedulerImpl::RunPendingTask()
+	{
+		unsigned int workerIndex = s_currentWorkerIndex;
+
+		Functor* task = nullptr;
+		if (workerIndex != InvalidWorkerIndex)
+			task = PopTask(workerIndex);
+
+		if (!task)
+			task = StealTask(workerIndex);
+
+		if (!task)
+			return false;
+
+		ExecuteTask(task);
+		return true;
 	}
 
 	void TaskSchedulerImpl::Uninitialize()
@@ -79,25 +119,31 @@ namespace Nz
 		}
 		#endif
 
-		// On réveille les threads pour qu'ils sortent de la boucle et terminent.
-		pthread_mutex_lock(&s_mutexQueue);
-		// On commence par vider la queue et demander qu'ils s'arrêtent.
-		std::queue<Functor*> emptyQueue;
-		std::swap(s_tasks, emptyQueue);
+		// Wake up every worker so they can exit their loop
+		pthread_mutex_lock(&s_mutexSleep);
 		s_shouldFinish = true;
 		pthread_cond_broadcast(&s_cvNotEmpty);
-		pthread_mutex_unlock(&s_mutexQueue);
+		pthread_mutex_unlock(&s_mutexSleep);
 
-		// On attend que chaque thread se termine
 		for (unsigned int i = 0; i < s_workerCount; ++i)
-			pthread_join(s_threads[i], nullptr);
+			pthread_join(s_workers[i].thread, nullptr);
+
+		// Discard tasks which weren't executed and release resources
+		for (unsigned int i = 0; i < s_workerCount; ++i)
+		{
+			Worker& worker = s_workers[i];
+			for (Functor* task : worker.queue)
+				delete task;
+
+			pthread_mutex_destroy(&worker.queueMutex);
+		}
 
-		// Et on libère les ressources
 		pthread_barrier_destroy(&s_barrier);
 		pthread_cond_destroy(&s_cvEmpty);
 		pthread_cond_destroy(&s_cvNotEmpty);
-		pthread_mutex_destroy(&s_mutexQueue);
+		pthread_mutex_destroy(&s_mutexSleep);
 
+		s_workers.reset();
 		s_workerCount = 0;
 	}
 
@@ -111,91 +157,132 @@ namespace Nz
 		}
 		#endif
 
-		Wait();
+		// Help the workers as long as there are queued tasks, then sleep until the running ones are done
+		while (RunPendingTask());
+
+		pthread_mutex_lock(&s_mutexSleep);
+		while (s_pendingTaskCount.load(std::memory_order_acquire) > 0)
+			pthread_cond_wait(&s_cvEmpty, &s_mutexSleep);
+		pthread_mutex_unlock(&s_mutexSleep);
 	}
 
-	Functor* TaskSchedulerImpl::PopQueue()
+	void TaskSchedulerImpl::ExecuteTask(Functor* task)
 	{
-		Functor* task = nullptr;
+		task->Run();
+		delete task;
 
-		pthread_mutex_lock(&s_mutexQueue);
-
-		if (!s_tasks.empty())
+		if (s_pendingTaskCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
 		{
-			task = s_tasks.front();
-			s_tasks.pop();
+			// That was the last task, wake up threads waiting on WaitForTasks
+			pthread_mutex_lock(&s_mutexSleep);
+			pthread_cond_broadcast(&s_cvEmpty);
+			pthread_mutex_unlock(&s_mutexSleep);
 		}
+	}
+
+	Functor* TaskSchedulerImpl::PopTask(unsigned int workerIndex)
+	{
+		Worker& worker = s_workers[workerIndex];
 
-		pthread_mutex_unlock(&s_mutexQueue);
+		Functor* task = nullptr;
+
+		// The owner takes its most recent task (LIFO), which is the most likely to be hot in cache
+		pthread_mutex_lock(&worker.queueMutex);
+		if (!worker.queue.empty())
+		{
+			task = worker.queue.back();
+			worker.queue.pop_back();
+			s_queuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+		pthread_mutex_unlock(&worker.queueMutex);
 
 		return task;
 	}
 
-	void TaskSchedulerImpl::Wait()
+	void TaskSchedulerImpl::PushTask(unsigned int workerIndex, Functor* task)
 	{
-		if (s_isDone)
-			return;
+		Worker& worker = s_workers[workerIndex];
 
-		pthread_mutex_lock(&s_mutexQueue);
-		s_isWaiting = true;
-		pthread_cond_broadcast(&s_cvNotEmpty);
-		pthread_cond_wait(&s_cvEmpty, &s_mutexQueue);
-		pthread_mutex_unlock(&s_mutexQueue);
+		s_pendingTaskCount.fetch_add(1, std::memory_order_relaxed);
 
-		s_isDone = true;
+		pthread_mutex_lock(&worker.queueMutex);
+		worker.queue.push_back(task);
+		s_queuedTaskCount.fetch_add(1, std::memory_order_release);
+		pthread_mutex_unlock(&worker.queueMutex);
 	}
 
-	void* TaskSchedulerImpl::WorkerProc(void* /*userdata*/)
+	Functor* TaskSchedulerImpl::StealTask(unsigned int workerIndex)
 	{
-		// On s'assure que tous les threads soient correctement lancés.
-		pthread_barrier_wait(&s_barrier);
+		if (s_queuedTaskCount.load(std::memory_order_acquire) == 0)
+			return nullptr;
 
-		// On quitte s'il doit terminer.
-		while (!s_shouldFinish)
+		// Threads which are not part of the pool start looking at the first worker
+		unsigned int firstVictim = (workerIndex != InvalidWorkerIndex) ? workerIndex + 1 : 0;
+		for (unsigned int i = 0; i < s_workerCount; ++i)
 		{
-			Functor* task = PopQueue();
+			unsigned int victimIndex = (firstVictim + i) % s_workerCount;
+			if (victimIndex == workerIndex)
+				continue;
 
-			if (task)
+			Worker& victim = s_workers[victimIndex];
+
+			// Don't wait on a worker currently using its queue, try the next one instead
+			if (pthread_mutex_trylock(&victim.queueMutex) != 0)
+				continue;
+
+			Functor* task = nullptr;
+			if (!victim.queue.empty())
 			{
-				// On exécute la tâche avant de la supprimer
-				task->Run();
-				delete task;
+				// Steal the oldest task (FIFO), which is the most likely to spawn more work
+				task = victim.queue.front();
+				victim.queue.pop_front();
+				s_queuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
 			}
-			else
-			{
-				pthread_mutex_lock(&s_mutexQueue);
-				if (s_tasks.empty())
-					s_isDone = true;
+			pthread_mutex_unlock(&victim.queueMutex);
 
-				while (!(!s_tasks.empty() || s_isWaiting || s_shouldFinish))
-					pthread_cond_wait(&s_cvNotEmpty, &s_mutexQueue);
+			if (task)
+				return task;
+		}
 
-				if (s_tasks.empty() && s_isWaiting)
-				{
-					// On prévient le thread qui attend que les tâches soient effectuées.
-					s_isWaiting = false;
-					pthread_cond_signal(&s_cvEmpty);
-				}
+		return nullptr;
+	}
 
-				pthread_mutex_unlock(&s_mutexQueue);
-			}
+	void* TaskSchedulerImpl::WorkerProc(void* userdata)
+	{
+		unsigned int workerIndex = static_cast<unsigned int>(reinterpret_cast<std::uintptr_t>(userdata));
+		s_currentWorkerIndex = workerIndex;
+
+		// Make sure every thread has been started
+		pthread_barrier_wait(&s_barrier);
+
+		while (!s_shouldFinish)
+		{
+			if (RunPendingTask())
+				continue;
+
+			// Sleep until new tasks are queued, the queued task count is checked under the mutex to prevent missing a wake-up
+			pthread_mutex_lock(&s_mutexSleep);
+			while (s_queuedTaskCount.load(std::memory_order_acquire) == 0 && !s_shouldFinish)
+				pthread_cond_wait(&s_cvNotEmpty, &s_mutexSleep);
+			pthread_mutex_unlock(&s_mutexSleep);
 		}
 
 		return nullptr;
 	}
 
-	std::queue<Functor*> TaskSchedulerImpl::s_tasks;
-	std::unique_ptr<pthread_t[]> TaskSchedulerImpl::s_threads;
-	std::atomic<bool> TaskSchedulerImpl::s_isDone;
-	std::atomic<bool> TaskSchedulerImpl::s_isWaiting;
+	std::unique_ptr<TaskSchedulerImpl::Worker[]> TaskSchedulerImpl::s_workers;
 	std::atomic<bool> TaskSchedulerImpl::s_shouldFinish;
+	std::atomic<std::size_t> TaskSchedulerImpl::s_pendingTaskCount;
+	std::atomic<std::size_t> TaskSchedulerImpl::s_queuedTaskCount;
+	std::atomic<unsigned int> TaskSchedulerImpl::s_nextWorkerIndex;
 	unsigned int TaskSchedulerImpl::s_workerCount;
+	thread_local unsigned int TaskSchedulerImpl::s_currentWorkerIndex = TaskSchedulerImpl::InvalidWorkerIndex;
 
-	pthread_mutex_t TaskSchedulerImpl::s_mutexQueue;
+	pthread_mutex_t TaskSchedulerImpl::s_mutexSleep;
 	pthread_cond_t TaskSchedulerImpl::s_cvEmpty;
 	pthread_cond_t TaskSchedulerImpl::s_cvNotEmpty;
 	pthread_barrier_t TaskSchedulerImpl::s_barrier;
-	
+
 #if defined(NAZARA_PLATFORM_MACOS)
     //Code from https://blog.albertarmea.com/post/47089939939/using-pthreadbarrier-on-mac-os-x
 	int TaskSchedulerImpl::pthread_barrier_init(pthread_barrier_t *barrier, const pthread_barrierattr_t *attr, unsigned int count)
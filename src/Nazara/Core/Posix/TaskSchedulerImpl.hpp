@@ -9,8 +9,8 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <atomic>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <pthread.h>
 
 #if defined(NAZARA_PLATFORM_MACOS)
@@ -34,25 +34,40 @@ namespace Nz
 			TaskSchedulerImpl() = delete;
 			~TaskSchedulerImpl() = delete;
 
+			static void AddTask(Functor* task);
 			static bool Initialize(unsigned int workerCount);
 			static bool IsInitialized();
-			static void Run(Functor** tasks, unsigned int count);
+			static bool IsWorkerThread();
+			static void Run(Functor** tasks, std::size_t count);
+			static bool RunPendingTask();
 			static void Uninitialize();
 			static void WaitForTasks();
 
 		private:
-			static Functor* PopQueue();
-			static void Wait();
+			static void ExecuteTask(Functor* task);
+			static Functor* PopTask(unsigned int workerIndex);
+			static void PushTask(unsigned int workerIndex, Functor* task);
+			static Functor* StealTask(unsigned int workerIndex);
 			static void* WorkerProc(void* userdata);
 
-			static std::queue<Functor*> s_tasks;
-			static std::unique_ptr<pthread_t[]> s_threads;
-			static std::atomic<bool> s_isDone;
-			static std::atomic<bool> s_isWaiting;
+			struct Worker
+			{
+				std::deque<Functor*> queue;
+				pthread_mutex_t queueMutex;
+				pthread_t thread;
+			};
+
+			static constexpr unsigned int InvalidWorkerIndex = ~0U;
+
+			static std::unique_ptr<Worker[]> s_workers;
 			static std::atomic<bool> s_shouldFinish;
+			static std::atomic<std::size_t> s_pendingTaskCount; //< queued and running tasks
+			static std::atomic<std::size_t> s_queuedTaskCount;
+			static std::atomic<unsigned int> s_nextWorkerIndex;
 			static unsigned int s_workerCount;
+			static thread_local unsigned int s_currentWorkerIndex;
 
-			static pthread_mutex_t s_mutexQueue;
+			static pthread_mutex_t s_mutexSleep;
 			static pthread_cond_t s_cvEmpty;
 			static pthread_cond_t s_cvNotEmpty;
 			static pthread_barrier_t s_barrier;
@@ -0,0 +1,344 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		struct ProfilerEvent
+		{
+			UInt64 timestamp;
+			const ProfilerZoneInfo* zone;
+			UInt8 type;
+		};
+
+		// Event buffers are allocated by chunks when needed, threads recording few events don't pay for the maximum event count
+		constexpr std::size_t EventChunkSize = 4096;
+		constexpr std::size_t EventChunkCount = (NAZARA_CORE_PROFILER_THREAD_EVENTS + EventChunkSize - 1) / EventChunkSize;
+
+		// Events are only written by their thread and published by incrementing eventCount,
+		// which allows them to be read at any time without locking the recording thread
+		struct ThreadEvents
+		{
+			ProfilerEvent& GetEvent(std::size_t eventIndex) const
+			{
+				return eventChunks[eventIndex / EventChunkSize][eventIndex % EventChunkSize];
+			}
+
+			std::array<std::unique_ptr<ProfilerEvent[]>, EventChunkCount> eventChunks;
+			std::atomic_size_t droppedEventCount = 0;
+			std::atomic_size_t eventCount = 0;
+			std::atomic_uint captureId = 0;
+			std::string threadName;
+			unsigned int threadId;
+		};
+
+		std::atomic_uint s_remainingFrameCount = 0;
+		std::atomic<Int64> s_captureStart = 0; //< steady clock time, in nanoseconds
+
+		Int64 GetTimestamp()
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+		std::mutex s_threadEventsMutex;
+		std::vector<std::shared_ptr<ThreadEvents>> s_threadEvents;
+
+		ThreadEvents& GetThreadEvents()
+		{
+			thread_local std::shared_ptr<ThreadEvents> threadEvents = []
+			{
+				auto events = std::make_shared<ThreadEvents>();
+
+				// Keep a reference to the events of the thread, so they can be exported after the thread exits
+				std::lock_guard<std::mutex> lock(s_threadEventsMutex);
+				events->threadId = static_cast<unsigned int>(s_threadEvents.size());
+				events->threadName = "Thread #" + std::to_string(events->threadId);
+				s_threadEvents.push_back(events);
+
+				return events;
+			}();
+
+			return *threadEvents;
+		}
+
+		void AppendJsonString(std::string& str, std::string_view value)
+		{
+			str += '"';
+			for (char c : value)
+			{
+				switch (c)
+				{
+					case '"':  str += "\\\""; break;
+					case '\\': str += "\\\\"; break;
+					case '\n': str += "\\n"; break;
+					case '\r': str += "\\r"; break;
+					case '\t': str += "\\t"; break;
+					default:
+						if (static_cast<unsigned char>(c) < 0x20)
+							continue;
+
+						str += c;
+						break;
+				}
+			}
+			str += '"';
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::Profiler
+	* \brief Core class that records CPU zones and frames, to be exported in the Chrome trace event format
+	*
+	* Zones are recorded using the NazaraProfileZone macro (which begins a zone until the end of the current scope) and frames
+	* using NazaraProfileFrame. While no capture is running, a zone costs a relaxed atomic load.
+	*
+	* Each thread records its events in its own buffer (growing up to NAZARA_CORE_PROFILER_THREAD_EVENTS entries) without any lock.
+	* The resulting trace can be opened with chrome://tracing, Perfetto or Speedscope.
+	*/
+
+	/*!
+	* \brief Gets the number of events which couldn't be recorded during the last capture because a thread buffer was full
+	* \return Number of dropped events
+	*/
+	std::size_t Profiler::GetDroppedEventCount()
+	{
+		unsigned int captureId = GetCaptureId();
+
+		std::size_t droppedEventCount = 0;
+
+		std::lock_guard<std::mutex> lock(s_threadEventsMutex);
+		for (const auto& threadEventsPtr : s_threadEvents)
+		{
+			if (threadEventsPtr->captureId.load(std::memory_order_acquire) == captureId)
+				droppedEventCount += threadEventsPtr->droppedEventCount.load(std::memory_order_relaxed);
+		}
+
+		return droppedEventCount;
+	}
+
+	/*!
+	* \brief Saves the events of the last capture to a file, in the Chrome trace event format (JSON)
+	* \return True if the file has been written
+	*
+	* \param filePath Path of the output file
+	*
+	* \see ToChromeTrace
+	*/
+	bool Profiler::SaveChromeTrace(const std::filesystem::path& filePath)
+	{
+		File file(filePath, OpenMode::WriteOnly | OpenMode::Truncate);
+		if (!file.IsOpen())
+		{
+			NazaraError("failed to open \"" + PathToString(filePath) + '"');
+			return false;
+		}
+
+		std::string trace = ToChromeTrace();
+		if (file.Write(trace.data(), trace.size()) != trace.size())
+		{
+			NazaraError("failed to write trace to \"" + PathToString(filePath) + '"');
+			return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Sets the name of the calling thread as it will appear in exported traces
+	*
+	* \param threadName Name of the thread
+	*/
+	void Profiler::SetThreadName(std::string threadName)
+	{
+		ThreadEvents& threadEvents = GetThreadEvents();
+
+		std::lock_guard<std::mutex> lock(s_threadEventsMutex);
+		threadEvents.threadName = std::move(threadName);
+	}
+
+	/*!
+	* \brief Starts a new capture, discarding the events of the previous one
+	*
+	* \param frameCount If non-zero, the capture will automatically stop after this number of frames (see MarkFrame)
+	*/
+	void Profiler::StartCapture(unsigned int frameCount)
+	{
+		s_isCapturing.store(false, std::memory_order_relaxed);
+
+		s_captureStart.store(GetTimestamp(), std::memory_order_relaxed);
+		s_remainingFrameCount.store(frameCount, std::memory_order_relaxed);
+
+		// Threads reset their buffer when they record their first event of a new capture
+		s_captureId.fetch_add(1, std::memory_order_release);
+		s_isCapturing.store(true, std::memory_order_release);
+	}
+
+	/*!
+	* \brief Stops the current capture, recorded events are kept until the next capture is started
+	*/
+	void Profiler::StopCapture()
+	{
+		s_isCapturing.store(false, std::memory_order_release);
+	}
+
+	/*!
+	* \brief Exports the events of the last capture in the Chrome trace event format (JSON)
+	* \return A string holding the trace
+	*
+	* \remark This should be called after StopCapture, events recorded while exporting may be missing
+	*/
+	std::string Profiler::ToChromeTrace()
+	{
+		unsigned int captureId = GetCaptureId();
+
+		std::string trace = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		bool first = true;
+
+		auto BeginEvent = [&](const char* phase, unsigned int threadId)
+		{
+			if (!first)
+				trace += ",\n";
+
+			first = false;
+
+			trace += "{\"ph\":\"";
+			trace += phase;
+			trace += "\",\"pid\":0,\"tid\":";
+			trace += std::to_string(threadId);
+		};
+
+		auto AppendTimestamp = [&](UInt64 timestamp)
+		{
+			// Chrome trace timestamps are in microseconds
+			trace += ",\"ts\":";
+			trace += std::to_string(timestamp / 1000);
+			trace += '.';
+
+			std::string nanoseconds = std::to_string(timestamp % 1000);
+			trace.append(3 - nanoseconds.size(), '0');
+			trace += nanoseconds;
+		};
+
+		std::lock_guard<std::mutex> lock(s_threadEventsMutex);
+		for (const auto& threadEventsPtr : s_threadEvents)
+		{
+			const ThreadEvents& threadEvents = *threadEventsPtr;
+			if (threadEvents.captureId.load(std::memory_order_acquire) != captureId)
+				continue;
+
+			BeginEvent("M", threadEvents.threadId);
+			trace += ",\"name\":\"thread_name\",\"args\":{\"name\":";
+			AppendJsonString(trace, threadEvents.threadName);
+			trace += "}}";
+
+			std::size_t eventCount = threadEvents.eventCount.load(std::memory_order_acquire);
+			for (std::size_t i = 0; i < eventCount; ++i)
+			{
+				const ProfilerEvent& event = threadEvents.GetEvent(i);
+				switch (static_cast<EventType>(event.type))
+				{
+					case EventType::Frame:
+						BeginEvent("i", threadEvents.threadId);
+						trace += ",\"name\":\"Frame\",\"s\":\"g\"";
+						AppendTimestamp(event.timestamp);
+						trace += '}';
+						break;
+
+					case EventType::ZoneBegin:
+						BeginEvent("B", threadEvents.threadId);
+						trace += ",\"name\":";
+						AppendJsonString(trace, event.zone->name);
+						AppendTimestamp(event.timestamp);
+						trace += ",\"args\":{\"function\":";
+						AppendJsonString(trace, event.zone->function);
+						trace += ",\"file\":";
+						AppendJsonString(trace, event.zone->file);
+						trace += ",\"line\":";
+						trace += std::to_string(event.zone->line);
+						trace += "}}";
+						break;
+
+					case EventType::ZoneEnd:
+						BeginEvent("E", threadEvents.threadId);
+						AppendTimestamp(event.timestamp);
+						trace += '}';
+						break;
+				}
+			}
+		}
+
+		trace += "]}\n";
+
+		return trace;
+	}
+
+	void Profiler::PushEvent(EventType eventType, const ProfilerZoneInfo* zone, unsigned int captureId)
+	{
+		// Events of a previous capture (such as the end of a zone begun before a new capture was started) would break the new one
+		if (captureId != GetCaptureId())
+			return;
+
+		// Capture start is written before the capture id is incremented (and read after it)
+		UInt64 timestamp = static_cast<UInt64>(std::max<Int64>(GetTimestamp() - s_captureStart.load(std::memory_order_relaxed), 0));
+
+		ThreadEvents& threadEvents = GetThreadEvents();
+		if (threadEvents.captureId.load(std::memory_order_relaxed) != captureId)
+		{
+			// First event of this thread in the current capture
+			threadEvents.eventCount.store(0, std::memory_order_relaxed);
+			threadEvents.droppedEventCount.store(0, std::memory_order_relaxed);
+			threadEvents.captureId.store(captureId, std::memory_order_release);
+		}
+
+		std::size_t eventIndex = threadEvents.eventCount.load(std::memory_order_relaxed);
+		if (eventIndex >= NAZARA_CORE_PROFILER_THREAD_EVENTS)
+		{
+			threadEvents.droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		auto& eventChunk = threadEvents.eventChunks[eventIndex / EventChunkSize];
+		if (!eventChunk)
+			eventChunk = std::make_unique<ProfilerEvent[]>(EventChunkSize); //< published to readers along with eventCount
+
+		ProfilerEvent& event = threadEvents.GetEvent(eventIndex);
+		event.timestamp = timestamp;
+		event.type = static_cast<UInt8>(eventType);
+		event.zone = zone;
+
+		threadEvents.eventCount.store(eventIndex + 1, std::memory_order_release);
+
+		if (eventType == EventType::Frame)
+		{
+			// Stop the capture after the requested frame count (if any)
+			unsigned int remainingFrameCount = s_remainingFrameCount.load(std::memory_order_relaxed);
+			while (remainingFrameCount > 0)
+			{
+				if (s_remainingFrameCount.compare_exchange_weak(remainingFrameCount, remainingFrameCount - 1, std::memory_order_relaxed))
+				{
+					if (remainingFrameCount == 1)
+						StopCapture();
+
+					break;
+				}
+			}
+		}
+	}
+
+	std::atomic_bool Profiler::s_isCapturing = false;
+	std::atomic_uint Profiler::s_captureId = 0;
+}
@@ -44,6 +44,20 @@ namespace Nz
 		return {};
 	}
 
+	/*!
+	* \brief Gets a pointer to the whole stream content, for streams whose content is directly addressable in memory
+	* \return Pointer to the first byte of the stream (regardless of the cursor position) or nullptr if the stream is not memory mapped
+	*
+	* This allows parsers to read data in place instead of copying it, the pointer stays valid as long as the stream is alive.
+	*
+	* \see IsMemoryMapped
+	*/
+
+	const void* Stream::GetMappedPointer() const
+	{
+		return nullptr;
+	}
+
 	/*!
 	* \brief Gets the path of the stream
 	* \return Empty string (meant to be virtual)
@@ -4,9 +4,17 @@
 
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Utfcpp/utf8.h>
 #include <cinttypes>
+#include <cstring>
+
+#ifdef NAZARA_PLATFORM_x64
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -29,6 +37,330 @@ namespace Nz
 			}
 		}
 
+		std::size_t CountUtf8Characters(const char* str, std::size_t size)
+		{
+			// Every byte except continuation bytes (10xxxxxx) starts a character
+			std::size_t characterCount = 0;
+			std::size_t offset = 0;
+
+#ifdef NAZARA_PLATFORM_x64
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i one = _mm_set1_epi8(1);
+			const __m128i continuationMax = _mm_set1_epi8(static_cast<char>(0xBF)); //< continuation bytes are [-128, -65] as signed bytes
+
+			__m128i counts = zero;
+			for (; offset + 16 <= size; offset += 16)
+			{
+				__m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + offset));
+				__m128i isLeadByte = _mm_cmpgt_epi8(input, continuationMax);
+				counts = _mm_add_epi64(counts, _mm_sad_epu8(_mm_and_si128(isLeadByte, one), zero));
+			}
+
+			characterCount = static_cast<std::size_t>(_mm_cvtsi128_si64(counts) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(counts, counts)));
+#endif
+
+			for (; offset < size; ++offset)
+			{
+				if ((static_cast<UInt8>(str[offset]) & 0xC0) != 0x80)
+					characterCount++;
+			}
+
+			return characterCount;
+		}
+
+		// Transcodes valid UTF-8 to UTF-16 or UTF-32 (depending on CharT size), output must be able to hold one code unit per input byte
+		template<typename CharT>
+		std::size_t TranscodeValidUtf8(const char* str, std::size_t size, CharT* output)
+		{
+			static_assert(sizeof(CharT) == 2 || sizeof(CharT) == 4);
+
+			const UInt8* ptr = reinterpret_cast<const UInt8*>(str);
+			const UInt8* end = ptr + size;
+			CharT* outputBegin = output;
+
+			while (ptr < end)
+			{
+#ifdef NAZARA_PLATFORM_x64
+				// ASCII fast path: widen 16 bytes at once
+				if (end - ptr >= 16)
+				{
+					__m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+					if (_mm_movemask_epi8(input) == 0)
+					{
+						const __m128i zero = _mm_setzero_si128();
+						__m128i low = _mm_unpacklo_epi8(input, zero);
+						__m128i high = _mm_unpackhi_epi8(input, zero);
+
+						if constexpr (sizeof(CharT) == 2)
+						{
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(output), low);
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 8), high);
+						}
+						else
+						{
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_unpacklo_epi16(low, zero));
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 4), _mm_unpackhi_epi16(low, zero));
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 8), _mm_unpacklo_epi16(high, zero));
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 12), _mm_unpackhi_epi16(high, zero));
+						}
+
+						ptr += 16;
+						output += 16;
+						continue;
+					}
+				}
+#endif
+
+				// Decode characters up to the next ASCII block
+				const UInt8* blockEnd = ptr + std::min<std::ptrdiff_t>(end - ptr, 16);
+				while (ptr < blockEnd)
+				{
+					UInt8 lead = *ptr;
+					char32_t codepoint;
+					if (lead < 0x80)
+					{
+						codepoint = lead;
+						ptr += 1;
+					}
+					else if (lead < 0xE0)
+					{
+						codepoint = (char32_t(lead & 0x1F) << 6) | char32_t(ptr[1] & 0x3F);
+						ptr += 2;
+					}
+					else if (lead < 0xF0)
+					{
+						codepoint = (char32_t(lead & 0x0F) << 12) | (char32_t(ptr[1] & 0x3F) << 6) | char32_t(ptr[2] & 0x3F);
+						ptr += 3;
+					}
+					else
+					{
+						codepoint = (char32_t(lead & 0x07) << 18) | (char32_t(ptr[1] & 0x3F) << 12) | (char32_t(ptr[2] & 0x3F) << 6) | char32_t(ptr[3] & 0x3F);
+						ptr += 4;
+					}
+
+					if constexpr (sizeof(CharT) == 2)
+					{
+						if (codepoint >= 0x10000)
+						{
+							codepoint -= 0x10000;
+							*output++ = static_cast<CharT>(0xD800 + (codepoint >> 10));
+							*output++ = static_cast<CharT>(0xDC00 + (codepoint & 0x3FF));
+						}
+						else
+							*output++ = static_cast<CharT>(codepoint);
+					}
+					else
+						*output++ = static_cast<CharT>(codepoint);
+				}
+			}
+
+			return static_cast<std::size_t>(output - outputBegin);
+		}
+
+		template<typename CharT>
+		std::basic_string<CharT> TranscodeUtf8(const std::string_view& str)
+		{
+			std::basic_string<CharT> result;
+			if (!IsValidUtf8(str))
+			{
+				// Let utf8cpp handle (and report) invalid sequences
+				if constexpr (sizeof(CharT) == 2)
+					utf8::utf8to16(str.begin(), str.end(), std::back_inserter(result));
+				else
+					utf8::utf8to32(str.begin(), str.end(), std::back_inserter(result));
+
+				return result;
+			}
+
+			result.resize(str.size());
+			result.resize(TranscodeValidUtf8(str.data(), str.size(), result.data()));
+
+			return result;
+		}
+
+		bool ValidateUtf8(const char* str, std::size_t size)
+		{
+			const UInt8* ptr = reinterpret_cast<const UInt8*>(str);
+			const UInt8* end = ptr + size;
+
+			while (ptr < end)
+			{
+				// ASCII fast path, 8 bytes at once
+				if (end - ptr >= 8)
+				{
+					UInt64 block;
+					std::memcpy(&block, ptr, sizeof(block));
+					if ((block & 0x8080808080808080ULL) == 0)
+					{
+						ptr += 8;
+						continue;
+					}
+				}
+
+				UInt8 lead = *ptr;
+				if (lead < 0x80)
+				{
+					ptr++;
+					continue;
+				}
+
+				std::ptrdiff_t length;
+				char32_t codepoint;
+				char32_t minCodepoint;
+				if ((lead & 0xE0) == 0xC0)
+				{
+					length = 2;
+					codepoint = lead & 0x1F;
+					minCodepoint = 0x80;
+				}
+				else if ((lead & 0xF0) == 0xE0)
+				{
+					length = 3;
+					codepoint = lead & 0x0F;
+					minCodepoint = 0x800;
+				}
+				else if ((lead & 0xF8) == 0xF0)
+				{
+					length = 4;
+					codepoint = lead & 0x07;
+					minCodepoint = 0x10000;
+				}
+				else
+					return false;
+
+				if (end - ptr < length)
+					return false;
+
+				for (std::ptrdiff_t i = 1; i < length; ++i)
+				{
+					if ((ptr[i] & 0xC0) != 0x80)
+						return false;
+
+					codepoint = (codepoint << 6) | (ptr[i] & 0x3F);
+				}
+
+				// Overlong encodings, surrogates and out of range codepoints
+				if (codepoint < minCodepoint || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+					return false;
+
+				ptr += length;
+			}
+
+			return true;
+		}
+
+#ifdef NAZARA_PLATFORM_x64
+		NAZARA_TARGET_FEATURES("ssse3")
+		bool ValidateUtf8_SSSE3(const char* str, std::size_t size)
+		{
+			// Lookup algorithm from John Keiser and Daniel Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte" (2021):
+			// every error is identified by the high nibble of a byte, the low nibble of the previous one and the high nibble of the current one
+			constexpr char TooShort = 1 << 0;
+			constexpr char TooLong = 1 << 1;
+			constexpr char Overlong3 = 1 << 2;
+			constexpr char TooLarge = 1 << 3;
+			constexpr char Surrogate = 1 << 4;
+			constexpr char Overlong2 = 1 << 5;
+			constexpr char TooLarge1000 = 1 << 6;
+			constexpr char Overlong4 = 1 << 6;
+			constexpr char TwoConts = static_cast<char>(1 << 7);
+			constexpr char Carry = TooShort | TooLong | TwoConts;
+
+			const __m128i byte1HighTable = _mm_setr_epi8(
+				TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, //< 0xxx (ASCII)
+				TwoConts, TwoConts, TwoConts, TwoConts,                                 //< 10xx (continuation)
+				TooShort | Overlong2,                                                   //< 1100 (two bytes lead)
+				TooShort,                                                               //< 1101 (two bytes lead)
+				TooShort | Overlong3 | Surrogate,                                       //< 1110 (three bytes lead)
+				TooShort | TooLarge | TooLarge1000 | Overlong4                          //< 1111 (four bytes lead)
+			);
+
+			const __m128i byte1LowTable = _mm_setr_epi8(
+				Carry | Overlong3 | Overlong2 | Overlong4,
+				Carry | Overlong2,
+				Carry,
+				Carry,
+				Carry | TooLarge,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000 | Surrogate,
+				Carry | TooLarge | TooLarge1000,
+				Carry | TooLarge | TooLarge1000
+			);
+
+			const __m128i byte2HighTable = _mm_setr_epi8(
+				TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, //< 0xxx (ASCII)
+				TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,          //< 1000
+				TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,                          //< 1001
+				TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,                          //< 1010
+				TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,                          //< 1011
+				TooShort, TooShort, TooShort, TooShort                                          //< 11xx (lead)
+			);
+
+			// Last bytes of a block which must be followed by continuation bytes (a lead byte too close to the end)
+			const __m128i incompleteMax = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+
+			const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+			const __m128i zero = _mm_setzero_si128();
+
+			__m128i error = zero;
+			__m128i previousBlock = zero;
+			__m128i previousIncomplete = zero;
+
+			alignas(16) char tail[16];
+
+			for (std::size_t offset = 0; offset < size; offset += 16)
+			{
+				__m128i input;
+				if (size - offset >= 16)
+					input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + offset));
+				else
+				{
+					std::memset(tail, 0, sizeof(tail));
+					std::memcpy(tail, str + offset, size - offset);
+					input = _mm_load_si128(reinterpret_cast<const __m128i*>(tail));
+				}
+
+				if (_mm_movemask_epi8(input) == 0)
+				{
+					// ASCII block, only check the previous block didn't end in the middle of a character
+					error = _mm_or_si128(error, previousIncomplete);
+					previousIncomplete = zero;
+					previousBlock = input;
+					continue;
+				}
+
+				__m128i prev1 = _mm_alignr_epi8(input, previousBlock, 15);
+				__m128i byte1High = _mm_shuffle_epi8(byte1HighTable, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask));
+				__m128i byte1Low = _mm_shuffle_epi8(byte1LowTable, _mm_and_si128(prev1, nibbleMask));
+				__m128i byte2High = _mm_shuffle_epi8(byte2HighTable, _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+				__m128i specialCases = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+				// Third and fourth bytes of three and four bytes characters must be continuation bytes
+				__m128i prev2 = _mm_alignr_epi8(input, previousBlock, 14);
+				__m128i prev3 = _mm_alignr_epi8(input, previousBlock, 13);
+				__m128i isThirdByte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+				__m128i isFourthByte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+				__m128i mustBeContinuation = _mm_and_si128(_mm_or_si128(isThirdByte, isFourthByte), _mm_set1_epi8(static_cast<char>(0x80)));
+
+				error = _mm_or_si128(error, _mm_xor_si128(mustBeContinuation, specialCases));
+				previousIncomplete = _mm_subs_epu8(input, incompleteMax);
+				previousBlock = input;
+			}
+
+			error = _mm_or_si128(error, previousIncomplete);
+
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) == 0xFFFF;
+		}
+#endif
+
 		char ToLower(char character)
 		{
 			if (character >= 'A' && character <= 'Z')
@@ -69,20 +401,8 @@ namespace Nz
 
 			static std::wstring To(const std::string_view& str)
 			{
-				if constexpr (S == 2)
-				{
-					std::wstring result;
-					utf8::utf8to16(str.begin(), str.end(), std::back_inserter(result));
-
-					return result;
-				}
-				else if constexpr (S == 4)
-				{
-					std::wstring result;
-					utf8::utf8to32(str.begin(), str.end(), std::back_inserter(result));
-
-					return result;
-				}
+				if constexpr (S == 2 || S == 4)
+					return TranscodeUtf8<wchar_t>(str);
 				else
 				{
 					static_assert(AlwaysFalse<std::integral_constant<std::size_t, S>>::value, "Unsupported platform");
@@ -94,7 +414,12 @@ namespace Nz
 
 	std::size_t ComputeCharacterCount(const std::string_view& str)
 	{
-		return utf8::distance(str.data(), str.data() + str.size());
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (!IsValidUtf8(str))
+			return utf8::distance(str.data(), str.data() + str.size()); //< reports the error
+
+		return CountUtf8Characters(str.data(), str.size());
 	}
 	
 	bool EndsWith(const std::string_view& lhs, const std::string_view& rhs, CaseIndependent)
@@ -259,6 +584,19 @@ namespace Nz
 		return {};
 	}
 
+	bool IsValidUtf8(const std::string_view& str)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+#ifdef NAZARA_PLATFORM_x64
+		const Core* core = Core::Instance();
+		if (core && core->GetHardwareInfo().HasCapability(ProcessorCap::SSSE3))
+			return ValidateUtf8_SSSE3(str.data(), str.size());
+#endif
+
+		return ValidateUtf8(str.data(), str.size());
+	}
+
 	bool MatchPattern(const std::string_view& str, const std::string_view& pattern)
 	{
 		if (str.empty() || pattern.empty())
@@ -472,18 +810,16 @@ namespace Nz
 
 	std::u16string ToUtf16String(const std::string_view& str)
 	{
-		std::u16string result;
-		utf8::utf8to16(str.begin(), str.end(), std::back_inserter(result));
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-		return result;
+		return TranscodeUtf8<char16_t>(str);
 	}
 
 	std::u32string ToUtf32String(const std::string_view& str)
 	{
-		std::u32string result;
-		utf8::utf8to32(str.begin(), str.end(), std::back_inserter(result));
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-		return result;
+		return TranscodeUtf8<char32_t>(str);
 	}
 
 	std::wstring ToWideString(const std::string_view& str)
@@ -3,12 +3,41 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Systems/SystemGraph.hpp>
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
 	SystemGraph::NodeBase::~NodeBase() = default;
 
+	bool SystemGraph::NodeBase::ConflictsWith(const NodeBase& node) const
+	{
+		if (!allowConcurrent || !node.allowConcurrent)
+			return true;
+
+		auto Contains = [](const std::vector<entt::id_type>& components, entt::id_type componentId)
+		{
+			return std::find(components.begin(), components.end(), componentId) != components.end();
+		};
+
+		// Components can be read concurrently but a write requires exclusive access
+		for (entt::id_type componentId : writeComponents)
+		{
+			if (Contains(node.readComponents, componentId) || Contains(node.writeComponents, componentId))
+				return true;
+		}
+
+		for (entt::id_type componentId : readComponents)
+		{
+			if (Contains(node.writeComponents, componentId))
+				return true;
+		}
+
+		return false;
+	}
+
 	void SystemGraph::Update()
 	{
 		return Update(m_clock.Restart() / 1'000'000.f);
@@ -16,6 +45,8 @@ namespace Nz
 
 	void SystemGraph::Update(float elapsedTime)
 	{
+		NazaraProfileZone("SystemGraph::Update");
+
 		if (!m_systemOrderUpdated)
 		{
 			m_orderedNodes.clear();
@@ -23,15 +54,98 @@ namespace Nz
 			for (auto& nodePtr : m_nodes)
 				m_orderedNodes.emplace_back(nodePtr.get());
 
-			std::sort(m_orderedNodes.begin(), m_orderedNodes.end(), [](const NodeBase* a, const NodeBase* b)
+			std::stable_sort(m_orderedNodes.begin(), m_orderedNodes.end(), [](const NodeBase* a, const NodeBase* b)
 			{
 				return a->executionOrder < b->executionOrder;
 			});
 
+			BuildStages();
+
 			m_systemOrderUpdated = true;
 		}
 
+		if (!m_parallelUpdate)
+		{
+			for (NodeBase* node : m_orderedNodes)
+				node->Update(elapsedTime);
+
+			return;
+		}
+
+		for (const Stage& stage : m_stages)
+		{
+			if (stage.exclusive || stage.nodes.size() == 1)
+			{
+				for (NodeBase* node : stage.nodes)
+					node->Update(elapsedTime);
+
+				continue;
+			}
+
+			TaskCounter counter;
+			for (NodeBase* node : stage.nodes)
+				node->remainingDependencyCount.store(node->dependencyCount, std::memory_order_relaxed);
+
+			for (NodeBase* node : stage.nodes)
+			{
+				if (node->dependencyCount == 0)
+					SpawnNodeUpdate(counter, node, elapsedTime);
+			}
+
+			TaskScheduler::WaitForCounter(counter);
+		}
+	}
+
+	void SystemGraph::BuildStages()
+	{
+		// Exclusive systems split the graph in stages, concurrent systems of a stage form a DAG where
+		// conflicting systems depend on the ones preceding them in execution order
+		m_stages.clear();
+
 		for (NodeBase* node : m_orderedNodes)
+		{
+			node->dependencyCount = 0;
+			node->dependents.clear();
+
+			if (!node->allowConcurrent)
+			{
+				auto& stage = m_stages.emplace_back();
+				stage.exclusive = true;
+				stage.nodes.push_back(node);
+				continue;
+			}
+
+			if (m_stages.empty() || m_stages.back().exclusive)
+			{
+				auto& stage = m_stages.emplace_back();
+				stage.exclusive = false;
+			}
+
+			Stage& stage = m_stages.back();
+			for (NodeBase* previousNode : stage.nodes)
+			{
+				if (node->ConflictsWith(*previousNode))
+				{
+					previousNode->dependents.push_back(node);
+					node->dependencyCount++;
+				}
+			}
+
+			stage.nodes.push_back(node);
+		}
+	}
+
+	void SystemGraph::SpawnNodeUpdate(TaskCounter& counter, NodeBase* node, float elapsedTime)
+	{
+		TaskScheduler::SpawnTask(counter, [&counter, node, elapsedTime]
+		{
 			node->Update(elapsedTime);
+
+			for (NodeBase* dependent : node->dependents)
+			{
+				if (dependent->remainingDependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					SpawnNodeUpdate(counter, dependent, elapsedTime);
+			}
+		});
 	}
 }
@@ -14,6 +14,8 @@
 	#error Lack of implementation: Task Scheduler
 #endif
 
+#include <thread>
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -29,6 +31,9 @@ namespace Nz
 	* \class Nz::TaskScheduler
 	* \brief Core class that represents a pool of threads
 	*
+	* Each worker owns a task queue, it executes its most recent tasks first and steals the oldest tasks of other workers when it runs out of work.
+	* Tasks can either be batched (AddTask + Run) or spawned immediately (SpawnTask), including from another task.
+	*
 	* \remark Initialized should be called first
 	*/
 
@@ -52,6 +57,16 @@ namespace Nz
 		return TaskSchedulerImpl::Initialize(GetWorkerCount());
 	}
 
+	/*!
+	* \brief Checks if the calling thread is one of the workers of the pool
+	* \return true if the function is called from a task
+	*/
+
+	bool TaskScheduler::IsWorkerThread()
+	{
+		return TaskSchedulerImpl::IsWorkerThread();
+	}
+
 	/*!
 	* \brief Runs the pending works
 	*
@@ -96,6 +111,8 @@ namespace Nz
 
 	/*!
 	* \brief Uninitializes the TaskScheduler class
+	*
+	* \remark Tasks which were not yet executed are discarded
 	*/
 
 	void TaskScheduler::Uninitialize()
@@ -104,10 +121,38 @@ namespace Nz
 			TaskSchedulerImpl::Uninitialize();
 	}
 
+	/*!
+	* \brief Waits for every task tracked by a counter to be done
+	*
+	* Instead of blocking, the calling thread executes pending tasks while waiting, this makes it safe to call from a task (allowing a task to wait on its children).
+	*
+	* \param counter Counter to wait on
+	*
+	* \remark Produce a NazaraError if the class is not initialized
+	*/
+
+	void TaskScheduler::WaitForCounter(const TaskCounter& counter)
+	{
+		if (!Initialize())
+		{
+			NazaraError("Failed to initialize Task Scheduler");
+			return;
+		}
+
+		while (!counter.IsDone())
+		{
+			if (!TaskSchedulerImpl::RunPendingTask())
+				std::this_thread::yield();
+		}
+	}
+
 	/*!
 	* \brief Waits for tasks to be done
 	*
+	* This includes tasks spawned by other tasks, the calling thread executes pending tasks while waiting
+	*
 	* \remark Produce a NazaraError if the class is not initialized
+	* \remark Calling this from a task is undefined behavior, use a TaskCounter and WaitForCounter instead
 	*/
 
 	void TaskScheduler::WaitForTasks()
@@ -140,4 +185,24 @@ namespace Nz
 
 		s_pendingWorks.push_back(taskFunctor);
 	}
+
+	/*!
+	* \brief Pushes a task to the workers
+	*
+	* \param taskFunctor Functor represeting a task to be done
+	*
+	* \remark Produce a NazaraError if the class is not initialized
+	*/
+
+	void TaskScheduler::SpawnTaskFunctor(Functor* taskFunctor)
+	{
+		if (!Initialize())
+		{
+			NazaraError("Failed to initialize Task Scheduler");
+			delete taskFunctor;
+			return;
+		}
+
+		TaskSchedulerImpl::AddTask(taskFunctor);
+	}
 }
@@ -4,6 +4,9 @@
 
 #include <Nazara/Core/Win32/HardwareInfoImpl.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <bitset>
+#include <memory>
 #include <windows.h>
 
 #ifdef NAZARA_COMPILER_MSVC
@@ -43,6 +46,150 @@ namespace Nz
 	#endif
 	}
 
+	bool HardwareInfoImpl::FetchProcessorTopology(std::vector<HardwareInfo::LogicalProcessor>& logicalProcessors, std::array<HardwareInfo::CacheInfo, HardwareInfo::MaxCacheLevel>& caches)
+	{
+		DWORD bufferSize = 0;
+		GetLogicalProcessorInformationEx(RelationAll, nullptr, &bufferSize);
+		if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+			return false;
+
+		std::unique_ptr<UInt8[]> buffer = std::make_unique<UInt8[]>(bufferSize);
+		if (!GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.get()), &bufferSize))
+		{
+			NazaraError("GetLogicalProcessorInformationEx failed: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		// Logical processor indices are built as group * 64 + bit index in the group mask
+		auto ForEachProcessor = [](const GROUP_AFFINITY& groupAffinity, auto&& callback)
+		{
+			constexpr unsigned int bitCount = sizeof(KAFFINITY) * 8;
+			for (unsigned int i = 0; i < bitCount; ++i)
+			{
+				if (groupAffinity.Mask & (KAFFINITY(1) << i))
+					callback(groupAffinity.Group * bitCount + i);
+			}
+		};
+
+		auto FindProcessor = [&](unsigned int index) -> HardwareInfo::LogicalProcessor*
+		{
+			auto it = std::find_if(logicalProcessors.begin(), logicalProcessors.end(), [&](const HardwareInfo::LogicalProcessor& processor) { return processor.index == index; });
+			return (it != logicalProcessors.end()) ? &*it : nullptr;
+		};
+
+		// Processor cores are gathered first so the other relationships can refer to them
+		std::vector<BYTE> efficiencyClasses;
+		unsigned int coreIndex = 0;
+		BYTE maxEfficiencyClass = 0;
+		for (DWORD offset = 0; offset < bufferSize;)
+		{
+			const auto& info = *reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(&buffer[offset]);
+			if (info.Relationship == RelationProcessorCore)
+			{
+				for (WORD groupIndex = 0; groupIndex < info.Processor.GroupCount; ++groupIndex)
+				{
+					ForEachProcessor(info.Processor.GroupMask[groupIndex], [&](unsigned int processorIndex)
+					{
+						auto& logicalProcessor = logicalProcessors.emplace_back();
+						logicalProcessor.index = processorIndex;
+						logicalProcessor.coreIndex = coreIndex;
+						logicalProcessor.numaNode = 0;
+						logicalProcessor.packageIndex = 0;
+						logicalProcessor.coreType = ProcessorCoreType::Unknown;
+
+						efficiencyClasses.push_back(info.Processor.EfficiencyClass);
+					});
+				}
+
+				maxEfficiencyClass = std::max(maxEfficiencyClass, info.Processor.EfficiencyClass);
+				coreIndex++;
+			}
+
+			offset += info.Size;
+		}
+
+		// Higher efficiency classes are faster cores, a single class means a non-hybrid processor
+		for (std::size_t i = 0; i < logicalProcessors.size(); ++i)
+			logicalProcessors[i].coreType = (efficiencyClasses[i] == maxEfficiencyClass) ? ProcessorCoreType::Performance : ProcessorCoreType::Efficiency;
+
+		unsigned int packageIndex = 0;
+		for (DWORD offset = 0; offset < bufferSize;)
+		{
+			const auto& info = *reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(&buffer[offset]);
+			switch (info.Relationship)
+			{
+				case RelationCache:
+				{
+					const CACHE_RELATIONSHIP& cacheInfo = info.Cache;
+					if ((cacheInfo.Type != CacheData && cacheInfo.Type != CacheUnified) || cacheInfo.Level < 1 || cacheInfo.Level > HardwareInfo::MaxCacheLevel)
+						break;
+
+					// Keep the first cache of each level (belonging to the first processors)
+					HardwareInfo::CacheInfo& cache = caches[cacheInfo.Level - 1];
+					if (cache.size != 0)
+						break;
+
+					cache.size = cacheInfo.CacheSize;
+					cache.lineSize = cacheInfo.LineSize;
+					cache.sharingThreadCount = static_cast<unsigned int>(std::bitset<sizeof(KAFFINITY) * 8>(cacheInfo.GroupMask.Mask).count());
+					break;
+				}
+
+				case RelationNumaNode:
+				{
+					ForEachProcessor(info.NumaNode.GroupMask, [&](unsigned int processorIndex)
+					{
+						if (HardwareInfo::LogicalProcessor* logicalProcessor = FindProcessor(processorIndex))
+							logicalProcessor->numaNode = info.NumaNode.NodeNumber;
+					});
+					break;
+				}
+
+				case RelationProcessorPackage:
+				{
+					for (WORD groupIndex = 0; groupIndex < info.Processor.GroupCount; ++groupIndex)
+					{
+						ForEachProcessor(info.Processor.GroupMask[groupIndex], [&](unsigned int processorIndex)
+						{
+							if (HardwareInfo::LogicalProcessor* logicalProcessor = FindProcessor(processorIndex))
+								logicalProcessor->packageIndex = packageIndex;
+						});
+					}
+
+					packageIndex++;
+					break;
+				}
+
+				default:
+					break;
+			}
+
+			offset += info.Size;
+		}
+
+		return true;
+	}
+
+	bool HardwareInfoImpl::GetCurrentThreadAffinity(std::vector<unsigned int>& logicalProcessorIndices)
+	{
+		constexpr unsigned int bitCount = sizeof(KAFFINITY) * 8;
+
+		GROUP_AFFINITY groupAffinity;
+		if (!GetThreadGroupAffinity(GetCurrentThread(), &groupAffinity))
+		{
+			NazaraError("failed to get thread affinity: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		for (unsigned int i = 0; i < bitCount; ++i)
+		{
+			if (groupAffinity.Mask & (KAFFINITY(1) << i))
+				logicalProcessorIndices.push_back(groupAffinity.Group * bitCount + i);
+		}
+
+		return true;
+	}
+
 	unsigned int HardwareInfoImpl::GetProcessorCount()
 	{
 		// Simpler (and more portable) than using CPUID
@@ -109,6 +256,34 @@ namespace Nz
 		#endif
 	#endif
 	}
+
+	bool HardwareInfoImpl::SetCurrentThreadAffinity(const std::vector<unsigned int>& logicalProcessorIndices)
+	{
+		constexpr unsigned int bitCount = sizeof(KAFFINITY) * 8;
+
+		// A thread can only run on processors of a single group
+		GROUP_AFFINITY groupAffinity = {};
+		groupAffinity.Group = static_cast<WORD>(logicalProcessorIndices.front() / bitCount);
+
+		for (unsigned int processorIndex : logicalProcessorIndices)
+		{
+			if (processorIndex / bitCount != groupAffinity.Group)
+			{
+				NazaraError("logical processors must belong to the same processor group");
+				return false;
+			}
+
+			groupAffinity.Mask |= KAFFINITY(1) << (processorIndex % bitCount);
+		}
+
+		if (!SetThreadGroupAffinity(GetCurrentThread(), &groupAffinity, nullptr))
+		{
+			NazaraError("failed to set thread affinity: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		return true;
+	}
 }
 
 #include <Nazara/Core/AntiWindows.hpp>
@@ -0,0 +1,92 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Utils/CallOnExit.hpp>
+#include <limits>
+#include <windows.h>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	MappedFileImpl::MappedFileImpl() :
+	m_mappedPtr(nullptr),
+	m_size(0)
+	{
+	}
+
+	MappedFileImpl::~MappedFileImpl()
+	{
+		if (m_mappedPtr)
+			UnmapViewOfFile(m_mappedPtr);
+	}
+
+	const void* MappedFileImpl::GetPointer() const
+	{
+		return m_mappedPtr;
+	}
+
+	UInt64 MappedFileImpl::GetSize() const
+	{
+		return m_size;
+	}
+
+	bool MappedFileImpl::Open(const std::filesystem::path& filePath)
+	{
+		HANDLE fileHandle = CreateFileW(ToWideString(filePath.generic_u8string()).data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			NazaraError("Failed to open \"" + filePath.generic_u8string() + "\" : " + Error::GetLastSystemError());
+			return false;
+		}
+
+		// The view stays valid once the file and mapping handles are closed
+		CallOnExit closeFileOnExit([&]
+		{
+			CloseHandle(fileHandle);
+		});
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize))
+		{
+			NazaraError("Failed to get \"" + filePath.generic_u8string() + "\" size: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		m_size = static_cast<UInt64>(fileSize.QuadPart);
+		if (m_size == 0)
+			return true; //< CreateFileMapping doesn't support empty mappings
+
+		if (m_size > (std::numeric_limits<SIZE_T>::max)())
+		{
+			NazaraError("\"" + filePath.generic_u8string() + "\" is too big to be mapped");
+			return false;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mappingHandle)
+		{
+			NazaraError("Failed to create \"" + filePath.generic_u8string() + "\" mapping: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		CallOnExit closeMappingOnExit([&]
+		{
+			CloseHandle(mappingHandle);
+		});
+
+		m_mappedPtr = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		if (!m_mappedPtr)
+		{
+			NazaraError("Failed to map \"" + filePath.generic_u8string() + "\": " + Error::GetLastSystemError());
+			return false;
+		}
+
+		return true;
+	}
+}
+
+#include <Nazara/Core/AntiWindows.hpp>
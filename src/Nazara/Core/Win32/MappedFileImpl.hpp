@@ -0,0 +1,37 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_WIN32_MAPPEDFILEIMPL_HPP
+#define NAZARA_CORE_WIN32_MAPPEDFILEIMPL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <filesystem>
+
+namespace Nz
+{
+	class MappedFileImpl
+	{
+		public:
+			MappedFileImpl();
+			MappedFileImpl(const MappedFileImpl&) = delete;
+			MappedFileImpl(MappedFileImpl&&) = delete;
+			~MappedFileImpl();
+
+			const void* GetPointer() const;
+			UInt64 GetSize() const;
+
+			bool Open(const std::filesystem::path& filePath);
+
+			MappedFileImpl& operator=(const MappedFileImpl&) = delete;
+			MappedFileImpl& operator=(MappedFileImpl&&) = delete;
+
+		private:
+			void* m_mappedPtr;
+			UInt64 m_size;
+	};
+}
+
+#endif // NAZARA_CORE_WIN32_MAPPEDFILEIMPL_HPP
@@ -5,16 +5,30 @@
 #include <Nazara/Core/Win32/TaskSchedulerImpl.hpp>
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
-#include <cstdlib> // std::ldiv
+#include <cstdint>
 #include <process.h>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
-	bool TaskSchedulerImpl::Initialize(std::size_t workerCount)
+	void TaskSchedulerImpl::AddTask(Functor* task)
+	{
+		// Tasks spawned by a worker are kept local to that worker (until another worker steals them)
+		unsigned int workerIndex = s_currentWorkerIndex;
+		if (workerIndex == InvalidWorkerIndex)
+			workerIndex = s_nextWorkerIndex.fetch_add(1, std::memory_order_relaxed) % s_workerCount;
+
+		PushTask(workerIndex, task);
+
+		EnterCriticalSection(&s_sleepMutex);
+		WakeConditionVariable(&s_cvNotEmpty);
+		LeaveCriticalSection(&s_sleepMutex);
+	}
+
+	bool TaskSchedulerImpl::Initialize(unsigned int workerCount)
 	{
 		if (IsInitialized())
-			return true; // Déjà initialisé
+			return true; // Already initialized
 
 		#if NAZARA_CORE_SAFE
 		if (workerCount == 0)
@@ -24,32 +38,23 @@ namespace Nz
 		}
 		#endif
 
-		s_workerCount = static_cast<DWORD>(workerCount);
-		s_doneEvents.reset(new HANDLE[workerCount]);
-		s_workers.reset(new Worker[workerCount]);
-		s_workerThreads.reset(new HANDLE[workerCount]);
-
-		// L'identifiant de chaque worker doit rester en vie jusqu'à ce que chaque thread soit correctement lancé
-		std::unique_ptr<std::size_t[]> workerIDs(new std::size_t[workerCount]);
+		s_workerCount = workerCount;
+		s_nextWorkerIndex = 0;
+		s_pendingTaskCount = 0;
+		s_queuedTaskCount = 0;
+		s_shouldFinish = false;
 
-		for (std::size_t i = 0; i < workerCount; ++i)
-		{
-			// On initialise les évènements, mutex et threads de chaque worker
-			Worker& worker = s_workers[i];
-			InitializeCriticalSection(&worker.queueMutex);
-			worker.wakeEvent = CreateEventW(nullptr, false, false, nullptr);
-			worker.running = true;
-			worker.workCount = 0;
+		s_workers.reset(new Worker[workerCount]);
 
-			s_doneEvents[i] = CreateEventW(nullptr, true, false, nullptr);
+		InitializeConditionVariable(&s_cvEmpty);
+		InitializeConditionVariable(&s_cvNotEmpty);
+		InitializeCriticalSection(&s_sleepMutex);
 
-			// Le thread va se lancer, signaler qu'il est prêt à travailler (s_doneEvents) et attendre d'être réveillé
-			workerIDs[i] = i;
-			s_workerThreads[i] = reinterpret_cast<HANDLE>(_beginthreadex(nullptr, 0, &WorkerProc, &workerIDs[i], 0, nullptr));
-		}
+		for (unsigned int i = 0; i < workerCount; ++i)
+			InitializeSRWLock(&s_workers[i].queueLock);
 
-		// On attend que les workers se mettent en attente
-		WaitForMultipleObjects(s_workerCount, &s_doneEvents[0], true, INFINITE);
+		for (unsigned int i = 0; i < workerCount; ++i)
+			s_workers[i].thread = reinterpret_cast<HANDLE>(_beginthreadex(nullptr, 0, &WorkerProc, reinterpret_cast<void*>(static_cast<std::uintptr_t>(i)), 0, nullptr));
 
 		return true;
 	}
@@ -59,30 +64,39 @@ namespace Nz
 		return s_workerCount > 0;
 	}
 
+	bool TaskSchedulerImpl::IsWorkerThread()
+	{
+		return s_currentWorkerIndex != InvalidWorkerIndex;
+	}
+
 	void TaskSchedulerImpl::Run(Functor** tasks, std::size_t count)
 	{
-		// On s'assure que des tâches ne sont pas déjà en cours
-		WaitForMultipleObjects(s_workerCount, &s_doneEvents[0], true, INFINITE);
+		// Distribute the tasks evenly between workers, load will then be balanced by work-stealing
+		unsigned int workerIndex = s_nextWorkerIndex.fetch_add(1, std::memory_order_relaxed);
+		while (count--)
+			PushTask(workerIndex++ % s_workerCount, *tasks++);
+
+		EnterCriticalSection(&s_sleepMutex);
+		WakeAllConditionVariable(&s_cvNotEmpty);
+		LeaveCriticalSection(&s_sleepMutex);
+	}
 
-		std::lldiv_t div = std::lldiv(count, s_workerCount); // Division et modulo en une opération, y'a pas de petit profit
-		for (std::size_t i = 0; i < s_workerCount; ++i)
-		{
-			// On va maintenant répartir les tâches entre chaque worker et les envoyer dans la queue de chacun
-			Worker& worker = s_workers[i];
-			std::size_t taskCount = (i == 0) ? div.quot + div.rem : div.quot;
-			for (std::size_t j = 0; j < taskCount; ++j)
-				worker.queue.push(*tasks++);
+	bool TaskSchedulerImpl::RunPendingTask()
+	{
+		unsigned int workerIndex = s_currentWorkerIndex;
 
-			// On stocke le nombre de tâches à côté dans un entier atomique pour éviter d'entrer inutilement dans une section critique
-			worker.workCount = taskCount;
-		}
+		Functor* task = nullptr;
+		if (workerIndex != InvalidWorkerIndex)
+			task = PopTask(workerIndex);
 
-		// On les lance une fois qu'ils sont tous initialisés (pour éviter qu'un worker ne passe en pause détectant une absence de travaux)
-		for (std::size_t i = 0; i < s_workerCount; ++i)
-		{
-			ResetEvent(s_doneEvents[i]);
-			SetEvent(s_workers[i].wakeEvent);
-		}
+		if (!task)
+			task = StealTask(workerIndex);
+
+		if (!task)
+			return false;
+
+		ExecuteTask(task);
+		return true;
 	}
 
 	void TaskSchedulerImpl::Uninitialize()
@@ -95,40 +109,26 @@ namespace Nz
 		}
 		#endif
 
-		// On commence par vider la queue de chaque worker pour s'assurer qu'ils s'arrêtent
+		// Wake up every worker so they can exit their loop
+		EnterCriticalSection(&s_sleepMutex);
+		s_shouldFinish = true;
+		WakeAllConditionVariable(&s_cvNotEmpty);
+		LeaveCriticalSection(&s_sleepMutex);
+
 		for (unsigned int i = 0; i < s_workerCount; ++i)
 		{
 			Worker& worker = s_workers[i];
-			worker.running = false;
-			worker.workCount = 0;
-
-			EnterCriticalSection(&worker.queueMutex);
+			WaitForSingleObject(worker.thread, INFINITE);
+			CloseHandle(worker.thread);
 
-			std::queue<Functor*> emptyQueue;
-			std::swap(worker.queue, emptyQueue); // Et on vide la queue (merci std::swap)
-
-			LeaveCriticalSection(&worker.queueMutex);
-
-			// On réveille le worker pour qu'il sorte de la boucle et termine le thread
-			SetEvent(worker.wakeEvent);
+			// Discard tasks which weren't executed
+			for (Functor* task : worker.queue)
+				delete task;
 		}
 
-		// On attend que chaque thread se termine
-		WaitForMultipleObjects(s_workerCount, &s_workerThreads[0], true, INFINITE);
+		DeleteCriticalSection(&s_sleepMutex);
 
-		// Et on libère les ressources
-		for (unsigned int i = 0; i < s_workerCount; ++i)
-		{
-			Worker& worker = s_workers[i];
-			CloseHandle(s_doneEvents[i]);
-			CloseHandle(s_workerThreads[i]);
-			CloseHandle(worker.wakeEvent);
-			DeleteCriticalSection(&worker.queueMutex);
-		}
-
-		s_doneEvents.reset();
 		s_workers.reset();
-		s_workerThreads.reset();
 		s_workerCount = 0;
 	}
 
@@ -142,109 +142,126 @@ namespace Nz
 		}
 		#endif
 
-		WaitForMultipleObjects(s_workerCount, &s_doneEvents[0], true, INFINITE);
+		// Help the workers as long as there are queued tasks, then sleep until the running ones are done
+		while (RunPendingTask());
+
+		EnterCriticalSection(&s_sleepMutex);
+		while (s_pendingTaskCount.load(std::memory_order_acquire) > 0)
+			SleepConditionVariableCS(&s_cvEmpty, &s_sleepMutex, INFINITE);
+		LeaveCriticalSection(&s_sleepMutex);
 	}
 
-	Functor* TaskSchedulerImpl::StealTask(std::size_t workerID)
+	void TaskSchedulerImpl::ExecuteTask(Functor* task)
 	{
-		bool shouldRetry;
-		do
+		task->Run();
+		delete task;
+
+		if (s_pendingTaskCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
 		{
-			shouldRetry = false;
-			for (std::size_t i = 0; i < s_workerCount; ++i)
-			{
-				// On ne vole pas la famille, ni soi-même.
-				if (i == workerID)
-					continue;
-
-				Worker& worker = s_workers[i];
-
-				// Ce worker a-t-il encore des tâches dans sa file d'attente ?
-				if (worker.workCount > 0)
-				{
-					Functor* task = nullptr;
-
-					// Est-ce qu'il utilise la queue maintenant ?
-					if (TryEnterCriticalSection(&worker.queueMutex))
-					{
-						// Non, super ! Profitons-en pour essayer de lui voler un job
-						if (!worker.queue.empty()) // On vérifie que la queue n'est pas vide (peut avoir changé avant le verrouillage)
-						{
-							// Et hop, on vole la tâche
-							task = worker.queue.front();
-							worker.queue.pop();
-							worker.workCount = worker.queue.size();
-						}
-
-						LeaveCriticalSection(&worker.queueMutex);
-					}
-					else
-						shouldRetry = true; // Il est encore possible d'avoir un job
-
-					// Avons-nous notre tâche ?
-					if (task)
-						return task; // Parfait, sortons de là !
-				}
-			}
+			// That was the last task, wake up threads waiting on WaitForTasks
+			EnterCriticalSection(&s_sleepMutex);
+			WakeAllConditionVariable(&s_cvEmpty);
+			LeaveCriticalSection(&s_sleepMutex);
 		}
-		while (shouldRetry);
+	}
 
-		// Bon à priori plus aucun worker n'a de tâche
-		return nullptr;
+	Functor* TaskSchedulerImpl::PopTask(unsigned int workerIndex)
+	{
+		Worker& worker = s_workers[workerIndex];
+
+		Functor* task = nullptr;
+
+		// The owner takes its most recent task (LIFO), which is the most likely to be hot in cache
+		AcquireSRWLockExclusive(&worker.queueLock);
+		if (!worker.queue.empty())
+		{
+			task = worker.queue.back();
+			worker.queue.pop_back();
+			s_queuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+		ReleaseSRWLockExclusive(&worker.queueLock);
+
+		return task;
 	}
 
-	unsigned int __stdcall TaskSchedulerImpl::WorkerProc(void* userdata)
+	void TaskSchedulerImpl::PushTask(unsigned int workerIndex, Functor* task)
 	{
-		unsigned int workerID = *static_cast<unsigned int*>(userdata);
-		SetEvent(s_doneEvents[workerID]);
+		Worker& worker = s_workers[workerIndex];
 
-		Worker& worker = s_workers[workerID];
-		WaitForSingleObject(worker.wakeEvent, INFINITE);
+		s_pendingTaskCount.fetch_add(1, std::memory_order_relaxed);
+
+		AcquireSRWLockExclusive(&worker.queueLock);
+		worker.queue.push_back(task);
+		s_queuedTaskCount.fetch_add(1, std::memory_order_release);
+		ReleaseSRWLockExclusive(&worker.queueLock);
+	}
 
-		while (worker.running)
+	Functor* TaskSchedulerImpl::StealTask(unsigned int workerIndex)
+	{
+		if (s_queuedTaskCount.load(std::memory_order_acquire) == 0)
+			return nullptr;
+
+		// Threads which are not part of the pool start looking at the first worker
+		unsigned int firstVictim = (workerIndex != InvalidWorkerIndex) ? workerIndex + 1 : 0;
+		for (unsigned int i = 0; i < s_workerCount; ++i)
 		{
-			Functor* task = nullptr;
+			unsigned int victimIndex = (firstVictim + i) % s_workerCount;
+			if (victimIndex == workerIndex)
+				continue;
 
-			if (worker.workCount > 0) // Permet d'éviter d'entrer inutilement dans une section critique
-			{
-				EnterCriticalSection(&worker.queueMutex);
-				if (!worker.queue.empty()) // Nécessaire car le workCount peut être tombé à zéro juste avant l'entrée dans la section critique
-				{
-					task = worker.queue.front();
-					worker.queue.pop();
-					worker.workCount = worker.queue.size();
-				}
-				LeaveCriticalSection(&worker.queueMutex);
-			}
+			Worker& victim = s_workers[victimIndex];
 
-			// Que faire quand vous n'avez plus de travail ?
-			if (!task)
-				task = StealTask(workerID); // Voler le travail des autres !
+			// Don't wait on a worker currently using its queue, try the next one instead
+			if (!TryAcquireSRWLockExclusive(&victim.queueLock))
+				continue;
 
-			if (task)
-			{
-				// On exécute la tâche avant de la supprimer
-				task->Run();
-				delete task;
-			}
-			else
+			Functor* task = nullptr;
+			if (!victim.queue.empty())
 			{
-				SetEvent(s_doneEvents[workerID]);
-				WaitForSingleObject(worker.wakeEvent, INFINITE);
+				// Steal the oldest task (FIFO), which is the most likely to spawn more work
+				task = victim.queue.front();
+				victim.queue.pop_front();
+				s_queuedTaskCount.fetch_sub(1, std::memory_order_relaxed);
 			}
+			ReleaseSRWLockExclusive(&victim.queueLock);
+
+			if (task)
+				return task;
 		}
 
-		// Au cas où un thread attendrait sur WaitForTasks() pendant qu'un autre appellerait Uninitialize()
-		// Ça ne devrait pas arriver, mais comme ça ne coûte pas grand chose..
-		SetEvent(s_doneEvents[workerID]);
+		return nullptr;
+	}
+
+	unsigned int __stdcall TaskSchedulerImpl::WorkerProc(void* userdata)
+	{
+		s_currentWorkerIndex = static_cast<unsigned int>(reinterpret_cast<std::uintptr_t>(userdata));
+
+		while (!s_shouldFinish)
+		{
+			if (RunPendingTask())
+				continue;
+
+			// Sleep until new tasks are queued, the queued task count is checked under the lock to prevent missing a wake-up
+			EnterCriticalSection(&s_sleepMutex);
+			while (s_queuedTaskCount.load(std::memory_order_acquire) == 0 && !s_shouldFinish)
+				SleepConditionVariableCS(&s_cvNotEmpty, &s_sleepMutex, INFINITE);
+			LeaveCriticalSection(&s_sleepMutex);
+		}
 
 		return 0;
 	}
 
-	std::unique_ptr<HANDLE[]> TaskSchedulerImpl::s_doneEvents; // Doivent être contigus
 	std::unique_ptr<TaskSchedulerImpl::Worker[]> TaskSchedulerImpl::s_workers;
-	std::unique_ptr<HANDLE[]> TaskSchedulerImpl::s_workerThreads; // Doivent être contigus
-	DWORD TaskSchedulerImpl::s_workerCount;
+	std::atomic<bool> TaskSchedulerImpl::s_shouldFinish;
+	std::atomic<std::size_t> TaskSchedulerImpl::s_pendingTaskCount;
+	std::atomic<std::size_t> TaskSchedulerImpl::s_queuedTaskCount;
+	std::atomic<unsigned int> TaskSchedulerImpl::s_nextWorkerIndex;
+	unsigned int TaskSchedulerImpl::s_workerCount;
+	thread_local unsigned int TaskSchedulerImpl::s_currentWorkerIndex = TaskSchedulerImpl::InvalidWorkerIndex;
+
+	CONDITION_VARIABLE TaskSchedulerImpl::s_cvEmpty;
+	CONDITION_VARIABLE TaskSchedulerImpl::s_cvNotEmpty;
+	CRITICAL_SECTION TaskSchedulerImpl::s_sleepMutex;
 }
 
 #include <Nazara/Core/AntiWindows.hpp>
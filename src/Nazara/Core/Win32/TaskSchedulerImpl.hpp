@@ -10,8 +10,8 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Functor.hpp>
 #include <atomic>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <windows.h>
 
 namespace Nz
@@ -22,30 +22,43 @@ namespace Nz
 			TaskSchedulerImpl() = delete;
 			~TaskSchedulerImpl() = delete;
 
-			static bool Initialize(std::size_t workerCount);
+			static void AddTask(Functor* task);
+			static bool Initialize(unsigned int workerCount);
 			static bool IsInitialized();
+			static bool IsWorkerThread();
 			static void Run(Functor** tasks, std::size_t count);
+			static bool RunPendingTask();
 			static void Uninitialize();
 			static void WaitForTasks();
 
 		private:
-			static Functor* StealTask(std::size_t workerID);
+			static void ExecuteTask(Functor* task);
+			static Functor* PopTask(unsigned int workerIndex);
+			static void PushTask(unsigned int workerIndex, Functor* task);
+			static Functor* StealTask(unsigned int workerIndex);
 			static unsigned int __stdcall WorkerProc(void* userdata);
 
 			struct Worker
 			{
-				std::atomic_size_t workCount;
-				std::queue<Functor*> queue;
-				CRITICAL_SECTION queueMutex;
-				HANDLE wakeEvent;
-				volatile bool running;
+				std::deque<Functor*> queue;
+				HANDLE thread;
+				SRWLOCK queueLock;
 			};
 
-			static std::unique_ptr<HANDLE[]> s_doneEvents; // Doivent être contigus
+			static constexpr unsigned int InvalidWorkerIndex = ~0U;
+
 			static std::unique_ptr<Worker[]> s_workers;
-			static std::unique_ptr<HANDLE[]> s_workerThreads; // Doivent être contigus
-			static DWORD s_workerCount;
-};
+			static std::atomic<bool> s_shouldFinish;
+			static std::atomic<std::size_t> s_pendingTaskCount; //< queued and running tasks
+			static std::atomic<std::size_t> s_queuedTaskCount;
+			static std::atomic<unsigned int> s_nextWorkerIndex;
+			static unsigned int s_workerCount;
+			static thread_local unsigned int s_currentWorkerIndex;
+
+			static CONDITION_VARIABLE s_cvEmpty;
+			static CONDITION_VARIABLE s_cvNotEmpty;
+			static CRITICAL_SECTION s_sleepMutex;
+	};
 }
 
 #endif // NAZARA_CORE_WIN32_TASKSCHEDULERIMPL_HPP
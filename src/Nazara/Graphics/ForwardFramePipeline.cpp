@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/ForwardFramePipeline.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/FrameGraph.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
@@ -51,16 +52,11 @@ namespace Nz
 		lightData->renderMask = renderMask;
 		lightData->onLightInvalidated.Connect(lightData->light->OnLightDataInvalided, [=](Light*)
 		{
-			//TODO: Switch lights to storage buffers so they can all be part of GPU memory
-			for (auto& viewerData : m_viewerPool)
-			{
-				UInt32 viewerRenderMask = viewerData.viewer->GetRenderMask();
-
-				if (viewerRenderMask & renderMask)
-					viewerData.forwardPass->InvalidateElements();
-			}
+			UpdateLightBoundingVolume(lightIndex);
 		});
 
+		UpdateLightBoundingVolume(lightIndex);
+
 		return lightIndex;
 	}
 	
@@ -74,6 +70,20 @@ namespace Nz
 		renderableData->skeletonInstanceIndex = skeletonInstanceIndex;
 		renderableData->worldInstanceIndex = worldInstanceIndex;
 
+		// World-space AABB is only recomputed when the renderable AABB or its world matrix changes
+		renderableData->onAABBUpdate.Connect(instancedRenderable->OnAABBUpdate, [=](InstancedRenderable* /*instancedRenderable*/, const Boxf& /*aabb*/)
+		{
+			m_invalidatedRenderables.UnboundedSet(renderableIndex);
+		});
+
+		const WorldInstancePtr& worldInstance = m_worldInstances.RetrieveFromIndex(worldInstanceIndex)->worldInstance;
+		renderableData->onWorldMatrixUpdate.Connect(worldInstance->OnWorldMatrixUpdate, [=](WorldInstance* /*worldInstance*/, const Matrix4f& /*worldMatrix*/)
+		{
+			m_invalidatedRenderables.UnboundedSet(renderableIndex);
+		});
+
+		m_invalidatedRenderables.UnboundedSet(renderableIndex);
+
 		renderableData->onElementInvalidated.Connect(instancedRenderable->OnElementInvalidated, [=](InstancedRenderable* /*instancedRenderable*/)
 		{
 			// TODO: Invalidate only relevant viewers and passes
@@ -193,6 +203,8 @@ namespace Nz
 
 	void ForwardFramePipeline::Render(RenderFrame& renderFrame)
 	{
+		NazaraProfileZone("ForwardFramePipeline::Render");
+
 		m_currentRenderFrame = &renderFrame;
 
 		Graphics* graphics = Graphics::Instance();
@@ -219,6 +231,24 @@ namespace Nz
 		}
 		m_removedWorldInstances.Clear();
 
+		// Update world-space AABB of renderables which moved or changed since last frame
+		for (std::size_t renderableIndex = m_invalidatedRenderables.FindFirst(); renderableIndex != m_invalidatedRenderables.npos; renderableIndex = m_invalidatedRenderables.FindNext(renderableIndex))
+		{
+			RenderableData& renderableData = *m_renderablePool.RetrieveFromIndex(renderableIndex);
+			const WorldInstancePtr& worldInstance = m_worldInstances.RetrieveFromIndex(renderableData.worldInstanceIndex)->worldInstance;
+
+			BoundingVolumef boundingVolume(renderableData.renderable->GetAABB());
+			boundingVolume.Update(worldInstance->GetWorldMatrix());
+
+			renderableData.worldAABB = boundingVolume.aabb;
+
+			if (renderableData.treeLeafIndex == BoundingVolumeHierarchyf::InvalidIndex)
+				renderableData.treeLeafIndex = m_renderableTree.Insert(boundingVolume.aabb, renderableIndex);
+			else
+				m_renderableTree.Move(renderableData.treeLeafIndex, boundingVolume.aabb);
+		}
+		m_invalidatedRenderables.Clear();
+
 		if (m_rebuildFrameGraph)
 		{
 			renderFrame.PushForRelease(std::move(m_bakedFrameGraph));
@@ -251,6 +281,8 @@ namespace Nz
 		// Render queues handling
 		for (auto& viewerData : m_viewerPool)
 		{
+			NazaraProfileZone("ForwardFramePipeline::Render (viewer)");
+
 			UInt32 renderMask = viewerData.viewer->GetRenderMask();
 
 			// Frustum culling
@@ -260,21 +292,26 @@ namespace Nz
 
 			std::size_t visibilityHash = 5U;
 
+			// Gather indices first so renderables are always processed in the same order, whatever the tree layout is
+			m_visibleRenderableIndices.Clear();
+			m_renderableTree.QueryFrustum(frustum, [&](std::size_t renderableIndex)
+			{
+				m_visibleRenderableIndices.UnboundedSet(renderableIndex);
+			});
+
 			m_visibleRenderables.clear();
-			for (const RenderableData& renderableData : m_renderablePool)
+			for (std::size_t renderableIndex = m_visibleRenderableIndices.FindFirst(); renderableIndex != m_visibleRenderableIndices.npos; renderableIndex = m_visibleRenderableIndices.FindNext(renderableIndex))
 			{
+				const RenderableData& renderableData = *m_renderablePool.RetrieveFromIndex(renderableIndex);
 				if ((renderMask & renderableData.renderMask) == 0)
 					continue;
 
-				WorldInstancePtr& worldInstance = m_worldInstances.RetrieveFromIndex(renderableData.worldInstanceIndex)->worldInstance;
-
-				// Get global AABB
-				BoundingVolumef boundingVolume(renderableData.renderable->GetAABB());
-				boundingVolume.Update(worldInstance->GetWorldMatrix());
-
-				if (!frustum.Contains(boundingVolume))
+				// The tree only tests enlarged boxes, test the exact box of the leaves it reported
+				if (!frustum.Contains(renderableData.worldAABB))
 					continue;
 
+				WorldInstancePtr& worldInstance = m_worldInstances.RetrieveFromIndex(renderableData.worldInstanceIndex)->worldInstance;
+
 				auto& visibleRenderable = m_visibleRenderables.emplace_back();
 				visibleRenderable.instancedRenderable = renderableData.renderable;
 				visibleRenderable.scissorBox = renderableData.scissorBox;
@@ -288,24 +325,28 @@ namespace Nz
 				visibilityHash = CombineHash(visibilityHash, std::hash<const void*>()(&renderableData));
 			}
 
-			// Lights update don't trigger a rebuild of the depth pre-pass
-			std::size_t depthVisibilityHash = visibilityHash;
+			m_visibleLightIndices.Clear();
+			m_lightTree.QueryFrustum(frustum, [&](std::size_t lightIndex)
+			{
+				m_visibleLightIndices.UnboundedSet(lightIndex);
+			});
+
+			for (std::size_t lightIndex = m_infiniteLights.FindFirst(); lightIndex != m_infiniteLights.npos; lightIndex = m_infiniteLights.FindNext(lightIndex))
+				m_visibleLightIndices.UnboundedSet(lightIndex);
 
 			m_visibleLights.clear();
-			for (const LightData& lightData : m_lightPool)
+			for (std::size_t lightIndex = m_visibleLightIndices.FindFirst(); lightIndex != m_visibleLightIndices.npos; lightIndex = m_visibleLightIndices.FindNext(lightIndex))
 			{
+				const LightData& lightData = *m_lightPool.RetrieveFromIndex(lightIndex);
 				const BoundingVolumef& boundingVolume = lightData.light->GetBoundingVolume();
 
 				// TODO: Use more precise tests for point lights (frustum/sphere is cheap)
 				if (renderMask & lightData.renderMask && frustum.Contains(boundingVolume))
-				{
 					m_visibleLights.push_back(lightData.light.get());
-					visibilityHash = CombineHash(visibilityHash, std::hash<const void*>()(lightData.light.get()));
-				}
 			}
 
 			if (viewerData.depthPrepass)
-				viewerData.depthPrepass->Prepare(renderFrame, frustum, m_visibleRenderables, depthVisibilityHash);
+				viewerData.depthPrepass->Prepare(renderFrame, frustum, m_visibleRenderables, visibilityHash);
 
 			viewerData.forwardPass->Prepare(renderFrame, frustum, m_visibleRenderables, m_visibleLights, visibilityHash);
 
@@ -397,6 +438,13 @@ namespace Nz
 
 	void ForwardFramePipeline::UnregisterLight(std::size_t lightIndex)
 	{
+		LightData& lightData = *m_lightPool.RetrieveFromIndex(lightIndex);
+		if (lightData.treeLeafIndex != BoundingVolumeHierarchyf::InvalidIndex)
+			m_lightTree.Remove(lightData.treeLeafIndex);
+
+		if (lightIndex < m_infiniteLights.GetSize())
+			m_infiniteLights.Set(lightIndex, false);
+
 		m_lightPool.Free(lightIndex);
 	}
 
@@ -419,6 +467,12 @@ namespace Nz
 			}
 		}
 
+		if (renderable.treeLeafIndex != BoundingVolumeHierarchyf::InvalidIndex)
+			m_renderableTree.Remove(renderable.treeLeafIndex);
+
+		if (renderableIndex < m_invalidatedRenderables.GetSize())
+			m_invalidatedRenderables.Set(renderableIndex, false);
+
 		m_renderablePool.Free(renderableIndex);
 	}
 
@@ -605,4 +659,29 @@ namespace Nz
 		if (--materialInstanceData.usedCount == 0)
 			m_materialInstances.erase(it);
 	}
+
+	void ForwardFramePipeline::UpdateLightBoundingVolume(std::size_t lightIndex)
+	{
+		LightData& lightData = *m_lightPool.RetrieveFromIndex(lightIndex);
+		const BoundingVolumef& boundingVolume = lightData.light->GetBoundingVolume();
+
+		// Only finite lights can be part of the tree, infinite ones (directional lights) are always tested
+		if (boundingVolume.extend == Extend::Finite)
+		{
+			if (lightData.treeLeafIndex == BoundingVolumeHierarchyf::InvalidIndex)
+				lightData.treeLeafIndex = m_lightTree.Insert(boundingVolume.aabb, lightIndex);
+			else
+				m_lightTree.Move(lightData.treeLeafIndex, boundingVolume.aabb);
+		}
+		else if (lightData.treeLeafIndex != BoundingVolumeHierarchyf::InvalidIndex)
+		{
+			m_lightTree.Remove(lightData.treeLeafIndex);
+			lightData.treeLeafIndex = BoundingVolumeHierarchyf::InvalidIndex;
+		}
+
+		if (boundingVolume.extend == Extend::Infinite)
+			m_infiniteLights.UnboundedSet(lightIndex);
+		else if (lightIndex < m_infiniteLights.GetSize())
+			m_infiniteLights.Set(lightIndex, false);
+	}
 }
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/ForwardPipelinePass.hpp>
+#include <Nazara/Core/LinearArena.hpp>
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/ElementRendererRegistry.hpp>
 #include <Nazara/Graphics/FrameGraph.hpp>
@@ -14,6 +15,7 @@
 #include <Nazara/Graphics/ViewerInstance.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
 #include <Nazara/Renderer/RenderFrame.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -28,135 +30,47 @@ namespace Nz
 	{
 		Graphics* graphics = Graphics::Instance();
 		m_forwardPassIndex = graphics->GetMaterialPassRegistry().GetPassIndex("ForwardPass");
-		m_lightUboPool = std::make_shared<LightUboPool>();
+
+		const std::shared_ptr<RenderDevice>& renderDevice = graphics->GetRenderDevice();
+
+		// Light clustering requires storage buffers, fallback to a uniform buffer holding a limited number of lights otherwise
+		m_useLightClustering = renderDevice->GetEnabledFeatures().storageBuffers;
+		if (m_useLightClustering)
+		{
+			PredefinedClusteredLightData lightOffsets = PredefinedClusteredLightData::GetOffsets();
+			m_lightDataBuffer = renderDevice->InstantiateBuffer(BufferType::Storage, lightOffsets.totalSize, BufferUsage::DeviceLocal | BufferUsage::Dynamic | BufferUsage::Write);
+		}
+		else
+		{
+			PredefinedLightData lightOffsets = PredefinedLightData::GetOffsets();
+			m_lightDataBuffer = renderDevice->InstantiateBuffer(BufferType::Uniform, lightOffsets.totalSize, BufferUsage::DeviceLocal | BufferUsage::Dynamic | BufferUsage::Write);
+		}
 	}
 
 	void ForwardPipelinePass::Prepare(RenderFrame& renderFrame, const Frustumf& frustum, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, const std::vector<const Light*>& visibleLights, std::size_t visibilityHash)
 	{
+		// Lights are shared by every render element of the pass and don't require a rebuild when they change
+		if (m_useLightClustering)
+			UpdateClusteredLightData(renderFrame, visibleLights);
+		else
+			UpdateLightData(renderFrame, visibleLights);
+
 		if (m_lastVisibilityHash != visibilityHash || m_rebuildElements) //< FIXME
 		{
 			renderFrame.PushForRelease(std::move(m_renderElements));
 			m_renderElements.clear();
 			m_renderQueueRegistry.Clear();
 			m_renderQueue.Clear();
-			m_lightBufferPerLights.clear();
-			m_lightPerRenderElement.clear();
-
-			for (auto& lightDataUbo : m_lightDataBuffers)
-			{
-				renderFrame.PushReleaseCallback([pool = m_lightUboPool, lightUbo = std::move(lightDataUbo.renderBuffer)]() mutable
-				{
-					pool->lightUboBuffers.push_back(std::move(lightUbo));
-				});
-			}
-			m_lightDataBuffers.clear();
-
-			Graphics* graphics = Graphics::Instance();
-
-			PredefinedLightData lightOffsets = PredefinedLightData::GetOffsets();
-			std::size_t lightUboAlignedSize = AlignPow2(lightOffsets.totalSize, SafeCast<std::size_t>(graphics->GetRenderDevice()->GetDeviceInfo().limits.minUniformBufferOffsetAlignment));
-
-			UploadPool& uploadPool = renderFrame.GetUploadPool();
 
 			for (const auto& renderableData : visibleRenderables)
 			{
-				BoundingVolumef renderableBoundingVolume(renderableData.instancedRenderable->GetAABB());
-				renderableBoundingVolume.Update(renderableData.worldInstance->GetWorldMatrix());
-
-				// Select lights
-				m_renderableLights.clear();
-				for (const Light* light : visibleLights)
-				{
-					const BoundingVolumef& boundingVolume = light->GetBoundingVolume();
-					if (boundingVolume.Intersect(renderableBoundingVolume.aabb))
-						m_renderableLights.push_back(light);
-				}
-
-				// Sort lights
-				std::sort(m_renderableLights.begin(), m_renderableLights.end(), [&](const Light* lhs, const Light* rhs)
-				{
-					return lhs->ComputeContributionScore(renderableBoundingVolume) < rhs->ComputeContributionScore(renderableBoundingVolume);
-				});
-
-				std::size_t lightCount = std::min(m_renderableLights.size(), MaxLightCountPerDraw);
-
-				LightKey lightKey;
-				lightKey.fill(nullptr);
-				for (std::size_t i = 0; i < lightCount; ++i)
-					lightKey[i] = m_renderableLights[i];
-
-				RenderBufferView lightUboView;
-
-				auto it = m_lightBufferPerLights.find(lightKey);
-				if (it == m_lightBufferPerLights.end())
-				{
-					// Prepare light ubo upload
-
-					// Find light ubo
-					LightDataUbo* targetLightData = nullptr;
-					for (auto& lightUboData : m_lightDataBuffers)
-					{
-						if (lightUboData.offset + lightUboAlignedSize <= lightUboData.renderBuffer->GetSize())
-						{
-							targetLightData = &lightUboData;
-							break;
-						}
-					}
-
-					if (!targetLightData)
-					{
-						// Make a new light UBO
-						auto& lightUboData = m_lightDataBuffers.emplace_back();
-
-						// Reuse from pool if possible
-						if (!m_lightUboPool->lightUboBuffers.empty())
-						{
-							lightUboData.renderBuffer = m_lightUboPool->lightUboBuffers.back();
-							m_lightUboPool->lightUboBuffers.pop_back();
-						}
-						else
-							lightUboData.renderBuffer = graphics->GetRenderDevice()->InstantiateBuffer(BufferType::Uniform, 256 * lightUboAlignedSize, BufferUsage::DeviceLocal | BufferUsage::Dynamic | BufferUsage::Write);
-
-						targetLightData = &lightUboData;
-					}
-
-					assert(targetLightData);
-					if (!targetLightData->allocation)
-						targetLightData->allocation = &uploadPool.Allocate(targetLightData->renderBuffer->GetSize());
-
-					void* lightDataPtr = static_cast<UInt8*>(targetLightData->allocation->mappedPtr) + targetLightData->offset;
-					AccessByOffset<UInt32&>(lightDataPtr, lightOffsets.lightCountOffset) = SafeCast<UInt32>(lightCount);
-
-					UInt8* lightPtr = static_cast<UInt8*>(lightDataPtr) + lightOffsets.lightsOffset;
-					for (std::size_t i = 0; i < lightCount; ++i)
-					{
-						m_renderableLights[i]->FillLightData(lightPtr);
-						lightPtr += lightOffsets.lightSize;
-					}
-
-					// Associate render element with light ubo
-					lightUboView = RenderBufferView(targetLightData->renderBuffer.get(), targetLightData->offset, lightUboAlignedSize);
-
-					targetLightData->offset += lightUboAlignedSize;
-
-					m_lightBufferPerLights.emplace(lightKey, lightUboView);
-				}
-				else
-					lightUboView = it->second;
-
 				InstancedRenderable::ElementData elementData{
 					&renderableData.scissorBox,
 					renderableData.skeletonInstance,
 					renderableData.worldInstance
 				};
 
-				std::size_t previousCount = m_renderElements.size();
 				renderableData.instancedRenderable->BuildElement(m_elementRegistry, elementData, m_forwardPassIndex, m_renderElements);
-				for (std::size_t i = previousCount; i < m_renderElements.size(); ++i)
-				{
-					const RenderElement* element = m_renderElements[i].GetElement();
-					m_lightPerRenderElement.emplace(element, lightUboView);
-				}
 			}
 
 			for (const auto& renderElement : m_renderElements)
@@ -167,23 +81,6 @@ namespace Nz
 
 			m_renderQueueRegistry.Finalize();
 
-			renderFrame.Execute([&](CommandBufferBuilder& builder)
-			{
-				builder.BeginDebugRegion("Light UBO Update", Color::Yellow);
-				{
-					for (auto& lightUboData : m_lightDataBuffers)
-					{
-						if (!lightUboData.allocation)
-							continue;
-
-						builder.CopyBuffer(*lightUboData.allocation, RenderBufferView(lightUboData.renderBuffer.get(), 0, lightUboData.offset));
-					}
-
-					builder.PostTransferBarrier();
-				}
-				builder.EndDebugRegion();
-			}, QueueType::Transfer);
-
 			m_lastVisibilityHash = visibilityHash;
 			m_rebuildElements = true;
 		}
@@ -209,7 +106,7 @@ namespace Nz
 
 			const auto& viewerInstance = m_viewer->GetViewerInstance();
 
-			auto& lightPerRenderElement = m_lightPerRenderElement;
+			RenderBufferView lightDataView(m_lightDataBuffer.get());
 			m_elementRegistry.ProcessRenderQueue(m_renderQueue, [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
 			{
 				ElementRenderer& elementRenderer = m_elementRegistry.GetElementRenderer(elementType);
@@ -219,11 +116,8 @@ namespace Nz
 				m_renderStates.reserve(elementCount);
 				for (std::size_t i = 0; i < elementCount; ++i)
 				{
-					auto it = lightPerRenderElement.find(elements[i]);
-					assert(it != lightPerRenderElement.end());
-
 					auto& renderStates = m_renderStates.emplace_back();
-					renderStates.lightData = it->second;
+					renderStates.lightData = lightDataView;
 				}
 
 				elementRenderer.Prepare(viewerInstance, *m_elementRendererData[elementType], renderFrame, elementCount, elements, m_renderStates.data());
@@ -310,4 +204,147 @@ namespace Nz
 				m_materialInstances.erase(it);
 		}
 	}
+
+	void ForwardPipelinePass::UpdateClusteredLightData(RenderFrame& renderFrame, const std::vector<const Light*>& visibleLights)
+	{
+		// Light lists are only needed while building the light data, take their memory from the frame arena
+		LinearArena& arena = renderFrame.GetTransientArena();
+		ArenaAllocator<const Light*> lightAllocator(arena);
+		ArenaAllocator<Boxf> boxAllocator(arena);
+
+		std::vector<const Light*, ArenaAllocator<const Light*>> directionalLights(lightAllocator);
+		std::vector<const Light*, ArenaAllocator<const Light*>> clusteredLights(lightAllocator);
+		directionalLights.reserve(visibleLights.size());
+		clusteredLights.reserve(visibleLights.size());
+
+		// Directional lights affect every fragment and are stored first, other lights are assigned to clusters
+		for (const Light* light : visibleLights)
+		{
+			const BoundingVolumef& boundingVolume = light->GetBoundingVolume();
+			if (boundingVolume.extend == Extend::Infinite)
+			{
+				if (directionalLights.size() < PredefinedClusteredLightData::MaxLightCount)
+					directionalLights.push_back(light);
+			}
+			else
+				clusteredLights.push_back(light);
+		}
+
+		std::size_t clusteredLightCount = std::min(clusteredLights.size(), PredefinedClusteredLightData::MaxLightCount - directionalLights.size());
+		clusteredLights.resize(clusteredLightCount);
+
+		std::vector<Boxf, ArenaAllocator<Boxf>> clusteredLightBoxes(boxAllocator);
+		clusteredLightBoxes.reserve(clusteredLightCount);
+		for (const Light* light : clusteredLights)
+			clusteredLightBoxes.push_back(light->GetBoundingVolume().aabb);
+
+		const auto& viewerInstance = m_viewer->GetViewerInstance();
+		m_lightClusterGrid.Build(viewerInstance.GetViewMatrix(), viewerInstance.GetInvProjectionMatrix(), clusteredLightBoxes.data(), clusteredLightBoxes.size());
+
+		const auto& clusters = m_lightClusterGrid.GetClusters();
+		const auto& lightIndices = m_lightClusterGrid.GetLightIndices();
+
+		PredefinedClusteredLightData lightOffsets = PredefinedClusteredLightData::GetOffsets();
+
+		// Only upload the used part of the light indices array
+		std::size_t uploadSize = lightOffsets.lightIndicesOffset + lightIndices.size() * lightOffsets.lightIndexSize;
+
+		UploadPool& uploadPool = renderFrame.GetUploadPool();
+		auto& allocation = uploadPool.Allocate(uploadSize);
+
+		UInt8* lightDataPtr = static_cast<UInt8*>(allocation.mappedPtr);
+
+		UInt32 directionalLightCount = SafeCast<UInt32>(directionalLights.size());
+		AccessByOffset<UInt32&>(lightDataPtr, lightOffsets.lightCountOffset) = SafeCast<UInt32>(directionalLightCount + clusteredLightCount);
+		AccessByOffset<UInt32&>(lightDataPtr, lightOffsets.directionalLightCountOffset) = directionalLightCount;
+		AccessByOffset<Vector3ui32&>(lightDataPtr, lightOffsets.clusterGridSizeOffset) = Vector3ui32(PredefinedClusteredLightData::ClusterGridSizeX, PredefinedClusteredLightData::ClusterGridSizeY, PredefinedClusteredLightData::ClusterGridSizeZ);
+		AccessByOffset<Vector2f&>(lightDataPtr, lightOffsets.clusterDepthRangeOffset) = m_lightClusterGrid.GetDepthRange();
+
+		UInt8* lightPtr = lightDataPtr + lightOffsets.lightsOffset;
+		for (const auto* lights : { &directionalLights, &clusteredLights })
+		{
+			for (const Light* light : *lights)
+			{
+				light->FillLightData(lightPtr);
+				lightPtr += lightOffsets.lightSize;
+			}
+		}
+
+		UInt8* clusterPtr = lightDataPtr + lightOffsets.clustersOffset;
+		for (const LightClusterGrid::Cluster& cluster : clusters)
+		{
+			AccessByOffset<Vector2ui32&>(clusterPtr, 0) = Vector2ui32(cluster.firstLightIndex, cluster.lightCount);
+			clusterPtr += lightOffsets.clusterSize;
+		}
+
+		// Cluster light indices are relative to clustered lights, which are stored after directional lights
+		UInt8* lightIndexPtr = lightDataPtr + lightOffsets.lightIndicesOffset;
+		for (UInt32 lightIndex : lightIndices)
+		{
+			AccessByOffset<UInt32&>(lightIndexPtr, 0) = directionalLightCount + lightIndex;
+			lightIndexPtr += lightOffsets.lightIndexSize;
+		}
+
+		renderFrame.Execute([&](CommandBufferBuilder& builder)
+		{
+			builder.BeginDebugRegion("Light data update", Color::Yellow);
+			{
+				builder.CopyBuffer(allocation, RenderBufferView(m_lightDataBuffer.get(), 0, uploadSize));
+				builder.PostTransferBarrier();
+			}
+			builder.EndDebugRegion();
+		}, QueueType::Transfer);
+	}
+
+	void ForwardPipelinePass::UpdateLightData(RenderFrame& renderFrame, const std::vector<const Light*>& visibleLights)
+	{
+		LinearArena& arena = renderFrame.GetTransientArena();
+		std::vector<const Light*, ArenaAllocator<const Light*>> lights(visibleLights.begin(), visibleLights.end(), ArenaAllocator<const Light*>(arena));
+
+		// Every fragment processes every light, keep directional lights and the lights closest to the viewer
+		if (lights.size() > PredefinedLightData::MaxLightCount)
+		{
+			const Vector3f& eyePosition = m_viewer->GetViewerInstance().GetEyePosition();
+			auto ComputeLightDistance = [&](const Light* light)
+			{
+				const BoundingVolumef& boundingVolume = light->GetBoundingVolume();
+				if (boundingVolume.extend == Extend::Infinite)
+					return -1.f;
+
+				return eyePosition.SquaredDistance(boundingVolume.aabb.GetCenter());
+			};
+
+			std::nth_element(lights.begin(), lights.begin() + PredefinedLightData::MaxLightCount, lights.end(), [&](const Light* lhs, const Light* rhs)
+			{
+				return ComputeLightDistance(lhs) < ComputeLightDistance(rhs);
+			});
+
+			lights.resize(PredefinedLightData::MaxLightCount);
+		}
+
+		PredefinedLightData lightOffsets = PredefinedLightData::GetOffsets();
+
+		UploadPool& uploadPool = renderFrame.GetUploadPool();
+		auto& allocation = uploadPool.Allocate(lightOffsets.totalSize);
+
+		UInt8* lightDataPtr = static_cast<UInt8*>(allocation.mappedPtr);
+		AccessByOffset<UInt32&>(lightDataPtr, lightOffsets.lightCountOffset) = SafeCast<UInt32>(lights.size());
+
+		UInt8* lightPtr = lightDataPtr + lightOffsets.lightsOffset;
+		for (const Light* light : lights)
+		{
+			light->FillLightData(lightPtr);
+			lightPtr += lightOffsets.lightSize;
+		}
+
+		renderFrame.Execute([&](CommandBufferBuilder& builder)
+		{
+			builder.BeginDebugRegion("Light data update", Color::Yellow);
+			{
+				builder.CopyBuffer(allocation, RenderBufferView(m_lightDataBuffer.get(), 0, lightOffsets.totalSize));
+				builder.PostTransferBarrier();
+			}
+			builder.EndDebugRegion();
+		}, QueueType::Transfer);
+	}
 }
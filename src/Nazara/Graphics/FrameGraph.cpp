@@ -7,6 +7,7 @@
 
 #include <Nazara/Graphics/FrameGraph.hpp>
 #include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Utils/StackArray.hpp>
 #include <stdexcept>
@@ -27,6 +28,8 @@ namespace Nz
 
 	BakedFrameGraph FrameGraph::Bake()
 	{
+		NazaraProfileZone("FrameGraph::Bake");
+
 		if (m_backbufferOutputs.empty())
 			throw std::runtime_error("no backbuffer output has been set");
 
@@ -0,0 +1,284 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/FrustumCuller.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#if defined(NAZARA_PLATFORM_x64)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Box arrays are padded to this size with removed boxes so vectorized paths never need a scalar tail
+		constexpr std::size_t BoxBatchSize = 8;
+
+		// Negative extents put a box behind every plane, which makes it invisible
+		constexpr float RemovedExtent = -std::numeric_limits<float>::max();
+
+		struct CullingPlane
+		{
+			float normalX;
+			float normalY;
+			float normalZ;
+			float absNormalX;
+			float absNormalY;
+			float absNormalZ;
+			float distance;
+		};
+
+		using CullingPlanes = std::array<CullingPlane, FrustumPlaneCount>;
+
+		CullingPlanes BuildCullingPlanes(const Frustumf& frustum)
+		{
+			CullingPlanes cullingPlanes;
+			for (std::size_t i = 0; i < FrustumPlaneCount; ++i)
+			{
+				const Planef& plane = frustum.GetPlane(static_cast<FrustumPlane>(i));
+
+				CullingPlane& cullingPlane = cullingPlanes[i];
+				cullingPlane.normalX = plane.normal.x;
+				cullingPlane.normalY = plane.normal.y;
+				cullingPlane.normalZ = plane.normal.z;
+				cullingPlane.absNormalX = std::abs(plane.normal.x);
+				cullingPlane.absNormalY = std::abs(plane.normal.y);
+				cullingPlane.absNormalZ = std::abs(plane.normal.z);
+				cullingPlane.distance = plane.distance;
+			}
+
+			return cullingPlanes;
+		}
+
+		void SetVisibleBoxes(Bitset<UInt64>& visibleBoxes, std::size_t firstBox, unsigned int visibilityMask)
+		{
+			for (std::size_t i = 0; visibilityMask != 0; ++i, visibilityMask >>= 1)
+			{
+				if (visibilityMask & 1)
+					visibleBoxes.Set(firstBox + i);
+			}
+		}
+
+#if defined(NAZARA_PLATFORM_x64)
+		void CullSSE(const CullingPlanes& planes, const float* centerX, const float* centerY, const float* centerZ, const float* extentX, const float* extentY, const float* extentZ, std::size_t boxCount, Bitset<UInt64>& visibleBoxes)
+		{
+			const __m128 zero = _mm_setzero_ps();
+
+			for (std::size_t i = 0; i < boxCount; i += 4)
+			{
+				__m128 cx = _mm_loadu_ps(&centerX[i]);
+				__m128 cy = _mm_loadu_ps(&centerY[i]);
+				__m128 cz = _mm_loadu_ps(&centerZ[i]);
+				__m128 ex = _mm_loadu_ps(&extentX[i]);
+				__m128 ey = _mm_loadu_ps(&extentY[i]);
+				__m128 ez = _mm_loadu_ps(&extentZ[i]);
+
+				__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (const CullingPlane& plane : planes)
+				{
+					// Signed distance of the positive vertex (the box corner the furthest along the plane normal)
+					__m128 centerDist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, _mm_set1_ps(plane.normalX)), _mm_mul_ps(cy, _mm_set1_ps(plane.normalY))), _mm_mul_ps(cz, _mm_set1_ps(plane.normalZ)));
+					__m128 extentDist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, _mm_set1_ps(plane.absNormalX)), _mm_mul_ps(ey, _mm_set1_ps(plane.absNormalY))), _mm_mul_ps(ez, _mm_set1_ps(plane.absNormalZ)));
+					__m128 dist = _mm_add_ps(_mm_sub_ps(centerDist, _mm_set1_ps(plane.distance)), extentDist);
+
+					visible = _mm_and_ps(visible, _mm_cmpge_ps(dist, zero));
+				}
+
+				SetVisibleBoxes(visibleBoxes, i, static_cast<unsigned int>(_mm_movemask_ps(visible)));
+			}
+		}
+
+		NAZARA_TARGET_FEATURES("avx")
+		void CullAVX(const CullingPlanes& planes, const float* centerX, const float* centerY, const float* centerZ, const float* extentX, const float* extentY, const float* extentZ, std::size_t boxCount, Bitset<UInt64>& visibleBoxes)
+		{
+			const __m256 zero = _mm256_setzero_ps();
+
+			for (std::size_t i = 0; i < boxCount; i += 8)
+			{
+				__m256 cx = _mm256_loadu_ps(&centerX[i]);
+				__m256 cy = _mm256_loadu_ps(&centerY[i]);
+				__m256 cz = _mm256_loadu_ps(&centerZ[i]);
+				__m256 ex = _mm256_loadu_ps(&extentX[i]);
+				__m256 ey = _mm256_loadu_ps(&extentY[i]);
+				__m256 ez = _mm256_loadu_ps(&extentZ[i]);
+
+				__m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+				for (const CullingPlane& plane : planes)
+				{
+					__m256 centerDist = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(cx, _mm256_set1_ps(plane.normalX)), _mm256_mul_ps(cy, _mm256_set1_ps(plane.normalY))), _mm256_mul_ps(cz, _mm256_set1_ps(plane.normalZ)));
+					__m256 extentDist = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ex, _mm256_set1_ps(plane.absNormalX)), _mm256_mul_ps(ey, _mm256_set1_ps(plane.absNormalY))), _mm256_mul_ps(ez, _mm256_set1_ps(plane.absNormalZ)));
+					__m256 dist = _mm256_add_ps(_mm256_sub_ps(centerDist, _mm256_set1_ps(plane.distance)), extentDist);
+
+					visible = _mm256_and_ps(visible, _mm256_cmp_ps(dist, zero, _CMP_GE_OQ));
+				}
+
+				SetVisibleBoxes(visibleBoxes, i, static_cast<unsigned int>(_mm256_movemask_ps(visible)));
+			}
+		}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+		void CullNEON(const CullingPlanes& planes, const float* centerX, const float* centerY, const float* centerZ, const float* extentX, const float* extentY, const float* extentZ, std::size_t boxCount, Bitset<UInt64>& visibleBoxes)
+		{
+			const float32x4_t zero = vdupq_n_f32(0.f);
+
+			for (std::size_t i = 0; i < boxCount; i += 4)
+			{
+				float32x4_t cx = vld1q_f32(&centerX[i]);
+				float32x4_t cy = vld1q_f32(&centerY[i]);
+				float32x4_t cz = vld1q_f32(&centerZ[i]);
+				float32x4_t ex = vld1q_f32(&extentX[i]);
+				float32x4_t ey = vld1q_f32(&extentY[i]);
+				float32x4_t ez = vld1q_f32(&extentZ[i]);
+
+				uint32x4_t visible = vdupq_n_u32(0xFFFFFFFF);
+				for (const CullingPlane& plane : planes)
+				{
+					float32x4_t centerDist = vaddq_f32(vaddq_f32(vmulq_n_f32(cx, plane.normalX), vmulq_n_f32(cy, plane.normalY)), vmulq_n_f32(cz, plane.normalZ));
+					float32x4_t extentDist = vaddq_f32(vaddq_f32(vmulq_n_f32(ex, plane.absNormalX), vmulq_n_f32(ey, plane.absNormalY)), vmulq_n_f32(ez, plane.absNormalZ));
+					float32x4_t dist = vaddq_f32(vsubq_f32(centerDist, vdupq_n_f32(plane.distance)), extentDist);
+
+					visible = vandq_u32(visible, vcgeq_f32(dist, zero));
+				}
+
+				unsigned int visibilityMask = (vgetq_lane_u32(visible, 0) & 1) | (vgetq_lane_u32(visible, 1) & 2) | (vgetq_lane_u32(visible, 2) & 4) | (vgetq_lane_u32(visible, 3) & 8);
+				SetVisibleBoxes(visibleBoxes, i, visibilityMask);
+			}
+		}
+#else
+		void CullScalar(const CullingPlanes& planes, const float* centerX, const float* centerY, const float* centerZ, const float* extentX, const float* extentY, const float* extentZ, std::size_t boxCount, Bitset<UInt64>& visibleBoxes)
+		{
+			for (std::size_t i = 0; i < boxCount; ++i)
+			{
+				bool visible = true;
+				for (const CullingPlane& plane : planes)
+				{
+					float dist = centerX[i] * plane.normalX + centerY[i] * plane.normalY + centerZ[i] * plane.normalZ - plane.distance +
+					             extentX[i] * plane.absNormalX + extentY[i] * plane.absNormalY + extentZ[i] * plane.absNormalZ;
+
+					if (dist < 0.f)
+					{
+						visible = false;
+						break;
+					}
+				}
+
+				if (visible)
+					visibleBoxes.Set(i);
+			}
+		}
+#endif
+	}
+
+	/*!
+	* \ingroup graphics
+	* \class Nz::FrustumCuller
+	* \brief Graphics class that tests a large number of world-space boxes against a frustum
+	*
+	* Boxes are identified by an index (typically the index of the renderable they bound) and are kept in contiguous arrays,
+	* so they only have to be updated when the object they bound moves. Culling then tests four (SSE, NEON) or eight (AVX) boxes at once.
+	*/
+
+	FrustumCuller::FrustumCuller() :
+	m_boxCount(0),
+	m_useAVX(false)
+	{
+#ifdef NAZARA_PLATFORM_x64
+		const Core* core = Core::Instance();
+		m_useAVX = (core && core->GetHardwareInfo().HasCapability(ProcessorCap::AVX));
+#endif
+	}
+
+	void FrustumCuller::Clear()
+	{
+		m_centerX.clear();
+		m_centerY.clear();
+		m_centerZ.clear();
+		m_extentX.clear();
+		m_extentY.clear();
+		m_extentZ.clear();
+		m_boxCount = 0;
+	}
+
+	void FrustumCuller::Cull(const Frustumf& frustum, Bitset<UInt64>& visibleBoxes) const
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		// Only world-space boxes are tested, which is a bit more conservative than Frustum::Contains on bounding volumes
+		visibleBoxes.Clear();
+		visibleBoxes.Resize(m_boxCount, false);
+
+		if (m_boxCount == 0)
+			return;
+
+		CullingPlanes planes = BuildCullingPlanes(frustum);
+
+		// Padding boxes are invisible and will never set a bit
+		std::size_t paddedBoxCount = (m_boxCount + BoxBatchSize - 1) / BoxBatchSize * BoxBatchSize;
+
+#if defined(NAZARA_PLATFORM_x64)
+		if (m_useAVX)
+			CullAVX(planes, m_centerX.data(), m_centerY.data(), m_centerZ.data(), m_extentX.data(), m_extentY.data(), m_extentZ.data(), paddedBoxCount, visibleBoxes);
+		else
+			CullSSE(planes, m_centerX.data(), m_centerY.data(), m_centerZ.data(), m_extentX.data(), m_extentY.data(), m_extentZ.data(), paddedBoxCount, visibleBoxes);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+		CullNEON(planes, m_centerX.data(), m_centerY.data(), m_centerZ.data(), m_extentX.data(), m_extentY.data(), m_extentZ.data(), paddedBoxCount, visibleBoxes);
+#else
+		CullScalar(planes, m_centerX.data(), m_centerY.data(), m_centerZ.data(), m_extentX.data(), m_extentY.data(), m_extentZ.data(), m_boxCount, visibleBoxes);
+#endif
+	}
+
+	void FrustumCuller::RemoveBox(std::size_t boxIndex)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (boxIndex >= m_boxCount)
+			return;
+
+		m_centerX[boxIndex] = 0.f;
+		m_centerY[boxIndex] = 0.f;
+		m_centerZ[boxIndex] = 0.f;
+		m_extentX[boxIndex] = RemovedExtent;
+		m_extentY[boxIndex] = RemovedExtent;
+		m_extentZ[boxIndex] = RemovedExtent;
+
+		while (m_boxCount > 0 && m_extentX[m_boxCount - 1] == RemovedExtent)
+			m_boxCount--;
+	}
+
+	void FrustumCuller::UpdateBox(std::size_t boxIndex, const Boxf& box)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (boxIndex >= m_centerX.size())
+		{
+			std::size_t paddedBoxCount = (boxIndex / BoxBatchSize + 1) * BoxBatchSize;
+			m_centerX.resize(paddedBoxCount, 0.f);
+			m_centerY.resize(paddedBoxCount, 0.f);
+			m_centerZ.resize(paddedBoxCount, 0.f);
+			m_extentX.resize(paddedBoxCount, RemovedExtent);
+			m_extentY.resize(paddedBoxCount, RemovedExtent);
+			m_extentZ.resize(paddedBoxCount, RemovedExtent);
+		}
+
+		m_boxCount = std::max(m_boxCount, boxIndex + 1);
+
+		Vector3f center = box.GetCenter();
+		m_centerX[boxIndex] = center.x;
+		m_centerY[boxIndex] = center.y;
+		m_centerZ[boxIndex] = center.z;
+		m_extentX[boxIndex] = box.width * 0.5f;
+		m_extentY[boxIndex] = box.height * 0.5f;
+		m_extentZ[boxIndex] = box.depth * 0.5f;
+	}
+}
@@ -0,0 +1,224 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/LightClusterGrid.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Graphics/PredefinedShaderStructs.hpp>
+#include <Nazara/Math/BoundingVolume.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <Nazara/Utils/Algorithm.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::LightClusterGrid
+	* \brief Graphics class assigning lights to the clusters (froxels) of a view frustum
+	*
+	* The frustum is split uniformly in NDC space along X and Y, and along the view depth following a square root distribution (giving thinner clusters close to the viewer).
+	* Layout and distribution match what shaders expect from the ClusteredLightData storage buffer (see PredefinedClusteredLightData).
+	*
+	* \remark When more than MaxLightPerCluster lights intersect a cluster, the ones closest to its center (relatively to their range) are kept, see GetDroppedLightCount
+	*/
+
+	LightClusterGrid::LightClusterGrid() :
+	m_clusters(PredefinedClusteredLightData::ClusterCount),
+	m_sliceLightIndices(PredefinedClusteredLightData::ClusterGridSizeZ),
+	m_clusterLightIndices(PredefinedClusteredLightData::ClusterCount * MaxLightPerCluster),
+	m_invProjectionMatrix(Matrix4f::Zero()),
+	m_depthRange(0.f, 0.f),
+	m_droppedLightCount(0)
+	{
+	}
+
+	void LightClusterGrid::Build(const Matrix4f& viewMatrix, const Matrix4f& invProjectionMatrix, SparsePtr<const Boxf> lightBoxes, std::size_t lightCount)
+	{
+		constexpr std::size_t GridSizeX = PredefinedClusteredLightData::ClusterGridSizeX;
+		constexpr std::size_t GridSizeY = PredefinedClusteredLightData::ClusterGridSizeY;
+		constexpr std::size_t GridSizeZ = PredefinedClusteredLightData::ClusterGridSizeZ;
+
+		// Cluster boxes are expressed in view space and only depend on the projection
+		if (m_clusterBoxes.empty() || m_invProjectionMatrix != invProjectionMatrix)
+			UpdateClusterBoxes(invProjectionMatrix);
+
+		m_lightBoxes.resize(lightCount);
+		for (std::size_t i = 0; i < lightCount; ++i)
+		{
+			BoundingVolumef lightVolume(lightBoxes[i]);
+			lightVolume.Update(viewMatrix);
+
+			m_lightBoxes[i] = lightVolume.aabb;
+		}
+
+		// Each depth slice is processed independently: lights are first filtered against the slice, then against each of its clusters
+		constexpr std::size_t SliceClusterCount = GridSizeX * GridSizeY;
+
+		std::atomic<std::size_t> droppedLightCount(0);
+
+		ParallelFor(0, GridSizeZ, [&](std::size_t sliceIndex)
+		{
+			std::size_t firstClusterIndex = sliceIndex * SliceClusterCount;
+
+			Boxf sliceBox = m_clusterBoxes[firstClusterIndex];
+			for (std::size_t i = 1; i < SliceClusterCount; ++i)
+				sliceBox.ExtendTo(m_clusterBoxes[firstClusterIndex + i]);
+
+			std::vector<UInt32>& sliceLightIndices = m_sliceLightIndices[sliceIndex];
+			sliceLightIndices.clear();
+			for (std::size_t lightIndex = 0; lightIndex < lightCount; ++lightIndex)
+			{
+				if (sliceBox.Intersect(m_lightBoxes[lightIndex]))
+					sliceLightIndices.push_back(SafeCast<UInt32>(lightIndex));
+			}
+
+			std::size_t sliceDroppedLightCount = 0;
+			std::array<float, MaxLightPerCluster> lightInfluences;
+			for (std::size_t clusterIndex = firstClusterIndex; clusterIndex < firstClusterIndex + SliceClusterCount; ++clusterIndex)
+			{
+				const Boxf& clusterBox = m_clusterBoxes[clusterIndex];
+				Vector3f clusterCenter = clusterBox.GetCenter();
+				UInt32* clusterLightIndices = &m_clusterLightIndices[clusterIndex * MaxLightPerCluster];
+
+				UInt32 clusterLightCount = 0;
+				for (UInt32 lightIndex : sliceLightIndices)
+				{
+					const Boxf& lightBox = m_lightBoxes[lightIndex];
+					if (!clusterBox.Intersect(lightBox))
+						continue;
+
+					// Rough estimate of the light attenuation at the cluster center, only used to pick which lights to keep once the cluster is full
+					float lightInfluence = 1.f - clusterCenter.Distance(lightBox.GetCenter()) / lightBox.GetRadius();
+
+					if (clusterLightCount < MaxLightPerCluster)
+					{
+						clusterLightIndices[clusterLightCount] = lightIndex;
+						lightInfluences[clusterLightCount] = lightInfluence;
+						clusterLightCount++;
+						continue;
+					}
+
+					sliceDroppedLightCount++;
+
+					// Replace the least significant light of the cluster if this one matters more
+					auto weakestIt = std::min_element(lightInfluences.begin(), lightInfluences.end());
+					if (*weakestIt < lightInfluence)
+					{
+						clusterLightIndices[std::distance(lightInfluences.begin(), weakestIt)] = lightIndex;
+						*weakestIt = lightInfluence;
+					}
+				}
+
+				m_clusters[clusterIndex].lightCount = clusterLightCount;
+			}
+
+			if (sliceDroppedLightCount > 0)
+				droppedLightCount += sliceDroppedLightCount;
+		}, 1);
+
+		m_droppedLightCount = droppedLightCount;
+
+		// Pack light indices of every cluster in a single array
+		m_lightIndices.clear();
+		for (std::size_t clusterIndex = 0; clusterIndex < m_clusters.size(); ++clusterIndex)
+		{
+			Cluster& cluster = m_clusters[clusterIndex];
+			cluster.firstLightIndex = SafeCast<UInt32>(m_lightIndices.size());
+
+			UInt32 remainingIndexCount = SafeCast<UInt32>(PredefinedClusteredLightData::MaxLightIndexCount - m_lightIndices.size());
+			if (cluster.lightCount > remainingIndexCount)
+			{
+				m_droppedLightCount += cluster.lightCount - remainingIndexCount;
+				cluster.lightCount = remainingIndexCount;
+			}
+
+			const UInt32* clusterLightIndices = &m_clusterLightIndices[clusterIndex * MaxLightPerCluster];
+			m_lightIndices.insert(m_lightIndices.end(), clusterLightIndices, clusterLightIndices + cluster.lightCount);
+		}
+	}
+
+	void LightClusterGrid::UpdateClusterBoxes(const Matrix4f& invProjectionMatrix)
+	{
+		constexpr std::size_t GridSizeX = PredefinedClusteredLightData::ClusterGridSizeX;
+		constexpr std::size_t GridSizeY = PredefinedClusteredLightData::ClusterGridSizeY;
+		constexpr std::size_t GridSizeZ = PredefinedClusteredLightData::ClusterGridSizeZ;
+
+		m_invProjectionMatrix = invProjectionMatrix;
+
+		auto Unproject = [&](float x, float y, float z)
+		{
+			Vector4f position = invProjectionMatrix.Transform(Vector4f(x, y, z, 1.f));
+			return Vector3f(position.x, position.y, position.z) / position.w;
+		};
+
+		// Rays going through the corners of every cluster column, from the near plane (NDC depth 0) to the far plane (NDC depth 1)
+		struct CornerRay
+		{
+			Vector3f nearPosition;
+			Vector3f farPosition;
+		};
+
+		std::array<CornerRay, (GridSizeX + 1) * (GridSizeY + 1)> cornerRays;
+		for (std::size_t y = 0; y <= GridSizeY; ++y)
+		{
+			float ndcY = -1.f + 2.f * y / GridSizeY;
+			for (std::size_t x = 0; x <= GridSizeX; ++x)
+			{
+				float ndcX = -1.f + 2.f * x / GridSizeX;
+
+				CornerRay& cornerRay = cornerRays[y * (GridSizeX + 1) + x];
+				cornerRay.nearPosition = Unproject(ndcX, ndcY, 0.f);
+				cornerRay.farPosition = Unproject(ndcX, ndcY, 1.f);
+			}
+		}
+
+		m_depthRange.x = Unproject(0.f, 0.f, 0.f).z;
+		m_depthRange.y = Unproject(0.f, 0.f, 1.f).z;
+
+		auto GetSliceDepth = [&](std::size_t sliceIndex)
+		{
+			float sliceFactor = float(sliceIndex) / GridSizeZ;
+			return m_depthRange.x + (m_depthRange.y - m_depthRange.x) * sliceFactor * sliceFactor;
+		};
+
+		m_clusterBoxes.resize(PredefinedClusteredLightData::ClusterCount);
+		for (std::size_t z = 0; z < GridSizeZ; ++z)
+		{
+			std::array<float, 2> sliceDepths = { GetSliceDepth(z), GetSliceDepth(z + 1) };
+
+			for (std::size_t y = 0; y < GridSizeY; ++y)
+			{
+				for (std::size_t x = 0; x < GridSizeX; ++x)
+				{
+					Boxf& clusterBox = m_clusterBoxes[(z * GridSizeY + y) * GridSizeX + x];
+
+					bool first = true;
+					for (std::size_t cornerY = y; cornerY <= y + 1; ++cornerY)
+					{
+						for (std::size_t cornerX = x; cornerX <= x + 1; ++cornerX)
+						{
+							const CornerRay& cornerRay = cornerRays[cornerY * (GridSizeX + 1) + cornerX];
+							for (float depth : sliceDepths)
+							{
+								float factor = (depth - cornerRay.nearPosition.z) / (cornerRay.farPosition.z - cornerRay.nearPosition.z);
+								Vector3f position = cornerRay.nearPosition + (cornerRay.farPosition - cornerRay.nearPosition) * factor;
+
+								if (first)
+								{
+									clusterBox.Set(position, position);
+									first = false;
+								}
+								else
+									clusterBox.ExtendTo(position);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
@@ -36,7 +36,11 @@ namespace Nz
 		options.forceAutoBindingResolve = true;
 		options.partialSanitization = true;
 		options.moduleResolver = graphics->GetShaderModuleResolver();
+		options.optionValues[CRC32("LightClusterCount")] = SafeCast<UInt32>(PredefinedClusteredLightData::ClusterCount);
+		options.optionValues[CRC32("LightClustering")] = renderDevice->GetEnabledFeatures().storageBuffers;
+		options.optionValues[CRC32("MaxClusteredLightCount")] = SafeCast<UInt32>(PredefinedClusteredLightData::MaxLightCount);
 		options.optionValues[CRC32("MaxLightCount")] = SafeCast<UInt32>(PredefinedLightData::MaxLightCount);
+		options.optionValues[CRC32("MaxLightIndexCount")] = SafeCast<UInt32>(PredefinedClusteredLightData::MaxLightIndexCount);
 		options.optionValues[CRC32("MaxJointCount")] = SafeCast<UInt32>(PredefinedSkeletalData::MaxMatricesCount);
 
 		nzsl::Ast::ModulePtr sanitizedModule = nzsl::Ast::Sanitize(*referenceModule, options);
@@ -88,6 +92,9 @@ namespace Nz
 			if (auto it = block->uniformBlocks.find("InstanceData"); it != block->uniformBlocks.end())
 				m_engineShaderBindings[UnderlyingCast(EngineShaderBinding::InstanceDataUbo)] = it->second.bindingIndex;
 
+			if (auto it = block->storageBlocks.find("LightData"); it != block->storageBlocks.end())
+				m_engineShaderBindings[UnderlyingCast(EngineShaderBinding::LightDataSsbo)] = it->second.bindingIndex;
+
 			if (auto it = block->uniformBlocks.find("LightData"); it != block->uniformBlocks.end())
 				m_engineShaderBindings[UnderlyingCast(EngineShaderBinding::LightDataUbo)] = it->second.bindingIndex;
 
@@ -33,6 +33,49 @@ namespace Nz
 		return lightData;
 	}
 
+	// PredefinedClusteredLightData
+	PredefinedClusteredLightData PredefinedClusteredLightData::GetOffsets()
+	{
+		PredefinedClusteredLightData lightData;
+
+		// Light members are filled using PredefinedLightData::Light offsets, which are the same in std140 and std430
+		nzsl::FieldOffsets lightStruct(nzsl::StructLayout::Std430);
+		lightStruct.AddField(nzsl::StructFieldType::Int1);
+		lightStruct.AddField(nzsl::StructFieldType::Float4);
+		lightStruct.AddField(nzsl::StructFieldType::Float2);
+		lightStruct.AddField(nzsl::StructFieldType::Float4);
+		lightStruct.AddField(nzsl::StructFieldType::Float4);
+		lightStruct.AddField(nzsl::StructFieldType::Float4);
+		lightStruct.AddField(nzsl::StructFieldType::Bool1);
+
+		lightData.lightSize = lightStruct.GetAlignedSize();
+
+		// ClusteredLightData is a storage block (std430), array elements aren't rounded to 16 bytes like in uniform blocks
+		auto ComputeArrayStride = [](nzsl::StructFieldType fieldType)
+		{
+			nzsl::FieldOffsets arrayStruct(nzsl::StructLayout::Std430);
+			arrayStruct.AddFieldArray(fieldType, 2);
+
+			return arrayStruct.GetSize() / 2;
+		};
+
+		lightData.clusterSize = ComputeArrayStride(nzsl::StructFieldType::UInt2);
+		lightData.lightIndexSize = ComputeArrayStride(nzsl::StructFieldType::UInt1);
+
+		nzsl::FieldOffsets lightDataStruct(nzsl::StructLayout::Std430);
+		lightData.lightsOffset = lightDataStruct.AddStructArray(lightStruct, MaxLightCount);
+		lightData.lightCountOffset = lightDataStruct.AddField(nzsl::StructFieldType::UInt1);
+		lightData.directionalLightCountOffset = lightDataStruct.AddField(nzsl::StructFieldType::UInt1);
+		lightData.clusterGridSizeOffset = lightDataStruct.AddField(nzsl::StructFieldType::UInt3);
+		lightData.clusterDepthRangeOffset = lightDataStruct.AddField(nzsl::StructFieldType::Float2);
+		lightData.clustersOffset = lightDataStruct.AddFieldArray(nzsl::StructFieldType::UInt2, ClusterCount);
+		lightData.lightIndicesOffset = lightDataStruct.AddFieldArray(nzsl::StructFieldType::UInt1, MaxLightIndexCount);
+
+		lightData.totalSize = lightDataStruct.GetAlignedSize();
+
+		return lightData;
+	}
+
 	// PredefinedInstanceData
 	PredefinedInstanceData PredefinedInstanceData::GetOffsets()
 	{
@@ -173,6 +173,16 @@ namespace Nz
 						};
 					}
 
+					if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::LightDataSsbo); bindingIndex != Material::InvalidBindingIndex && m_pendingData.currentLightData)
+					{
+						auto& bindingEntry = m_bindingCache.emplace_back();
+						bindingEntry.bindingIndex = bindingIndex;
+						bindingEntry.content = ShaderBinding::StorageBufferBinding{
+							m_pendingData.currentLightData.GetBuffer(),
+							m_pendingData.currentLightData.GetOffset(), m_pendingData.currentLightData.GetSize()
+						};
+					}
+
 					if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::LightDataUbo); bindingIndex != Material::InvalidBindingIndex && m_pendingData.currentLightData)
 					{
 						auto& bindingEntry = m_bindingCache.emplace_back();
@@ -140,6 +140,16 @@ namespace Nz
 					};
 				}
 
+				if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::LightDataSsbo); bindingIndex != Material::InvalidBindingIndex && currentLightData)
+				{
+					auto& bindingEntry = m_bindingCache.emplace_back();
+					bindingEntry.bindingIndex = bindingIndex;
+					bindingEntry.content = ShaderBinding::StorageBufferBinding{
+						currentLightData.GetBuffer(),
+						currentLightData.GetOffset(), currentLightData.GetSize()
+					};
+				}
+
 				if (UInt32 bindingIndex = material.GetEngineBindingIndex(EngineShaderBinding::LightDataUbo); bindingIndex != Material::InvalidBindingIndex && currentLightData)
 				{
 					auto& bindingEntry = m_bindingCache.emplace_back();
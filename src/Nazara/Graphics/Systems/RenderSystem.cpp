@@ -33,11 +33,20 @@ namespace Nz
 		m_cameraDestroyConnection = registry.on_destroy<CameraComponent>().connect<&RenderSystem::OnCameraDestroy>(this);
 		m_graphicsDestroyConnection = registry.on_destroy<GraphicsComponent>().connect<&RenderSystem::OnGraphicsDestroy>(this);
 		m_lightDestroyConnection = registry.on_destroy<LightComponent>().connect<&RenderSystem::OnLightDestroy>(this);
+		m_nodeConstructConnection = registry.on_construct<NodeComponent>().connect<&RenderSystem::OnNodeConstruct>(this);
 		m_nodeDestroyConnection = registry.on_destroy<NodeComponent>().connect<&RenderSystem::OnNodeDestroy>(this);
 		m_sharedSkeletonDestroyConnection = registry.on_destroy<SharedSkeletonComponent>().connect<&RenderSystem::OnSharedSkeletonDestroy>(this);
 		m_skeletonDestroyConnection = registry.on_destroy<SkeletonComponent>().connect<&RenderSystem::OnSkeletonDestroy>(this);
 
 		m_pipeline = std::make_unique<ForwardFramePipeline>(m_elementRegistry);
+
+		// World transforms of every node are computed by the transform hierarchy
+		for (entt::entity entity : registry.view<NodeComponent>())
+		{
+			NodeComponent& entityNode = registry.get<NodeComponent>(entity);
+			if (!entityNode.GetHierarchy())
+				entityNode.AttachToHierarchy(m_transformHierarchy);
+		}
 	}
 
 	RenderSystem::~RenderSystem()
@@ -46,12 +55,21 @@ namespace Nz
 		m_graphicsConstructObserver.disconnect();
 		m_lightConstructObserver.disconnect();
 		m_pipeline.reset();
+
+		for (entt::entity entity : m_registry.view<NodeComponent>())
+		{
+			NodeComponent& entityNode = m_registry.get<NodeComponent>(entity);
+			if (entityNode.GetHierarchy() == &m_transformHierarchy)
+				entityNode.DetachFromHierarchy();
+		}
 	}
 
 	void RenderSystem::Update(float /*elapsedTime*/)
 	{
 		UpdateObservers();
 		UpdateVisibility();
+
+		m_transformHierarchy.Update();
 		UpdateInstances();
 
 		for (auto& windowPtr : m_renderWindows)
@@ -148,6 +166,15 @@ namespace Nz
 		m_lightEntityPool.Free(lightEntity->poolIndex);
 	}
 
+	void RenderSystem::OnNodeConstruct(entt::registry& registry, entt::entity entity)
+	{
+		assert(&m_registry == &registry);
+
+		NodeComponent& entityNode = registry.get<NodeComponent>(entity);
+		if (!entityNode.GetHierarchy())
+			entityNode.AttachToHierarchy(m_transformHierarchy);
+	}
+
 	void RenderSystem::OnNodeDestroy(entt::registry& registry, entt::entity entity)
 	{
 		assert(&m_registry == &registry);
@@ -210,18 +237,21 @@ namespace Nz
 
 	void RenderSystem::UpdateInstances()
 	{
+		// World transforms were computed by the transform hierarchy, only invalidated entities (or entities with an invalidated ancestor) need to be updated
 		for (CameraEntity* cameraEntity : m_invalidatedCameraNode)
 		{
 			entt::entity entity = cameraEntity->entity;
 
 			const NodeComponent& entityNode = m_registry.get<const NodeComponent>(entity);
 			CameraComponent& entityCamera = m_registry.get<CameraComponent>(entity);
+			NazaraAssert(entityNode.GetHierarchy() == &m_transformHierarchy, "node is attached to another hierarchy");
+
+			std::size_t nodeIndex = entityNode.GetHierarchyIndex();
+			const Vector3f& cameraPosition = m_transformHierarchy.GetWorldPosition(nodeIndex);
 
-			Vector3f cameraPosition = entityNode.GetPosition(CoordSys::Global);
-			
 			ViewerInstance& viewerInstance = entityCamera.GetViewerInstance();
 			viewerInstance.UpdateEyePosition(cameraPosition);
-			viewerInstance.UpdateViewMatrix(Nz::Matrix4f::TransformInverse(cameraPosition, entityNode.GetRotation(CoordSys::Global)));
+			viewerInstance.UpdateViewMatrix(Nz::Matrix4f::TransformInverse(cameraPosition, m_transformHierarchy.GetWorldRotation(nodeIndex)));
 		}
 		m_invalidatedCameraNode.clear();
 
@@ -231,9 +261,10 @@ namespace Nz
 
 			const NodeComponent& entityNode = m_registry.get<const NodeComponent>(entity);
 			GraphicsComponent& entityGraphics = m_registry.get<GraphicsComponent>(entity);
+			NazaraAssert(entityNode.GetHierarchy() == &m_transformHierarchy, "node is attached to another hierarchy");
 
 			const WorldInstancePtr& worldInstance = entityGraphics.GetWorldInstance();
-			worldInstance->UpdateWorldMatrix(entityNode.GetTransformMatrix());
+			worldInstance->UpdateWorldMatrix(m_transformHierarchy.GetWorldMatrix(entityNode.GetHierarchyIndex()));
 		}
 		m_invalidatedGfxWorldNode.clear();
 
@@ -243,10 +274,12 @@ namespace Nz
 
 			const NodeComponent& entityNode = m_registry.get<const NodeComponent>(entity);
 			LightComponent& entityLight = m_registry.get<LightComponent>(entity);
+			NazaraAssert(entityNode.GetHierarchy() == &m_transformHierarchy, "node is attached to another hierarchy");
 
-			const Vector3f& position = entityNode.GetPosition(CoordSys::Global);
-			const Quaternionf& rotation = entityNode.GetRotation(CoordSys::Global);
-			const Vector3f& scale = entityNode.GetScale(CoordSys::Global);
+			std::size_t nodeIndex = entityNode.GetHierarchyIndex();
+			const Vector3f& position = m_transformHierarchy.GetWorldPosition(nodeIndex);
+			const Quaternionf& rotation = m_transformHierarchy.GetWorldRotation(nodeIndex);
+			const Vector3f& scale = m_transformHierarchy.GetWorldScale(nodeIndex);
 
 			for (const auto& lightEntry : entityLight.GetLights())
 			{
@@ -271,6 +304,7 @@ namespace Nz
 			cameraEntity->poolIndex = poolIndex;
 			cameraEntity->entity = entity;
 			cameraEntity->viewerIndex = m_pipeline->RegisterViewer(&entityCamera, entityCamera.GetRenderOrder());
+
 			cameraEntity->onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, cameraEntity](const Node* /*node*/)
 			{
 				m_invalidatedCameraNode.insert(cameraEntity);
@@ -294,6 +328,7 @@ namespace Nz
 			graphicsEntity->renderableIndices.fill(std::numeric_limits<std::size_t>::max());
 			graphicsEntity->skeletonInstanceIndex = NoInstance; //< will be set in skeleton observer
 			graphicsEntity->worldInstanceIndex = m_pipeline->RegisterWorldInstance(entityGfx.GetWorldInstance());
+
 			graphicsEntity->onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, graphicsEntity](const Node* /*node*/)
 			{
 				m_invalidatedGfxWorldNode.insert(graphicsEntity);
@@ -344,6 +379,7 @@ namespace Nz
 					m_newlyVisibleGfxEntities.erase(graphicsEntity);
 				}
 			});
+
 			m_invalidatedGfxWorldNode.insert(graphicsEntity);
 
 			if (entityGfx.IsVisible())
@@ -362,10 +398,6 @@ namespace Nz
 			LightEntity* lightEntity = m_lightEntityPool.Allocate(poolIndex);
 			lightEntity->entity = entity;
 			lightEntity->poolIndex = poolIndex;
-			lightEntity->onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, lightEntity](const Node* /*node*/)
-			{
-				m_invalidatedLightWorldNode.insert(lightEntity);
-			});
 
 			lightEntity->onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, lightEntity](const Node* /*node*/)
 			{
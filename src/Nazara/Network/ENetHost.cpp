@@ -13,6 +13,7 @@
 */
 
 #include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
@@ -220,6 +221,8 @@ namespace Nz
 
 	int ENetHost::Service(ENetEvent* event, UInt32 timeout)
 	{
+		NazaraProfileZone("ENetHost::Service");
+
 		if (event)
 		{
 			event->type = ENetEventType::None;
@@ -110,10 +110,8 @@ namespace Nz
 		if (!m_buffer)
 			return;
 
-		std::size_t size = m_buffer->GetSize();
-
-		std::lock_guard<std::mutex> lock(s_availableBuffersMutex);
-		s_availableBuffers.emplace_back(std::make_pair(size, std::move(m_buffer)));
+		s_bufferPool.ReturnByteArray(std::move(*m_buffer));
+		m_buffer.reset();
 	}
 
 	/*!
@@ -130,21 +128,9 @@ namespace Nz
 	{
 		NazaraAssert(minCapacity >= cursorPos, "Cannot init stream with a smaller capacity than wanted cursor pos");
 
-		{
-			std::lock_guard<std::mutex> lock(s_availableBuffersMutex);
-
-			FreeStream(); //< In case it wasn't released yet
-
-			if (!s_availableBuffers.empty())
-			{
-				m_buffer = std::move(s_availableBuffers.back().second);
-				s_availableBuffers.pop_back();
-			}
-		}
-
-		if (!m_buffer)
-			m_buffer = std::make_unique<ByteArray>();
+		FreeStream(); //< In case it wasn't released yet
 
+		m_buffer = std::make_unique<ByteArray>(s_bufferPool.GetByteArray(minCapacity));
 		m_buffer->Resize(minCapacity);
 
 		m_memoryStream.SetBuffer(m_buffer.get(), openMode);
@@ -168,9 +154,8 @@ namespace Nz
 
 	void NetPacket::Uninitialize()
 	{
-		s_availableBuffers.clear();
+		s_bufferPool.Clear();
 	}
 
-	std::mutex NetPacket::s_availableBuffersMutex;
-	std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> NetPacket::s_availableBuffers;
+	ByteArrayPool NetPacket::s_bufferPool;
 }
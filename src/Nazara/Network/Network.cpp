@@ -6,6 +6,7 @@
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/MemoryTracker.hpp>
 #include <Nazara/Network/Config.hpp>
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Utils/CallOnExit.hpp>
@@ -33,6 +34,8 @@ namespace Nz
 	Network::Network(Config /*config*/) :
 	ModuleBase("Network", this)
 	{
+		NazaraMemoryScope(MemoryTag::Network, "Network initialization");
+
 		// Initialize module here
 		if (!SocketImpl::Initialize())
 			throw std::runtime_error("failed to initialize socket implementation");
@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
+#include <Nazara/Core/MemoryTracker.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Physics2D/Arbiter2D.hpp>
 #include <Nazara/Utils/StackArray.hpp>
 #include <chipmunk/chipmunk.h>
@@ -83,6 +85,8 @@ namespace Nz
 	m_stepSize(0.005f),
 	m_timestepAccumulator(0.f)
 	{
+		NazaraMemoryScope(MemoryTag::Physics, "PhysWorld2D creation");
+
 		m_handle = cpSpaceNew();
 		cpSpaceSetUserData(m_handle, this);
 	}
@@ -351,6 +355,9 @@ namespace Nz
 
 	void PhysWorld2D::Step(float timestep)
 	{
+		NazaraProfileZone("PhysWorld2D::Step");
+		NazaraMemoryScope(MemoryTag::Physics, "PhysWorld2D::Step");
+
 		m_timestepAccumulator += timestep;
 
 		std::size_t stepCount = std::min(static_cast<std::size_t>(m_timestepAccumulator / m_stepSize), m_maxStepCount);
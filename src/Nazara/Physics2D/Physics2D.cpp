@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Physics2D/Physics2D.hpp>
+#include <Nazara/Core/MemoryTracker.hpp>
 #include <Nazara/Physics2D/Debug.hpp>
 
 namespace Nz
@@ -10,6 +11,7 @@ namespace Nz
 	Physics2D::Physics2D(Config /*config*/) :
 	ModuleBase("Physics2D", this)
 	{
+		NazaraMemoryScope(MemoryTag::Physics, "Physics2D initialization");
 	}
 
 	Physics2D* Physics2D::s_instance = nullptr;
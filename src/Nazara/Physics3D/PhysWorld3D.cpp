@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Core/MemoryTracker.hpp>
 #include <Nazara/Utils/StackVector.hpp>
 #include <newton/Newton.h>
 #include <cassert>
@@ -16,6 +17,8 @@ namespace Nz
 	m_stepSize(1.f / 120.f),
 	m_timestepAccumulator(0.f)
 	{
+		NazaraMemoryScope(MemoryTag::Physics, "PhysWorld3D creation");
+
 		m_world = NewtonCreate();
 		NewtonWorldSetUserData(m_world, this);
 
@@ -161,6 +164,8 @@ namespace Nz
 
 	void PhysWorld3D::Step(float timestep)
 	{
+		NazaraMemoryScope(MemoryTag::Physics, "PhysWorld3D::Step");
+
 		m_timestepAccumulator += timestep;
 
 		std::size_t stepCount = 0;
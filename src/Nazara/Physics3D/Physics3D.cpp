@@ -6,6 +6,7 @@
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/MemoryTracker.hpp>
 #include <Nazara/Physics3D/Collider3D.hpp>
 #include <Nazara/Physics3D/Config.hpp>
 #include <newton/Newton.h>
@@ -16,6 +17,7 @@ namespace Nz
 	Physics3D::Physics3D(Config /*config*/) :
 	ModuleBase("Physics3D", this)
 	{
+		NazaraMemoryScope(MemoryTag::Physics, "Physics3D initialization");
 	}
 
 	unsigned int Physics3D::GetMemoryUsed()
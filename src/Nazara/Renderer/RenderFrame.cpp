@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Renderer/RenderFrame.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Renderer/RenderImage.hpp>
 #include <stdexcept>
 #include <Nazara/Renderer/Debug.hpp>
@@ -32,6 +33,8 @@ namespace Nz
 
 		m_image->Present();
 		m_image = nullptr;
+
+		NazaraProfileFrame();
 	}
 
 	void RenderFrame::SubmitCommandBuffer(CommandBuffer* commandBuffer, QueueTypeFlags queueTypeFlags)
@@ -25,14 +25,24 @@
  * THE SOFTWARE.
  */
 
-#include <Nazara/Math/Angle.hpp>
 #include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Math/Angle.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
 #include <Nazara/Utility/Joint.hpp>
 #include <Nazara/Utility/Mesh.hpp>
 #include <Nazara/Utility/SkeletalMesh.hpp>
 #include <algorithm>
+#include <cmath>
 #include <unordered_map>
+#include <vector>
+
+#if defined(NAZARA_PLATFORM_x64)
+#include <immintrin.h>
+#endif
+
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -629,6 +639,315 @@ namespace Nz
 				float m_valenceBoostScale;
 				float m_valenceBoostPower;
 		};
+
+		// Vertices are split in ranges of this size between TaskScheduler workers, smaller meshes are skinned on the calling thread
+		constexpr UInt32 SkinningGrainSize = 4096;
+
+		struct SkinningAttributes
+		{
+			bool hasPositions;
+			bool hasNormals;
+			bool hasTangents;
+		};
+
+		struct SkinningDualQuaternion
+		{
+			Quaternionf real;
+			Quaternionf dual;
+		};
+
+		SkinningAttributes CheckSkinningData(const SkinningData& skinningInfos)
+		{
+			NazaraAssert(skinningInfos.inputJointIndices, "missing input joint indices");
+			NazaraAssert(skinningInfos.inputJointWeights, "missing input joint weights");
+
+			SkinningAttributes attributes;
+			attributes.hasPositions = skinningInfos.inputPositions && skinningInfos.outputPositions;
+			attributes.hasNormals = skinningInfos.inputNormals && skinningInfos.outputNormals;
+			attributes.hasTangents = skinningInfos.inputTangents && skinningInfos.outputTangents;
+
+			if (skinningInfos.outputPositions || skinningInfos.outputNormals || skinningInfos.outputTangents)
+			{
+				NazaraAssert(skinningInfos.joints, "missing skeleton joints");
+
+				if (skinningInfos.outputPositions)
+					NazaraAssert(skinningInfos.inputPositions, "missing input positions");
+
+				if (skinningInfos.outputNormals)
+					NazaraAssert(skinningInfos.inputNormals, "missing input normals");
+
+				if (skinningInfos.outputTangents)
+					NazaraAssert(skinningInfos.inputTangents, "missing input tangents");
+			}
+
+			return attributes;
+		}
+
+		void CopySkinningUv(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+		{
+			if (skinningInfos.outputUv)
+			{
+				NazaraAssert(skinningInfos.inputUv, "missing input uv");
+
+				for (UInt32 i = startVertex; i < startVertex + vertexCount; ++i)
+					skinningInfos.outputUv[i] = skinningInfos.inputUv[i];
+			}
+		}
+
+		// Joint skinning matrices are lazily computed and can't be queried concurrently, retrieve them once for the whole mesh
+		void RetrieveSkinningMatrices(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount, std::vector<Matrix4f>& skinningMatrices)
+		{
+			Int32 maxJointIndex = -1;
+			for (UInt32 i = startVertex; i < startVertex + vertexCount; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				maxJointIndex = std::max({ maxJointIndex, jointIndices.x, jointIndices.y, jointIndices.z, jointIndices.w });
+			}
+
+			skinningMatrices.resize(std::size_t(maxJointIndex + 1));
+			for (std::size_t i = 0; i < skinningMatrices.size(); ++i)
+				skinningMatrices[i] = skinningInfos.joints[i].GetSkinningMatrix();
+		}
+
+		void StoreSkinnedVertex(const SkinningData& skinningInfos, const SkinningAttributes& attributes, UInt32 vertexIndex, const Vector3f& position, const Vector3f& normal, const Vector3f& tangent)
+		{
+			if (attributes.hasPositions)
+				skinningInfos.outputPositions[vertexIndex] = position;
+
+			if (attributes.hasNormals)
+				skinningInfos.outputNormals[vertexIndex] = normal.GetNormal();
+
+			if (attributes.hasTangents)
+				skinningInfos.outputTangents[vertexIndex] = tangent.GetNormal();
+		}
+
+		// Blends the joint matrices of a vertex first, which is cheaper than transforming each attribute once per joint
+		void SkinLinearBlendScalar(const SkinningData& skinningInfos, const SkinningAttributes& attributes, const Matrix4f* skinningMatrices, UInt32 firstVertex, UInt32 lastVertex)
+		{
+			for (UInt32 i = firstVertex; i < lastVertex; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				const Vector4f& jointWeights = skinningInfos.inputJointWeights[i];
+
+				Matrix4f blendedMatrix = skinningMatrices[jointIndices.x] * jointWeights.x;
+				for (std::size_t j = 1; j < 4; ++j)
+				{
+					const Matrix4f& jointMatrix = skinningMatrices[jointIndices[j]];
+					float weight = jointWeights[j];
+
+					for (std::size_t k = 0; k < 16; ++k)
+						blendedMatrix[k] += jointMatrix[k] * weight;
+				}
+
+				Vector3f position = (attributes.hasPositions) ? blendedMatrix.Transform(skinningInfos.inputPositions[i]) : Vector3f::Zero();
+				Vector3f normal = (attributes.hasNormals) ? blendedMatrix.Transform(skinningInfos.inputNormals[i], 0.f) : Vector3f::Zero();
+				Vector3f tangent = (attributes.hasTangents) ? blendedMatrix.Transform(skinningInfos.inputTangents[i], 0.f) : Vector3f::Zero();
+
+				StoreSkinnedVertex(skinningInfos, attributes, i, position, normal, tangent);
+			}
+		}
+
+#if defined(NAZARA_PLATFORM_x64)
+		// Matrices are stored row by row (m11 m12 m13 m14), a transformed vector being the sum of the rows weighted by its components
+		inline __m128 TransformSSE(__m128 row1, __m128 row2, __m128 row3, __m128 row4, const Vector3f& vec)
+		{
+			__m128 result = _mm_add_ps(_mm_mul_ps(row1, _mm_set1_ps(vec.x)), _mm_mul_ps(row2, _mm_set1_ps(vec.y)));
+			result = _mm_add_ps(result, _mm_mul_ps(row3, _mm_set1_ps(vec.z)));
+
+			return _mm_add_ps(result, row4);
+		}
+
+		// Normalizes the xyz part of a vector, null vectors being left untouched
+		inline __m128 NormalizeSSE(__m128 vec)
+		{
+			__m128 squared = _mm_mul_ps(vec, vec);
+			__m128 squaredLength = _mm_add_ps(squared, _mm_shuffle_ps(squared, squared, _MM_SHUFFLE(1, 1, 1, 1)));
+			squaredLength = _mm_add_ps(squaredLength, _mm_shuffle_ps(squared, squared, _MM_SHUFFLE(2, 2, 2, 2)));
+
+			__m128 length = _mm_sqrt_ps(_mm_shuffle_ps(squaredLength, squaredLength, _MM_SHUFFLE(0, 0, 0, 0)));
+			return _mm_and_ps(_mm_div_ps(vec, length), _mm_cmpgt_ps(length, _mm_setzero_ps()));
+		}
+
+		inline Vector3f ToVector3(__m128 value)
+		{
+			alignas(16) float components[4];
+			_mm_store_ps(components, value);
+
+			return Vector3f(components[0], components[1], components[2]);
+		}
+
+		// One vertex at a time, each register holding a matrix row
+		void SkinLinearBlendSSE(const SkinningData& skinningInfos, const SkinningAttributes& attributes, const Matrix4f* skinningMatrices, UInt32 firstVertex, UInt32 lastVertex)
+		{
+			const __m128 zero = _mm_setzero_ps();
+
+			for (UInt32 i = firstVertex; i < lastVertex; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				const Vector4f& jointWeights = skinningInfos.inputJointWeights[i];
+
+				__m128 rows[4] = { zero, zero, zero, zero };
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					const float* jointMatrix = &skinningMatrices[jointIndices[j]].m11;
+					__m128 weight = _mm_set1_ps(jointWeights[j]);
+
+					for (std::size_t k = 0; k < 4; ++k)
+						rows[k] = _mm_add_ps(rows[k], _mm_mul_ps(_mm_loadu_ps(&jointMatrix[k * 4]), weight));
+				}
+
+				if (attributes.hasPositions)
+					skinningInfos.outputPositions[i] = ToVector3(TransformSSE(rows[0], rows[1], rows[2], rows[3], skinningInfos.inputPositions[i]));
+
+				if (attributes.hasNormals)
+					skinningInfos.outputNormals[i] = ToVector3(NormalizeSSE(TransformSSE(rows[0], rows[1], rows[2], zero, skinningInfos.inputNormals[i])));
+
+				if (attributes.hasTangents)
+					skinningInfos.outputTangents[i] = ToVector3(NormalizeSSE(TransformSSE(rows[0], rows[1], rows[2], zero, skinningInfos.inputTangents[i])));
+			}
+		}
+
+		NAZARA_TARGET_FEATURES("avx")
+		inline __m256 TransformAVX(__m256 row1, __m256 row2, __m256 row3, __m256 row4, const Vector3f& vecA, const Vector3f& vecB)
+		{
+			__m256 result = _mm256_add_ps(_mm256_mul_ps(row1, _mm256_setr_ps(vecA.x, vecA.x, vecA.x, vecA.x, vecB.x, vecB.x, vecB.x, vecB.x)), _mm256_mul_ps(row2, _mm256_setr_ps(vecA.y, vecA.y, vecA.y, vecA.y, vecB.y, vecB.y, vecB.y, vecB.y)));
+			result = _mm256_add_ps(result, _mm256_mul_ps(row3, _mm256_setr_ps(vecA.z, vecA.z, vecA.z, vecA.z, vecB.z, vecB.z, vecB.z, vecB.z)));
+
+			return _mm256_add_ps(result, row4);
+		}
+
+		// Normalizes the xyz part of both vectors, null vectors being left untouched
+		NAZARA_TARGET_FEATURES("avx")
+		inline __m256 NormalizeAVX(__m256 vec)
+		{
+			__m256 length = _mm256_sqrt_ps(_mm256_dp_ps(vec, vec, 0x7F));
+			return _mm256_and_ps(_mm256_div_ps(vec, length), _mm256_cmp_ps(length, _mm256_setzero_ps(), _CMP_GT_OQ));
+		}
+
+		NAZARA_TARGET_FEATURES("avx")
+		inline void StoreAVX(__m256 value, Vector3f& resultA, Vector3f& resultB)
+		{
+			alignas(32) float components[8];
+			_mm256_store_ps(components, value);
+
+			resultA.Set(components[0], components[1], components[2]);
+			resultB.Set(components[4], components[5], components[6]);
+		}
+
+		// Two vertices at a time, each register holding the same matrix row of both vertices
+		NAZARA_TARGET_FEATURES("avx")
+		void SkinLinearBlendAVX(const SkinningData& skinningInfos, const SkinningAttributes& attributes, const Matrix4f* skinningMatrices, UInt32 firstVertex, UInt32 lastVertex)
+		{
+			const __m256 zero = _mm256_setzero_ps();
+
+			UInt32 i = firstVertex;
+			for (; i + 1 < lastVertex; i += 2)
+			{
+				const Vector4i32& jointIndicesA = skinningInfos.inputJointIndices[i];
+				const Vector4i32& jointIndicesB = skinningInfos.inputJointIndices[i + 1];
+				const Vector4f& jointWeightsA = skinningInfos.inputJointWeights[i];
+				const Vector4f& jointWeightsB = skinningInfos.inputJointWeights[i + 1];
+
+				__m256 rows[4] = { zero, zero, zero, zero };
+				for (std::size_t j = 0; j < 4; ++j)
+				{
+					const float* jointMatrixA = &skinningMatrices[jointIndicesA[j]].m11;
+					const float* jointMatrixB = &skinningMatrices[jointIndicesB[j]].m11;
+
+					float weightA = jointWeightsA[j];
+					float weightB = jointWeightsB[j];
+					__m256 weight = _mm256_setr_ps(weightA, weightA, weightA, weightA, weightB, weightB, weightB, weightB);
+
+					for (std::size_t k = 0; k < 4; ++k)
+					{
+						__m256 row = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&jointMatrixA[k * 4])), _mm_loadu_ps(&jointMatrixB[k * 4]), 1);
+						rows[k] = _mm256_add_ps(rows[k], _mm256_mul_ps(row, weight));
+					}
+				}
+
+				if (attributes.hasPositions)
+					StoreAVX(TransformAVX(rows[0], rows[1], rows[2], rows[3], skinningInfos.inputPositions[i], skinningInfos.inputPositions[i + 1]), skinningInfos.outputPositions[i], skinningInfos.outputPositions[i + 1]);
+
+				if (attributes.hasNormals)
+					StoreAVX(NormalizeAVX(TransformAVX(rows[0], rows[1], rows[2], zero, skinningInfos.inputNormals[i], skinningInfos.inputNormals[i + 1])), skinningInfos.outputNormals[i], skinningInfos.outputNormals[i + 1]);
+
+				if (attributes.hasTangents)
+					StoreAVX(NormalizeAVX(TransformAVX(rows[0], rows[1], rows[2], zero, skinningInfos.inputTangents[i], skinningInfos.inputTangents[i + 1])), skinningInfos.outputTangents[i], skinningInfos.outputTangents[i + 1]);
+			}
+
+			if (i < lastVertex)
+				SkinLinearBlendSSE(skinningInfos, attributes, skinningMatrices, i, lastVertex);
+		}
+#endif
+
+		// Skinning matrices are expected to be rigid transformations (rotation and translation), as dual quaternions can't represent scaling
+		SkinningDualQuaternion ToDualQuaternion(const Matrix4f& matrix)
+		{
+			SkinningDualQuaternion dualQuaternion;
+			dualQuaternion.real = matrix.GetRotation();
+			dualQuaternion.real.Normalize();
+
+			// dual = 0.5 * translation * real
+			Vector3f translation = matrix.GetTranslation();
+			const Quaternionf& real = dualQuaternion.real;
+
+			dualQuaternion.dual.w = -0.5f * (translation.x * real.x + translation.y * real.y + translation.z * real.z);
+			dualQuaternion.dual.x = 0.5f * (translation.x * real.w + translation.y * real.z - translation.z * real.y);
+			dualQuaternion.dual.y = 0.5f * (-translation.x * real.z + translation.y * real.w + translation.z * real.x);
+			dualQuaternion.dual.z = 0.5f * (translation.x * real.y - translation.y * real.x + translation.z * real.w);
+
+			return dualQuaternion;
+		}
+
+		void SkinDualQuaternionBlendScalar(const SkinningData& skinningInfos, const SkinningAttributes& attributes, const SkinningDualQuaternion* dualQuaternions, UInt32 firstVertex, UInt32 lastVertex)
+		{
+			for (UInt32 i = firstVertex; i < lastVertex; ++i)
+			{
+				const Vector4i32& jointIndices = skinningInfos.inputJointIndices[i];
+				const Vector4f& jointWeights = skinningInfos.inputJointWeights[i];
+
+				const SkinningDualQuaternion& firstDualQuaternion = dualQuaternions[jointIndices.x];
+
+				Vector4f real = Vector4f(firstDualQuaternion.real.x, firstDualQuaternion.real.y, firstDualQuaternion.real.z, firstDualQuaternion.real.w) * jointWeights.x;
+				Vector4f dual = Vector4f(firstDualQuaternion.dual.x, firstDualQuaternion.dual.y, firstDualQuaternion.dual.z, firstDualQuaternion.dual.w) * jointWeights.x;
+				for (std::size_t j = 1; j < 4; ++j)
+				{
+					const SkinningDualQuaternion& dualQuaternion = dualQuaternions[jointIndices[j]];
+
+					// Blend along the shortest path
+					float weight = jointWeights[j];
+					if (firstDualQuaternion.real.DotProduct(dualQuaternion.real) < 0.f)
+						weight = -weight;
+
+					real += Vector4f(dualQuaternion.real.x, dualQuaternion.real.y, dualQuaternion.real.z, dualQuaternion.real.w) * weight;
+					dual += Vector4f(dualQuaternion.dual.x, dualQuaternion.dual.y, dualQuaternion.dual.z, dualQuaternion.dual.w) * weight;
+				}
+
+				float invLength = 1.f / std::sqrt(real.DotProduct(real));
+				real *= invLength;
+				dual *= invLength;
+
+				Vector3f realVec(real.x, real.y, real.z);
+				Vector3f dualVec(dual.x, dual.y, dual.z);
+
+				auto Rotate = [&](const Vector3f& vec)
+				{
+					return vec + realVec.CrossProduct(realVec.CrossProduct(vec) + vec * real.w) * 2.f;
+				};
+
+				Vector3f position = Vector3f::Zero();
+				if (attributes.hasPositions)
+				{
+					Vector3f translation = (dualVec * real.w - realVec * dual.w + realVec.CrossProduct(dualVec)) * 2.f;
+					position = Rotate(skinningInfos.inputPositions[i]) + translation;
+				}
+
+				Vector3f normal = (attributes.hasNormals) ? Rotate(skinningInfos.inputNormals[i]) : Vector3f::Zero();
+				Vector3f tangent = (attributes.hasTangents) ? Rotate(skinningInfos.inputTangents[i]) : Vector3f::Zero();
+
+				StoreSkinnedVertex(skinningInfos, attributes, i, position, normal, tangent);
+			}
+		}
 	}
 
 	/**********************************Compute**********************************/
@@ -1065,70 +1384,109 @@ namespace Nz
 
 	/************************************Skin***********************************/
 
-	void SkinLinearBlend(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
+	/*!
+	* \brief Applies dual quaternion skinning to a vertex range
+	*
+	* Same as SkinLinearBlend but joint transformations are blended as dual quaternions, which preserves volume around twisted joints (no "candy wrapper" effect) at a higher cost.
+	*
+	* \param skinningInfos Skinning data (input and output attributes, skeleton joints)
+	* \param startVertex First vertex to skin
+	* \param vertexCount Number of vertices to skin
+	*
+	* \remark Joint skinning matrices must be rigid transformations (rotation and translation only), scaling is ignored
+	*
+	* \see SkinLinearBlend
+	*/
+	void SkinDualQuaternionBlend(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount)
 	{
-		NazaraAssert(skinningInfos.inputJointIndices, "missing input joint indices");
-		NazaraAssert(skinningInfos.inputJointWeights, "missing input joint weights");
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-		UInt32 endVertex = startVertex + vertexCount - 1;
-		if (skinningInfos.outputPositions || skinningInfos.outputNormals || skinningInfos.outputTangents)
+		SkinningAttributes attributes = CheckSkinningData(skinningInfos);
+		if (attributes.hasPositions || attributes.hasNormals || attributes.hasTangents)
 		{
-			NazaraAssert(skinningInfos.joints, "missing skeleton joints");
-
-			if (skinningInfos.outputPositions)
-				NazaraAssert(skinningInfos.inputPositions, "missing input positions");
+			std::vector<Matrix4f> skinningMatrices;
+			RetrieveSkinningMatrices(skinningInfos, startVertex, vertexCount, skinningMatrices);
 
-			if (skinningInfos.outputNormals)
-				NazaraAssert(skinningInfos.inputNormals, "missing input positions");
+			std::vector<SkinningDualQuaternion> dualQuaternions(skinningMatrices.size());
+			for (std::size_t i = 0; i < skinningMatrices.size(); ++i)
+				dualQuaternions[i] = ToDualQuaternion(skinningMatrices[i]);
 
-			if (skinningInfos.outputTangents)
-				NazaraAssert(skinningInfos.inputTangents, "missing input positions");
+			ParallelForRange(startVertex, startVertex + vertexCount, [&](std::size_t firstVertex, std::size_t lastVertex)
+			{
+				SkinDualQuaternionBlendScalar(skinningInfos, attributes, dualQuaternions.data(), UInt32(firstVertex), UInt32(lastVertex));
+			}, SkinningGrainSize);
+		}
 
-			bool hasPositions = skinningInfos.inputPositions && skinningInfos.outputPositions;
-			bool hasNormals = skinningInfos.inputNormals && skinningInfos.outputNormals;
-			bool hasTangents = skinningInfos.inputTangents && skinningInfos.outputTangents;
+		CopySkinningUv(skinningInfos, startVertex, vertexCount);
+	}
 
-			for (UInt32 i = startVertex; i <= endVertex; ++i)
-			{
-				Vector3f finalPosition = Vector3f::Zero();
-				Vector3f finalNormal = Vector3f::Zero();
-				Vector3f finalTangent = Vector3f::Zero();
+	/*!
+	* \brief Applies linear blend skinning to a vertex range
+	*
+	* Joint matrices are blended per vertex before transforming its position, normal and tangent, using SSE or AVX (two vertices at once) when supported.
+	* Large vertex ranges are split between TaskScheduler workers.
+	*
+	* \param skinningInfos Skinning data (input and output attributes, skeleton joints)
+	* \param startVertex First vertex to skin
+	* \param vertexCount Number of vertices to skin
+	* \param implementation Implementation to use, the fastest one supported by the processor by default (an unsupported implementation triggers an error and falls back to a supported one)
+	*
+	* \remark Joint skinning matrices are retrieved once on the calling thread, joints must not be modified until this function returns
+	*
+	* \see SkinDualQuaternionBlend
+	*/
+	void SkinLinearBlend(const SkinningData& skinningInfos, UInt32 startVertex, UInt32 vertexCount, SkinningImplementation implementation)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
 
-				for (Int32 j = 0; j < 4; ++j)
-				{
-					Int32 jointIndex = skinningInfos.inputJointIndices[i][j];
+		SkinningAttributes attributes = CheckSkinningData(skinningInfos);
+		if (attributes.hasPositions || attributes.hasNormals || attributes.hasTangents)
+		{
+			std::vector<Matrix4f> skinningMatrices;
+			RetrieveSkinningMatrices(skinningInfos, startVertex, vertexCount, skinningMatrices);
 
-					Matrix4f mat = skinningInfos.joints[jointIndex].GetSkinningMatrix();
-					mat *= skinningInfos.inputJointWeights[i][j];
+			using SkinFunction = void(*)(const SkinningData& skinningInfos, const SkinningAttributes& attributes, const Matrix4f* skinningMatrices, UInt32 firstVertex, UInt32 lastVertex);
 
-					// Hopefully the branch predictor will help here
-					if (hasPositions)
-						finalPosition += mat.Transform(skinningInfos.inputPositions[i]);
+			SkinFunction skinFunction = SkinLinearBlendScalar;
 
-					if (hasNormals)
-						finalNormal += mat.Transform(skinningInfos.inputNormals[i], 0.f);
+#if defined(NAZARA_PLATFORM_x64)
+			Core* core = Core::Instance();
+			bool supportsAVX = (core && core->GetHardwareInfo().HasCapability(ProcessorCap::AVX));
 
-					if (hasTangents)
-						finalTangent += mat.Transform(skinningInfos.inputTangents[i], 0.f);
-				}
+			switch (implementation)
+			{
+				case SkinningImplementation::Auto:
+					skinFunction = (supportsAVX) ? SkinLinearBlendAVX : SkinLinearBlendSSE;
+					break;
 
-				if (hasPositions)
-					skinningInfos.outputPositions[i] = finalPosition;
+				case SkinningImplementation::AVX:
+					if (supportsAVX)
+						skinFunction = SkinLinearBlendAVX;
+					else
+					{
+						NazaraError("AVX skinning is not supported by this processor");
+						skinFunction = SkinLinearBlendSSE;
+					}
+					break;
 
-				if (hasNormals)
-					skinningInfos.outputNormals[i] = finalNormal.GetNormal();
+				case SkinningImplementation::Scalar:
+					break;
 
-				if (hasTangents)
-					skinningInfos.outputTangents[i] = finalTangent.GetNormal();
+				case SkinningImplementation::SSE:
+					skinFunction = SkinLinearBlendSSE;
+					break;
 			}
-		}
+#else
+			if (implementation == SkinningImplementation::AVX || implementation == SkinningImplementation::SSE)
+				NazaraError("SIMD skinning is only supported on x64");
+#endif
 
-		if (skinningInfos.outputUv)
-		{
-			NazaraAssert(skinningInfos.inputUv, "missing input uv");
-
-			for (UInt64 i = startVertex; i <= endVertex; ++i)
-				skinningInfos.outputUv[i] = skinningInfos.inputUv[i];
+			ParallelForRange(startVertex, startVertex + vertexCount, [&](std::size_t firstVertex, std::size_t lastVertex)
+			{
+				skinFunction(skinningInfos, attributes, skinningMatrices.data(), UInt32(firstVertex), UInt32(lastVertex));
+			}, SkinningGrainSize);
 		}
+
+		CopySkinningUv(skinningInfos, startVertex, vertexCount);
 	}
 }
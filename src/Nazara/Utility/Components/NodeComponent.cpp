@@ -10,6 +10,103 @@
 
 namespace Nz
 {
+	/*!
+	* \ingroup utility
+	* \class Nz::NodeComponent
+	* \brief Utility component giving a transform to an entity
+	*
+	* A NodeComponent is a Node (so it can be parented to widgets or skeleton joints and used as their parent) which can also be attached to a TransformHierarchy.
+	* Once attached, changes made to the node are forwarded to its hierarchy node, letting systems (such as the RenderSystem) update all world transforms in a single pass instead of querying each node.
+	* Only the node whose local state changed is forwarded, its descendants being updated by the hierarchy itself.
+	*
+	* Parent nodes which aren't attached to the same hierarchy are unknown to it, in this case the hierarchy node follows the node global transform (read on the next hierarchy update).
+	*/
+
+	NodeComponent::NodeComponent(const NodeComponent& node) :
+	Node(node),
+	m_hierarchy(nullptr),
+	m_hierarchyIndex(TransformHierarchy::InvalidNodeIndex),
+	m_isInvalidating(false)
+	{
+	}
+
+	NodeComponent::NodeComponent(NodeComponent&& node) noexcept :
+	Node(std::move(node)),
+	m_hierarchy(node.m_hierarchy),
+	m_hierarchyIndex(node.m_hierarchyIndex),
+	m_isInvalidating(false)
+	{
+		node.m_hierarchy = nullptr;
+		node.m_hierarchyIndex = TransformHierarchy::InvalidNodeIndex;
+
+		// The hierarchy node may be following the moved node global transform
+		if (m_hierarchy)
+			UpdateHierarchyNode();
+	}
+
+	NodeComponent::~NodeComponent()
+	{
+		DetachFromHierarchy();
+	}
+
+	/*!
+	* \brief Attaches this node to a transform hierarchy
+	*
+	* \param hierarchy Hierarchy which will hold the node transform
+	*
+	* \remark The node must not be attached to a hierarchy
+	*/
+	void NodeComponent::AttachToHierarchy(TransformHierarchy& hierarchy)
+	{
+		NazaraAssert(!m_hierarchy, "node is already attached to a hierarchy");
+
+		m_hierarchy = &hierarchy;
+		m_hierarchyIndex = hierarchy.CreateNode();
+		UpdateHierarchyNode();
+
+		// Children attached to the same hierarchy were using this node global transform until now
+		for (Node* child : m_childs)
+		{
+			if (child->GetNodeType() != NodeType::Component)
+				continue;
+
+			NodeComponent* childComponent = static_cast<NodeComponent*>(child);
+			if (childComponent->m_hierarchy == m_hierarchy)
+				childComponent->UpdateHierarchyNode();
+		}
+	}
+
+	/*!
+	* \brief Detaches this node from its transform hierarchy, if any
+	*/
+	void NodeComponent::DetachFromHierarchy()
+	{
+		if (!m_hierarchy)
+			return;
+
+		TransformHierarchy* hierarchy = m_hierarchy;
+		hierarchy->DestroyNode(m_hierarchyIndex);
+
+		m_hierarchy = nullptr;
+		m_hierarchyIndex = TransformHierarchy::InvalidNodeIndex;
+
+		// Children attached to the hierarchy now have a parent unknown to it
+		for (Node* child : m_childs)
+		{
+			if (child->GetNodeType() != NodeType::Component)
+				continue;
+
+			NodeComponent* childComponent = static_cast<NodeComponent*>(child);
+			if (childComponent->m_hierarchy == hierarchy)
+				childComponent->UpdateHierarchyNode();
+		}
+	}
+
+	NodeType NodeComponent::GetNodeType() const
+	{
+		return NodeType::Component;
+	}
+
 	void NodeComponent::SetParent(entt::handle entity, bool keepDerived)
 	{
 		NodeComponent* nodeComponent = entity.try_get<NodeComponent>();
@@ -45,4 +142,74 @@ namespace Nz
 		NazaraAssert(skeletonComponent, "entity doesn't have a SkeletonComponent nor a SharedSkeletonComponent");
 		Node::SetParent(skeletonComponent->GetAttachedJoint(jointIndex), keepDerived);
 	}
+
+	NodeComponent& NodeComponent::operator=(const NodeComponent& node)
+	{
+		Node::operator=(node);
+
+		return *this;
+	}
+
+	NodeComponent& NodeComponent::operator=(NodeComponent&& node) noexcept
+	{
+		DetachFromHierarchy();
+
+		Node::operator=(std::move(node));
+
+		m_hierarchy = node.m_hierarchy;
+		m_hierarchyIndex = node.m_hierarchyIndex;
+		node.m_hierarchy = nullptr;
+		node.m_hierarchyIndex = TransformHierarchy::InvalidNodeIndex;
+
+		if (m_hierarchy)
+			UpdateHierarchyNode();
+
+		return *this;
+	}
+
+	const NodeComponent* NodeComponent::GetHierarchyParent() const
+	{
+		if (!m_parent || m_parent->GetNodeType() != NodeType::Component)
+			return nullptr;
+
+		const NodeComponent* parentComponent = static_cast<const NodeComponent*>(m_parent);
+		if (parentComponent->m_hierarchy != m_hierarchy)
+			return nullptr;
+
+		return parentComponent;
+	}
+
+	void NodeComponent::InvalidateNode()
+	{
+		m_isInvalidating = true;
+		Node::InvalidateNode();
+		m_isInvalidating = false;
+
+		if (!m_hierarchy)
+			return;
+
+		// Invalidation coming from a parent known to the hierarchy doesn't change our local state, the hierarchy propagates it by itself
+		if (const NodeComponent* parentComponent = GetHierarchyParent(); parentComponent && parentComponent->m_isInvalidating)
+			return;
+
+		UpdateHierarchyNode();
+	}
+
+	void NodeComponent::UpdateHierarchyNode()
+	{
+		const NodeComponent* parentComponent = GetHierarchyParent();
+		if (parentComponent || !m_parent)
+		{
+			m_hierarchy->SetExternalTransform(m_hierarchyIndex, nullptr);
+			m_hierarchy->SetParent(m_hierarchyIndex, (parentComponent) ? parentComponent->m_hierarchyIndex : TransformHierarchy::InvalidNodeIndex);
+			m_hierarchy->SetInheritance(m_hierarchyIndex, m_inheritPosition, m_inheritRotation, m_inheritScale);
+			m_hierarchy->SetLocalTransform(m_hierarchyIndex, m_initialPosition + m_position, m_initialRotation * m_rotation, m_initialScale * m_scale);
+		}
+		else
+		{
+			// Parent is unknown to the hierarchy, our global transform will be read by the hierarchy on its next update
+			m_hierarchy->SetParent(m_hierarchyIndex, TransformHierarchy::InvalidNodeIndex);
+			m_hierarchy->SetExternalTransform(m_hierarchyIndex, this);
+		}
+	}
 }
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Formats/MD5AnimParser.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Utility/Config.hpp>
@@ -12,25 +13,23 @@
 namespace Nz
 {
 	MD5AnimParser::MD5AnimParser(Stream& stream) :
+	m_currentStream(nullptr),
 	m_stream(stream),
-	m_streamFlags(stream.GetStreamOptions()), //< Saves stream flags
 	m_keepLastLine(false),
 	m_frameIndex(0),
 	m_frameRate(0),
 	m_lineCount(0)
 	{
-		m_stream.EnableTextMode(true);
 	}
 
-	MD5AnimParser::~MD5AnimParser()
-	{
-		// Reset stream flags
-		if ((m_streamFlags & StreamOption::Text) == 0)
-			m_stream.EnableTextMode(false);
-	}
+	MD5AnimParser::~MD5AnimParser() = default;
 
 	bool MD5AnimParser::Check()
 	{
+		BufferedStream bufferedStream(m_stream);
+		bufferedStream.EnableTextMode(true);
+		m_currentStream = &bufferedStream;
+
 		if (Advance(false))
 		{
 			unsigned int version;
@@ -76,6 +75,10 @@ namespace Nz
 
 	bool MD5AnimParser::Parse()
 	{
+		BufferedStream bufferedStream(m_stream);
+		bufferedStream.EnableTextMode(true);
+		m_currentStream = &bufferedStream;
+
 		while (Advance(false))
 		{
 			switch (m_currentLine[0])
@@ -240,7 +243,7 @@ namespace Nz
 		{
 			do
 			{
-				if (m_stream.EndOfStream())
+				if (m_currentStream->EndOfStream())
 				{
 					if (required)
 						Error("Incomplete MD5 file");
@@ -250,7 +253,7 @@ namespace Nz
 
 				m_lineCount++;
 
-				m_currentLine = m_stream.ReadLine();
+				m_currentLine = m_currentStream->ReadLine();
 				if (std::size_t pos = m_currentLine.find("//"); pos != std::string::npos)
 					m_currentLine.resize(pos);
 			}
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Formats/MD5MeshParser.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Utility/Config.hpp>
@@ -13,24 +14,22 @@
 namespace Nz
 {
 	MD5MeshParser::MD5MeshParser(Stream& stream) :
+	m_currentStream(nullptr),
 	m_stream(stream),
-	m_streamFlags(stream.GetStreamOptions()), //< Saves stream flags
 	m_keepLastLine(false),
 	m_lineCount(0),
 	m_meshIndex(0)
 	{
-		m_stream.EnableTextMode(true);
 	}
 
-	MD5MeshParser::~MD5MeshParser()
-	{
-		// Reset stream flags
-		if ((m_streamFlags & StreamOption::Text) == 0)
-			m_stream.EnableTextMode(false);
-	}
+	MD5MeshParser::~MD5MeshParser() = default;
 
 	bool MD5MeshParser::Check()
 	{
+		BufferedStream bufferedStream(m_stream);
+		bufferedStream.EnableTextMode(true);
+		m_currentStream = &bufferedStream;
+
 		if (Advance(false))
 		{
 			unsigned int version;
@@ -66,6 +65,10 @@ namespace Nz
 
 	bool MD5MeshParser::Parse()
 	{
+		BufferedStream bufferedStream(m_stream);
+		bufferedStream.EnableTextMode(true);
+		m_currentStream = &bufferedStream;
+
 		while (Advance(false))
 		{
 			switch (m_currentLine[0])
@@ -172,7 +175,7 @@ namespace Nz
 		{
 			do
 			{
-				if (m_stream.EndOfStream())
+				if (m_currentStream->EndOfStream())
 				{
 					if (required)
 						Error("Incomplete MD5 file");
@@ -182,7 +185,7 @@ namespace Nz
 
 				m_lineCount++;
 
-				m_currentLine = m_stream.ReadLine();
+				m_currentLine = m_currentStream->ReadLine();
 
 				if (std::size_t p = m_currentLine.find("//"); p != m_currentLine.npos)
 				{
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Formats/MTLParser.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utils/CallOnExit.hpp>
@@ -31,18 +32,10 @@ namespace Nz
 
 	bool MTLParser::Parse(Stream& stream)
 	{
-		m_currentStream = &stream;
+		BufferedStream bufferedStream(stream);
+		bufferedStream.EnableTextMode(true);
 
-		// force stream in text mode, reset it at the end
-		CallOnExit resetTextMode([&stream]
-		{
-			stream.EnableTextMode(false);
-		});
-
-		if ((stream.GetStreamOptions() & StreamOption::Text) == 0)
-			stream.EnableTextMode(true);
-		else
-			resetTextMode.Reset();
+		m_currentStream = &bufferedStream;
 
 		m_keepLastLine = false;
 		m_lineCount = 0;
@@ -30,7 +30,7 @@ namespace Nz
 		bool ParseMTL(Mesh& mesh, const std::filesystem::path& filePath, const std::string* materials, const OBJParser::Mesh* meshes, std::size_t meshCount)
 		{
 			File file(filePath);
-			if (!file.Open(OpenMode::ReadOnly | OpenMode::Text))
+			if (!file.Open(OpenMode::ReadOnly | OpenMode::Text | OpenMode::Unbuffered)) //< unbuffered since the parser does its own buffering
 			{
 				NazaraError("Failed to open MTL file (" + file.GetPath().generic_u8string() + ')');
 				return false;
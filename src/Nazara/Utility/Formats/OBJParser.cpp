@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Formats/OBJParser.hpp>
+#include <Nazara/Core/BufferedStream.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utils/CallOnExit.hpp>
@@ -16,22 +17,14 @@ namespace Nz
 {
 	bool OBJParser::Check(Stream& stream)
 	{
-		m_currentStream = &stream;
+		BufferedStream bufferedStream(stream);
+		bufferedStream.EnableTextMode(true);
+
+		m_currentStream = &bufferedStream;
 		m_errorCount = 0;
 		m_keepLastLine = false;
 		m_lineCount = 0;
 
-		// force stream in text mode, reset it at the end
-		CallOnExit resetTextMode([&stream]
-		{
-			stream.EnableTextMode(false);
-		});
-
-		if ((stream.GetStreamOptions() & StreamOption::Text) == 0)
-			stream.EnableTextMode(true);
-		else
-			resetTextMode.Reset();
-
 		unsigned int failureCount = 0;
 		while (Advance(false))
 		{
@@ -87,22 +80,14 @@ namespace Nz
 
 	bool OBJParser::Parse(Nz::Stream& stream, std::size_t reservedVertexCount)
 	{
-		m_currentStream = &stream;
+		BufferedStream bufferedStream(stream);
+		bufferedStream.EnableTextMode(true);
+
+		m_currentStream = &bufferedStream;
 		m_errorCount = 0;
 		m_keepLastLine = false;
 		m_lineCount = 0;
 
-		// force stream in text mode, reset it at the end
-		CallOnExit resetTextMode([&stream]
-		{
-			stream.EnableTextMode(false);
-		});
-
-		if ((stream.GetStreamOptions() & StreamOption::Text) == 0)
-			stream.EnableTextMode(true);
-		else
-			resetTextMode.Reset();
-
 		std::string matName, meshName;
 		matName = meshName = "default";
 		m_meshes.clear();
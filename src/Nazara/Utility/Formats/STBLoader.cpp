@@ -10,6 +10,7 @@
 #include <Nazara/Utils/Endianness.hpp>
 #include <frozen/string.h>
 #include <frozen/unordered_set.h>
+#include <limits>
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #include <Nazara/Utility/Debug.hpp>
@@ -49,16 +50,38 @@ namespace Nz
 		{
 			UInt64 streamPos = stream.GetCursorPos();
 
+			// Decode memory mapped streams in place instead of copying them through the callbacks
+			const stbi_uc* mappedPtr = nullptr;
+			int mappedSize = 0;
+			if (stream.IsMemoryMapped() && stream.GetSize() - streamPos <= static_cast<UInt64>(std::numeric_limits<int>::max()))
+			{
+				mappedPtr = static_cast<const stbi_uc*>(stream.GetMappedPointer()) + streamPos;
+				mappedSize = static_cast<int>(stream.GetSize() - streamPos);
+			}
+
 			int width, height, bpp;
-			if (!stbi_info_from_callbacks(&s_stbiCallbacks, &stream, &width, &height, &bpp))
-				return Err(ResourceLoadingError::Unrecognized);
+			if (mappedPtr)
+			{
+				if (!stbi_info_from_memory(mappedPtr, mappedSize, &width, &height, &bpp))
+					return Err(ResourceLoadingError::Unrecognized);
+			}
+			else
+			{
+				if (!stbi_info_from_callbacks(&s_stbiCallbacks, &stream, &width, &height, &bpp))
+					return Err(ResourceLoadingError::Unrecognized);
 
-			stream.SetCursorPos(streamPos);
+				stream.SetCursorPos(streamPos);
+			}
 
 			// Load everything as RGBA8 and then convert using the Image::Convert method
 			// This is because of a STB bug when loading some JPG images with default settings
 
-			UInt8* ptr = stbi_load_from_callbacks(&s_stbiCallbacks, &stream, &width, &height, &bpp, STBI_rgb_alpha);
+			UInt8* ptr;
+			if (mappedPtr)
+				ptr = stbi_load_from_memory(mappedPtr, mappedSize, &width, &height, &bpp, STBI_rgb_alpha);
+			else
+				ptr = stbi_load_from_callbacks(&s_stbiCallbacks, &stream, &width, &height, &bpp, STBI_rgb_alpha);
+
 			if (!ptr)
 			{
 				NazaraError("Failed to load image: " + std::string(stbi_failure_reason()));
@@ -388,6 +388,17 @@ namespace Nz
 		return static_cast<std::size_t>(m_materialData.size());
 	}
 
+	std::size_t Mesh::GetMemoryUsage() const
+	{
+		NazaraAssert(m_isValid, "Mesh should be created first");
+
+		std::size_t memoryUsage = 0;
+		for (const SubMeshData& data : m_subMeshes)
+			memoryUsage += data.subMesh->GetMemoryUsage();
+
+		return memoryUsage;
+	}
+
 	Skeleton* Mesh::GetSkeleton()
 	{
 		NazaraAssert(m_isValid, "Mesh should be created first");
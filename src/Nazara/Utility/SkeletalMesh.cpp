@@ -31,6 +31,11 @@ namespace Nz
 		return m_indexBuffer;
 	}
 
+	std::size_t SkeletalMesh::GetMemoryUsage() const
+	{
+		return SubMesh::GetMemoryUsage() + SafeCast<std::size_t>(m_vertexBuffer->GetStride() * m_vertexBuffer->GetVertexCount());
+	}
+
 	const std::shared_ptr<VertexBuffer>& SkeletalMesh::GetVertexBuffer() const
 	{
 		return m_vertexBuffer;
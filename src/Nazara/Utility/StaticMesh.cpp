@@ -58,6 +58,11 @@ namespace Nz
 		return m_indexBuffer;
 	}
 
+	std::size_t StaticMesh::GetMemoryUsage() const
+	{
+		return SubMesh::GetMemoryUsage() + SafeCast<std::size_t>(m_vertexBuffer->GetStride() * m_vertexBuffer->GetVertexCount());
+	}
+
 	const std::shared_ptr<VertexBuffer>& StaticMesh::GetVertexBuffer() const
 	{
 		return m_vertexBuffer;
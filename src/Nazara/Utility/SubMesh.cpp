@@ -7,6 +7,7 @@
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/TriangleIterator.hpp>
 #include <Nazara/Utility/VertexMapper.hpp>
+#include <Nazara/Utils/Algorithm.hpp>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -194,6 +195,21 @@ namespace Nz
 		return m_matIndex;
 	}
 
+	/*!
+	* \brief Gets the memory used by the submesh data
+	* \return Size of the index buffer data, in bytes
+	*
+	* \remark Submeshes owning other data (such as vertices) should override this to add its size
+	*/
+	std::size_t SubMesh::GetMemoryUsage() const
+	{
+		const std::shared_ptr<IndexBuffer>& indexBuffer = GetIndexBuffer();
+		if (!indexBuffer)
+			return 0;
+
+		return SafeCast<std::size_t>(indexBuffer->GetStride() * indexBuffer->GetIndexCount());
+	}
+
 	void SubMesh::SetPrimitiveMode(PrimitiveMode mode)
 	{
 		m_primitiveMode = mode;
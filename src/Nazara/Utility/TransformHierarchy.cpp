@@ -0,0 +1,468 @@
+// Copyright (C) 2022 Jérôme "Lynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup utility
+	* \class Nz::TransformHierarchy
+	* \brief Utility class storing a transform hierarchy as flat arrays sorted by depth
+	*
+	* Contrary to Node, world transforms are not lazily computed when queried: nodes are only flagged on change, and Update recomputes every invalidated node (and its descendants) in a single pass over the arrays.
+	* Nodes of a same depth level are independent from each other and large levels are updated in parallel using the TaskScheduler.
+	*
+	* Node indices are stable until the node is destroyed, while the storage is reordered by depth each time the hierarchy structure changes.
+	* World transforms follow the same rules as Node (without initial transforms).
+	*/
+
+	void TransformHierarchy::Clear()
+	{
+		m_worldMatrices.clear();
+		m_localRotations.clear();
+		m_worldRotations.clear();
+		m_localPositions.clear();
+		m_localScales.clear();
+		m_worldPositions.clear();
+		m_worldScales.clear();
+		m_parentSlots.clear();
+		m_slotNodes.clear();
+		m_flags.clear();
+		m_invalidated.clear();
+		m_updated.clear();
+		m_nodeExternalTransforms.clear();
+		m_freeNodeIndices.clear();
+		m_nodeDepths.clear();
+		m_nodeFirstChildren.clear();
+		m_nodeNextSiblings.clear();
+		m_nodeParents.clear();
+		m_nodePreviousSiblings.clear();
+		m_nodeSlots.clear();
+		m_externalTransformNodes.clear();
+		m_levelOffsets.clear();
+		m_nodeCount = 0;
+		m_sortRequired = false;
+	}
+
+	/*!
+	* \brief Creates a new node with an identity local transform
+	* \return Index of the new node
+	*
+	* \param parentIndex Index of the parent node, InvalidNodeIndex for a root node
+	*/
+	std::size_t TransformHierarchy::CreateNode(std::size_t parentIndex)
+	{
+		NazaraAssert(parentIndex == InvalidNodeIndex || IsValid(parentIndex), "invalid parent index");
+
+		std::size_t nodeIndex;
+		if (!m_freeNodeIndices.empty())
+		{
+			nodeIndex = m_freeNodeIndices.back();
+			m_freeNodeIndices.pop_back();
+		}
+		else
+		{
+			nodeIndex = m_nodeSlots.size();
+			m_nodeExternalTransforms.push_back(nullptr);
+			m_nodeDepths.push_back(0);
+			m_nodeFirstChildren.push_back(InvalidNodeIndex);
+			m_nodeNextSiblings.push_back(InvalidNodeIndex);
+			m_nodeParents.push_back(InvalidNodeIndex);
+			m_nodePreviousSiblings.push_back(InvalidNodeIndex);
+			m_nodeSlots.push_back(InvalidNodeIndex);
+		}
+
+		// New nodes are appended and will be moved to their depth level on next update
+		std::size_t slot = m_slotNodes.size();
+
+		m_worldMatrices.push_back(Matrix4f::Identity());
+		m_localRotations.push_back(Quaternionf::Identity());
+		m_worldRotations.push_back(Quaternionf::Identity());
+		m_localPositions.push_back(Vector3f::Zero());
+		m_localScales.push_back(Vector3f::Unit());
+		m_worldPositions.push_back(Vector3f::Zero());
+		m_worldScales.push_back(Vector3f::Unit());
+		m_parentSlots.push_back(InvalidNodeIndex);
+		m_slotNodes.push_back(nodeIndex);
+		m_flags.push_back(AllInheritance);
+		m_invalidated.push_back(1);
+		m_updated.push_back(0);
+
+		m_nodeDepths[nodeIndex] = (parentIndex != InvalidNodeIndex) ? m_nodeDepths[parentIndex] + 1 : 0;
+		m_nodeParents[nodeIndex] = parentIndex;
+		m_nodeSlots[nodeIndex] = slot;
+		LinkToParent(nodeIndex);
+
+		m_nodeCount++;
+		m_sortRequired = true;
+
+		return nodeIndex;
+	}
+
+	/*!
+	* \brief Destroys a node
+	*
+	* \param nodeIndex Index of the node to destroy
+	*
+	* \remark Children of the node are not destroyed but become root nodes (keeping their local transform)
+	*/
+	void TransformHierarchy::DestroyNode(std::size_t nodeIndex)
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+
+		std::size_t childIndex = m_nodeFirstChildren[nodeIndex];
+		while (childIndex != InvalidNodeIndex)
+		{
+			std::size_t nextChildIndex = m_nodeNextSiblings[childIndex];
+
+			m_nodeNextSiblings[childIndex] = InvalidNodeIndex;
+			m_nodeParents[childIndex] = InvalidNodeIndex;
+			m_nodePreviousSiblings[childIndex] = InvalidNodeIndex;
+			UpdateSubtreeDepth(childIndex, 0);
+			Invalidate(childIndex);
+
+			childIndex = nextChildIndex;
+		}
+
+		m_nodeFirstChildren[nodeIndex] = InvalidNodeIndex;
+		UnlinkFromParent(nodeIndex);
+
+		if (m_nodeExternalTransforms[nodeIndex])
+			SetExternalTransform(nodeIndex, nullptr);
+
+		// Slot will be reclaimed on next update
+		m_slotNodes[m_nodeSlots[nodeIndex]] = InvalidNodeIndex;
+
+		m_nodeDepths[nodeIndex] = InvalidNodeIndex;
+		m_nodeParents[nodeIndex] = InvalidNodeIndex;
+		m_nodeSlots[nodeIndex] = InvalidNodeIndex;
+		m_freeNodeIndices.push_back(nodeIndex);
+
+		m_nodeCount--;
+		m_sortRequired = true;
+	}
+
+	/*!
+	* \brief Makes a root node follow the global transform of a Node
+	*
+	* \param nodeIndex Index of the node
+	* \param node Node whose global transform will be used as the node local transform, nullptr to stop following it
+	*
+	* \remark The Node global transform is read on the next Update, and only if the node was invalidated since the previous one
+	* \remark The node is expected to be a root node
+	*/
+	void TransformHierarchy::SetExternalTransform(std::size_t nodeIndex, const Node* node)
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+
+		const Node*& externalTransform = m_nodeExternalTransforms[nodeIndex];
+		if (externalTransform != node)
+		{
+			if (!externalTransform)
+				m_externalTransformNodes.push_back(nodeIndex);
+			else if (!node)
+			{
+				auto it = std::find(m_externalTransformNodes.begin(), m_externalTransformNodes.end(), nodeIndex);
+				NazaraAssert(it != m_externalTransformNodes.end(), "external transform node not found");
+
+				*it = m_externalTransformNodes.back();
+				m_externalTransformNodes.pop_back();
+			}
+
+			externalTransform = node;
+		}
+
+		Invalidate(nodeIndex);
+	}
+
+	void TransformHierarchy::SetInheritance(std::size_t nodeIndex, bool inheritPosition, bool inheritRotation, bool inheritScale)
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+
+		UInt8 flags = 0;
+		if (inheritPosition)
+			flags |= InheritPosition;
+
+		if (inheritRotation)
+			flags |= InheritRotation;
+
+		if (inheritScale)
+			flags |= InheritScale;
+
+		m_flags[m_nodeSlots[nodeIndex]] = flags;
+
+		Invalidate(nodeIndex);
+	}
+
+	/*!
+	* \brief Changes the parent of a node, keeping its local transform
+	*
+	* \param nodeIndex Index of the node
+	* \param parentIndex Index of the new parent node, InvalidNodeIndex to make it a root node
+	*/
+	void TransformHierarchy::SetParent(std::size_t nodeIndex, std::size_t parentIndex)
+	{
+		NazaraAssert(IsValid(nodeIndex), "invalid node index");
+		NazaraAssert(parentIndex == InvalidNodeIndex || IsValid(parentIndex), "invalid parent index");
+
+		if (m_nodeParents[nodeIndex] == parentIndex)
+			return;
+
+		#if NAZARA_UTILITY_SAFE
+		for (std::size_t ancestorIndex = parentIndex; ancestorIndex != InvalidNodeIndex; ancestorIndex = m_nodeParents[ancestorIndex])
+		{
+			if (ancestorIndex == nodeIndex)
+			{
+				NazaraError("a node cannot be its own ancestor");
+				return;
+			}
+		}
+		#endif
+
+		UnlinkFromParent(nodeIndex);
+		m_nodeParents[nodeIndex] = parentIndex;
+		LinkToParent(nodeIndex);
+
+		UpdateSubtreeDepth(nodeIndex, (parentIndex != InvalidNodeIndex) ? m_nodeDepths[parentIndex] + 1 : 0);
+		m_sortRequired = true;
+
+		Invalidate(nodeIndex);
+	}
+
+	/*!
+	* \brief Recomputes world transforms of invalidated nodes and their descendants
+	*
+	* Depth levels are processed in order, nodes of a level being updated in parallel if there are more than ParallelUpdateGrainSize of them.
+	*
+	* \remark Nodes must not be modified while this function is running
+	*/
+	void TransformHierarchy::Update()
+	{
+		if (m_sortRequired)
+			SortNodes();
+
+		// Node computes its global transform lazily and can't be queried concurrently, resolve external transforms beforehand
+		for (std::size_t nodeIndex : m_externalTransformNodes)
+		{
+			std::size_t slot = m_nodeSlots[nodeIndex];
+			if (!m_invalidated[slot])
+				continue;
+
+			const Node* node = m_nodeExternalTransforms[nodeIndex];
+			m_localPositions[slot] = node->GetPosition(CoordSys::Global);
+			m_localRotations[slot] = node->GetRotation(CoordSys::Global);
+			m_localScales[slot] = node->GetScale(CoordSys::Global);
+		}
+
+		for (std::size_t level = 0; level + 1 < m_levelOffsets.size(); ++level)
+		{
+			ParallelForRange(m_levelOffsets[level], m_levelOffsets[level + 1], [&](std::size_t firstSlot, std::size_t lastSlot)
+			{
+				UpdateSlots(firstSlot, lastSlot);
+			}, ParallelUpdateGrainSize);
+		}
+	}
+
+	void TransformHierarchy::LinkToParent(std::size_t nodeIndex)
+	{
+		std::size_t parentIndex = m_nodeParents[nodeIndex];
+		if (parentIndex == InvalidNodeIndex)
+			return;
+
+		std::size_t nextSiblingIndex = m_nodeFirstChildren[parentIndex];
+		if (nextSiblingIndex != InvalidNodeIndex)
+			m_nodePreviousSiblings[nextSiblingIndex] = nodeIndex;
+
+		m_nodeNextSiblings[nodeIndex] = nextSiblingIndex;
+		m_nodePreviousSiblings[nodeIndex] = InvalidNodeIndex;
+		m_nodeFirstChildren[parentIndex] = nodeIndex;
+	}
+
+	void TransformHierarchy::SortNodes()
+	{
+		std::size_t maxDepth = 0;
+		for (std::size_t nodeIndex : m_slotNodes)
+		{
+			if (nodeIndex != InvalidNodeIndex)
+				maxDepth = std::max(maxDepth, m_nodeDepths[nodeIndex]);
+		}
+
+		// Counting sort by depth, keeping the current order inside a level
+		m_levelOffsets.assign(maxDepth + 2, 0);
+		for (std::size_t nodeIndex : m_slotNodes)
+		{
+			if (nodeIndex != InvalidNodeIndex)
+				m_levelOffsets[m_nodeDepths[nodeIndex] + 1]++;
+		}
+
+		for (std::size_t level = 1; level < m_levelOffsets.size(); ++level)
+			m_levelOffsets[level] += m_levelOffsets[level - 1];
+
+		std::vector<std::size_t> levelSlots(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+		std::vector<std::size_t> newSlots(m_slotNodes.size(), InvalidNodeIndex);
+		for (std::size_t slot = 0; slot < m_slotNodes.size(); ++slot)
+		{
+			std::size_t nodeIndex = m_slotNodes[slot];
+			if (nodeIndex != InvalidNodeIndex)
+				newSlots[slot] = levelSlots[m_nodeDepths[nodeIndex]]++;
+		}
+
+		auto Reorder = [&](auto& values)
+		{
+			std::remove_reference_t<decltype(values)> sortedValues(m_nodeCount);
+			for (std::size_t slot = 0; slot < newSlots.size(); ++slot)
+			{
+				if (newSlots[slot] != InvalidNodeIndex)
+					sortedValues[newSlots[slot]] = std::move(values[slot]);
+			}
+
+			values = std::move(sortedValues);
+		};
+
+		Reorder(m_worldMatrices);
+		Reorder(m_localRotations);
+		Reorder(m_worldRotations);
+		Reorder(m_localPositions);
+		Reorder(m_localScales);
+		Reorder(m_worldPositions);
+		Reorder(m_worldScales);
+		Reorder(m_slotNodes);
+		Reorder(m_flags);
+		Reorder(m_invalidated);
+		Reorder(m_updated);
+
+		m_parentSlots.resize(m_nodeCount);
+		for (std::size_t slot = 0; slot < m_nodeCount; ++slot)
+		{
+			std::size_t nodeIndex = m_slotNodes[slot];
+			m_nodeSlots[nodeIndex] = slot;
+		}
+
+		for (std::size_t slot = 0; slot < m_nodeCount; ++slot)
+		{
+			std::size_t parentIndex = m_nodeParents[m_slotNodes[slot]];
+			m_parentSlots[slot] = (parentIndex != InvalidNodeIndex) ? m_nodeSlots[parentIndex] : InvalidNodeIndex;
+		}
+
+		m_sortRequired = false;
+	}
+
+	void TransformHierarchy::UnlinkFromParent(std::size_t nodeIndex)
+	{
+		std::size_t parentIndex = m_nodeParents[nodeIndex];
+		if (parentIndex == InvalidNodeIndex)
+			return;
+
+		std::size_t previousSiblingIndex = m_nodePreviousSiblings[nodeIndex];
+		std::size_t nextSiblingIndex = m_nodeNextSiblings[nodeIndex];
+
+		if (previousSiblingIndex != InvalidNodeIndex)
+			m_nodeNextSiblings[previousSiblingIndex] = nextSiblingIndex;
+		else
+			m_nodeFirstChildren[parentIndex] = nextSiblingIndex;
+
+		if (nextSiblingIndex != InvalidNodeIndex)
+			m_nodePreviousSiblings[nextSiblingIndex] = previousSiblingIndex;
+
+		m_nodeNextSiblings[nodeIndex] = InvalidNodeIndex;
+		m_nodePreviousSiblings[nodeIndex] = InvalidNodeIndex;
+	}
+
+	void TransformHierarchy::UpdateSlots(std::size_t firstSlot, std::size_t lastSlot)
+	{
+		for (std::size_t slot = firstSlot; slot < lastSlot; ++slot)
+		{
+			std::size_t parentSlot = m_parentSlots[slot];
+
+			// Parents belong to a previous level and were already processed
+			bool update = m_invalidated[slot] || (parentSlot != InvalidNodeIndex && m_updated[parentSlot]);
+			m_invalidated[slot] = 0;
+			m_updated[slot] = update;
+
+			if (!update)
+				continue;
+
+			const Vector3f& localPosition = m_localPositions[slot];
+			const Quaternionf& localRotation = m_localRotations[slot];
+			const Vector3f& localScale = m_localScales[slot];
+
+			Vector3f& worldPosition = m_worldPositions[slot];
+			Quaternionf& worldRotation = m_worldRotations[slot];
+			Vector3f& worldScale = m_worldScales[slot];
+
+			if (parentSlot != InvalidNodeIndex)
+			{
+				UInt8 flags = m_flags[slot];
+
+				const Vector3f& parentPosition = m_worldPositions[parentSlot];
+				const Quaternionf& parentRotation = m_worldRotations[parentSlot];
+				const Vector3f& parentScale = m_worldScales[parentSlot];
+
+				if (flags & InheritPosition)
+					worldPosition = parentRotation * (parentScale * localPosition) + parentPosition;
+				else
+					worldPosition = localPosition;
+
+				if (flags & InheritRotation)
+				{
+					Quaternionf rotation = localRotation;
+					if (flags & InheritScale)
+						rotation = Quaternionf::Mirror(rotation, parentScale);
+
+					worldRotation = parentRotation * rotation;
+					worldRotation.Normalize();
+				}
+				else
+					worldRotation = localRotation;
+
+				worldScale = localScale;
+				if (flags & InheritScale)
+					worldScale *= parentScale;
+			}
+			else
+			{
+				worldPosition = localPosition;
+				worldRotation = localRotation;
+				worldScale = localScale;
+			}
+
+			m_worldMatrices[slot].MakeTransform(worldPosition, worldRotation, worldScale);
+		}
+	}
+
+	void TransformHierarchy::UpdateSubtreeDepth(std::size_t nodeIndex, std::size_t depth)
+	{
+		if (m_nodeDepths[nodeIndex] == depth)
+			return;
+
+		m_nodeDepths[nodeIndex] = depth;
+
+		// Depth-first walk of the subtree using child and sibling links
+		std::size_t descendantIndex = m_nodeFirstChildren[nodeIndex];
+		while (descendantIndex != InvalidNodeIndex)
+		{
+			m_nodeDepths[descendantIndex] = m_nodeDepths[m_nodeParents[descendantIndex]] + 1;
+
+			if (m_nodeFirstChildren[descendantIndex] != InvalidNodeIndex)
+			{
+				descendantIndex = m_nodeFirstChildren[descendantIndex];
+				continue;
+			}
+
+			while (descendantIndex != nodeIndex && m_nodeNextSiblings[descendantIndex] == InvalidNodeIndex)
+				descendantIndex = m_nodeParents[descendantIndex];
+
+			if (descendantIndex == nodeIndex)
+				break;
+
+			descendantIndex = m_nodeNextSiblings[descendantIndex];
+		}
+	}
+}
@@ -5,6 +5,7 @@
 #include <Nazara/Utility/Utility.hpp>
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryTracker.hpp>
 #include <Nazara/Utility/Animation.hpp>
 #include <Nazara/Utility/Buffer.hpp>
 #include <Nazara/Utility/Config.hpp>
@@ -40,6 +41,8 @@ namespace Nz
 	Utility::Utility(Config /*config*/) :
 	ModuleBase("Utility", this)
 	{
+		NazaraMemoryScope(MemoryTag::Utility, "Utility initialization");
+
 		if (!Font::Initialize())
 			throw std::runtime_error("failed to initialize fonts");
 
@@ -0,0 +1,74 @@
+#include <Nazara/Core.hpp>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string_view>
+
+namespace
+{
+	void PrintUsage(const char* executable)
+	{
+		std::cout << "Usage: " << executable << " <output archive> <input directory> [--lz4] [--align <bytes>]\n";
+		std::cout << "  --lz4            Compress files using LZ4 (files which don't benefit from it are stored uncompressed)\n";
+		std::cout << "  --align <bytes>  Alignment of file contents in the archive (power of two, default: " << Nz::PackedArchiveBuilder::DefaultDataAlignment << ")\n";
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Nz::Modules<Nz::Core> nazara;
+
+	std::filesystem::path outputPath = Nz::Utf8Path(argv[1]);
+	std::filesystem::path inputPath = Nz::Utf8Path(argv[2]);
+
+	Nz::PackedArchiveCompression compression = Nz::PackedArchiveCompression::None;
+	std::size_t dataAlignment = Nz::PackedArchiveBuilder::DefaultDataAlignment;
+	for (int i = 3; i < argc; ++i)
+	{
+		std::string_view arg = argv[i];
+		if (arg == "--lz4")
+			compression = Nz::PackedArchiveCompression::LZ4;
+		else if (arg == "--align" && i + 1 < argc)
+		{
+			std::string_view value = argv[++i];
+			auto result = std::from_chars(value.data(), value.data() + value.size(), dataAlignment);
+			if (result.ec != std::errc{} || dataAlignment == 0 || (dataAlignment & (dataAlignment - 1)) != 0)
+			{
+				std::cerr << "invalid alignment " << value << " (must be a power of two)" << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		else
+		{
+			std::cerr << "unknown option " << arg << std::endl;
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (!std::filesystem::is_directory(inputPath))
+	{
+		std::cerr << Nz::PathToString(inputPath) << " is not a directory" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Nz::PackedArchiveBuilder builder;
+	if (!builder.AddDirectory({}, inputPath, compression))
+		return EXIT_FAILURE;
+
+	auto startTime = std::chrono::steady_clock::now();
+	if (!builder.Save(outputPath, dataAlignment))
+		return EXIT_FAILURE;
+
+	auto elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+	std::cout << "Packed " << builder.GetFileCount() << " file(s) into " << Nz::PathToString(outputPath) << " (" << std::filesystem::file_size(outputPath) << " bytes) in " << elapsedTime.count() << "ms" << std::endl;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#ifndef NAZARA_BENCHMARKS_BENCHMARK_HPP
+#define NAZARA_BENCHMARKS_BENCHMARK_HPP
+
+#include <Nazara/Core/Algorithm.hpp>
+#include <nanobench.h>
+#include <vector>
+
+using BenchmarkFunction = void(*)(ankerl::nanobench::Bench& bench);
+
+struct BenchmarkEntry
+{
+	const char* name;
+	BenchmarkFunction function;
+};
+
+std::vector<BenchmarkEntry>& GetBenchmarks();
+
+struct BenchmarkRegistrar
+{
+	BenchmarkRegistrar(const char* name, BenchmarkFunction function)
+	{
+		GetBenchmarks().push_back({ name, function });
+	}
+};
+
+// Defines a group of benchmarks, the body receives an ankerl::nanobench::Bench& named bench and may throw to report a failure
+#define NAZARA_BENCHMARK(name) \
+	static void NazaraConcatMacro(NazaraBenchmark, __LINE__)(ankerl::nanobench::Bench& bench); \
+	static BenchmarkRegistrar NazaraConcatMacro(nazaraBenchmarkRegistrar, __LINE__)(name, &NazaraConcatMacro(NazaraBenchmark, __LINE__)); \
+	static void NazaraConcatMacro(NazaraBenchmark, __LINE__)(ankerl::nanobench::Bench& bench)
+
+#endif // NAZARA_BENCHMARKS_BENCHMARK_HPP
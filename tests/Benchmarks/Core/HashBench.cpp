@@ -0,0 +1,31 @@
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <random>
+#include <vector>
+
+NAZARA_BENCHMARK("Core/Hash")
+{
+	constexpr std::size_t dataSize = 64 * 1024;
+
+	std::mt19937 randomGenerator(42);
+	std::uniform_int_distribution<unsigned int> dis(0, 255);
+
+	std::vector<Nz::UInt8> data(dataSize);
+	for (Nz::UInt8& byte : data)
+		byte = static_cast<Nz::UInt8>(dis(randomGenerator));
+
+	bench.batch(dataSize).unit("byte");
+
+	for (Nz::HashType hashType : { Nz::HashType::CRC32, Nz::HashType::CRC64, Nz::HashType::Fletcher16, Nz::HashType::MD5, Nz::HashType::SHA1, Nz::HashType::SHA256, Nz::HashType::SHA512, Nz::HashType::Whirlpool, Nz::HashType::XXH3, Nz::HashType::XXH128 })
+	{
+		std::unique_ptr<Nz::AbstractHash> hash = Nz::AbstractHash::Get(hashType);
+
+		bench.run(hash->GetHashName(), [&]
+		{
+			hash->Begin();
+			hash->Append(data.data(), data.size());
+			ankerl::nanobench::doNotOptimizeAway(hash->End());
+		});
+	}
+}
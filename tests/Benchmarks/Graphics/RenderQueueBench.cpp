@@ -0,0 +1,72 @@
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Stand-in for a render element, only what's needed to compute a sorting score
+	struct FakeRenderElement
+	{
+		Nz::UInt64 pipelineIndex;
+		Nz::UInt64 materialIndex;
+		Nz::Vector3f position;
+	};
+}
+
+// Builds and sorts a render queue the way ForwardPipelinePass does, without requiring a render device
+NAZARA_BENCHMARK("Graphics/RenderQueue")
+{
+	constexpr std::size_t elementCount = 10'000;
+
+	std::mt19937 randomGenerator(42);
+	std::uniform_int_distribution<Nz::UInt64> pipelineDis(0, 15);
+	std::uniform_int_distribution<Nz::UInt64> materialDis(0, 255);
+	std::uniform_real_distribution<float> positionDis(-100.f, 100.f);
+
+	std::vector<FakeRenderElement> elements(elementCount);
+	for (FakeRenderElement& element : elements)
+	{
+		element.pipelineIndex = pipelineDis(randomGenerator);
+		element.materialIndex = materialDis(randomGenerator);
+		element.position = Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator));
+	}
+
+	Nz::Frustumf frustum = Nz::Frustumf::Extract(Nz::Matrix4f::Perspective(Nz::DegreeAnglef(70.f), 16.f / 9.f, 0.1f, 1000.f));
+	const Nz::Planef& nearPlane = frustum.GetPlane(Nz::FrustumPlane::Near);
+
+	auto ComputeScore = [&](const FakeRenderElement* element)
+	{
+		// Pipeline, material then depth, similar to RenderSubmesh::ComputeSortingScore
+		float distance = nearPlane.Distance(element->position);
+		Nz::UInt64 depth = static_cast<Nz::UInt64>(std::max(distance, 0.f)) & 0xFFFF;
+
+		return (element->pipelineIndex << 48) | (element->materialIndex << 16) | depth;
+	};
+
+	Nz::RenderQueue<const FakeRenderElement*> renderQueue;
+
+	bench.batch(elementCount).unit("element");
+
+	bench.run("Insert", [&]
+	{
+		renderQueue.Clear();
+		for (const FakeRenderElement& element : elements)
+			renderQueue.Insert(&element);
+
+		ankerl::nanobench::doNotOptimizeAway(renderQueue.size());
+	});
+
+	bench.run("Insert + Sort", [&]
+	{
+		renderQueue.Clear();
+		for (const FakeRenderElement& element : elements)
+			renderQueue.Insert(&element);
+
+		renderQueue.Sort(ComputeScore);
+		ankerl::nanobench::doNotOptimizeAway(renderQueue.begin());
+	});
+}
@@ -0,0 +1,264 @@
+#include <Nazara/Math/Angle.hpp>
+#include <Nazara/Math/BatchOperations.hpp>
+#include <Nazara/Math/BoundingVolume.hpp>
+#include <Nazara/Math/BoundingVolumeHierarchy.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	std::vector<Nz::Boxf> GenerateBoxes(std::size_t count)
+	{
+		std::mt19937 randomGenerator(42);
+		std::uniform_real_distribution<float> positionDis(-100.f, 100.f);
+		std::uniform_real_distribution<float> sizeDis(0.1f, 5.f);
+
+		std::vector<Nz::Boxf> boxes(count);
+		for (Nz::Boxf& box : boxes)
+			box = Nz::Boxf(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator), sizeDis(randomGenerator), sizeDis(randomGenerator), sizeDis(randomGenerator));
+
+		return boxes;
+	}
+}
+
+NAZARA_BENCHMARK("Math/Matrix4")
+{
+	Nz::Matrix4f lhs = Nz::Matrix4f::Transform(Nz::Vector3f(1.f, 2.f, 3.f), Nz::EulerAnglesf(10.f, 20.f, 30.f), Nz::Vector3f(2.f));
+	Nz::Matrix4f rhs = Nz::Matrix4f::Perspective(Nz::DegreeAnglef(70.f), 16.f / 9.f, 0.1f, 1000.f);
+	Nz::Vector3f position(5.f, -2.f, 8.f);
+
+	bench.run("Concatenate", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::Matrix4f::Concatenate(lhs, rhs));
+	});
+
+	bench.run("ConcatenateTransform", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::Matrix4f::ConcatenateTransform(lhs, lhs));
+	});
+
+	bench.run("GetInverse", [&]
+	{
+		Nz::Matrix4f inverse;
+		lhs.GetInverse(&inverse);
+		ankerl::nanobench::doNotOptimizeAway(inverse);
+	});
+
+	bench.run("GetInverseTransform", [&]
+	{
+		Nz::Matrix4f inverse;
+		lhs.GetInverseTransform(&inverse);
+		ankerl::nanobench::doNotOptimizeAway(inverse);
+	});
+
+	bench.run("Transform(Vector3)", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(lhs.Transform(position));
+	});
+}
+
+NAZARA_BENCHMARK("Math/Quaternion")
+{
+	Nz::Quaternionf from = Nz::EulerAnglesf(10.f, 20.f, 30.f);
+	Nz::Quaternionf to = Nz::EulerAnglesf(-45.f, 90.f, 5.f);
+	Nz::Vector3f vec(1.f, 2.f, 3.f);
+
+	bench.run("Multiply", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(from * to);
+	});
+
+	bench.run("Rotate(Vector3)", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(from * vec);
+	});
+
+	bench.run("Slerp", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::Quaternionf::Slerp(from, to, 0.3f));
+	});
+
+	bench.run("Normalize", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::Quaternionf::Normalize(to));
+	});
+}
+
+NAZARA_BENCHMARK("Math/BatchOperations")
+{
+	constexpr std::size_t count = 4096;
+
+	std::mt19937 randomGenerator(42);
+	std::uniform_real_distribution<float> dis(-100.f, 100.f);
+
+	Nz::Matrix4f matrix = Nz::Matrix4f::Transform(Nz::Vector3f(1.f, 2.f, 3.f), Nz::EulerAnglesf(10.f, 20.f, 30.f), Nz::Vector3f(2.f));
+
+	std::vector<Nz::Vector3f> positions(count);
+	std::vector<float> x(count), y(count), z(count);
+	std::vector<Nz::Matrix4f> matrices(count);
+	std::vector<Nz::Quaternionf> fromQuats(count);
+	std::vector<Nz::Quaternionf> toQuats(count);
+	std::vector<float> interpolations(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		positions[i].Set(dis(randomGenerator), dis(randomGenerator), dis(randomGenerator));
+		x[i] = positions[i].x;
+		y[i] = positions[i].y;
+		z[i] = positions[i].z;
+
+		matrices[i] = Nz::Matrix4f::Transform(positions[i], Nz::EulerAnglesf(dis(randomGenerator), dis(randomGenerator), 0.f));
+		fromQuats[i] = Nz::EulerAnglesf(dis(randomGenerator), dis(randomGenerator), dis(randomGenerator));
+		toQuats[i] = Nz::EulerAnglesf(dis(randomGenerator), dis(randomGenerator), dis(randomGenerator));
+		interpolations[i] = (dis(randomGenerator) + 100.f) / 200.f;
+	}
+
+	std::vector<Nz::Vector3f> outputPositions(count);
+	std::vector<float> outputX(count), outputY(count), outputZ(count);
+	std::vector<Nz::Matrix4f> outputMatrices(count);
+	std::vector<Nz::Quaternionf> outputQuats(count);
+
+	bench.batch(count).unit("position");
+
+	bench.run("Matrix4::Transform (loop)", [&]
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			outputPositions[i] = matrix.Transform(positions[i]);
+
+		ankerl::nanobench::doNotOptimizeAway(outputPositions.data());
+	});
+
+	bench.run("TransformPositions (AoS)", [&]
+	{
+		Nz::TransformPositions(matrix, Nz::SparsePtr<const Nz::Vector3f>(positions.data()), Nz::SparsePtr<Nz::Vector3f>(outputPositions.data()), count);
+		ankerl::nanobench::doNotOptimizeAway(outputPositions.data());
+	});
+
+	bench.run("TransformPositions (SoA)", [&]
+	{
+		Nz::TransformPositions(matrix, x.data(), y.data(), z.data(), outputX.data(), outputY.data(), outputZ.data(), count);
+		ankerl::nanobench::doNotOptimizeAway(outputX.data());
+	});
+
+	bench.batch(count).unit("matrix");
+
+	bench.run("Matrix4::Concatenate (loop)", [&]
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			outputMatrices[i] = Nz::Matrix4f::Concatenate(matrices[i], matrix);
+
+		ankerl::nanobench::doNotOptimizeAway(outputMatrices.data());
+	});
+
+	bench.run("ConcatenateMatrices", [&]
+	{
+		Nz::ConcatenateMatrices(Nz::SparsePtr<const Nz::Matrix4f>(matrices.data()), Nz::SparsePtr<const Nz::Matrix4f>(&matrix, 0), Nz::SparsePtr<Nz::Matrix4f>(outputMatrices.data()), count);
+		ankerl::nanobench::doNotOptimizeAway(outputMatrices.data());
+	});
+
+	bench.batch(count).unit("quaternion");
+
+	bench.run("Quaternion::Slerp (loop)", [&]
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			outputQuats[i] = Nz::Quaternionf::Slerp(fromQuats[i], toQuats[i], interpolations[i]);
+
+		ankerl::nanobench::doNotOptimizeAway(outputQuats.data());
+	});
+
+	bench.run("SlerpQuaternions", [&]
+	{
+		Nz::SlerpQuaternions(Nz::SparsePtr<const Nz::Quaternionf>(fromQuats.data()), Nz::SparsePtr<const Nz::Quaternionf>(toQuats.data()), Nz::SparsePtr<const float>(interpolations.data()), Nz::SparsePtr<Nz::Quaternionf>(outputQuats.data()), count);
+		ankerl::nanobench::doNotOptimizeAway(outputQuats.data());
+	});
+}
+
+NAZARA_BENCHMARK("Math/Frustum")
+{
+	Nz::Matrix4f viewProjMatrix = Nz::Matrix4f::Concatenate(Nz::Matrix4f::LookAt(Nz::Vector3f::Zero(), Nz::Vector3f::Forward()), Nz::Matrix4f::Perspective(Nz::DegreeAnglef(70.f), 16.f / 9.f, 0.1f, 1000.f));
+	Nz::Frustumf frustum = Nz::Frustumf::Extract(viewProjMatrix);
+
+	constexpr std::size_t boxCount = 10'000;
+	std::vector<Nz::Boxf> boxes = GenerateBoxes(boxCount);
+
+	std::vector<Nz::BoundingVolumef> volumes;
+	volumes.reserve(boxes.size());
+	for (const Nz::Boxf& box : boxes)
+	{
+		Nz::BoundingVolumef& volume = volumes.emplace_back(box);
+		volume.Update(Nz::Matrix4f::Transform(Nz::Vector3f::Zero(), Nz::EulerAnglesf(0.f, 45.f, 0.f)));
+	}
+
+	bench.run("Extract", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::Frustumf::Extract(viewProjMatrix));
+	});
+
+	bench.batch(boxCount).unit("box").run("Contains(Box)", [&]
+	{
+		std::size_t visibleCount = 0;
+		for (const Nz::Boxf& box : boxes)
+			visibleCount += frustum.Contains(box);
+
+		ankerl::nanobench::doNotOptimizeAway(visibleCount);
+	});
+
+	bench.batch(boxCount).unit("volume").run("Contains(BoundingVolume)", [&]
+	{
+		std::size_t visibleCount = 0;
+		for (const Nz::BoundingVolumef& volume : volumes)
+			visibleCount += frustum.Contains(volume);
+
+		ankerl::nanobench::doNotOptimizeAway(visibleCount);
+	});
+}
+
+NAZARA_BENCHMARK("Math/BoundingVolumeHierarchy")
+{
+	Nz::Matrix4f viewProjMatrix = Nz::Matrix4f::Concatenate(Nz::Matrix4f::LookAt(Nz::Vector3f::Zero(), Nz::Vector3f::Forward()), Nz::Matrix4f::Perspective(Nz::DegreeAnglef(70.f), 16.f / 9.f, 0.1f, 50.f));
+	Nz::Frustumf frustum = Nz::Frustumf::Extract(viewProjMatrix);
+
+	constexpr std::size_t boxCount = 10'000;
+	std::vector<Nz::Boxf> boxes = GenerateBoxes(boxCount);
+
+	Nz::BoundingVolumeHierarchyf tree;
+	for (std::size_t i = 0; i < boxes.size(); ++i)
+		tree.Insert(boxes[i], i);
+
+	bench.batch(boxCount).unit("box").run("Insert", [&]
+	{
+		Nz::BoundingVolumeHierarchyf newTree;
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+			newTree.Insert(boxes[i], i);
+
+		ankerl::nanobench::doNotOptimizeAway(newTree.GetHeight());
+	});
+
+	bench.batch(boxCount).unit("box").run("Frustum::Intersect (loop)", [&]
+	{
+		std::size_t visibleCount = 0;
+		for (const Nz::Boxf& box : boxes)
+			visibleCount += (frustum.Intersect(box) != Nz::IntersectionSide::Outside);
+
+		ankerl::nanobench::doNotOptimizeAway(visibleCount);
+	});
+
+	bench.batch(boxCount).unit("box").run("QueryFrustum", [&]
+	{
+		std::size_t visibleCount = 0;
+		tree.QueryFrustum(frustum, [&](std::size_t /*userData*/) { visibleCount++; });
+
+		ankerl::nanobench::doNotOptimizeAway(visibleCount);
+	});
+
+	bench.batch(boxCount).unit("box").run("QuerySphere", [&]
+	{
+		std::size_t overlapCount = 0;
+		tree.QuerySphere(Nz::Spheref(Nz::Vector3f::Zero(), 20.f), [&](std::size_t /*userData*/) { overlapCount++; });
+
+		ankerl::nanobench::doNotOptimizeAway(overlapCount);
+	});
+}
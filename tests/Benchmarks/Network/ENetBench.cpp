@@ -0,0 +1,86 @@
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	bool ServiceUntil(Nz::ENetHost& server, Nz::ENetHost& client, std::size_t& eventCount, std::size_t expectedCount, bool waitForConnection)
+	{
+		for (unsigned int attempt = 0; attempt < 10'000; ++attempt)
+		{
+			Nz::ENetEvent event;
+			while (client.Service(&event, 0) > 0)
+			{
+				if (event.type == Nz::ENetEventType::OutgoingConnect && waitForConnection)
+					eventCount++;
+			}
+
+			while (server.Service(&event, 0) > 0)
+			{
+				if (event.type == Nz::ENetEventType::Receive || (event.type == Nz::ENetEventType::IncomingConnect && waitForConnection))
+					eventCount++;
+			}
+
+			if (eventCount >= expectedCount)
+				return true;
+		}
+
+		return false;
+	}
+}
+
+NAZARA_BENCHMARK("Network/ENet")
+{
+	Nz::ENetHost server;
+	if (!server.Create(Nz::NetProtocol::IPv4, 0, 1, 1))
+	{
+		std::cerr << "failed to create ENet server host, skipping\n";
+		return;
+	}
+
+	Nz::ENetHost client;
+	if (!client.Create(Nz::IpAddress::AnyIpV4, 1, 1))
+	{
+		std::cerr << "failed to create ENet client host, skipping\n";
+		return;
+	}
+
+	Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), server.GetBoundAddress().GetPort());
+	Nz::ENetPeer* peer = client.Connect(serverAddress, 1);
+
+	std::size_t connectionEvents = 0;
+	if (!peer || !ServiceUntil(server, client, connectionEvents, 2, true))
+	{
+		std::cerr << "failed to connect ENet hosts over loopback, skipping\n";
+		return;
+	}
+
+	constexpr std::size_t packetPerBatch = 64;
+
+	for (std::size_t packetSize : { 64, 1024 })
+	{
+		std::vector<Nz::UInt8> payload(packetSize, 0x42);
+
+		bench.batch(packetPerBatch * packetSize).unit("byte");
+
+		// Unreliable packets are subject to ENet packet throttling, only reliable ones give stable results
+		bench.run("Reliable loopback (" + std::to_string(packetSize) + " bytes packets)", [&]
+		{
+			for (std::size_t i = 0; i < packetPerBatch; ++i)
+				peer->Send(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, payload.data(), payload.size()));
+
+			client.Flush();
+
+			// Timing a broken connection would give meaningless results
+			std::size_t receivedCount = 0;
+			if (!ServiceUntil(server, client, receivedCount, packetPerBatch, false))
+				throw std::runtime_error("only " + std::to_string(receivedCount) + " packets out of " + std::to_string(packetPerBatch) + " were received");
+		});
+	}
+}
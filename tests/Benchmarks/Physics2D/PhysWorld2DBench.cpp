@@ -0,0 +1,34 @@
+#include <Nazara/Physics2D/Collider2D.hpp>
+#include <Nazara/Physics2D/PhysWorld2D.hpp>
+#include <Nazara/Physics2D/RigidBody2D.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <string>
+#include <vector>
+
+NAZARA_BENCHMARK("Physics2D/PhysWorld2D")
+{
+	for (std::size_t bodyCount : { 100, 1000 })
+	{
+		Nz::PhysWorld2D world;
+		world.SetGravity(Nz::Vector2f(0.f, -9.81f));
+
+		std::shared_ptr<Nz::Collider2D> ground = std::make_shared<Nz::BoxCollider2D>(Nz::Vector2f(1000.f, 1.f));
+		Nz::RigidBody2D groundBody(&world, 0.f, ground);
+
+		// Stack boxes in columns above the ground so they keep colliding
+		std::shared_ptr<Nz::Collider2D> box = std::make_shared<Nz::BoxCollider2D>(Nz::Vector2f(1.f, 1.f));
+
+		std::vector<Nz::RigidBody2D> bodies;
+		bodies.reserve(bodyCount);
+		for (std::size_t i = 0; i < bodyCount; ++i)
+		{
+			Nz::RigidBody2D& body = bodies.emplace_back(&world, 1.f, box);
+			body.SetPosition(Nz::Vector2f(float(i % 50) * 1.5f - 37.5f, 1.f + float(i / 50) * 1.1f));
+		}
+
+		bench.run("Step (" + std::to_string(bodyCount) + " bodies)", [&]
+		{
+			world.Step(1.f / 60.f);
+		});
+	}
+}
@@ -0,0 +1,32 @@
+#include <Nazara/Utility/Font.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <string_view>
+
+NAZARA_BENCHMARK("Utility/Font")
+{
+	const std::shared_ptr<Nz::Font>& font = Nz::Font::GetDefault();
+
+	constexpr std::u32string_view characters = U"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+
+	bench.batch(characters.size()).unit("glyph");
+
+	bench.run("GetGlyph (generation)", [&]
+	{
+		font->ClearGlyphCache();
+		for (char32_t character : characters)
+			ankerl::nanobench::doNotOptimizeAway(font->GetGlyph(32, Nz::TextStyle_Regular, 0.f, character));
+	});
+
+	bench.run("GetGlyph (generation, outlined)", [&]
+	{
+		font->ClearGlyphCache();
+		for (char32_t character : characters)
+			ankerl::nanobench::doNotOptimizeAway(font->GetGlyph(32, Nz::TextStyle_Regular, 2.f, character));
+	});
+
+	bench.run("GetGlyph (cached)", [&]
+	{
+		for (char32_t character : characters)
+			ankerl::nanobench::doNotOptimizeAway(font->GetGlyph(32, Nz::TextStyle_Regular, 0.f, character));
+	});
+}
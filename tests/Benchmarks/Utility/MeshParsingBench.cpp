@@ -0,0 +1,146 @@
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/Formats/MD5MeshParser.hpp>
+#include <Nazara/Utility/Formats/OBJParser.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <cmath>
+#include <string>
+
+namespace
+{
+	// Generates a (gridSize+1)² vertices grid with positions, normals and texture coordinates
+	std::string GenerateOBJ(unsigned int gridSize)
+	{
+		std::string content;
+		content += "o Grid\n";
+
+		for (unsigned int y = 0; y <= gridSize; ++y)
+		{
+			for (unsigned int x = 0; x <= gridSize; ++x)
+			{
+				float u = float(x) / gridSize;
+				float v = float(y) / gridSize;
+				content += "v " + std::to_string(u * 10.f) + " " + std::to_string(std::sin(u * 6.28f) * std::cos(v * 6.28f)) + " " + std::to_string(v * 10.f) + "\n";
+				content += "vt " + std::to_string(u) + " " + std::to_string(v) + "\n";
+				content += "vn 0.0 1.0 0.0\n";
+			}
+		}
+
+		content += "usemtl Default\n";
+		for (unsigned int y = 0; y < gridSize; ++y)
+		{
+			for (unsigned int x = 0; x < gridSize; ++x)
+			{
+				unsigned int i0 = y * (gridSize + 1) + x + 1; //< OBJ indices start at one
+				unsigned int i1 = i0 + 1;
+				unsigned int i2 = i0 + gridSize + 1;
+				unsigned int i3 = i2 + 1;
+
+				auto Vertex = [](unsigned int index) { std::string str = std::to_string(index); return str + "/" + str + "/" + str; };
+				content += "f " + Vertex(i0) + " " + Vertex(i2) + " " + Vertex(i1) + "\n";
+				content += "f " + Vertex(i1) + " " + Vertex(i2) + " " + Vertex(i3) + "\n";
+			}
+		}
+
+		return content;
+	}
+
+	// Generates a skinned (gridSize+1)² vertices grid bound to a chain of joints, two weights per vertex
+	std::string GenerateMD5Mesh(unsigned int gridSize, unsigned int jointCount)
+	{
+		unsigned int vertexCount = (gridSize + 1) * (gridSize + 1);
+
+		std::string content;
+		content += "MD5Version 10\n";
+		content += "commandline \"\"\n\n";
+		content += "numJoints " + std::to_string(jointCount) + "\n";
+		content += "numMeshes 1\n\n";
+
+		content += "joints {\n";
+		for (unsigned int i = 0; i < jointCount; ++i)
+			content += "\t\"joint" + std::to_string(i) + "\" " + std::to_string(int(i) - 1) + " ( 0.0 0.0 " + std::to_string(float(i)) + " ) ( 0.0 0.0 0.0 )\n";
+		content += "}\n\n";
+
+		content += "mesh {\n";
+		content += "\tshader \"default\"\n\n";
+
+		content += "\tnumverts " + std::to_string(vertexCount) + "\n";
+		for (unsigned int i = 0; i < vertexCount; ++i)
+		{
+			float u = float(i % (gridSize + 1)) / gridSize;
+			float v = float(i / (gridSize + 1)) / gridSize;
+			content += "\tvert " + std::to_string(i) + " ( " + std::to_string(u) + " " + std::to_string(v) + " ) " + std::to_string(i * 2) + " 2\n";
+		}
+
+		content += "\n\tnumtris " + std::to_string(gridSize * gridSize * 2) + "\n";
+		unsigned int triangleIndex = 0;
+		for (unsigned int y = 0; y < gridSize; ++y)
+		{
+			for (unsigned int x = 0; x < gridSize; ++x)
+			{
+				unsigned int i0 = y * (gridSize + 1) + x;
+				unsigned int i1 = i0 + 1;
+				unsigned int i2 = i0 + gridSize + 1;
+				unsigned int i3 = i2 + 1;
+
+				content += "\ttri " + std::to_string(triangleIndex++) + " " + std::to_string(i0) + " " + std::to_string(i2) + " " + std::to_string(i1) + "\n";
+				content += "\ttri " + std::to_string(triangleIndex++) + " " + std::to_string(i1) + " " + std::to_string(i2) + " " + std::to_string(i3) + "\n";
+			}
+		}
+
+		content += "\n\tnumweights " + std::to_string(vertexCount * 2) + "\n";
+		for (unsigned int i = 0; i < vertexCount; ++i)
+		{
+			unsigned int joint = i % jointCount;
+			std::string position = "( " + std::to_string(float(i % (gridSize + 1))) + " 0.0 " + std::to_string(float(i / (gridSize + 1))) + " )";
+			content += "\tweight " + std::to_string(i * 2) + " " + std::to_string(joint) + " 0.75 " + position + "\n";
+			content += "\tweight " + std::to_string(i * 2 + 1) + " " + std::to_string((joint + 1) % jointCount) + " 0.25 " + position + "\n";
+		}
+
+		content += "}\n";
+
+		return content;
+	}
+}
+
+NAZARA_BENCHMARK("Utility/MeshParsing")
+{
+	constexpr unsigned int gridSize = 100;
+	constexpr std::size_t triangleCount = gridSize * gridSize * 2;
+
+	std::string objContent = GenerateOBJ(gridSize);
+	std::string md5Content = GenerateMD5Mesh(gridSize, 32);
+
+	bench.batch(triangleCount).unit("triangle");
+
+	bench.run("OBJParser", [&]
+	{
+		Nz::MemoryView stream(objContent.data(), objContent.size());
+
+		Nz::OBJParser parser;
+		parser.Parse(stream);
+		ankerl::nanobench::doNotOptimizeAway(parser.GetMeshCount());
+	});
+
+	bench.run("MD5MeshParser", [&]
+	{
+		Nz::MemoryView stream(md5Content.data(), md5Content.size());
+
+		Nz::MD5MeshParser parser(stream);
+		parser.Parse();
+		ankerl::nanobench::doNotOptimizeAway(parser.GetMeshCount());
+	});
+
+	Nz::MeshParams meshParams;
+	meshParams.animated = false;
+
+	bench.run("Mesh::LoadFromMemory (OBJ)", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::Mesh::LoadFromMemory(objContent.data(), objContent.size(), meshParams));
+	});
+
+	bench.run("Mesh::LoadFromMemory (MD5)", [&]
+	{
+		ankerl::nanobench::doNotOptimizeAway(Nz::Mesh::LoadFromMemory(md5Content.data(), md5Content.size(), meshParams));
+	});
+}
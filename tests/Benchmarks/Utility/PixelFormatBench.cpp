@@ -0,0 +1,43 @@
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <string>
+#include <vector>
+
+NAZARA_BENCHMARK("Utility/PixelFormat")
+{
+	constexpr std::size_t pixelCount = 512 * 512;
+
+	struct Conversion
+	{
+		Nz::PixelFormat from;
+		Nz::PixelFormat to;
+	};
+
+	constexpr Conversion conversions[] = {
+		{ Nz::PixelFormat::BGRA8, Nz::PixelFormat::RGBA8 },
+		{ Nz::PixelFormat::BGRA8, Nz::PixelFormat::L8 },
+		{ Nz::PixelFormat::BGRA8, Nz::PixelFormat::RGBA4 },
+		{ Nz::PixelFormat::BGRA8, Nz::PixelFormat::RGBA32F },
+		{ Nz::PixelFormat::RGB8, Nz::PixelFormat::BGRA8 },
+		{ Nz::PixelFormat::RGBA8, Nz::PixelFormat::BGRA8 },
+		{ Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGB8 }
+	};
+
+	bench.batch(pixelCount).unit("pixel");
+
+	for (const Conversion& conversion : conversions)
+	{
+		std::vector<Nz::UInt8> source(pixelCount * Nz::PixelFormatInfo::GetBytesPerPixel(conversion.from));
+		for (std::size_t i = 0; i < source.size(); ++i)
+			source[i] = static_cast<Nz::UInt8>(i * 31);
+
+		std::vector<Nz::UInt8> destination(pixelCount * Nz::PixelFormatInfo::GetBytesPerPixel(conversion.to));
+
+		std::string name = Nz::PixelFormatInfo::GetName(conversion.from) + " -> " + Nz::PixelFormatInfo::GetName(conversion.to);
+		bench.run(name, [&]
+		{
+			Nz::PixelFormatInfo::Convert(conversion.from, conversion.to, source.data(), source.data() + source.size(), destination.data());
+			ankerl::nanobench::doNotOptimizeAway(destination.data());
+		});
+	}
+}
@@ -0,0 +1,115 @@
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/Skeleton.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Former SkinLinearBlend implementation (each attribute transformed once per joint), kept as a reference
+	void SkinLinearBlendPerJoint(const Nz::SkinningData& skinningInfos, Nz::UInt32 startVertex, Nz::UInt32 vertexCount)
+	{
+		for (Nz::UInt32 i = startVertex; i < startVertex + vertexCount; ++i)
+		{
+			Nz::Vector3f finalPosition = Nz::Vector3f::Zero();
+			Nz::Vector3f finalNormal = Nz::Vector3f::Zero();
+			Nz::Vector3f finalTangent = Nz::Vector3f::Zero();
+
+			for (Nz::Int32 j = 0; j < 4; ++j)
+			{
+				Nz::Matrix4f mat = skinningInfos.joints[skinningInfos.inputJointIndices[i][j]].GetSkinningMatrix();
+				mat *= skinningInfos.inputJointWeights[i][j];
+
+				finalPosition += mat.Transform(skinningInfos.inputPositions[i]);
+				finalNormal += mat.Transform(skinningInfos.inputNormals[i], 0.f);
+				finalTangent += mat.Transform(skinningInfos.inputTangents[i], 0.f);
+			}
+
+			skinningInfos.outputPositions[i] = finalPosition;
+			skinningInfos.outputNormals[i] = finalNormal.GetNormal();
+			skinningInfos.outputTangents[i] = finalTangent.GetNormal();
+		}
+	}
+}
+
+NAZARA_BENCHMARK("Utility/Skinning")
+{
+	constexpr std::size_t JointCount = 64;
+	constexpr Nz::UInt32 VertexCount = 50'000;
+
+	std::mt19937 randomGenerator(42);
+	std::uniform_real_distribution<float> positionDis(-1.f, 1.f);
+	std::uniform_real_distribution<float> angleDis(-180.f, 180.f);
+	std::uniform_real_distribution<float> weightDis(0.f, 1.f);
+
+	Nz::Skeleton skeleton;
+	skeleton.Create(JointCount);
+
+	Nz::Joint* joints = skeleton.GetJoints();
+	for (std::size_t i = 0; i < JointCount; ++i)
+	{
+		if (i > 0)
+			joints[i].SetParent(joints[i - 1]);
+
+		joints[i].SetInverseBindMatrix(Nz::Matrix4f::Identity());
+		joints[i].SetPosition(Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator)));
+		joints[i].SetRotation(Nz::EulerAnglesf(angleDis(randomGenerator), angleDis(randomGenerator), angleDis(randomGenerator)));
+	}
+
+	std::vector<Nz::Vector3f> inputPositions(VertexCount);
+	std::vector<Nz::Vector3f> inputNormals(VertexCount);
+	std::vector<Nz::Vector3f> inputTangents(VertexCount);
+	std::vector<Nz::Vector4i32> jointIndices(VertexCount);
+	std::vector<Nz::Vector4f> jointWeights(VertexCount);
+	for (Nz::UInt32 i = 0; i < VertexCount; ++i)
+	{
+		inputPositions[i] = Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator));
+		inputNormals[i] = Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator)).GetNormal();
+		inputTangents[i] = Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator)).GetNormal();
+
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			jointIndices[i][j] = std::uniform_int_distribution<Nz::Int32>(0, JointCount - 1)(randomGenerator);
+			jointWeights[i][j] = weightDis(randomGenerator);
+		}
+
+		jointWeights[i] /= jointWeights[i].x + jointWeights[i].y + jointWeights[i].z + jointWeights[i].w;
+	}
+
+	std::vector<Nz::Vector3f> outputPositions(VertexCount);
+	std::vector<Nz::Vector3f> outputNormals(VertexCount);
+	std::vector<Nz::Vector3f> outputTangents(VertexCount);
+
+	Nz::SkinningData skinningData;
+	skinningData.joints = joints;
+	skinningData.inputJointIndices = jointIndices.data();
+	skinningData.inputJointWeights = jointWeights.data();
+	skinningData.inputNormals = inputNormals.data();
+	skinningData.inputPositions = inputPositions.data();
+	skinningData.inputTangents = inputTangents.data();
+	skinningData.outputNormals = outputNormals.data();
+	skinningData.outputPositions = outputPositions.data();
+	skinningData.outputTangents = outputTangents.data();
+
+	bench.batch(VertexCount).unit("vertex");
+
+	bench.run("Per joint transform (former SkinLinearBlend)", [&]
+	{
+		SkinLinearBlendPerJoint(skinningData, 0, VertexCount);
+		ankerl::nanobench::doNotOptimizeAway(outputPositions.back());
+	});
+
+	bench.run("SkinLinearBlend", [&]
+	{
+		Nz::SkinLinearBlend(skinningData, 0, VertexCount);
+		ankerl::nanobench::doNotOptimizeAway(outputPositions.back());
+	});
+
+	bench.run("SkinDualQuaternionBlend", [&]
+	{
+		Nz::SkinDualQuaternionBlend(skinningData, 0, VertexCount);
+		ankerl::nanobench::doNotOptimizeAway(outputPositions.back());
+	});
+}
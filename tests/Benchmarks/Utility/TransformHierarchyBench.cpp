@@ -0,0 +1,87 @@
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Each node parent is randomly picked among the previous nodes, giving a wide tree about ten levels deep
+	std::vector<std::size_t> GenerateParents(std::size_t count)
+	{
+		std::mt19937 randomGenerator(42);
+
+		std::vector<std::size_t> parents(count, Nz::TransformHierarchy::InvalidNodeIndex);
+		for (std::size_t i = 1; i < count; ++i)
+			parents[i] = std::uniform_int_distribution<std::size_t>(0, i - 1)(randomGenerator);
+
+		return parents;
+	}
+}
+
+NAZARA_BENCHMARK("Utility/TransformHierarchy")
+{
+	constexpr std::size_t NodeCount = 10'000;
+
+	std::vector<std::size_t> parents = GenerateParents(NodeCount);
+	Nz::Quaternionf rotation(Nz::EulerAnglesf(0.f, 1.f, 0.f));
+
+	std::vector<std::unique_ptr<Nz::Node>> nodes(NodeCount);
+	for (std::size_t i = 0; i < NodeCount; ++i)
+	{
+		nodes[i] = std::make_unique<Nz::Node>();
+		if (parents[i] != Nz::TransformHierarchy::InvalidNodeIndex)
+			nodes[i]->SetParent(*nodes[parents[i]]);
+
+		nodes[i]->SetPosition(Nz::Vector3f(0.f, 0.f, 1.f));
+	}
+
+	Nz::TransformHierarchy hierarchy;
+	std::vector<std::size_t> nodeIndices(NodeCount);
+	for (std::size_t i = 0; i < NodeCount; ++i)
+	{
+		nodeIndices[i] = hierarchy.CreateNode((parents[i] != Nz::TransformHierarchy::InvalidNodeIndex) ? nodeIndices[parents[i]] : Nz::TransformHierarchy::InvalidNodeIndex);
+		hierarchy.SetLocalPosition(nodeIndices[i], Nz::Vector3f(0.f, 0.f, 1.f));
+	}
+	hierarchy.Update();
+
+	bench.batch(NodeCount).unit("node");
+
+	// Every node is rotated then every world matrix is retrieved, as a scene with animated nodes would do each frame
+	bench.run("Node (rotate all, get matrices)", [&]
+	{
+		for (auto& node : nodes)
+			node->Rotate(rotation);
+
+		for (auto& node : nodes)
+			ankerl::nanobench::doNotOptimizeAway(node->GetTransformMatrix());
+	});
+
+	bench.run("TransformHierarchy (rotate all, update)", [&]
+	{
+		for (std::size_t nodeIndex : nodeIndices)
+			hierarchy.SetLocalRotation(nodeIndex, hierarchy.GetLocalRotation(nodeIndex) * rotation);
+
+		hierarchy.Update();
+		ankerl::nanobench::doNotOptimizeAway(hierarchy.GetWorldMatrix(nodeIndices.back()));
+	});
+
+	// Only the root moves, invalidating the whole tree
+	bench.run("Node (move root, get matrices)", [&]
+	{
+		nodes.front()->Move(Nz::Vector3f(0.f, 0.01f, 0.f));
+
+		for (auto& node : nodes)
+			ankerl::nanobench::doNotOptimizeAway(node->GetTransformMatrix());
+	});
+
+	bench.run("TransformHierarchy (move root, update)", [&]
+	{
+		hierarchy.SetLocalPosition(nodeIndices.front(), hierarchy.GetLocalPosition(nodeIndices.front()) + Nz::Vector3f(0.f, 0.01f, 0.f));
+
+		hierarchy.Update();
+		ankerl::nanobench::doNotOptimizeAway(hierarchy.GetWorldMatrix(nodeIndices.back()));
+	});
+}
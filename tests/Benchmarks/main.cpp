@@ -0,0 +1,98 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <Nazara/Physics2D/Physics2D.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <Benchmarks/Benchmark.hpp>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+
+std::vector<BenchmarkEntry>& GetBenchmarks()
+{
+	static std::vector<BenchmarkEntry> benchmarks;
+	return benchmarks;
+}
+
+int main(int argc, char* argv[])
+{
+	std::filesystem::path jsonPath;
+	std::string_view filter;
+	bool listOnly = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string_view arg = argv[i];
+		if (arg == "--json" && i + 1 < argc)
+			jsonPath = argv[++i];
+		else if (arg == "--filter" && i + 1 < argc)
+			filter = argv[++i];
+		else if (arg == "--list")
+			listOnly = true;
+		else
+		{
+			std::cout << "usage: " << argv[0] << " [--filter <name part>] [--json <output file>] [--list]\n";
+			return (arg == "--help") ? 0 : 1;
+		}
+	}
+
+	// Registration order depends on static initialization order, make it stable
+	auto& benchmarks = GetBenchmarks();
+	std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkEntry& lhs, const BenchmarkEntry& rhs)
+	{
+		return std::strcmp(lhs.name, rhs.name) < 0;
+	});
+
+	if (listOnly)
+	{
+		for (const BenchmarkEntry& entry : benchmarks)
+			std::cout << entry.name << '\n';
+
+		return 0;
+	}
+
+	Nz::Modules<Nz::Network, Nz::Physics2D, Nz::Utility> nazara;
+
+	ankerl::nanobench::Bench bench;
+	bench.warmup(10);
+
+	bool failed = false;
+	for (const BenchmarkEntry& entry : benchmarks)
+	{
+		if (!filter.empty() && std::string_view(entry.name).find(filter) == std::string_view::npos)
+			continue;
+
+		// Reset per-run settings a previous group may have changed
+		bench.title(entry.name).batch(1).unit("op");
+
+		try
+		{
+			entry.function(bench);
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << "benchmark " << entry.name << " failed: " << e.what() << '\n';
+			failed = true;
+		}
+	}
+
+	if (!jsonPath.empty())
+	{
+		std::ofstream file(jsonPath);
+		if (!file)
+		{
+			std::cerr << "failed to open " << jsonPath.generic_u8string() << '\n';
+			return 1;
+		}
+
+		bench.render(ankerl::nanobench::templates::json(), file);
+	}
+
+	return (failed) ? 1 : 0;
+}
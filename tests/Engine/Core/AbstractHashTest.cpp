@@ -1,10 +1,33 @@
 #include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/Hash/CRC32.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 #include <Nazara/Core/ByteArray.hpp>
 
 #include <array>
+#include <string>
+#include <vector>
+
+namespace
+{
+	std::vector<Nz::UInt8> GenerateData(std::size_t size)
+	{
+		std::vector<Nz::UInt8> data(size);
+		for (std::size_t i = 0; i < size; ++i)
+			data[i] = static_cast<Nz::UInt8>(i * 7 + 3);
+
+		return data;
+	}
+
+	std::string ComputeHex(Nz::AbstractHash& hash, const void* data, std::size_t size)
+	{
+		hash.Begin();
+		hash.Append(static_cast<const Nz::UInt8*>(data), size);
+		return hash.End().ToHex();
+	}
+}
 
 SCENARIO("AbstractHash", "[CORE][ABSTRACTHASH]")
 {
@@ -25,4 +48,84 @@ SCENARIO("AbstractHash", "[CORE][ABSTRACTHASH]")
 			}
 		}
 	}
+
+	GIVEN("Known test vectors")
+	{
+		struct TestVector
+		{
+			Nz::HashType type;
+			const char* abcDigest;
+			const char* largeDigest; //< digest of GenerateData(10000)
+		};
+
+		std::array<TestVector, 5> testVectors = { {
+			{ Nz::HashType::CRC32,  "352441c2", "d5e50a16" },
+			{ Nz::HashType::SHA1,   "a9993e364706816aba3e25717850c26c9cd0d89d", "504bab9f255da75e2c3c08dfbc11061a05996bbf" },
+			{ Nz::HashType::SHA224, "23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7", "282b4fc1243f142664495cef63bfacacb0b9c015559330fd32b3e0dd" },
+			{ Nz::HashType::SHA256, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", "6e97d8601cb17906a4819e0fcc8d03150d3e4331353ecaa516c0084cadad54dd" },
+			{ Nz::HashType::XXH3,   "78af5f94892f3950", "fcd0ecba1a48462d" }
+		} };
+
+		std::vector<Nz::UInt8> largeData = GenerateData(10000);
+
+		for (const TestVector& testVector : testVectors)
+		{
+			std::unique_ptr<Nz::AbstractHash> hash = Nz::AbstractHash::Get(testVector.type);
+			REQUIRE(hash);
+
+			WHEN("Hashing data with " + std::string(hash->GetHashName()))
+			{
+				CHECK(ComputeHex(*hash, "abc", 3) == testVector.abcDigest);
+				CHECK(ComputeHex(*hash, largeData.data(), largeData.size()) == testVector.largeDigest);
+
+				// Feeding data in unaligned chunks must give the same result
+				hash->Begin();
+				hash->Append(&largeData[0], 1);
+				hash->Append(&largeData[1], 130);
+				hash->Append(&largeData[131], largeData.size() - 131);
+				CHECK(hash->End().ToHex() == testVector.largeDigest);
+			}
+		}
+
+		WHEN("Hashing data with XXH128")
+		{
+			std::unique_ptr<Nz::AbstractHash> hash = Nz::AbstractHash::Get(Nz::HashType::XXH128);
+			CHECK(hash->GetDigestLength() == 16);
+			CHECK(ComputeHex(*hash, "", 0) == "99aa06d3014798d86001c324468d497f");
+			CHECK(ComputeHex(*hash, "abc", 3) == "06b05ab6733a618578af5f94892f3950");
+			CHECK(ComputeHex(*hash, largeData.data(), largeData.size()) == "614feaaa3ff5ae66fcd0ecba1a48462d");
+		}
+
+		WHEN("Hashing data with CRC32 using the Castagnoli polynomial")
+		{
+			Nz::CRC32Hash hash(Nz::CRC32Hash::CastagnoliPolynomial);
+			CHECK(ComputeHex(hash, "123456789", 9) == "e3069283");
+			CHECK(ComputeHex(hash, largeData.data(), largeData.size()) == "4eb72655");
+		}
+	}
+}
+
+SCENARIO("AbstractHash throughput", "[.benchmark][CORE][ABSTRACTHASH]")
+{
+	std::vector<Nz::UInt8> data = GenerateData(1024 * 1024);
+
+	for (Nz::HashType hashType : { Nz::HashType::CRC32, Nz::HashType::CRC64, Nz::HashType::MD5, Nz::HashType::SHA1, Nz::HashType::SHA256, Nz::HashType::SHA512, Nz::HashType::XXH3, Nz::HashType::XXH128 })
+	{
+		std::unique_ptr<Nz::AbstractHash> hash = Nz::AbstractHash::Get(hashType);
+
+		BENCHMARK(std::string(hash->GetHashName()) + " (1MiB)")
+		{
+			hash->Begin();
+			hash->Append(data.data(), data.size());
+			return hash->End();
+		};
+	}
+
+	Nz::CRC32Hash crc32c(Nz::CRC32Hash::CastagnoliPolynomial);
+	BENCHMARK("CRC32C (1MiB)")
+	{
+		crc32c.Begin();
+		crc32c.Append(data.data(), data.size());
+		return crc32c.End();
+	};
 }
@@ -0,0 +1,106 @@
+#include <Nazara/Core/AsyncLogger.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	class RecordingLogger : public Nz::AbstractLogger
+	{
+		public:
+			void EnableStdReplication(bool /*enable*/) override
+			{
+			}
+
+			bool IsStdReplicationEnabled() const override
+			{
+				return false;
+			}
+
+			void Write(const std::string_view& string) override
+			{
+				messages.emplace_back(string);
+			}
+
+			std::vector<std::string> messages;
+	};
+}
+
+SCENARIO("AsyncLogger", "[CORE][ASYNCLOGGER]")
+{
+	GIVEN("An asynchronous logger")
+	{
+		auto recordingLoggerPtr = std::make_unique<RecordingLogger>();
+		RecordingLogger& recordingLogger = *recordingLoggerPtr;
+
+		Nz::AsyncLogger logger(std::move(recordingLoggerPtr), 16, Nz::LogOverflowPolicy::Block);
+		CHECK(logger.GetCapacity() == 16);
+
+		WHEN("We write messages from multiple threads")
+		{
+			logger.SetRepeatInterval(std::chrono::milliseconds(0));
+
+			std::vector<std::thread> threads;
+			for (unsigned int i = 0; i < 4; ++i)
+			{
+				threads.emplace_back([&, i]
+				{
+					for (unsigned int j = 0; j < 100; ++j)
+						logger.Write("Thread #" + std::to_string(i) + ": " + std::to_string(j));
+				});
+			}
+
+			for (std::thread& thread : threads)
+				thread.join();
+
+			logger.Flush();
+
+			THEN("Every message has been written, in order for each thread")
+			{
+				REQUIRE(recordingLogger.messages.size() == 400);
+				CHECK(logger.GetDroppedMessageCount() == 0);
+
+				std::string firstMessage;
+				for (const std::string& message : recordingLogger.messages)
+				{
+					if (message.rfind("Thread #0: ", 0) == 0)
+					{
+						firstMessage = message;
+						break;
+					}
+				}
+				CHECK(firstMessage == "Thread #0: 0");
+			}
+		}
+
+		WHEN("We write the same message many times")
+		{
+			for (unsigned int i = 0; i < 50; ++i)
+				logger.Write("Repeated");
+
+			logger.Write("Other");
+			logger.Flush();
+
+			THEN("Repetitions are summarized")
+			{
+				REQUIRE(recordingLogger.messages.size() == 3);
+				CHECK(recordingLogger.messages[0] == "Repeated");
+				CHECK(recordingLogger.messages[1] == "Last message repeated 49 times");
+				CHECK(recordingLogger.messages[2] == "Other");
+			}
+		}
+
+		WHEN("We write an error")
+		{
+			logger.WriteError(Nz::ErrorType::Normal, "Something failed");
+
+			THEN("It is written before the call returns")
+			{
+				REQUIRE(recordingLogger.messages.size() == 1);
+				CHECK(recordingLogger.messages[0] == "Error: Something failed");
+			}
+		}
+	}
+}
@@ -0,0 +1,155 @@
+#include <Nazara/Core/BufferedStream.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+
+SCENARIO("BufferedStream", "[CORE][BUFFEREDSTREAM]")
+{
+	GIVEN("A stream containing text lines")
+	{
+		const char content[] = "first line\r\nsecond line\n\nlast line";
+
+		for (std::size_t bufferSize : { 1, 3, 7, 0xFFFF })
+		{
+			Nz::ByteArray byteArray(content, sizeof(content) - 1);
+			Nz::MemoryStream memoryStream(&byteArray, Nz::OpenMode::ReadOnly);
+
+			WHEN("Reading it through a buffer of size " + std::to_string(bufferSize))
+			{
+				{
+					Nz::BufferedStream bufferedStream(memoryStream, bufferSize);
+					bufferedStream.EnableTextMode(true);
+					CHECK(bufferedStream.GetReadBufferSize() == bufferSize);
+					CHECK(bufferedStream.GetSize() == sizeof(content) - 1);
+
+					CHECK(bufferedStream.ReadLine() == "first line");
+					CHECK(bufferedStream.ReadLine() == "second line");
+					CHECK(bufferedStream.GetCursorPos() == 24);
+					CHECK(bufferedStream.ReadLine() == "");
+
+					char buffer[4];
+					REQUIRE(bufferedStream.Read(buffer, 4) == 4);
+					CHECK(std::memcmp(buffer, "last", 4) == 0);
+					CHECK_FALSE(bufferedStream.EndOfStream());
+
+					REQUIRE(bufferedStream.SetCursorPos(6));
+					CHECK(bufferedStream.ReadLine() == "line");
+					CHECK(bufferedStream.GetCursorPos() == 12);
+				}
+
+				THEN("The wrapped stream cursor follows the buffered stream")
+				{
+					CHECK(memoryStream.GetCursorPos() == 12);
+					CHECK_FALSE(memoryStream.IsTextModeEnabled());
+					CHECK(memoryStream.ReadLine() == "second line");
+				}
+			}
+		}
+
+		WHEN("Reading it from a memory mapped stream")
+		{
+			Nz::MemoryView memoryView(content, sizeof(content) - 1);
+
+			Nz::BufferedStream bufferedStream(memoryView);
+			bufferedStream.EnableTextMode(true);
+			CHECK(bufferedStream.GetReadBufferSize() == 0);
+
+			CHECK(bufferedStream.ReadLine() == "first line");
+			CHECK(bufferedStream.ReadLine() == "second line");
+			CHECK(bufferedStream.ReadLine() == "");
+			CHECK(bufferedStream.ReadLine() == "last line");
+			CHECK(bufferedStream.EndOfStream());
+		}
+	}
+
+	GIVEN("A writable stream")
+	{
+		Nz::ByteArray byteArray;
+		Nz::MemoryStream memoryStream(&byteArray, Nz::OpenMode_ReadWrite);
+
+		WHEN("Doing small writes through a buffered stream")
+		{
+			Nz::BufferedStream bufferedStream(memoryStream, 16, 8);
+			CHECK(bufferedStream.GetWriteBufferSize() == 8);
+			CHECK_FALSE(bufferedStream.IsBufferingEnabled()); //< buffering isn't done by the Stream base class
+
+			CHECK(bufferedStream.Write("abc", 3) == 3);
+			CHECK(bufferedStream.Write("def", 3) == 3);
+
+			THEN("They are combined until the buffer is full")
+			{
+				CHECK(byteArray.GetSize() == 0);
+				CHECK(bufferedStream.GetSize() == 6);
+
+				CHECK(bufferedStream.Write("ghi", 3) == 3);
+				CHECK(byteArray.GetSize() == 6);
+
+				CHECK(bufferedStream.FlushWriteBuffer());
+				CHECK(byteArray.GetSize() == 9);
+				CHECK(std::memcmp(byteArray.GetConstBuffer(), "abcdefghi", 9) == 0);
+			}
+
+			AND_THEN("Pending writes are visible to reads")
+			{
+				REQUIRE(bufferedStream.SetCursorPos(1));
+				CHECK(bufferedStream.Write("X", 1) == 1);
+				REQUIRE(bufferedStream.SetCursorPos(0));
+
+				char buffer[6];
+				REQUIRE(bufferedStream.Read(buffer, 6) == 6);
+				CHECK(std::memcmp(buffer, "aXcdef", 6) == 0);
+			}
+
+			AND_THEN("Large writes bypass the buffer")
+			{
+				const char largeContent[] = "0123456789ABCDEF";
+				CHECK(bufferedStream.Write(largeContent, 16) == 16);
+				CHECK(byteArray.GetSize() == 22);
+				CHECK(std::memcmp(byteArray.GetConstBuffer(), "abcdef0123456789ABCDEF", 22) == 0);
+			}
+		}
+	}
+
+	GIVEN("A file")
+	{
+		{
+			Nz::File file("BufferedStreamTest.txt", Nz::OpenMode::WriteOnly | Nz::OpenMode::Truncate | Nz::OpenMode::Unbuffered);
+			REQUIRE(file.IsOpen());
+
+			Nz::BufferedStream bufferedFile(file);
+
+			bool writeSucceeded = true;
+			for (unsigned int i = 0; i < 1000; ++i)
+			{
+				if (!bufferedFile.Write("line #" + std::to_string(i) + "\n"))
+					writeSucceeded = false;
+			}
+
+			REQUIRE(writeSucceeded);
+		}
+
+		WHEN("We read it back line by line")
+		{
+			Nz::File file("BufferedStreamTest.txt", Nz::OpenMode::ReadOnly | Nz::OpenMode::Unbuffered);
+			REQUIRE(file.IsOpen());
+
+			Nz::BufferedStream bufferedFile(file, 100);
+
+			bool linesMatch = true;
+			for (unsigned int i = 0; i < 1000; ++i)
+			{
+				if (bufferedFile.ReadLine() != "line #" + std::to_string(i))
+					linesMatch = false;
+			}
+
+			CHECK(linesMatch);
+			CHECK(bufferedFile.EndOfStream());
+		}
+
+		std::filesystem::remove("BufferedStreamTest.txt");
+	}
+}
@@ -0,0 +1,186 @@
+#include <Nazara/Core/ByteArrayPool.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+SCENARIO("ByteArrayPool", "[CORE][BYTEARRAYPOOL]")
+{
+	GIVEN("An empty pool")
+	{
+		Nz::ByteArrayPool pool;
+
+		CHECK(Nz::ByteArrayPool::GetPooledCapacity(0) == Nz::ByteArrayPool::MinPooledCapacity);
+		CHECK(Nz::ByteArrayPool::GetPooledCapacity(100) == 128);
+		CHECK(Nz::ByteArrayPool::GetPooledCapacity(1024) == 1024);
+		CHECK(Nz::ByteArrayPool::GetPooledCapacity(Nz::ByteArrayPool::MaxPooledCapacity + 1) == Nz::ByteArrayPool::MaxPooledCapacity + 1);
+
+		WHEN("We take a byte array from it")
+		{
+			Nz::ByteArray byteArray = pool.GetByteArray(100);
+
+			THEN("It is allocated with the capacity of its size class")
+			{
+				CHECK(byteArray.IsEmpty());
+				CHECK(byteArray.GetCapacity() >= 128);
+
+				Nz::ByteArrayPool::Stats stats = pool.GetStats();
+				CHECK(stats.hitCount == 0);
+				CHECK(stats.missCount == 1);
+				CHECK(stats.pooledBytes == 0);
+			}
+
+			AND_WHEN("We give it back and take another one of the same size class")
+			{
+				byteArray.Append("Hello", 5);
+				const Nz::UInt8* buffer = byteArray.GetConstBuffer();
+				std::size_t capacity = byteArray.GetCapacity();
+
+				pool.ReturnByteArray(std::move(byteArray));
+				CHECK(pool.GetStats().pooledBytes == capacity);
+				CHECK(pool.GetStats().peakPooledBytes == capacity);
+
+				Nz::ByteArray recycled = pool.GetByteArray(120);
+
+				THEN("The same buffer is reused")
+				{
+					CHECK(recycled.IsEmpty());
+					CHECK(recycled.GetConstBuffer() == buffer);
+
+					Nz::ByteArrayPool::Stats stats = pool.GetStats();
+					CHECK(stats.hitCount == 1);
+					CHECK(stats.missCount == 1);
+					CHECK(stats.pooledBytes == 0);
+					CHECK(stats.peakPooledBytes == capacity);
+				}
+			}
+
+			AND_WHEN("We give it back and ask for a bigger one")
+			{
+				pool.ReturnByteArray(std::move(byteArray));
+
+				Nz::ByteArray bigger = pool.GetByteArray(1000);
+
+				THEN("The small buffer is not used")
+				{
+					CHECK(bigger.GetCapacity() >= 1000);
+					CHECK(pool.GetStats().hitCount == 0);
+					CHECK(pool.GetStats().missCount == 2);
+				}
+			}
+
+			AND_WHEN("We give it back and clear the pool")
+			{
+				pool.ReturnByteArray(std::move(byteArray));
+				pool.Clear();
+
+				THEN("The pool is empty")
+				{
+					CHECK(pool.GetStats().pooledBytes == 0);
+
+					pool.GetByteArray(100);
+					CHECK(pool.GetStats().hitCount == 0);
+				}
+			}
+		}
+
+		WHEN("We give back byte arrays outside of pooled size classes")
+		{
+			Nz::ByteArray tiny;
+			tiny.Reserve(Nz::ByteArrayPool::MinPooledCapacity / 2);
+			pool.ReturnByteArray(std::move(tiny));
+			pool.ReturnByteArray(Nz::ByteArray());
+
+			THEN("They are not kept")
+			{
+				CHECK(pool.GetStats().pooledBytes == 0);
+			}
+		}
+
+		WHEN("We give back many byte arrays")
+		{
+			std::vector<Nz::ByteArray> byteArrays;
+			for (std::size_t i = 0; i < 4 * Nz::ByteArrayPool::ThreadCacheCapacity; ++i)
+				byteArrays.push_back(pool.GetByteArray(256));
+
+			for (Nz::ByteArray& byteArray : byteArrays)
+				pool.ReturnByteArray(std::move(byteArray));
+
+			std::size_t pooledBytes = pool.GetStats().pooledBytes;
+			CHECK(pooledBytes >= byteArrays.size() * 256);
+
+			pool.ResetStats();
+			CHECK(pool.GetStats().peakPooledBytes == pooledBytes);
+
+			THEN("They can all be reused")
+			{
+				for (std::size_t i = 0; i < byteArrays.size(); ++i)
+					byteArrays[i] = pool.GetByteArray(200);
+
+				Nz::ByteArrayPool::Stats stats = pool.GetStats();
+				CHECK(stats.hitCount == byteArrays.size());
+				CHECK(stats.missCount == 0);
+				CHECK(stats.pooledBytes == 0);
+			}
+		}
+	}
+
+	GIVEN("A pool shared by multiple threads")
+	{
+		Nz::ByteArrayPool pool;
+
+		constexpr std::size_t ThreadCount = 4;
+		constexpr std::size_t IterationCount = 2000;
+
+		std::atomic_bool error(false);
+
+		std::vector<std::thread> threads;
+		for (std::size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+		{
+			threads.emplace_back([&, threadIndex]
+			{
+				std::vector<Nz::ByteArray> byteArrays;
+				for (std::size_t i = 0; i < IterationCount; ++i)
+				{
+					std::size_t capacity = 64 + ((i * 37 + threadIndex * 101) % 4000);
+
+					Nz::ByteArray byteArray = pool.GetByteArray(capacity);
+					if (!byteArray.IsEmpty() || byteArray.GetCapacity() < capacity)
+						error = true;
+
+					byteArray.Resize(capacity, static_cast<Nz::UInt8>(threadIndex));
+					byteArrays.push_back(std::move(byteArray));
+
+					if (byteArrays.size() > 8)
+					{
+						for (Nz::ByteArray& pendingArray : byteArrays)
+						{
+							for (Nz::UInt8 byte : pendingArray)
+							{
+								if (byte != threadIndex)
+									error = true;
+							}
+
+							pool.ReturnByteArray(std::move(pendingArray));
+						}
+
+						byteArrays.clear();
+					}
+				}
+			});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		THEN("Byte arrays were never shared between threads and most of them were recycled")
+		{
+			CHECK_FALSE(error);
+
+			Nz::ByteArrayPool::Stats stats = pool.GetStats();
+			CHECK(stats.hitCount + stats.missCount == ThreadCount * IterationCount);
+			CHECK(stats.hitCount > stats.missCount);
+			CHECK(stats.pooledBytes <= stats.peakPooledBytes);
+		}
+	}
+}
@@ -0,0 +1,69 @@
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+#include <thread>
+#include <vector>
+
+SCENARIO("HardwareInfo", "[CORE][HARDWAREINFO]")
+{
+	GIVEN("Hardware info of this computer")
+	{
+		Nz::HardwareInfo hardwareInfo;
+
+		THEN("Processor topology is consistent")
+		{
+			const auto& logicalProcessors = hardwareInfo.GetCpuLogicalProcessors();
+			REQUIRE(!logicalProcessors.empty());
+			CHECK(hardwareInfo.GetCpuCoreCount() >= 1);
+			CHECK(hardwareInfo.GetCpuCoreCount() <= logicalProcessors.size());
+			CHECK(hardwareInfo.GetNumaNodeCount() >= 1);
+
+			std::set<unsigned int> indices;
+			for (const auto& logicalProcessor : logicalProcessors)
+				indices.insert(logicalProcessor.index);
+
+			CHECK(indices.size() == logicalProcessors.size());
+
+			unsigned int coreCount = 0;
+			for (Nz::ProcessorCoreType coreType : { Nz::ProcessorCoreType::Unknown, Nz::ProcessorCoreType::Efficiency, Nz::ProcessorCoreType::Performance })
+				coreCount += hardwareInfo.GetCpuCoreCount(coreType);
+
+			CHECK(coreCount == hardwareInfo.GetCpuCoreCount());
+		}
+
+		THEN("Cache info is sensible")
+		{
+			unsigned int lineSize = hardwareInfo.GetCpuCacheLineSize();
+			CHECK(lineSize >= 16);
+			CHECK((lineSize & (lineSize - 1)) == 0);
+
+			for (unsigned int level = 2; level <= Nz::HardwareInfo::MaxCacheLevel; ++level)
+			{
+				const auto& cache = hardwareInfo.GetCpuCacheInfo(level);
+				const auto& previousCache = hardwareInfo.GetCpuCacheInfo(level - 1);
+				if (cache.size != 0 && previousCache.size != 0)
+					CHECK(cache.size >= previousCache.size);
+			}
+		}
+
+#if defined(NAZARA_PLATFORM_LINUX) || defined(NAZARA_PLATFORM_WINDOWS)
+		WHEN("We pin a thread to a logical processor it's allowed to run on")
+		{
+			// The process may be restricted to a subset of the processors (containers, taskset, ...)
+			std::vector<unsigned int> allowedProcessors = Nz::HardwareInfo::GetCurrentThreadAffinity();
+			REQUIRE(!allowedProcessors.empty());
+
+			unsigned int processorIndex = allowedProcessors.back();
+
+			bool pinned = false;
+			std::thread thread([&]
+			{
+				pinned = Nz::HardwareInfo::SetCurrentThreadAffinity(processorIndex);
+			});
+			thread.join();
+
+			CHECK(pinned);
+		}
+#endif
+	}
+}
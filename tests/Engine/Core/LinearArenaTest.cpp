@@ -0,0 +1,107 @@
+#include <Nazara/Core/LinearArena.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+SCENARIO("LinearArena", "[CORE][LINEARARENA]")
+{
+	GIVEN("An arena with small blocks")
+	{
+		Nz::LinearArena arena(256);
+		CHECK(arena.GetBlockCount() == 0);
+		CHECK(arena.GetCapacity() == 0);
+
+		WHEN("We allocate memory with various alignments")
+		{
+			void* ptr1 = arena.Allocate(1, 1);
+			void* ptr2 = arena.Allocate(8, 8);
+			void* ptr3 = arena.Allocate(16, 64);
+			double* ptr4 = arena.Allocate<double>(3);
+
+			THEN("Allocations are aligned and don't overlap")
+			{
+				CHECK(reinterpret_cast<std::uintptr_t>(ptr2) % 8 == 0);
+				CHECK(reinterpret_cast<std::uintptr_t>(ptr3) % 64 == 0);
+				CHECK(reinterpret_cast<std::uintptr_t>(ptr4) % alignof(double) == 0);
+
+				CHECK(static_cast<Nz::UInt8*>(ptr2) >= static_cast<Nz::UInt8*>(ptr1) + 1);
+				CHECK(static_cast<Nz::UInt8*>(ptr3) >= static_cast<Nz::UInt8*>(ptr2) + 8);
+				CHECK(reinterpret_cast<Nz::UInt8*>(ptr4) >= static_cast<Nz::UInt8*>(ptr3) + 16);
+
+				CHECK(arena.GetBlockCount() == 1);
+				CHECK(arena.GetAllocatedSize() >= 1 + 8 + 16 + 3 * sizeof(double));
+			}
+		}
+
+		WHEN("We allocate more than a block can hold")
+		{
+			for (std::size_t i = 0; i < 10; ++i)
+				arena.Allocate(100);
+
+			void* bigAllocation = arena.Allocate(1000, 16);
+			CHECK(reinterpret_cast<std::uintptr_t>(bigAllocation) % 16 == 0);
+
+			std::size_t blockCount = arena.GetBlockCount();
+			std::size_t capacity = arena.GetCapacity();
+			CHECK(blockCount > 1);
+			CHECK(capacity >= 2000);
+
+			THEN("Resetting the arena merges its blocks")
+			{
+				arena.Reset();
+				CHECK(arena.GetBlockCount() == 1);
+				CHECK(arena.GetCapacity() == capacity);
+				CHECK(arena.GetAllocatedSize() == 0);
+
+				AND_THEN("The same allocations fit in the merged block")
+				{
+					for (std::size_t i = 0; i < 10; ++i)
+						arena.Allocate(100);
+
+					arena.Allocate(1000, 16);
+					CHECK(arena.GetBlockCount() == 1);
+					CHECK(arena.GetCapacity() == capacity);
+				}
+			}
+
+			THEN("Releasing the arena frees its blocks")
+			{
+				arena.Release();
+				CHECK(arena.GetBlockCount() == 0);
+				CHECK(arena.GetCapacity() == 0);
+				CHECK(arena.GetAllocatedSize() == 0);
+			}
+		}
+	}
+
+	GIVEN("Standard containers using an arena allocator")
+	{
+		Nz::LinearArena arena;
+
+		WHEN("We fill a vector and a map")
+		{
+			std::vector<int, Nz::ArenaAllocator<int>> values(arena);
+			for (int i = 0; i < 1000; ++i)
+				values.push_back(i);
+
+			using MapAllocator = Nz::ArenaAllocator<std::pair<const int, int>>;
+			std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, MapAllocator> squares(16, std::hash<int>{}, std::equal_to<int>{}, arena);
+			for (int i = 0; i < 100; ++i)
+				squares.emplace(i, i * i);
+
+			THEN("They work as usual, allocating from the arena")
+			{
+				REQUIRE(values.size() == 1000);
+				CHECK(values.front() == 0);
+				CHECK(values.back() == 999);
+
+				REQUIRE(squares.size() == 100);
+				CHECK(squares.at(42) == 42 * 42);
+
+				CHECK(arena.GetAllocatedSize() >= 1000 * sizeof(int));
+				CHECK(values.get_allocator() == Nz::ArenaAllocator<float>(arena));
+			}
+		}
+	}
+}
@@ -0,0 +1,60 @@
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFileStream.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+
+SCENARIO("MappedFileStream", "[CORE][MAPPEDFILESTREAM]")
+{
+	GIVEN("A file on disk")
+	{
+		const char content[] = "Memory mapped file content";
+		REQUIRE(Nz::File::WriteWhole("MappedFileTest.txt", content, sizeof(content) - 1));
+
+		WHEN("We map it")
+		{
+			Nz::MappedFileStream file("MappedFileTest.txt");
+			REQUIRE(file.IsOpen());
+
+			THEN("Its content is directly accessible")
+			{
+				CHECK(file.IsMemoryMapped());
+				CHECK(file.IsReadable());
+				CHECK_FALSE(file.IsWritable());
+				REQUIRE(file.GetSize() == sizeof(content) - 1);
+				REQUIRE(file.GetMappedPointer());
+				CHECK(std::memcmp(file.GetMappedPointer(), content, sizeof(content) - 1) == 0);
+			}
+
+			AND_THEN("It can be read like any stream")
+			{
+				char buffer[6] = {};
+				REQUIRE(file.Read(buffer, 6) == 6);
+				CHECK(std::string(buffer, 6) == "Memory");
+
+				REQUIRE(file.SetCursorPos(file.GetSize() - 7));
+				REQUIRE(file.Read(buffer, 6) == 6);
+				CHECK(std::string(buffer, 6) == "conten");
+				CHECK(file.Read(buffer, 6) == 1);
+				CHECK(file.EndOfStream());
+			}
+
+			AND_THEN("Closing it unmaps it")
+			{
+				file.Close();
+				CHECK_FALSE(file.IsOpen());
+				CHECK_FALSE(file.IsMemoryMapped());
+				CHECK(file.GetMappedPointer() == nullptr);
+			}
+		}
+
+		std::filesystem::remove("MappedFileTest.txt");
+	}
+
+	GIVEN("A file which doesn't exist")
+	{
+		Nz::MappedFileStream file;
+		CHECK_FALSE(file.Open("ThisFileDoesNotExist.txt"));
+		CHECK_FALSE(file.IsOpen());
+	}
+}
@@ -0,0 +1,98 @@
+#include <Nazara/Core/MemoryTracker.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+SCENARIO("MemoryTracker", "[CORE][MEMORYTRACKER]")
+{
+	GIVEN("Memory allocated under a tag")
+	{
+		Nz::MemoryTracker::Stats initialStats = Nz::MemoryTracker::GetStats(Nz::MemoryTag::Audio);
+		Nz::MemoryTracker::Stats initialTotalStats = Nz::MemoryTracker::GetTotalStats();
+
+		void* ptr = Nz::MemoryTracker::Allocate(1000, Nz::MemoryTag::Audio);
+		REQUIRE(ptr);
+		CHECK(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t) == 0);
+		std::memset(ptr, 0xFF, 1000);
+
+		THEN("It is accounted for its tag")
+		{
+			Nz::MemoryTracker::Stats stats = Nz::MemoryTracker::GetStats(Nz::MemoryTag::Audio);
+			CHECK(stats.allocationCount == initialStats.allocationCount + 1);
+			CHECK(stats.allocatedBytes == initialStats.allocatedBytes + 1000);
+			CHECK(stats.liveAllocationCount == initialStats.liveAllocationCount + 1);
+			CHECK(stats.liveBytes == initialStats.liveBytes + 1000);
+			CHECK(stats.peakBytes >= stats.liveBytes);
+
+			Nz::MemoryTracker::Stats totalStats = Nz::MemoryTracker::GetTotalStats();
+			CHECK(totalStats.liveBytes >= initialTotalStats.liveBytes + 1000);
+
+			Nz::MemoryTracker::Free(ptr);
+		}
+
+		WHEN("We free it")
+		{
+			Nz::MemoryTracker::Free(ptr);
+
+			THEN("Live bytes are back to their initial value while the peak is kept")
+			{
+				Nz::MemoryTracker::Stats stats = Nz::MemoryTracker::GetStats(Nz::MemoryTag::Audio);
+				CHECK(stats.allocationCount == initialStats.allocationCount + 1);
+				CHECK(stats.liveAllocationCount == initialStats.liveAllocationCount);
+				CHECK(stats.liveBytes == initialStats.liveBytes);
+				CHECK(stats.peakBytes >= initialStats.liveBytes + 1000);
+			}
+
+			AND_WHEN("We reset the stats")
+			{
+				Nz::MemoryTracker::ResetStats();
+
+				THEN("Counters and peak are reset")
+				{
+					Nz::MemoryTracker::Stats stats = Nz::MemoryTracker::GetStats(Nz::MemoryTag::Audio);
+					CHECK(stats.allocationCount == 0);
+					CHECK(stats.allocatedBytes == 0);
+					CHECK(stats.peakBytes == stats.liveBytes);
+				}
+			}
+		}
+	}
+
+	GIVEN("Allocations made inside a memory scope")
+	{
+		std::vector<int, Nz::TaggedAllocator<int, Nz::MemoryTag::Network>> values;
+
+		{
+			NazaraMemoryScope(Nz::MemoryTag::Network, "MemoryTrackerTest scope");
+			CHECK(Nz::MemoryTracker::GetCurrentTag() == Nz::MemoryTag::Network);
+
+			for (int i = 0; i < 1000; ++i)
+				values.push_back(i);
+		}
+
+		CHECK(Nz::MemoryTracker::GetCurrentTag() == Nz::MemoryTag::Other);
+
+		THEN("They are attributed to the scope call site")
+		{
+			bool found = false;
+			for (const Nz::MemoryTracker::CallSiteStats& callSiteStats : Nz::MemoryTracker::GetTopCallSites(NAZARA_CORE_MEMORY_TRACKER_CALLSITES))
+			{
+				if (std::strcmp(callSiteStats.callSite->name, "MemoryTrackerTest scope") != 0)
+					continue;
+
+				found = true;
+				CHECK(callSiteStats.tag == Nz::MemoryTag::Network);
+				CHECK(callSiteStats.allocationCount > 0);
+				CHECK(callSiteStats.allocatedBytes >= 1000 * sizeof(int));
+				CHECK(callSiteStats.liveBytes >= values.capacity() * sizeof(int));
+			}
+			CHECK(found);
+
+			std::string report = Nz::MemoryTracker::ToReport();
+			CHECK(report.find("Network") != std::string::npos);
+			CHECK(report.find("MemoryTrackerTest scope") != std::string::npos);
+		}
+	}
+}
@@ -0,0 +1,215 @@
+#include <Nazara/Core/PackedArchive.hpp>
+#include <Nazara/Core/PackedArchiveBuilder.hpp>
+#include <Nazara/Core/VirtualDirectory.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <set>
+#include <string>
+
+namespace
+{
+	std::vector<Nz::UInt8> MakeContent(std::string_view str)
+	{
+		return std::vector<Nz::UInt8>(str.begin(), str.end());
+	}
+}
+
+SCENARIO("PackedArchive", "[CORE][PACKEDARCHIVE]")
+{
+	GIVEN("An archive built from memory files")
+	{
+		std::string compressibleContent;
+		for (std::size_t i = 0; i < 1000; ++i)
+			compressibleContent += "Nazara Engine ";
+
+		Nz::PackedArchiveBuilder builder;
+		REQUIRE(builder.AddFile("readme.txt", MakeContent("Hello world")));
+		REQUIRE(builder.AddFile("data/a.bin", MakeContent("AAAA")));
+		REQUIRE(builder.AddFile("data/sub/b.bin", MakeContent("BB")));
+		REQUIRE(builder.AddFile("data\\empty.bin", std::vector<Nz::UInt8>{}));
+		REQUIRE(builder.AddFile("compressed.txt", MakeContent(compressibleContent), Nz::PackedArchiveCompression::LZ4));
+		CHECK(builder.GetFileCount() == 5);
+
+		CHECK_FALSE(builder.AddFile("../escape.txt", MakeContent("nope")));
+		CHECK_FALSE(builder.AddFile("data", MakeContent("directory name")));
+		CHECK_FALSE(builder.AddFile("readme.txt/child", MakeContent("file name")));
+
+		REQUIRE(builder.Save("PackedArchiveTest.nzpk"));
+
+		WHEN("We open it")
+		{
+			std::shared_ptr<Nz::PackedArchive> archive = std::make_shared<Nz::PackedArchive>();
+			REQUIRE(archive->Open("PackedArchiveTest.nzpk"));
+
+			THEN("Entries can be found by path")
+			{
+				// root, readme.txt, data, a.bin, sub, b.bin, empty.bin, compressed.txt
+				CHECK(archive->GetEntryCount() == 8);
+				CHECK(archive->IsDirectory(Nz::PackedArchive::RootIndex));
+
+				std::size_t readmeIndex = archive->FindEntry("readme.txt");
+				REQUIRE(readmeIndex != Nz::PackedArchive::InvalidIndex);
+				CHECK_FALSE(archive->IsDirectory(readmeIndex));
+				CHECK(archive->GetEntryName(readmeIndex) == "readme.txt");
+				CHECK(archive->GetEntrySize(readmeIndex) == 11);
+				CHECK(archive->GetEntryCompression(readmeIndex) == Nz::PackedArchiveCompression::None);
+				REQUIRE(archive->GetEntryData(readmeIndex));
+				CHECK(std::memcmp(archive->GetEntryData(readmeIndex), "Hello world", 11) == 0);
+
+				std::size_t bIndex = archive->FindEntry("/data/sub/b.bin");
+				REQUIRE(bIndex != Nz::PackedArchive::InvalidIndex);
+				CHECK(archive->GetEntryPath(bIndex) == "data/sub/b.bin");
+				CHECK(archive->GetEntryName(bIndex) == "b.bin");
+
+				std::size_t dataIndex = archive->FindEntry("data");
+				REQUIRE(dataIndex != Nz::PackedArchive::InvalidIndex);
+				CHECK(archive->IsDirectory(dataIndex));
+				CHECK(archive->GetEntryData(dataIndex) == nullptr);
+
+				std::size_t emptyIndex = archive->FindEntry("data/empty.bin");
+				REQUIRE(emptyIndex != Nz::PackedArchive::InvalidIndex);
+				CHECK(archive->GetEntrySize(emptyIndex) == 0);
+
+				CHECK(archive->FindEntry("data/c.bin") == Nz::PackedArchive::InvalidIndex);
+				CHECK(archive->FindEntry("Readme.txt") == Nz::PackedArchive::InvalidIndex);
+			}
+
+			AND_THEN("Directories can be listed")
+			{
+				std::set<std::string> children;
+				archive->ForeachChild(archive->FindEntry("data"), [&](std::string_view name, std::size_t /*entryIndex*/)
+				{
+					children.emplace(name);
+				});
+
+				CHECK(children == std::set<std::string>{ "a.bin", "empty.bin", "sub" });
+			}
+
+			AND_THEN("Compressed files can be read back")
+			{
+				std::size_t entryIndex = archive->FindEntry("compressed.txt");
+				REQUIRE(entryIndex != Nz::PackedArchive::InvalidIndex);
+				CHECK(archive->GetEntryCompression(entryIndex) == Nz::PackedArchiveCompression::LZ4);
+				CHECK(archive->GetEntryData(entryIndex) == nullptr);
+				REQUIRE(archive->GetEntrySize(entryIndex) == compressibleContent.size());
+
+				std::string content(compressibleContent.size(), '\0');
+				REQUIRE(archive->ReadEntry(entryIndex, content.data()));
+				CHECK(content == compressibleContent);
+			}
+
+			AND_WHEN("We mount it in a virtual directory")
+			{
+				std::shared_ptr<Nz::VirtualDirectory> virtualDir = std::make_shared<Nz::VirtualDirectory>();
+				virtualDir->StoreDirectory("Assets/Packed", archive);
+
+				auto ReadFile = [&](std::string_view path)
+				{
+					std::string content;
+					bool found = virtualDir->GetFileContent(path, [&](const void* data, std::size_t size)
+					{
+						content.assign(static_cast<const char*>(data), size);
+					});
+
+					return (found) ? std::optional<std::string>(std::move(content)) : std::nullopt;
+				};
+
+				THEN("Archive files can be accessed through it")
+				{
+					CHECK(ReadFile("Assets/Packed/readme.txt") == "Hello world");
+					CHECK(ReadFile("Assets/Packed/data/sub/b.bin") == "BB");
+					CHECK(ReadFile("Assets/Packed/data/sub/../a.bin") == "AAAA");
+					CHECK(ReadFile("Assets/Packed/./data/empty.bin") == "");
+					CHECK(ReadFile("Assets/Packed/compressed.txt") == compressibleContent);
+					CHECK_FALSE(ReadFile("Assets/Packed/missing.txt"));
+
+					CHECK(virtualDir->GetEntry("Assets/Packed/data/sub", [](const Nz::VirtualDirectory::Entry& entry)
+					{
+						return std::holds_alternative<Nz::VirtualDirectory::ArchiveDirectoryEntry>(entry);
+					}));
+
+					// Going up from the archive root leads back to the virtual directory
+					CHECK(virtualDir->GetEntry("Assets/Packed/data/../..", [](const Nz::VirtualDirectory::Entry& entry)
+					{
+						return std::holds_alternative<Nz::VirtualDirectory::VirtualDirectoryEntry>(entry);
+					}));
+				}
+
+				AND_THEN("Archive directories can be iterated")
+				{
+					REQUIRE(virtualDir->GetDirectoryEntry("Assets/Packed/data", [&](const Nz::VirtualDirectory::DirectoryEntry& dirEntry)
+					{
+						std::set<std::string> children;
+						dirEntry.directory->Foreach([&](std::string_view name, const Nz::VirtualDirectory::Entry& entry)
+						{
+							children.emplace(name);
+							if (name == "sub")
+								CHECK(std::holds_alternative<Nz::VirtualDirectory::ArchiveDirectoryEntry>(entry));
+							else
+								CHECK(std::holds_alternative<Nz::VirtualDirectory::ArchiveFileEntry>(entry));
+						});
+
+						CHECK(children == std::set<std::string>{ "a.bin", "empty.bin", "sub" });
+					}));
+				}
+			}
+		}
+	}
+
+	GIVEN("A file which isn't an archive")
+	{
+		const char content[] = "This is not an archive";
+		{
+			Nz::PackedArchiveBuilder builder;
+			REQUIRE(builder.AddFile("file.txt", MakeContent(content)));
+			REQUIRE(builder.Save("PackedArchiveInvalid.nzpk"));
+		}
+
+		FILE* file = std::fopen("PackedArchiveInvalid.nzpk", "r+b");
+		REQUIRE(file);
+		std::fwrite(content, 1, sizeof(content), file);
+		std::fclose(file);
+
+		THEN("Opening it fails")
+		{
+			Nz::PackedArchive archive;
+			CHECK_FALSE(archive.Open("PackedArchiveInvalid.nzpk"));
+			CHECK_FALSE(archive.IsOpen());
+		}
+	}
+
+	GIVEN("An archive with a corrupted bucket table")
+	{
+		{
+			Nz::PackedArchiveBuilder builder;
+			REQUIRE(builder.AddFile("file.txt", MakeContent("content")));
+			REQUIRE(builder.Save("PackedArchiveCorrupted.nzpk"));
+		}
+
+		FILE* file = std::fopen("PackedArchiveCorrupted.nzpk", "r+b");
+		REQUIRE(file);
+
+		// Make the first bucket reference an entry past the entry table
+		Nz::UInt8 header[48];
+		REQUIRE(std::fread(header, 1, sizeof(header), file) == sizeof(header));
+
+		Nz::UInt32 entryCount;
+		Nz::UInt64 bucketTableOffset;
+		std::memcpy(&entryCount, &header[8], sizeof(entryCount));
+		std::memcpy(&bucketTableOffset, &header[24], sizeof(bucketTableOffset));
+
+		Nz::UInt32 invalidBucket = entryCount + 1;
+		std::fseek(file, static_cast<long>(bucketTableOffset), SEEK_SET);
+		std::fwrite(&invalidBucket, 1, sizeof(invalidBucket), file);
+		std::fclose(file);
+
+		THEN("Opening it fails")
+		{
+			Nz::PackedArchive archive;
+			CHECK_FALSE(archive.Open("PackedArchiveCorrupted.nzpk"));
+			CHECK_FALSE(archive.IsOpen());
+		}
+	}
+}
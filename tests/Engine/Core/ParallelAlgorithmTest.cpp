@@ -0,0 +1,92 @@
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+SCENARIO("ParallelAlgorithm", "[CORE][PARALLELALGORITHM]")
+{
+	GIVEN("A large array")
+	{
+		std::vector<unsigned int> values(100'003, 0);
+
+		WHEN("We fill it using ParallelFor")
+		{
+			Nz::ParallelFor(0, values.size(), [&](std::size_t i) { values[i] = static_cast<unsigned int>(i % 7); });
+
+			THEN("Every index has been processed")
+			{
+				bool valid = true;
+				for (std::size_t i = 0; i < values.size(); ++i)
+					valid = valid && (values[i] == i % 7);
+
+				CHECK(valid);
+			}
+
+			AND_THEN("We can sum it using ParallelReduce")
+			{
+				auto SumRange = [&](std::size_t first, std::size_t last)
+				{
+					return std::accumulate(values.begin() + first, values.begin() + last, Nz::UInt64(0));
+				};
+
+				Nz::UInt64 expected = SumRange(0, values.size());
+
+				CHECK(Nz::ParallelReduce(0, values.size(), Nz::UInt64(0), SumRange, std::plus<Nz::UInt64>()) == expected);
+				CHECK(Nz::ParallelReduce(0, values.size(), Nz::UInt64(0), SumRange, std::plus<Nz::UInt64>(), 1000) == expected);
+			}
+		}
+	}
+
+	GIVEN("A non-commutative reduction")
+	{
+		auto ToString = [](std::size_t first, std::size_t last)
+		{
+			std::string str;
+			for (std::size_t i = first; i < last; ++i)
+				str += static_cast<char>('a' + i);
+
+			return str;
+		};
+
+		THEN("Partial results are combined in order")
+		{
+			CHECK(Nz::ParallelReduce(0, 26, std::string(), ToString, std::plus<std::string>(), 3) == "abcdefghijklmnopqrstuvwxyz");
+			CHECK(Nz::ParallelReduce(5, 5, std::string("empty"), ToString, std::plus<std::string>()) == "empty");
+		}
+	}
+
+	GIVEN("A chunk throwing on the calling thread")
+	{
+		std::atomic<std::size_t> processedCount = 0;
+		auto ProcessRange = [&](std::size_t first, std::size_t last)
+		{
+			if (first == 0)
+				throw std::runtime_error("first chunk failed");
+
+			processedCount += last - first;
+		};
+
+		THEN("The exception is propagated once other chunks have been processed")
+		{
+			CHECK_THROWS_AS(Nz::ParallelForRange(0, 1000, ProcessRange, 10), std::runtime_error);
+			CHECK(processedCount == 990);
+		}
+	}
+
+	GIVEN("Nested parallel loops")
+	{
+		std::vector<unsigned int> values(64 * 64, 0);
+		Nz::ParallelFor(0, 64, [&](std::size_t y)
+		{
+			Nz::ParallelFor(0, 64, [&](std::size_t x) { values[y * 64 + x] = 1; }, 8);
+		}, 1);
+
+		THEN("Every index has been processed")
+		{
+			CHECK(std::accumulate(values.begin(), values.end(), 0u) == values.size());
+		}
+	}
+}
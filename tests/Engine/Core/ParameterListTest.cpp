@@ -243,5 +243,84 @@ SCENARIO("ParameterList", "[CORE][PARAMETERLIST]")
 				CHECK(parameterList.HasParameter("str"));
 			}
 		}
+
+		WHEN("We look for parameters using string views and keys")
+		{
+			std::string name = "stri";
+			std::string_view nameView = std::string_view(name).substr(0, 3);
+
+			constexpr Nz::ParameterKey doubleKey("d");
+			static_assert(doubleKey.GetHash() == Nz::ParameterKey::ComputeHash("d"));
+
+			THEN("They are found without having to build a string")
+			{
+				CHECK(parameterList.GetStringViewParameter(nameView).GetValue() == "ing");
+				CHECK(parameterList.GetDoubleParameter(doubleKey).GetValue() == d);
+				CHECK_FALSE(parameterList.HasParameter(std::string_view(name)));
+				CHECK(Nz::ParameterKey(nameView) == Nz::ParameterKey("str"));
+				CHECK(Nz::ParameterKey(name) != Nz::ParameterKey("str"));
+			}
+		}
+
+		WHEN("We remove some parameters while iterating")
+		{
+			parameterList.ForEach([](const Nz::ParameterList& list, const std::string& name)
+			{
+				return list.GetParameterType(name).GetValue() != Nz::ParameterType::String;
+			});
+
+			THEN("Only the remaining parameters are kept")
+			{
+				CHECK(!parameterList.HasParameter("i"));
+				CHECK(!parameterList.HasParameter("d"));
+				CHECK(!parameterList.HasParameter("toaster"));
+				CHECK(parameterList.GetStringParameter("str").GetValue() == "ing");
+			}
+		}
+	}
+
+	GIVEN("A parameter list with many values")
+	{
+		int destructorCount = 0;
+		auto Destructor = [](void* value)
+		{
+			++*static_cast<int*>(value);
+		};
+
+		{
+			Nz::ParameterList parameterList;
+			for (long long i = 0; i < 100; ++i)
+			{
+				std::string index = std::to_string(i);
+				parameterList.SetParameter("Int" + index, i);
+				parameterList.SetParameter("String" + index, "This is a string long enough to require an allocation #" + index);
+			}
+			parameterList.SetParameter("Userdata", &destructorCount, Destructor);
+
+			Nz::ParameterList copy = parameterList;
+			parameterList.SetParameter("String42", "Replaced");
+			parameterList.RemoveParameter("Int10");
+
+			THEN("Values survive their storage being reallocated")
+			{
+				for (long long i = 0; i < 100; ++i)
+				{
+					std::string index = std::to_string(i);
+					if (i != 10)
+						CHECK(parameterList.GetIntegerParameter("Int" + index).GetValue() == i);
+
+					if (i != 42)
+						CHECK(parameterList.GetStringParameter("String" + index).GetValue() == "This is a string long enough to require an allocation #" + index);
+				}
+
+				CHECK(parameterList.GetStringParameter("String42").GetValue() == "Replaced");
+				CHECK(!parameterList.HasParameter("Int10"));
+				CHECK(copy.GetIntegerParameter("Int10").GetValue() == 10);
+				CHECK(copy.GetStringParameter("String42").GetValue() == "This is a string long enough to require an allocation #42");
+				CHECK(copy.GetUserdataParameter("Userdata").GetValue() == &destructorCount);
+			}
+		}
+
+		CHECK(destructorCount == 1);
 	}
 }
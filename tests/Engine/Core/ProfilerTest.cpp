@@ -0,0 +1,93 @@
+#include <Nazara/Core/Profiler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+SCENARIO("Profiler", "[CORE][PROFILER]")
+{
+	GIVEN("A running capture")
+	{
+		Nz::Profiler::StartCapture();
+		REQUIRE(Nz::Profiler::IsCapturing());
+
+		WHEN("We record nested zones")
+		{
+			{
+				NazaraProfileZone("OuterZone");
+				{
+					NazaraProfileZone("InnerZone");
+				}
+			}
+			NazaraProfileFrame();
+
+			Nz::Profiler::StopCapture();
+
+			THEN("They appear in the Chrome trace")
+			{
+				CHECK_FALSE(Nz::Profiler::IsCapturing());
+
+				std::string trace = Nz::Profiler::ToChromeTrace();
+#if NAZARA_CORE_PROFILER
+				CHECK(trace.find("\"OuterZone\"") != std::string::npos);
+				CHECK(trace.find("\"InnerZone\"") != std::string::npos);
+				CHECK(trace.find("\"ph\":\"B\"") != std::string::npos);
+				CHECK(trace.find("\"ph\":\"E\"") != std::string::npos);
+#endif
+				CHECK(Nz::Profiler::GetDroppedEventCount() == 0);
+			}
+		}
+
+		WHEN("We limit the capture to a frame count")
+		{
+			Nz::Profiler::StartCapture(2);
+			NazaraProfileFrame();
+			NazaraProfileFrame();
+
+			THEN("The capture stops by itself")
+			{
+#if NAZARA_CORE_PROFILER
+				CHECK_FALSE(Nz::Profiler::IsCapturing());
+#endif
+				Nz::Profiler::StopCapture();
+			}
+		}
+
+		WHEN("We restart the capture while a zone is open")
+		{
+			{
+				NazaraProfileZone("RestartedZone");
+				Nz::Profiler::StartCapture();
+			}
+			Nz::Profiler::StopCapture();
+
+			THEN("The new capture doesn't hold the end of the zone")
+			{
+				std::string trace = Nz::Profiler::ToChromeTrace();
+				CHECK(trace.find("\"ph\":\"E\"") == std::string::npos);
+			}
+		}
+
+		WHEN("We record more events than a buffer chunk holds")
+		{
+			constexpr std::size_t ZoneCount = 10'000;
+			for (std::size_t i = 0; i < ZoneCount; ++i)
+			{
+				NazaraProfileZone("RepeatedZone");
+			}
+
+			Nz::Profiler::StopCapture();
+
+			THEN("Every event is exported")
+			{
+				std::string trace = Nz::Profiler::ToChromeTrace();
+#if NAZARA_CORE_PROFILER
+				std::size_t beginCount = 0;
+				for (std::size_t pos = trace.find("\"ph\":\"B\""); pos != std::string::npos; pos = trace.find("\"ph\":\"B\"", pos + 1))
+					beginCount++;
+
+				CHECK(beginCount == ZoneCount);
+#endif
+				CHECK(Nz::Profiler::GetDroppedEventCount() == 0);
+			}
+		}
+	}
+}
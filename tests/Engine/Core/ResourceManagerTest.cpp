@@ -0,0 +1,271 @@
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/ResourceManager.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace
+{
+	struct TestResourceParams : Nz::ResourceParameters
+	{
+		bool IsValid() const { return true; }
+	};
+
+	struct TestResource : Nz::Resource
+	{
+		std::size_t GetMemoryUsage() const { return content.size(); }
+
+		std::string content;
+	};
+
+	using TestResourceLoader = Nz::ResourceLoader<TestResource, TestResourceParams>;
+	using TestResourceManager = Nz::ResourceManager<TestResource, TestResourceParams>;
+}
+
+SCENARIO("ResourceManager", "[CORE][RESOURCEMANAGER]")
+{
+	GIVEN("A resource manager and a loader counting its loads")
+	{
+		REQUIRE(Nz::File::WriteWhole("ResourceManagerTest.res", "Resource content", 16));
+
+		std::atomic_uint loadCount = 0;
+
+		TestResourceLoader loader;
+		TestResourceLoader::Entry loaderEntry;
+		loaderEntry.extensionSupport = [](std::string_view extension)
+		{
+			return extension == ".res";
+		};
+
+		loaderEntry.fileLoader = [&](const std::filesystem::path& filePath, const TestResourceParams& /*parameters*/) -> Nz::Result<std::shared_ptr<TestResource>, Nz::ResourceLoadingError>
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			loadCount++;
+
+			std::optional<std::vector<Nz::UInt8>> content = Nz::File::ReadWhole(filePath);
+			if (!content)
+				return Nz::Err(Nz::ResourceLoadingError::FailedToOpenFile);
+
+			auto resource = std::make_shared<TestResource>();
+			resource->content.assign(content->begin(), content->end());
+
+			return resource;
+		};
+		loader.RegisterLoader(loaderEntry);
+
+		TestResourceManager manager(loader);
+
+		WHEN("We request the same resource asynchronously multiple times")
+		{
+			unsigned int callbackCount = 0;
+			std::shared_ptr<TestResource> callbackResource;
+			auto callback = [&](const std::shared_ptr<TestResource>& resource)
+			{
+				callbackCount++;
+				callbackResource = resource;
+			};
+
+			auto future1 = manager.GetAsync("ResourceManagerTest.res", callback);
+			auto future2 = manager.GetAsync("ResourceManagerTest.res", callback);
+			CHECK(manager.GetPendingLoadCount() == 1);
+
+			THEN("It is only loaded once and callbacks are called when processing completed loads")
+			{
+				std::shared_ptr<TestResource> resource = future1.get();
+				REQUIRE(resource);
+				CHECK(resource->content == "Resource content");
+				CHECK(future2.get() == resource);
+				CHECK(loadCount == 1);
+
+				// Callbacks are only called from ProcessCompletedLoads
+				CHECK(callbackCount == 0);
+				while (manager.GetPendingLoadCount() > 0)
+				{
+					manager.ProcessCompletedLoads();
+					std::this_thread::yield();
+				}
+
+				CHECK(callbackCount == 2);
+				CHECK(callbackResource == resource);
+
+				// Resource is now registered
+				CHECK(manager.Get("ResourceManagerTest.res") == resource);
+				auto future3 = manager.GetAsync("ResourceManagerTest.res", callback);
+				CHECK(callbackCount == 3);
+				CHECK(future3.get() == resource);
+				CHECK(loadCount == 1);
+			}
+
+			AND_THEN("Getting it synchronously waits for the pending load")
+			{
+				std::shared_ptr<TestResource> resource = manager.Get("ResourceManagerTest.res");
+				REQUIRE(resource);
+				CHECK(loadCount == 1);
+				CHECK(callbackCount == 2);
+				CHECK(manager.GetPendingLoadCount() == 0);
+				CHECK(future1.get() == resource);
+
+				manager.ProcessCompletedLoads();
+				CHECK(callbackCount == 2);
+			}
+		}
+
+		WHEN("We load a resource asynchronously using the loader")
+		{
+			auto future = loader.LoadFromFileAsync("ResourceManagerTest.res");
+
+			THEN("We get the resource")
+			{
+				std::shared_ptr<TestResource> resource = future.get();
+				REQUIRE(resource);
+				CHECK(resource->content == "Resource content");
+				CHECK(loadCount == 1);
+			}
+		}
+	}
+
+	GIVEN("A resource manager with multiple resources loaded")
+	{
+		REQUIRE(Nz::File::WriteWhole("ResourceManagerA.res", "Resource A", 10));
+		REQUIRE(Nz::File::WriteWhole("ResourceManagerB.res", "Resource B", 10));
+		REQUIRE(Nz::File::WriteWhole("ResourceManagerC.res", "Resource C", 10));
+
+		TestResourceLoader loader;
+		TestResourceLoader::Entry loaderEntry;
+		loaderEntry.extensionSupport = [](std::string_view extension)
+		{
+			return extension == ".res";
+		};
+
+		loaderEntry.fileLoader = [&](const std::filesystem::path& filePath, const TestResourceParams& /*parameters*/) -> Nz::Result<std::shared_ptr<TestResource>, Nz::ResourceLoadingError>
+		{
+			std::optional<std::vector<Nz::UInt8>> content = Nz::File::ReadWhole(filePath);
+			if (!content)
+				return Nz::Err(Nz::ResourceLoadingError::FailedToOpenFile);
+
+			auto resource = std::make_shared<TestResource>();
+			resource->content.assign(content->begin(), content->end());
+
+			return resource;
+		};
+		loader.RegisterLoader(loaderEntry);
+
+		TestResourceManager manager(loader);
+		CHECK(manager.GetMemoryBudget() == TestResourceManager::NoMemoryBudget);
+
+		REQUIRE(manager.Get("ResourceManagerA.res"));
+		REQUIRE(manager.Get("ResourceManagerB.res"));
+		REQUIRE(manager.Get("ResourceManagerC.res"));
+
+		CHECK(manager.GetStats().missCount == 3);
+		CHECK(manager.GetStats().hitCount == 0);
+		CHECK(manager.GetStats().memoryUsage == 30);
+		CHECK(manager.GetStats().resourceCount == 3);
+
+		WHEN("We set a memory budget")
+		{
+			// Use A so C becomes the least recently used resource, and keep a reference to B
+			REQUIRE(manager.Get("ResourceManagerA.res"));
+			std::shared_ptr<TestResource> resourceB = manager.Get("ResourceManagerB.res");
+			CHECK(manager.GetStats().hitCount == 2);
+
+			manager.SetMemoryBudget(20);
+
+			THEN("Least recently used resources are evicted")
+			{
+				CHECK(manager.GetStats().evictionCount == 1);
+				CHECK(manager.GetStats().evictedMemory == 10);
+				CHECK(manager.GetStats().memoryUsage == 20);
+				CHECK(manager.GetStats().resourceCount == 2);
+
+				// C has to be loaded again
+				REQUIRE(manager.Get("ResourceManagerC.res"));
+				CHECK(manager.GetStats().missCount == 4);
+
+				// which evicted A as B is still in use
+				CHECK(manager.GetStats().evictionCount == 2);
+				CHECK(manager.Get("ResourceManagerB.res") == resourceB);
+				CHECK(manager.GetStats().hitCount == 3);
+			}
+
+			AND_THEN("Resources still in use are only evicted once released")
+			{
+				CHECK(manager.EvictUnused() == 1);
+				CHECK(manager.GetStats().resourceCount == 1);
+				CHECK(manager.GetStats().memoryUsage == 10);
+
+				manager.SetMemoryBudget(0);
+				CHECK(manager.GetStats().resourceCount == 1);
+
+				resourceB.reset();
+				manager.ProcessCompletedLoads();
+				CHECK(manager.GetStats().resourceCount == 0);
+				CHECK(manager.GetStats().memoryUsage == 0);
+				CHECK(manager.GetStats().evictionCount == 3);
+			}
+		}
+
+		WHEN("We unregister and clear resources")
+		{
+			manager.Unregister("ResourceManagerA.res");
+			CHECK(manager.GetStats().resourceCount == 2);
+			CHECK(manager.GetStats().memoryUsage == 20);
+
+			manager.Clear();
+			CHECK(manager.GetStats().resourceCount == 0);
+			CHECK(manager.GetStats().memoryUsage == 0);
+
+			manager.ResetStats();
+			CHECK(manager.GetStats().missCount == 0);
+		}
+	}
+
+	GIVEN("A loader reading resources from streams")
+	{
+		REQUIRE(Nz::File::WriteWhole("ResourceLoaderTest.res", "Resource content", 16));
+		REQUIRE(Nz::File::WriteWhole("ResourceLoaderEmpty.res", "", 0));
+
+		bool memoryMapped = false;
+
+		TestResourceLoader loader;
+		TestResourceLoader::Entry loaderEntry;
+		loaderEntry.extensionSupport = [](std::string_view extension)
+		{
+			return extension == ".res";
+		};
+
+		loaderEntry.streamLoader = [&](Nz::Stream& stream, const TestResourceParams& /*parameters*/) -> Nz::Result<std::shared_ptr<TestResource>, Nz::ResourceLoadingError>
+		{
+			memoryMapped = stream.IsMemoryMapped();
+
+			auto resource = std::make_shared<TestResource>();
+			resource->content.resize(stream.GetSize());
+			if (stream.Read(resource->content.data(), resource->content.size()) != resource->content.size())
+				return Nz::Err(Nz::ResourceLoadingError::DecodingError);
+
+			return resource;
+		};
+		loader.RegisterLoader(loaderEntry);
+
+		THEN("Regular files are memory mapped")
+		{
+			std::shared_ptr<TestResource> resource = loader.LoadFromFile("ResourceLoaderTest.res");
+			REQUIRE(resource);
+			CHECK(resource->content == "Resource content");
+			CHECK(memoryMapped);
+		}
+
+		AND_THEN("Files which can't be mapped are read as usual")
+		{
+			std::shared_ptr<TestResource> resource = loader.LoadFromFile("ResourceLoaderEmpty.res");
+			REQUIRE(resource);
+			CHECK(resource->content.empty());
+			CHECK_FALSE(memoryMapped);
+		}
+
+		std::filesystem::remove("ResourceLoaderTest.res");
+		std::filesystem::remove("ResourceLoaderEmpty.res");
+	}
+}
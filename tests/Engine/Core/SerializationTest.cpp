@@ -1,11 +1,16 @@
 #include <Nazara/Core/SerializationContext.hpp>
 
+#include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
 #include <Nazara/Core/MemoryView.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Math/Ray.hpp>
 #include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -231,6 +236,139 @@ SCENARIO("Serialization", "[CORE][SERIALIZATION]")
 			}
 		}
 
+		WHEN("We serialize using compact encodings")
+		{
+			THEN("Variable-length integers")
+			{
+				auto CheckVarInt = [&](auto value, std::size_t expectedSize)
+				{
+					context.stream->SetCursorPos(0);
+					REQUIRE(SerializeVarInt(context, value));
+					CHECK(context.stream->GetCursorPos() == expectedSize);
+
+					decltype(value) result = 0;
+					context.stream->SetCursorPos(0);
+					REQUIRE(UnserializeVarInt(context, &result));
+					CHECK(result == value);
+					CHECK(context.stream->GetCursorPos() == expectedSize);
+				};
+
+				CheckVarInt(Nz::UInt32(0), 1);
+				CheckVarInt(Nz::UInt32(127), 1);
+				CheckVarInt(Nz::UInt32(128), 2);
+				CheckVarInt(Nz::UInt32(300), 2);
+				CheckVarInt(std::numeric_limits<Nz::UInt32>::max(), 5);
+				CheckVarInt(std::numeric_limits<Nz::UInt64>::max(), 10);
+				CheckVarInt(Nz::Int32(-1), 1);
+				CheckVarInt(Nz::Int32(-64), 1);
+				CheckVarInt(Nz::Int32(64), 2);
+				CheckVarInt(std::numeric_limits<Nz::Int32>::min(), 5);
+				CheckVarInt(std::numeric_limits<Nz::Int64>::min(), 10);
+
+				// A value too big for the target type must be rejected
+				context.stream->SetCursorPos(0);
+				REQUIRE(SerializeVarInt(context, Nz::UInt32(70000)));
+				Nz::UInt16 tooSmall;
+				context.stream->SetCursorPos(0);
+				CHECK_FALSE(UnserializeVarInt(context, &tooSmall));
+			}
+
+			THEN("Bits")
+			{
+				context.stream->SetCursorPos(0);
+				REQUIRE(SerializeBits(context, 0b10110, 5));
+				REQUIRE(Serialize(context, true));
+				REQUIRE(SerializeBits(context, 0xABC, 12));
+				REQUIRE(SerializeBits(context, 0x0123456789ABCDEF, 64));
+				context.FlushBits();
+				CHECK(context.stream->GetCursorPos() == 11);
+
+				Nz::UInt64 value;
+				bool boolean;
+				context.stream->SetCursorPos(0);
+				REQUIRE(UnserializeBits(context, &value, 5));
+				CHECK(value == 0b10110);
+				REQUIRE(Unserialize(context, &boolean));
+				CHECK(boolean);
+				REQUIRE(UnserializeBits(context, &value, 12));
+				CHECK(value == 0xABC);
+				REQUIRE(UnserializeBits(context, &value, 64));
+				CHECK(value == 0x0123456789ABCDEF);
+			}
+
+			THEN("Quantized floats and vectors")
+			{
+				context.stream->SetCursorPos(0);
+				REQUIRE(SerializeQuantized(context, 0.3f, 0.f, 1.f, 10));
+				REQUIRE(SerializeQuantized(context, 5.f, 0.f, 1.f, 10)); //< Clamped to max
+				REQUIRE(SerializeQuantized(context, Nz::Vector3f(-100.f, 0.5f, 250.f), -500.f, 500.f, 16));
+				context.FlushBits();
+				CHECK(context.stream->GetCursorPos() == 9); //< 10 + 10 + 3 * 16 bits
+
+				float value;
+				Nz::Vector3f vector;
+				context.stream->SetCursorPos(0);
+				REQUIRE(UnserializeQuantized(context, &value, 0.f, 1.f, 10));
+				CHECK(value == Catch::Approx(0.3f).margin(1.f / 1023.f));
+				REQUIRE(UnserializeQuantized(context, &value, 0.f, 1.f, 10));
+				CHECK(value == Catch::Approx(1.f));
+				REQUIRE(UnserializeQuantized(context, &vector, -500.f, 500.f, 16));
+				CHECK(vector.x == Catch::Approx(-100.f).margin(0.02f));
+				CHECK(vector.y == Catch::Approx(0.5f).margin(0.02f));
+				CHECK(vector.z == Catch::Approx(250.f).margin(0.02f));
+			}
+
+			THEN("Quantized quaternions")
+			{
+				for (const Nz::Quaternionf& quaternion : { Nz::Quaternionf::Identity(), Nz::Quaternionf(Nz::EulerAnglesf(30.f, 45.f, 60.f)), Nz::Quaternionf(-0.5f, 0.5f, -0.5f, 0.5f) })
+				{
+					context.stream->SetCursorPos(0);
+					REQUIRE(SerializeQuantized(context, quaternion, 12));
+					context.FlushBits();
+					CHECK(context.stream->GetCursorPos() == 5); //< 2 + 3 * 12 bits
+
+					Nz::Quaternionf result;
+					context.stream->SetCursorPos(0);
+					context.ResetReadBitPosition();
+					REQUIRE(UnserializeQuantized(context, &result, 12));
+
+					// q and -q represent the same rotation
+					CHECK(std::abs(result.DotProduct(quaternion)) == Catch::Approx(1.f).margin(0.0001f));
+				}
+			}
+
+			THEN("Arrays")
+			{
+				std::vector<Nz::UInt16> values(300);
+				for (std::size_t i = 0; i < values.size(); ++i)
+					values[i] = static_cast<Nz::UInt16>(i * 257);
+
+				for (Nz::Endianness endianness : { Nz::Endianness::BigEndian, Nz::Endianness::LittleEndian })
+				{
+					Nz::ByteArray byteArray;
+					Nz::MemoryStream memoryStream(&byteArray, Nz::OpenMode_ReadWrite);
+
+					Nz::SerializationContext arrayContext;
+					arrayContext.stream = &memoryStream;
+					arrayContext.endianness = endianness;
+
+					REQUIRE(SerializeArray(arrayContext, values.data(), values.size()));
+					CHECK(byteArray.GetSize() == values.size() * sizeof(Nz::UInt16));
+
+					// Must match element-by-element serialization
+					Nz::UInt16 singleValue;
+					memoryStream.SetCursorPos(sizeof(Nz::UInt16) * 299);
+					REQUIRE(Unserialize(arrayContext, &singleValue));
+					CHECK(singleValue == values[299]);
+
+					std::vector<Nz::UInt16> result(values.size());
+					memoryStream.SetCursorPos(0);
+					REQUIRE(UnserializeArray(arrayContext, result.data(), result.size()));
+					CHECK(result == values);
+				}
+			}
+		}
+
 		WHEN("We serialize core classes")
 		{
 			THEN("Color")
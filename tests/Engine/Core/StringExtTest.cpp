@@ -40,6 +40,32 @@ SCENARIO("String", "[CORE][STRING]")
 	{
 		CHECK(Nz::FromUtf16String(Nz::ToUtf16String(unicodeString)) == unicodeString);
 		CHECK(Nz::FromUtf32String(Nz::ToUtf32String(unicodeString)) == unicodeString);
+
+		// Long enough to mix ASCII blocks and multibyte characters (including four bytes ones)
+		std::string mixedString(u8"Nazara Engine is a fast, complete, cross-platform engine - \u00C9t\u00E9 \u5B98\U0001F600 end");
+		CHECK(Nz::ToUtf32String(mixedString) == U"Nazara Engine is a fast, complete, cross-platform engine - \u00C9t\u00E9 \u5B98\U0001F600 end");
+		CHECK(Nz::ToUtf16String(mixedString) == u"Nazara Engine is a fast, complete, cross-platform engine - \u00C9t\u00E9 \u5B98\U0001F600 end");
+		CHECK(Nz::ComputeCharacterCount(mixedString) == 69);
+		CHECK(Nz::FromUtf16String(Nz::ToUtf16String(mixedString)) == mixedString);
+		CHECK(Nz::FromWideString(Nz::ToWideString(mixedString)) == mixedString);
+		CHECK(Nz::ToUtf32String("").empty());
+	}
+
+	WHEN("Validating UTF-8")
+	{
+		CHECK(Nz::IsValidUtf8(""));
+		CHECK(Nz::IsValidUtf8("Nazara Engine"));
+		CHECK(Nz::IsValidUtf8(unicodeString));
+		CHECK(Nz::IsValidUtf8(u8"\U0010FFFF\uD7FF"));
+
+		std::string padding(37, 'a');
+		for (const char* invalidSequence : { "\x80", "\xC0\xAF", "\xC3", "\xE2\x82", "\xED\xA0\x80", "\xF0\x82\x82\xAC", "\xF4\x90\x80\x80", "\xF8\x88\x80\x80\x80", "\xFF", "\xC3\xA9\xA9" })
+		{
+			CHECK_FALSE(Nz::IsValidUtf8(invalidSequence));
+			CHECK_FALSE(Nz::IsValidUtf8(padding + invalidSequence));
+			CHECK_FALSE(Nz::IsValidUtf8(invalidSequence + padding));
+			CHECK_FALSE(Nz::IsValidUtf8(padding + invalidSequence + padding));
+		}
 	}
 
 	WHEN("Fetching words")
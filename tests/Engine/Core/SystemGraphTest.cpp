@@ -0,0 +1,167 @@
+#include <Nazara/Core/Systems/SystemGraph.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+	struct ComponentA {};
+	struct ComponentB {};
+
+	// Only used by UpdateCounterSystem, so their storages don't exist before the system is added
+	struct CounterComponentA { unsigned int counter = 0; };
+	struct CounterComponentB { unsigned int counter = 0; };
+
+	struct ExecutionLog
+	{
+		std::mutex mutex;
+		std::vector<int> order;
+
+		void Push(int systemId)
+		{
+			std::lock_guard lock(mutex);
+			order.push_back(systemId);
+		}
+	};
+
+	template<int Id, Nz::Int64 Order, typename ComponentList>
+	struct ConcurrentSystem
+	{
+		static constexpr Nz::Int64 ExecutionOrder = Order;
+		using Components = ComponentList;
+
+		ConcurrentSystem(entt::registry& /*registry*/, ExecutionLog& executionLog) :
+		log(executionLog)
+		{
+		}
+
+		void Update(float /*elapsedTime*/)
+		{
+			log.Push(Id);
+		}
+
+		ExecutionLog& log;
+	};
+
+	template<int Id, Nz::Int64 Order>
+	struct ExclusiveSystem
+	{
+		static constexpr Nz::Int64 ExecutionOrder = Order;
+
+		ExclusiveSystem(entt::registry& /*registry*/, ExecutionLog& executionLog) :
+		log(executionLog)
+		{
+		}
+
+		void Update(float /*elapsedTime*/)
+		{
+			log.Push(Id);
+		}
+
+		ExecutionLog& log;
+	};
+
+	template<typename Component>
+	struct UpdateCounterSystem
+	{
+		using Components = Nz::TypeList<Component>;
+
+		UpdateCounterSystem(entt::registry& systemRegistry, const std::vector<entt::entity>& systemEntities) :
+		entities(systemEntities),
+		registry(systemRegistry)
+		{
+		}
+
+		void Update(float /*elapsedTime*/)
+		{
+			registry.view<Component>().each([](Component& component)
+			{
+				component.counter++;
+			});
+
+			for (entt::entity entity : entities)
+			{
+				if (!registry.all_of<Component>(entity))
+					registry.emplace<Component>(entity);
+			}
+		}
+
+		const std::vector<entt::entity>& entities;
+		entt::registry& registry;
+	};
+
+	std::size_t IndexOf(const std::vector<int>& order, int systemId)
+	{
+		return std::size_t(std::find(order.begin(), order.end(), systemId) - order.begin());
+	}
+}
+
+SCENARIO("SystemGraph", "[CORE][SYSTEMGRAPH]")
+{
+	GIVEN("A graph with concurrent and exclusive systems")
+	{
+		entt::registry registry;
+		ExecutionLog log;
+
+		Nz::SystemGraph systemGraph(registry);
+		systemGraph.AddSystem<ConcurrentSystem<0, 0, Nz::TypeList<ComponentA>>>(log);
+		systemGraph.AddSystem<ConcurrentSystem<1, 1, Nz::TypeList<const ComponentB>>>(log);
+		systemGraph.AddSystem<ConcurrentSystem<2, 2, Nz::TypeList<const ComponentA, const ComponentB>>>(log);
+		systemGraph.AddSystem<ExclusiveSystem<3, 3>>(log);
+		systemGraph.AddSystem<ConcurrentSystem<4, 4, Nz::TypeList<ComponentB>>>(log);
+
+		WHEN("We update it")
+		{
+			for (bool parallelUpdate : { false, true })
+			{
+				log.order.clear();
+
+				systemGraph.EnableParallelUpdate(parallelUpdate);
+				systemGraph.Update(0.f);
+
+				REQUIRE(log.order.size() == 5);
+
+				// System 2 reads ComponentA which is written by system 0
+				CHECK(IndexOf(log.order, 0) < IndexOf(log.order, 2));
+
+				// Exclusive systems act as a barrier
+				CHECK(IndexOf(log.order, 0) < IndexOf(log.order, 3));
+				CHECK(IndexOf(log.order, 1) < IndexOf(log.order, 3));
+				CHECK(IndexOf(log.order, 2) < IndexOf(log.order, 3));
+				CHECK(IndexOf(log.order, 3) < IndexOf(log.order, 4));
+			}
+		}
+	}
+
+	GIVEN("Two concurrent systems using component types unknown to the registry")
+	{
+		entt::registry registry;
+
+		std::vector<entt::entity> entities(1000);
+		registry.create(entities.begin(), entities.end());
+
+		Nz::SystemGraph systemGraph(registry);
+		systemGraph.AddSystem<UpdateCounterSystem<CounterComponentA>>(entities);
+		systemGraph.AddSystem<UpdateCounterSystem<CounterComponentB>>(entities);
+
+		WHEN("We update it concurrently")
+		{
+			constexpr unsigned int UpdateCount = 50;
+			for (unsigned int i = 0; i < UpdateCount; ++i)
+				systemGraph.Update(0.f);
+
+			THEN("Both systems added and updated their components")
+			{
+				CHECK(registry.view<CounterComponentA>().size() == entities.size());
+				CHECK(registry.view<CounterComponentB>().size() == entities.size());
+
+				for (entt::entity entity : entities)
+				{
+					CHECK(registry.get<CounterComponentA>(entity).counter == UpdateCount - 1);
+					CHECK(registry.get<CounterComponentB>(entity).counter == UpdateCount - 1);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,82 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <vector>
+
+namespace
+{
+	void SpawnRecursive(std::atomic_uint& executedTasks, unsigned int depth)
+	{
+		executedTasks++;
+		if (depth == 0)
+			return;
+
+		Nz::TaskCounter counter;
+		for (unsigned int i = 0; i < 4; ++i)
+			Nz::TaskScheduler::SpawnTask(counter, [&executedTasks, depth] { SpawnRecursive(executedTasks, depth - 1); });
+
+		Nz::TaskScheduler::WaitForCounter(counter);
+	}
+}
+
+SCENARIO("TaskScheduler", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("A batch of tasks")
+	{
+		std::vector<unsigned int> results(1000, 0);
+		for (unsigned int i = 0; i < results.size(); ++i)
+			Nz::TaskScheduler::AddTask([&results, i] { results[i] = i * 2; });
+
+		WHEN("We run them and wait for them")
+		{
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("Every task has been executed")
+			{
+				bool allExecuted = true;
+				for (unsigned int i = 0; i < results.size(); ++i)
+					allExecuted = allExecuted && (results[i] == i * 2);
+
+				CHECK(allExecuted);
+			}
+		}
+	}
+
+	GIVEN("Tasks spawning children tasks")
+	{
+		std::atomic_uint executedTasks = 0;
+
+		WHEN("We wait on a counter")
+		{
+			Nz::TaskCounter counter;
+			Nz::TaskScheduler::SpawnTask(counter, [&] { SpawnRecursive(executedTasks, 4); });
+			Nz::TaskScheduler::WaitForCounter(counter);
+
+			THEN("Every child task has been executed")
+			{
+				CHECK(counter.IsDone());
+				CHECK(executedTasks == 1 + 4 + 16 + 64 + 256);
+			}
+		}
+
+		WHEN("We wait for every task")
+		{
+			bool spawnedFromWorker = false;
+			Nz::TaskScheduler::SpawnTask([&]
+			{
+				spawnedFromWorker = Nz::TaskScheduler::IsWorkerThread();
+				for (unsigned int i = 0; i < 10; ++i)
+					Nz::TaskScheduler::SpawnTask([&] { executedTasks++; });
+			});
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("Child tasks were waited too")
+			{
+				CHECK(spawnedFromWorker);
+				CHECK(!Nz::TaskScheduler::IsWorkerThread());
+				CHECK(executedTasks == 10);
+			}
+		}
+	}
+}
@@ -0,0 +1,127 @@
+#include <Nazara/Graphics/FrustumCuller.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+SCENARIO("FrustumCuller", "[GRAPHICS][FRUSTUMCULLER]")
+{
+	std::mt19937 randomGenerator(2022);
+	std::uniform_real_distribution<float> positionDis(-150.f, 150.f);
+	std::uniform_real_distribution<float> sizeDis(0.1f, 20.f);
+
+	// Looking along the X axis, the frustum spans x in [1, 100] and side planes are y = +-x and z = +-x
+	Nz::Frustumf frustum = Nz::Frustumf::Build(Nz::DegreeAnglef(90.f), 1.f, 1.f, 100.f, Nz::Vector3f::Zero(), Nz::Vector3f::UnitX());
+
+	auto BoxAround = [&](const Nz::Vector3f& center)
+	{
+		float width = sizeDis(randomGenerator);
+		float height = sizeDis(randomGenerator);
+		float depth = sizeDis(randomGenerator);
+
+		return Nz::Boxf(center.x - width * 0.5f, center.y - height * 0.5f, center.z - depth * 0.5f, width, height, depth);
+	};
+
+	// Boxes too close to a plane may give a different result because of rounding, they aren't interesting for this test
+	auto IsAmbiguous = [&](const Nz::Boxf& box)
+	{
+		for (std::size_t i = 0; i < Nz::FrustumPlaneCount; ++i)
+		{
+			const Nz::Planef& plane = frustum.GetPlane(static_cast<Nz::FrustumPlane>(i));
+			if (std::abs(plane.Distance(box.GetPositiveVertex(plane.normal))) < 0.001f)
+				return true;
+		}
+
+		return false;
+	};
+
+	GIVEN("A culler filled with random boxes and boxes straddling the frustum planes")
+	{
+		std::vector<Nz::Boxf> boxes;
+		std::vector<bool> straddling;
+
+		for (std::size_t i = 0; i < 1001; ++i) //< not a multiple of the batch size
+		{
+			boxes.push_back(BoxAround(Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator))));
+			straddling.push_back(false);
+		}
+
+		std::uniform_real_distribution<float> depthDis(1.f, 100.f);
+		std::uniform_real_distribution<float> offsetDis(-1.f, 1.f);
+		for (std::size_t i = 0; i < 100; ++i)
+		{
+			float x = depthDis(randomGenerator);
+			float offset = x * offsetDis(randomGenerator) * 0.5f;
+
+			// Centers lying on the near, far, left, right, bottom and top planes
+			for (const Nz::Vector3f& center : { Nz::Vector3f(1.f, offsetDis(randomGenerator) * 0.5f, offsetDis(randomGenerator) * 0.5f),
+			                                    Nz::Vector3f(100.f, offset, -offset),
+			                                    Nz::Vector3f(x, x, offset),
+			                                    Nz::Vector3f(x, -x, offset),
+			                                    Nz::Vector3f(x, offset, x),
+			                                    Nz::Vector3f(x, offset, -x) })
+			{
+				boxes.push_back(BoxAround(center));
+				straddling.push_back(true);
+			}
+		}
+
+		Nz::FrustumCuller culler;
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+			culler.UpdateBox(i, boxes[i]);
+
+		CHECK(culler.GetBoxCount() == boxes.size());
+
+		WHEN("We cull them")
+		{
+			Nz::Bitset<Nz::UInt64> visibleBoxes;
+			culler.Cull(frustum, visibleBoxes);
+
+			THEN("Results are the same as Frustum::Contains")
+			{
+				REQUIRE(visibleBoxes.GetSize() == boxes.size());
+
+				std::size_t visibleCount = 0;
+				for (std::size_t i = 0; i < boxes.size(); ++i)
+				{
+					if (IsAmbiguous(boxes[i]))
+						continue;
+
+					bool visible = frustum.Contains(boxes[i]);
+					CHECK(visibleBoxes.Test(i) == visible);
+
+					if (straddling[i])
+						CHECK(visible);
+
+					if (visible)
+						visibleCount++;
+				}
+
+				CHECK(visibleCount > 600);
+				CHECK(visibleCount < boxes.size());
+			}
+		}
+
+		WHEN("We remove some boxes")
+		{
+			for (std::size_t i = 0; i < boxes.size(); i += 3)
+				culler.RemoveBox(i);
+
+			culler.RemoveBox(boxes.size() - 1);
+
+			Nz::Bitset<Nz::UInt64> visibleBoxes;
+			culler.Cull(frustum, visibleBoxes);
+
+			THEN("They are never reported as visible")
+			{
+				for (std::size_t i = 0; i < visibleBoxes.GetSize(); ++i)
+				{
+					if (i % 3 == 0 || i == boxes.size() - 1)
+						CHECK_FALSE(visibleBoxes.Test(i));
+					else if (!IsAmbiguous(boxes[i]))
+						CHECK(visibleBoxes.Test(i) == frustum.Contains(boxes[i]));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,190 @@
+#include <Nazara/Graphics/LightClusterGrid.hpp>
+#include <Nazara/Graphics/PredefinedShaderStructs.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+SCENARIO("LightClusterGrid", "[GRAPHICS][LIGHTCLUSTERGRID]")
+{
+	constexpr std::size_t GridSizeX = Nz::PredefinedClusteredLightData::ClusterGridSizeX;
+	constexpr std::size_t GridSizeY = Nz::PredefinedClusteredLightData::ClusterGridSizeY;
+	constexpr std::size_t GridSizeZ = Nz::PredefinedClusteredLightData::ClusterGridSizeZ;
+
+	std::mt19937 randomGenerator(2022);
+	std::uniform_real_distribution<float> ndcDis(-1.f, 1.f);
+	std::uniform_real_distribution<float> distanceDis(1.f, 100.f);
+	std::uniform_real_distribution<float> sizeDis(1.f, 20.f);
+
+	// The viewer stands at (0, 0, 10) and looks along -Z, its frustum spans view depths from 1 to 100
+	Nz::Matrix4f projectionMatrix = Nz::Matrix4f::Perspective(Nz::DegreeAnglef(90.f), 16.f / 9.f, 1.f, 100.f);
+	Nz::Matrix4f viewMatrix = Nz::Matrix4f::Translate(Nz::Vector3f(0.f, 0.f, -10.f));
+
+	Nz::Matrix4f invProjectionMatrix;
+	REQUIRE(projectionMatrix.GetInverse(&invProjectionMatrix));
+
+	Nz::Matrix4f invViewMatrix;
+	REQUIRE(viewMatrix.GetInverseTransform(&invViewMatrix));
+
+	// Picks a position in view depth range (linearly, NDC depth would gather everything close to the near plane)
+	auto RandomPosition = [&](float ndcScale)
+	{
+		Nz::Vector4f farPosition = invProjectionMatrix.Transform(Nz::Vector4f(ndcDis(randomGenerator) * ndcScale, ndcDis(randomGenerator) * ndcScale, 1.f, 1.f));
+		Nz::Vector3f viewPosition = Nz::Vector3f(farPosition.x, farPosition.y, farPosition.z) / farPosition.w;
+
+		return invViewMatrix.Transform(viewPosition * distanceDis(randomGenerator) / 100.f);
+	};
+
+	GIVEN("Random lights around the viewer frustum and a light behind the viewer")
+	{
+		std::vector<Nz::Boxf> lightBoxes;
+		for (std::size_t i = 0; i < 40; ++i)
+		{
+			Nz::Vector3f center = RandomPosition(1.2f);
+			float size = sizeDis(randomGenerator);
+
+			lightBoxes.emplace_back(center.x - size * 0.5f, center.y - size * 0.5f, center.z - size * 0.5f, size, size, size);
+		}
+
+		std::size_t hiddenLightIndex = lightBoxes.size();
+		lightBoxes.emplace_back(-5.f, -5.f, 15.f, 10.f, 10.f, 10.f);
+
+		Nz::LightClusterGrid clusterGrid;
+		clusterGrid.Build(viewMatrix, invProjectionMatrix, lightBoxes.data(), lightBoxes.size());
+
+		const auto& clusters = clusterGrid.GetClusters();
+		const auto& lightIndices = clusterGrid.GetLightIndices();
+
+		THEN("Clusters reference contiguous ranges of the light index list")
+		{
+			REQUIRE(clusters.size() == Nz::PredefinedClusteredLightData::ClusterCount);
+
+			// Light index list must not have been truncated for the following checks to be meaningful
+			REQUIRE(lightIndices.size() < Nz::PredefinedClusteredLightData::MaxLightIndexCount);
+
+			std::size_t expectedFirstIndex = 0;
+			for (const Nz::LightClusterGrid::Cluster& cluster : clusters)
+			{
+				CHECK(cluster.firstLightIndex == expectedFirstIndex);
+				CHECK(cluster.lightCount <= Nz::LightClusterGrid::MaxLightPerCluster);
+				expectedFirstIndex += cluster.lightCount;
+			}
+
+			CHECK(expectedFirstIndex == lightIndices.size());
+			CHECK(std::all_of(lightIndices.begin(), lightIndices.end(), [&](Nz::UInt32 lightIndex) { return lightIndex < lightBoxes.size(); }));
+		}
+
+		THEN("The light behind the viewer isn't assigned to any cluster")
+		{
+			CHECK(std::find(lightIndices.begin(), lightIndices.end(), hiddenLightIndex) == lightIndices.end());
+		}
+
+		THEN("Every light containing a point is listed in the cluster shaders pick for that point")
+		{
+			const Nz::Vector2f& depthRange = clusterGrid.GetDepthRange();
+
+			std::size_t checkedLightCount = 0;
+			for (std::size_t i = 0; i < 10'000; ++i)
+			{
+				Nz::Vector3f position = RandomPosition(1.f);
+
+				// Same computation as in the forward shaders
+				Nz::Vector3f viewPosition = viewMatrix.Transform(position);
+				Nz::Vector4f clipPosition = projectionMatrix.Transform(Nz::Vector4f(viewPosition.x, viewPosition.y, viewPosition.z, 1.f));
+
+				float depthFactor = (viewPosition.z - depthRange.x) / (depthRange.y - depthRange.x);
+				Nz::Vector3f clusterPosition((clipPosition.x / clipPosition.w) * 0.5f + 0.5f, (clipPosition.y / clipPosition.w) * 0.5f + 0.5f, std::sqrt(std::max(depthFactor, 0.f)));
+				clusterPosition *= Nz::Vector3f(float(GridSizeX), float(GridSizeY), float(GridSizeZ));
+
+				// Points lying on a cluster boundary may end up in the neighbor cluster because of rounding
+				auto IsOnBoundary = [](float value)
+				{
+					return std::abs(value - std::round(value)) < 0.001f;
+				};
+
+				if (IsOnBoundary(clusterPosition.x) || IsOnBoundary(clusterPosition.y) || IsOnBoundary(clusterPosition.z))
+					continue;
+
+				std::size_t clusterX = std::min(std::size_t(std::max(clusterPosition.x, 0.f)), GridSizeX - 1);
+				std::size_t clusterY = std::min(std::size_t(std::max(clusterPosition.y, 0.f)), GridSizeY - 1);
+				std::size_t clusterZ = std::min(std::size_t(std::max(clusterPosition.z, 0.f)), GridSizeZ - 1);
+
+				const Nz::LightClusterGrid::Cluster& cluster = clusters[clusterX + (clusterY + clusterZ * GridSizeY) * GridSizeX];
+				auto clusterBegin = lightIndices.begin() + cluster.firstLightIndex;
+				auto clusterEnd = clusterBegin + cluster.lightCount;
+
+				for (std::size_t lightIndex = 0; lightIndex < lightBoxes.size(); ++lightIndex)
+				{
+					// Shrink the light box a bit to ignore points lying on its boundary
+					const Nz::Boxf& lightBox = lightBoxes[lightIndex];
+					Nz::Boxf innerBox(lightBox.x + 0.01f, lightBox.y + 0.01f, lightBox.z + 0.01f, lightBox.width - 0.02f, lightBox.height - 0.02f, lightBox.depth - 0.02f);
+
+					if (!innerBox.Contains(position))
+						continue;
+
+					CHECK(std::find(clusterBegin, clusterEnd, lightIndex) != clusterEnd);
+					checkedLightCount++;
+				}
+			}
+
+			CHECK(checkedLightCount > 100);
+		}
+	}
+	GIVEN("More lights around a point than a cluster can hold")
+	{
+		constexpr std::size_t ClusterX = 8;
+		constexpr std::size_t ClusterY = 4;
+		constexpr std::size_t ClusterZ = 10;
+
+		std::vector<Nz::Boxf> lightBoxes;
+
+		Nz::LightClusterGrid clusterGrid;
+		clusterGrid.Build(viewMatrix, invProjectionMatrix, lightBoxes.data(), lightBoxes.size());
+
+		CHECK(clusterGrid.GetDroppedLightCount() == 0);
+
+		// Pick the center of a cluster, following the same distribution as shaders
+		const Nz::Vector2f& depthRange = clusterGrid.GetDepthRange();
+		auto GetSliceDepth = [&](float sliceIndex)
+		{
+			float sliceFactor = sliceIndex / GridSizeZ;
+			return depthRange.x + (depthRange.y - depthRange.x) * sliceFactor * sliceFactor;
+		};
+
+		float ndcX = -1.f + 2.f * (ClusterX + 0.5f) / GridSizeX;
+		float ndcY = -1.f + 2.f * (ClusterY + 0.5f) / GridSizeY;
+		float viewDepth = (GetSliceDepth(ClusterZ) + GetSliceDepth(ClusterZ + 1)) * 0.5f;
+
+		Nz::Vector4f farPosition = invProjectionMatrix.Transform(Nz::Vector4f(ndcX, ndcY, 1.f, 1.f));
+		Nz::Vector3f viewPosition = Nz::Vector3f(farPosition.x, farPosition.y, farPosition.z) / farPosition.w;
+		Nz::Vector3f clusterCenter = invViewMatrix.Transform(viewPosition * (viewDepth / viewPosition.z));
+
+		// Lights barely reaching the cluster center are registered first, they should be replaced by the ones centered on it
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			Nz::Vector3f center = clusterCenter + Nz::Vector3f(1.9f, 0.f, 0.f);
+			lightBoxes.emplace_back(center.x - 2.f, center.y - 2.f, center.z - 2.f, 4.f, 4.f, 4.f);
+		}
+
+		std::size_t firstCenteredLightIndex = lightBoxes.size();
+		for (std::size_t i = 0; i < Nz::LightClusterGrid::MaxLightPerCluster; ++i)
+			lightBoxes.emplace_back(clusterCenter.x - 2.f, clusterCenter.y - 2.f, clusterCenter.z - 2.f, 4.f, 4.f, 4.f);
+
+		clusterGrid.Build(viewMatrix, invProjectionMatrix, lightBoxes.data(), lightBoxes.size());
+
+		THEN("The cluster only keeps the most significant lights and reports the others")
+		{
+			const auto& lightIndices = clusterGrid.GetLightIndices();
+			const Nz::LightClusterGrid::Cluster& cluster = clusterGrid.GetClusters()[ClusterX + (ClusterY + ClusterZ * GridSizeY) * GridSizeX];
+			REQUIRE(cluster.lightCount == Nz::LightClusterGrid::MaxLightPerCluster);
+
+			auto clusterBegin = lightIndices.begin() + cluster.firstLightIndex;
+			auto clusterEnd = clusterBegin + cluster.lightCount;
+			CHECK(std::all_of(clusterBegin, clusterEnd, [&](Nz::UInt32 lightIndex) { return lightIndex >= firstCenteredLightIndex; }));
+
+			CHECK(clusterGrid.GetDroppedLightCount() >= 16);
+		}
+	}
+}
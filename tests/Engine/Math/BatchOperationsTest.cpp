@@ -0,0 +1,206 @@
+#include <Nazara/Math/BatchOperations.hpp>
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	bool ApproxEqual(const Nz::Vector3f& lhs, const Nz::Vector3f& rhs)
+	{
+		return lhs.x == Catch::Approx(rhs.x).margin(0.001f) && lhs.y == Catch::Approx(rhs.y).margin(0.001f) && lhs.z == Catch::Approx(rhs.z).margin(0.001f);
+	}
+
+	bool ApproxEqual(const Nz::Quaternionf& lhs, const Nz::Quaternionf& rhs)
+	{
+		return lhs.w == Catch::Approx(rhs.w).margin(0.0001f) && lhs.x == Catch::Approx(rhs.x).margin(0.0001f) && lhs.y == Catch::Approx(rhs.y).margin(0.0001f) && lhs.z == Catch::Approx(rhs.z).margin(0.0001f);
+	}
+
+	bool ApproxEqual(const Nz::Matrix4f& lhs, const Nz::Matrix4f& rhs)
+	{
+		for (std::size_t i = 0; i < 16; ++i)
+		{
+			if ((&lhs.m11)[i] != Catch::Approx((&rhs.m11)[i]).margin(0.001f))
+				return false;
+		}
+
+		return true;
+	}
+}
+
+SCENARIO("BatchOperations", "[MATH][BATCHOPERATIONS]")
+{
+	std::mt19937 randomGenerator(1337);
+	std::uniform_real_distribution<float> dis(-100.f, 100.f);
+
+	GIVEN("A transform matrix and some positions")
+	{
+		Nz::Matrix4f matrix = Nz::Matrix4f::Transform(Nz::Vector3f(1.f, -2.f, 3.f), Nz::EulerAnglesf(30.f, 45.f, -60.f), Nz::Vector3f(2.f, 0.5f, 1.f));
+
+		// Odd count to exercise the scalar tail
+		std::vector<Nz::Vector3f> positions(37);
+		for (Nz::Vector3f& position : positions)
+			position.Set(dis(randomGenerator), dis(randomGenerator), dis(randomGenerator));
+
+		WHEN("We transform them as an array of structures")
+		{
+			std::vector<Nz::Vector3f> transformedPositions(positions.size());
+			Nz::TransformPositions(matrix, Nz::SparsePtr<const Nz::Vector3f>(positions.data()), Nz::SparsePtr<Nz::Vector3f>(transformedPositions.data()), positions.size());
+
+			std::vector<Nz::Vector3f> transformedDirections(positions.size());
+			Nz::TransformDirections(matrix, Nz::SparsePtr<const Nz::Vector3f>(positions.data()), Nz::SparsePtr<Nz::Vector3f>(transformedDirections.data()), positions.size());
+
+			THEN("We get the same results as Matrix4::Transform")
+			{
+				for (std::size_t i = 0; i < positions.size(); ++i)
+				{
+					CHECK(ApproxEqual(transformedPositions[i], matrix.Transform(positions[i])));
+					CHECK(ApproxEqual(transformedDirections[i], matrix.Transform(positions[i], 0.f)));
+				}
+			}
+		}
+
+		WHEN("We transform them in place with a stride")
+		{
+			struct Vertex
+			{
+				Nz::Vector3f position;
+				Nz::Vector2f uv;
+			};
+
+			std::vector<Vertex> vertices(positions.size());
+			for (std::size_t i = 0; i < positions.size(); ++i)
+				vertices[i].position = positions[i];
+
+			Nz::SparsePtr<Nz::Vector3f> vertexPositions(&vertices[0].position, sizeof(Vertex));
+			Nz::TransformPositions(matrix, Nz::SparsePtr<const Nz::Vector3f>(vertexPositions), vertexPositions, vertices.size());
+
+			THEN("Only positions are transformed")
+			{
+				for (std::size_t i = 0; i < positions.size(); ++i)
+				{
+					CHECK(ApproxEqual(vertices[i].position, matrix.Transform(positions[i])));
+					CHECK(vertices[i].uv == Nz::Vector2f::Zero());
+				}
+			}
+		}
+
+		WHEN("We transform them as a structure of arrays")
+		{
+			std::vector<float> x(positions.size()), y(positions.size()), z(positions.size());
+			for (std::size_t i = 0; i < positions.size(); ++i)
+			{
+				x[i] = positions[i].x;
+				y[i] = positions[i].y;
+				z[i] = positions[i].z;
+			}
+
+			Nz::TransformPositions(matrix, x.data(), y.data(), z.data(), x.data(), y.data(), z.data(), positions.size());
+
+			THEN("We get the same results as Matrix4::Transform")
+			{
+				for (std::size_t i = 0; i < positions.size(); ++i)
+					CHECK(ApproxEqual(Nz::Vector3f(x[i], y[i], z[i]), matrix.Transform(positions[i])));
+			}
+		}
+
+		WHEN("We transform double positions")
+		{
+			Nz::Matrix4d matrixD(matrix);
+			std::vector<Nz::Vector3d> positionsD(positions.begin(), positions.end());
+			Nz::TransformPositions(matrixD, Nz::SparsePtr<const Nz::Vector3d>(positionsD.data()), Nz::SparsePtr<Nz::Vector3d>(positionsD.data()), positionsD.size());
+
+			THEN("The scalar fallback is used")
+			{
+				for (std::size_t i = 0; i < positions.size(); ++i)
+					CHECK(positionsD[i] == matrixD.Transform(Nz::Vector3d(positions[i])));
+			}
+		}
+	}
+
+	GIVEN("Pairs of matrices")
+	{
+		std::vector<Nz::Matrix4f> left(10);
+		std::vector<Nz::Matrix4f> right(10);
+		for (std::size_t i = 0; i < left.size(); ++i)
+		{
+			left[i] = Nz::Matrix4f::Transform(Nz::Vector3f(dis(randomGenerator), dis(randomGenerator), dis(randomGenerator)), Nz::EulerAnglesf(dis(randomGenerator), dis(randomGenerator), dis(randomGenerator)));
+			right[i] = Nz::Matrix4f::Perspective(Nz::DegreeAnglef(70.f), 16.f / 9.f, 0.1f, 1000.f) * Nz::Matrix4f::Translate(Nz::Vector3f(dis(randomGenerator), 0.f, 0.f));
+		}
+
+		WHEN("We concatenate them")
+		{
+			std::vector<Nz::Matrix4f> result(left.size());
+			Nz::ConcatenateMatrices(Nz::SparsePtr<const Nz::Matrix4f>(left.data()), Nz::SparsePtr<const Nz::Matrix4f>(right.data()), Nz::SparsePtr<Nz::Matrix4f>(result.data()), left.size());
+
+			THEN("We get the same results as Matrix4::Concatenate")
+			{
+				for (std::size_t i = 0; i < left.size(); ++i)
+					CHECK(ApproxEqual(result[i], Nz::Matrix4f::Concatenate(left[i], right[i])));
+			}
+
+			AND_WHEN("We concatenate them in place")
+			{
+				Nz::ConcatenateMatrices(Nz::SparsePtr<const Nz::Matrix4f>(left.data()), Nz::SparsePtr<const Nz::Matrix4f>(right.data()), Nz::SparsePtr<Nz::Matrix4f>(left.data()), left.size());
+
+				THEN("Results are the same")
+				{
+					for (std::size_t i = 0; i < left.size(); ++i)
+						CHECK(left[i] == result[i]);
+				}
+			}
+		}
+	}
+
+	GIVEN("Pairs of quaternions")
+	{
+		std::vector<Nz::Quaternionf> from(11);
+		std::vector<Nz::Quaternionf> to(11);
+		std::vector<float> interpolation(11);
+
+		std::uniform_real_distribution<float> interpolationDis(0.f, 1.f);
+		for (std::size_t i = 0; i < from.size(); ++i)
+		{
+			from[i] = Nz::EulerAnglesf(dis(randomGenerator), dis(randomGenerator), dis(randomGenerator)).ToQuaternion();
+			to[i] = Nz::EulerAnglesf(dis(randomGenerator), dis(randomGenerator), dis(randomGenerator)).ToQuaternion();
+			interpolation[i] = interpolationDis(randomGenerator);
+		}
+
+		// Opposite hemisphere, same quaternions and bounds
+		to[0] = Nz::Quaternionf(-from[0].w, -from[0].x, -from[0].y, -from[0].z);
+		to[1] = from[1];
+		interpolation[2] = 0.f;
+		interpolation[3] = 1.f;
+
+		WHEN("We interpolate them")
+		{
+			std::vector<Nz::Quaternionf> result(from.size());
+			Nz::SlerpQuaternions(Nz::SparsePtr<const Nz::Quaternionf>(from.data()), Nz::SparsePtr<const Nz::Quaternionf>(to.data()), Nz::SparsePtr<const float>(interpolation.data()), Nz::SparsePtr<Nz::Quaternionf>(result.data()), from.size());
+
+			THEN("We get the same results as Quaternion::Slerp")
+			{
+				for (std::size_t i = 0; i < from.size(); ++i)
+					CHECK(ApproxEqual(result[i], Nz::Quaternionf::Slerp(from[i], to[i], interpolation[i])));
+			}
+		}
+
+		WHEN("We interpolate them with the same factor")
+		{
+			std::vector<Nz::Quaternionf> original = from;
+
+			float factor = 0.25f;
+			Nz::SlerpQuaternions(Nz::SparsePtr<const Nz::Quaternionf>(from.data()), Nz::SparsePtr<const Nz::Quaternionf>(to.data()), Nz::SparsePtr<const float>(&factor, 0), Nz::SparsePtr<Nz::Quaternionf>(from.data()), 6);
+
+			THEN("The factor is shared by all pairs and the output can alias the input")
+			{
+				for (std::size_t i = 0; i < 6; ++i)
+					CHECK(ApproxEqual(from[i], Nz::Quaternionf::Slerp(original[i], to[i], factor)));
+
+				for (std::size_t i = 6; i < from.size(); ++i)
+					CHECK(from[i] == original[i]);
+			}
+		}
+	}
+}
@@ -0,0 +1,177 @@
+#include <Nazara/Math/BoundingVolumeHierarchy.hpp>
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+SCENARIO("BoundingVolumeHierarchy", "[MATH][BOUNDINGVOLUMEHIERARCHY]")
+{
+	std::mt19937 randomGenerator(1337);
+	std::uniform_real_distribution<float> positionDis(-100.f, 100.f);
+	std::uniform_real_distribution<float> sizeDis(0.1f, 5.f);
+
+	auto RandomBox = [&]
+	{
+		return Nz::Boxf(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator), sizeDis(randomGenerator), sizeDis(randomGenerator), sizeDis(randomGenerator));
+	};
+
+	GIVEN("An empty tree")
+	{
+		Nz::BoundingVolumeHierarchyf tree;
+
+		THEN("Queries report nothing")
+		{
+			std::size_t reportCount = 0;
+			tree.QueryBox(Nz::Boxf(-1000.f, -1000.f, -1000.f, 2000.f, 2000.f, 2000.f), [&](std::size_t) { reportCount++; });
+			tree.QuerySphere(Nz::Spheref(Nz::Vector3f::Zero(), 1000.f), [&](std::size_t) { reportCount++; });
+
+			CHECK(reportCount == 0);
+			CHECK(tree.GetHeight() == 0);
+			CHECK(tree.GetLeafCount() == 0);
+		}
+	}
+
+	GIVEN("A tree filled with random boxes")
+	{
+		Nz::BoundingVolumeHierarchyf tree(0.5f);
+
+		std::vector<Nz::Boxf> boxes(1000);
+		std::vector<std::size_t> leaves(boxes.size());
+		for (std::size_t i = 0; i < boxes.size(); ++i)
+		{
+			boxes[i] = RandomBox();
+			leaves[i] = tree.Insert(boxes[i], i);
+		}
+
+		// Brute force reference using the same fat boxes as the tree
+		auto CheckQuery = [&](auto&& query, auto&& reference)
+		{
+			std::vector<std::size_t> reported;
+			query([&](std::size_t userData) { reported.push_back(userData); });
+			std::sort(reported.begin(), reported.end());
+
+			std::vector<std::size_t> expected;
+			for (std::size_t i = 0; i < leaves.size(); ++i)
+			{
+				if (leaves[i] != tree.InvalidIndex && reference(tree.GetFatBox(leaves[i])))
+					expected.push_back(i);
+			}
+
+			CHECK(reported == expected);
+		};
+
+		auto CheckAllQueries = [&]
+		{
+			Nz::Boxf queryBox(-20.f, -30.f, -10.f, 50.f, 40.f, 60.f);
+			CheckQuery([&](auto&& callback) { tree.QueryBox(queryBox, callback); }, [&](const Nz::Boxf& box) { return queryBox.Intersect(box); });
+
+			Nz::Spheref querySphere(10.f, -5.f, 20.f, 35.f);
+			CheckQuery([&](auto&& callback) { tree.QuerySphere(querySphere, callback); }, [&](const Nz::Boxf& box) { return querySphere.Intersect(box); });
+
+			Nz::Rayf queryRay(Nz::Vector3f(-150.f, 3.f, -2.f), Nz::Vector3f(1.f, 0.05f, 0.02f).GetNormal());
+			CheckQuery([&](auto&& callback) { tree.QueryRay(queryRay, callback); }, [&](const Nz::Boxf& box) { return queryRay.Intersect(box); });
+
+			Nz::Matrix4f viewProj = Nz::Matrix4f::Concatenate(Nz::Matrix4f::TransformInverse(Nz::Vector3f(0.f, 0.f, 50.f), Nz::EulerAnglesf(0.f, 20.f, 0.f)), Nz::Matrix4f::Perspective(Nz::DegreeAnglef(70.f), 16.f / 9.f, 1.f, 120.f));
+			Nz::Frustumf queryFrustum = Nz::Frustumf::Extract(viewProj);
+			CheckQuery([&](auto&& callback) { tree.QueryFrustum(queryFrustum, callback); }, [&](const Nz::Boxf& box) { return queryFrustum.Intersect(box) != Nz::IntersectionSide::Outside; });
+		};
+
+		THEN("Every leaf contains its box and queries match a brute force test")
+		{
+			CHECK(tree.GetLeafCount() == boxes.size());
+			for (std::size_t i = 0; i < boxes.size(); ++i)
+			{
+				CHECK(tree.GetFatBox(leaves[i]).Contains(boxes[i]));
+				CHECK(tree.GetUserData(leaves[i]) == i);
+			}
+
+			CheckAllQueries();
+		}
+
+		THEN("The tree is balanced")
+		{
+			CHECK(tree.GetHeight() <= 20);
+		}
+
+		WHEN("We move boxes")
+		{
+			std::uniform_real_distribution<float> smallMoveDis(-0.2f, 0.2f);
+
+			std::size_t reinsertedCount = 0;
+			for (std::size_t i = 0; i < boxes.size(); ++i)
+			{
+				if (i % 2 == 0)
+				{
+					// Small displacement, should stay in the fat box
+					boxes[i].x += smallMoveDis(randomGenerator);
+					boxes[i].y += smallMoveDis(randomGenerator);
+					boxes[i].z += smallMoveDis(randomGenerator);
+				}
+				else
+					boxes[i] = RandomBox();
+
+				if (tree.Move(leaves[i], boxes[i]))
+					reinsertedCount++;
+			}
+
+			THEN("Only boxes leaving their fat box are reinserted")
+			{
+				CHECK(reinsertedCount <= boxes.size() / 2 + 1);
+				CHECK(reinsertedCount >= boxes.size() / 4);
+
+				for (std::size_t i = 0; i < boxes.size(); ++i)
+					CHECK(tree.GetFatBox(leaves[i]).Contains(boxes[i]));
+
+				CheckAllQueries();
+			}
+		}
+
+		WHEN("We remove some boxes")
+		{
+			for (std::size_t i = 0; i < leaves.size(); i += 3)
+			{
+				tree.Remove(leaves[i]);
+				leaves[i] = tree.InvalidIndex;
+			}
+
+			THEN("They are no longer reported")
+			{
+				CHECK(tree.GetLeafCount() == boxes.size() - (boxes.size() + 2) / 3);
+				CheckAllQueries();
+			}
+
+			AND_WHEN("We insert new boxes")
+			{
+				for (std::size_t i = 0; i < leaves.size(); i += 3)
+				{
+					boxes[i] = RandomBox();
+					leaves[i] = tree.Insert(boxes[i], i);
+				}
+
+				THEN("Removed nodes are reused")
+				{
+					CHECK(tree.GetLeafCount() == boxes.size());
+					CheckAllQueries();
+				}
+			}
+		}
+
+		WHEN("We remove every box")
+		{
+			for (std::size_t leafIndex : leaves)
+				tree.Remove(leafIndex);
+
+			THEN("The tree is empty")
+			{
+				CHECK(tree.GetLeafCount() == 0);
+				CHECK(tree.GetHeight() == 0);
+
+				std::size_t reportCount = 0;
+				tree.QueryBox(Nz::Boxf(-1000.f, -1000.f, -1000.f, 2000.f, 2000.f, 2000.f), [&](std::size_t) { reportCount++; });
+				CHECK(reportCount == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,214 @@
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/Skeleton.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+SCENARIO("Skinning", "[UTILITY][SKINNING]")
+{
+	std::mt19937 randomGenerator(2022);
+	std::uniform_real_distribution<float> positionDis(-10.f, 10.f);
+	std::uniform_real_distribution<float> angleDis(-180.f, 180.f);
+	std::uniform_real_distribution<float> weightDis(0.f, 1.f);
+
+	auto CheckVector = [](const Nz::Vector3f& lhs, const Nz::Vector3f& rhs)
+	{
+		CHECK(lhs.x == Catch::Approx(rhs.x).margin(0.001));
+		CHECK(lhs.y == Catch::Approx(rhs.y).margin(0.001));
+		CHECK(lhs.z == Catch::Approx(rhs.z).margin(0.001));
+	};
+
+	GIVEN("A skinned mesh with a random skeleton")
+	{
+		constexpr std::size_t JointCount = 16;
+		constexpr Nz::UInt32 VertexCount = 10'001; //< odd and big enough to be split between workers
+
+		Nz::Skeleton skeleton;
+		skeleton.Create(JointCount);
+
+		Nz::Joint* joints = skeleton.GetJoints();
+		for (std::size_t i = 0; i < JointCount; ++i)
+		{
+			if (i > 0)
+				joints[i].SetParent(joints[i / 2]);
+
+			joints[i].SetInverseBindMatrix(Nz::Matrix4f::Identity());
+			joints[i].SetPosition(Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator)));
+			joints[i].SetRotation(Nz::EulerAnglesf(angleDis(randomGenerator), angleDis(randomGenerator), angleDis(randomGenerator)));
+		}
+
+		std::vector<Nz::Vector3f> inputPositions(VertexCount);
+		std::vector<Nz::Vector3f> inputNormals(VertexCount);
+		std::vector<Nz::Vector3f> inputTangents(VertexCount);
+		std::vector<Nz::Vector2f> inputUv(VertexCount);
+		std::vector<Nz::Vector4i32> jointIndices(VertexCount);
+		std::vector<Nz::Vector4f> jointWeights(VertexCount);
+		for (Nz::UInt32 i = 0; i < VertexCount; ++i)
+		{
+			inputPositions[i] = Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator));
+			inputNormals[i] = Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator)).GetNormal();
+			inputTangents[i] = Nz::Vector3f(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator)).GetNormal();
+			inputUv[i] = Nz::Vector2f(weightDis(randomGenerator), weightDis(randomGenerator));
+
+			for (std::size_t j = 0; j < 4; ++j)
+			{
+				jointIndices[i][j] = std::uniform_int_distribution<Nz::Int32>(0, JointCount - 1)(randomGenerator);
+				jointWeights[i][j] = weightDis(randomGenerator);
+			}
+
+			jointWeights[i] /= jointWeights[i].x + jointWeights[i].y + jointWeights[i].z + jointWeights[i].w;
+		}
+
+		std::vector<Nz::Vector3f> outputPositions(VertexCount);
+		std::vector<Nz::Vector3f> outputNormals(VertexCount);
+		std::vector<Nz::Vector3f> outputTangents(VertexCount);
+		std::vector<Nz::Vector2f> outputUv(VertexCount);
+
+		Nz::SkinningData skinningData;
+		skinningData.joints = joints;
+		skinningData.inputJointIndices = jointIndices.data();
+		skinningData.inputJointWeights = jointWeights.data();
+		skinningData.inputNormals = inputNormals.data();
+		skinningData.inputPositions = inputPositions.data();
+		skinningData.inputTangents = inputTangents.data();
+		skinningData.inputUv = inputUv.data();
+		skinningData.outputNormals = outputNormals.data();
+		skinningData.outputPositions = outputPositions.data();
+		skinningData.outputTangents = outputTangents.data();
+		skinningData.outputUv = outputUv.data();
+
+		WHEN("We apply linear blend skinning with every implementation supported by the processor")
+		{
+			std::vector<std::pair<Nz::SkinningImplementation, const char*>> implementations = {
+				{ Nz::SkinningImplementation::Auto, "Auto" },
+				{ Nz::SkinningImplementation::Scalar, "Scalar" }
+			};
+
+#if defined(NAZARA_PLATFORM_x64)
+			implementations.emplace_back(Nz::SkinningImplementation::SSE, "SSE");
+			if (Nz::Core::Instance()->GetHardwareInfo().HasCapability(Nz::ProcessorCap::AVX))
+				implementations.emplace_back(Nz::SkinningImplementation::AVX, "AVX");
+#endif
+
+			THEN("Every vertex matches the weighted sum of its joint transformations")
+			{
+				for (auto&& [implementation, implementationName] : implementations)
+				{
+					INFO("Skinning with " << implementationName << " implementation");
+
+					std::fill(outputPositions.begin(), outputPositions.end(), Nz::Vector3f::Zero());
+					std::fill(outputNormals.begin(), outputNormals.end(), Nz::Vector3f::Zero());
+					std::fill(outputTangents.begin(), outputTangents.end(), Nz::Vector3f::Zero());
+
+					Nz::SkinLinearBlend(skinningData, 0, VertexCount, implementation);
+
+					for (Nz::UInt32 i = 0; i < VertexCount; ++i)
+					{
+						Nz::Vector3f expectedPosition = Nz::Vector3f::Zero();
+						Nz::Vector3f expectedNormal = Nz::Vector3f::Zero();
+						Nz::Vector3f expectedTangent = Nz::Vector3f::Zero();
+						for (std::size_t j = 0; j < 4; ++j)
+						{
+							const Nz::Matrix4f& skinningMatrix = joints[jointIndices[i][j]].GetSkinningMatrix();
+							float weight = jointWeights[i][j];
+
+							expectedPosition += skinningMatrix.Transform(inputPositions[i]) * weight;
+							expectedNormal += skinningMatrix.Transform(inputNormals[i], 0.f) * weight;
+							expectedTangent += skinningMatrix.Transform(inputTangents[i], 0.f) * weight;
+						}
+
+						CheckVector(outputPositions[i], expectedPosition);
+						CheckVector(outputNormals[i], expectedNormal.GetNormal());
+						CheckVector(outputTangents[i], expectedTangent.GetNormal());
+						CHECK(outputUv[i] == inputUv[i]);
+					}
+				}
+			}
+		}
+
+		WHEN("Each vertex is bound to a single joint")
+		{
+			for (Nz::UInt32 i = 0; i < VertexCount; ++i)
+				jointWeights[i] = Nz::Vector4f(1.f, 0.f, 0.f, 0.f);
+
+			Nz::SkinLinearBlend(skinningData, 0, VertexCount);
+
+			std::vector<Nz::Vector3f> linearPositions = outputPositions;
+			std::vector<Nz::Vector3f> linearNormals = outputNormals;
+
+			Nz::SkinDualQuaternionBlend(skinningData, 0, VertexCount);
+
+			THEN("Dual quaternion skinning gives the same result as linear blend skinning")
+			{
+				for (Nz::UInt32 i = 0; i < VertexCount; ++i)
+				{
+					CheckVector(outputPositions[i], linearPositions[i]);
+					CheckVector(outputNormals[i], linearNormals[i]);
+				}
+			}
+		}
+
+		WHEN("We only skin a part of the mesh")
+		{
+			Nz::SkinLinearBlend(skinningData, 100, 3);
+
+			THEN("Other vertices are left untouched")
+			{
+				CHECK(outputPositions[99] == Nz::Vector3f::Zero());
+				CHECK(outputPositions[100] != Nz::Vector3f::Zero());
+				CHECK(outputPositions[102] != Nz::Vector3f::Zero());
+				CHECK(outputPositions[103] == Nz::Vector3f::Zero());
+			}
+		}
+	}
+
+	GIVEN("A vertex evenly weighted between two joints twisted in opposite directions")
+	{
+		Nz::Skeleton skeleton;
+		skeleton.Create(2);
+
+		Nz::Joint* joints = skeleton.GetJoints();
+		joints[0].SetInverseBindMatrix(Nz::Matrix4f::Identity());
+		joints[1].SetInverseBindMatrix(Nz::Matrix4f::Identity());
+		joints[0].SetRotation(Nz::EulerAnglesf(80.f, 0.f, 0.f));
+		joints[1].SetRotation(Nz::EulerAnglesf(-80.f, 0.f, 0.f));
+
+		Nz::Vector3f inputPosition(0.f, 1.f, 0.f);
+		Nz::Vector4i32 jointIndices(0, 1, 0, 0);
+		Nz::Vector4f jointWeights(0.5f, 0.5f, 0.f, 0.f);
+		Nz::Vector3f outputPosition;
+
+		Nz::SkinningData skinningData = {};
+		skinningData.joints = joints;
+		skinningData.inputJointIndices = &jointIndices;
+		skinningData.inputJointWeights = &jointWeights;
+		skinningData.inputPositions = &inputPosition;
+		skinningData.outputPositions = &outputPosition;
+
+		WHEN("We apply linear blend skinning")
+		{
+			Nz::SkinLinearBlend(skinningData, 0, 1);
+
+			THEN("The vertex collapses toward the twist axis")
+			{
+				CHECK(outputPosition.GetLength() < 0.5f);
+			}
+		}
+
+		WHEN("We apply dual quaternion skinning")
+		{
+			Nz::SkinDualQuaternionBlend(skinningData, 0, 1);
+
+			THEN("The vertex keeps its distance to the twist axis")
+			{
+				CHECK(outputPosition.GetLength() == Catch::Approx(1.f));
+				CheckVector(outputPosition, inputPosition);
+			}
+		}
+	}
+}
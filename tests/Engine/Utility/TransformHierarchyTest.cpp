@@ -0,0 +1,275 @@
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+SCENARIO("TransformHierarchy", "[UTILITY][TRANSFORMHIERARCHY]")
+{
+	std::mt19937 randomGenerator(1337);
+	std::uniform_real_distribution<float> positionDis(-10.f, 10.f);
+	std::uniform_real_distribution<float> angleDis(-180.f, 180.f);
+	std::uniform_real_distribution<float> scaleDis(0.5f, 2.f);
+
+	auto RandomRotation = [&]
+	{
+		return Nz::Quaternionf(Nz::EulerAnglesf(angleDis(randomGenerator), angleDis(randomGenerator), angleDis(randomGenerator)));
+	};
+
+	auto CheckMatrix = [](const Nz::Matrix4f& lhs, const Nz::Matrix4f& rhs)
+	{
+		for (std::size_t i = 0; i < 16; ++i)
+			CHECK(lhs[i] == Catch::Approx(rhs[i]).margin(0.001));
+	};
+
+	GIVEN("A hierarchy mirroring a node tree")
+	{
+		// Build a random tree where each node parent is a previous node (so we can get deep chains)
+		constexpr std::size_t NodeCount = 200;
+
+		Nz::TransformHierarchy hierarchy;
+		std::vector<std::unique_ptr<Nz::Node>> nodes;
+		std::vector<std::size_t> nodeIndices;
+
+		for (std::size_t i = 0; i < NodeCount; ++i)
+		{
+			std::size_t parent = (i > 0) ? std::uniform_int_distribution<std::size_t>(std::max<std::size_t>(i, 5) - 5, i - 1)(randomGenerator) : Nz::TransformHierarchy::InvalidNodeIndex;
+			if (i % 17 == 0)
+				parent = Nz::TransformHierarchy::InvalidNodeIndex; //< a few roots
+
+			auto& node = nodes.emplace_back(std::make_unique<Nz::Node>());
+			nodeIndices.push_back(hierarchy.CreateNode((parent != Nz::TransformHierarchy::InvalidNodeIndex) ? nodeIndices[parent] : Nz::TransformHierarchy::InvalidNodeIndex));
+			if (parent != Nz::TransformHierarchy::InvalidNodeIndex)
+				node->SetParent(*nodes[parent]);
+
+			Nz::Vector3f position(positionDis(randomGenerator), positionDis(randomGenerator), positionDis(randomGenerator));
+			Nz::Quaternionf rotation = RandomRotation();
+			Nz::Vector3f scale(scaleDis(randomGenerator), scaleDis(randomGenerator), scaleDis(randomGenerator));
+
+			node->SetPosition(position);
+			node->SetRotation(rotation);
+			node->SetScale(scale);
+			hierarchy.SetLocalTransform(nodeIndices[i], position, rotation, scale);
+
+			if (i % 7 == 3)
+			{
+				node->SetInheritScale(false);
+				hierarchy.SetInheritance(nodeIndices[i], true, true, false);
+			}
+		}
+
+		auto CheckAll = [&]
+		{
+			for (std::size_t i = 0; i < nodes.size(); ++i)
+			{
+				if (!nodes[i])
+					continue;
+
+				CheckMatrix(hierarchy.GetWorldMatrix(nodeIndices[i]), nodes[i]->GetTransformMatrix());
+
+				std::size_t depth = 0;
+				for (const Nz::Node* node = nodes[i]->GetParent(); node; node = node->GetParent())
+					depth++;
+
+				CHECK(hierarchy.GetDepth(nodeIndices[i]) == depth);
+			}
+		};
+
+		hierarchy.Update();
+
+		THEN("World matrices match node ones")
+		{
+			CHECK(hierarchy.GetNodeCount() == NodeCount);
+			CheckAll();
+
+			for (std::size_t i = 0; i < NodeCount; ++i)
+				CHECK(hierarchy.WasUpdated(nodeIndices[i]));
+		}
+
+		WHEN("We update again without changes")
+		{
+			hierarchy.Update();
+
+			THEN("No node is updated")
+			{
+				for (std::size_t i = 0; i < NodeCount; ++i)
+					CHECK_FALSE(hierarchy.WasUpdated(nodeIndices[i]));
+			}
+		}
+
+		WHEN("We move a node")
+		{
+			nodes[20]->SetPosition(Nz::Vector3f(1.f, 2.f, 3.f));
+			hierarchy.SetLocalPosition(nodeIndices[20], Nz::Vector3f(1.f, 2.f, 3.f));
+			hierarchy.Update();
+
+			THEN("Only the node and its descendants are updated")
+			{
+				CheckAll();
+
+				for (std::size_t i = 0; i < NodeCount; ++i)
+				{
+					bool isDescendant = false;
+					for (const Nz::Node* node = nodes[i].get(); node; node = node->GetParent())
+					{
+						if (node == nodes[20].get())
+						{
+							isDescendant = true;
+							break;
+						}
+					}
+
+					CHECK(hierarchy.WasUpdated(nodeIndices[i]) == isDescendant);
+				}
+			}
+		}
+
+		WHEN("We reparent nodes")
+		{
+			for (std::size_t i = 30; i < NodeCount; i += 11)
+			{
+				std::size_t newParent = i / 3;
+				nodes[i]->SetParent(*nodes[newParent]);
+				hierarchy.SetParent(nodeIndices[i], nodeIndices[newParent]);
+			}
+
+			nodes[40]->SetParent(nullptr);
+			hierarchy.SetParent(nodeIndices[40], Nz::TransformHierarchy::InvalidNodeIndex);
+
+			hierarchy.Update();
+
+			THEN("World matrices and depths match node ones")
+			{
+				CheckAll();
+			}
+		}
+
+		WHEN("We destroy nodes and create new ones")
+		{
+			for (std::size_t i = 10; i < NodeCount; i += 13)
+			{
+				hierarchy.DestroyNode(nodeIndices[i]);
+				nodes[i].reset(); //< Node destructor detaches children as well
+			}
+
+			hierarchy.Update();
+
+			std::size_t newNode = hierarchy.CreateNode(nodeIndices[50]);
+			hierarchy.SetLocalPosition(newNode, Nz::Vector3f(0.f, 1.f, 0.f));
+
+			Nz::Node referenceNode;
+			referenceNode.SetParent(*nodes[50]);
+			referenceNode.SetPosition(Nz::Vector3f(0.f, 1.f, 0.f));
+
+			hierarchy.Update();
+
+			THEN("World matrices match node ones")
+			{
+				CHECK(hierarchy.GetNodeCount() == NodeCount - (NodeCount - 10 + 12) / 13 + 1);
+				CheckAll();
+				CheckMatrix(hierarchy.GetWorldMatrix(newNode), referenceNode.GetTransformMatrix());
+				CHECK(hierarchy.GetParent(newNode) == nodeIndices[50]);
+				CHECK(hierarchy.GetDepth(newNode) == hierarchy.GetDepth(nodeIndices[50]) + 1);
+			}
+		}
+	}
+
+	GIVEN("A single node")
+	{
+		Nz::TransformHierarchy hierarchy;
+		std::size_t node = hierarchy.CreateNode();
+		hierarchy.SetLocalTransform(node, Nz::Vector3f(1.f, 2.f, 3.f), Nz::Quaternionf::Identity(), Nz::Vector3f(2.f, 2.f, 2.f));
+		hierarchy.Update();
+
+		THEN("Its world transform is its local transform")
+		{
+			CHECK(hierarchy.GetWorldPosition(node) == Nz::Vector3f(1.f, 2.f, 3.f));
+			CHECK(hierarchy.GetWorldScale(node) == Nz::Vector3f(2.f, 2.f, 2.f));
+			CHECK(hierarchy.GetDepth(node) == 0);
+		}
+
+		WHEN("We destroy it")
+		{
+			hierarchy.DestroyNode(node);
+			hierarchy.Update();
+
+			THEN("The hierarchy is empty")
+			{
+				CHECK(hierarchy.GetNodeCount() == 0);
+				CHECK_FALSE(hierarchy.IsValid(node));
+			}
+		}
+	}
+
+	GIVEN("A root following an external node")
+	{
+		Nz::Node parentNode;
+		parentNode.SetPosition(Nz::Vector3f(1.f, 2.f, 3.f));
+		parentNode.SetRotation(RandomRotation());
+
+		Nz::Node externalNode;
+		externalNode.SetParent(parentNode);
+		externalNode.SetPosition(Nz::Vector3f(-1.f, 0.f, 2.f));
+
+		Nz::TransformHierarchy hierarchy;
+		std::size_t root = hierarchy.CreateNode();
+		std::size_t child = hierarchy.CreateNode(root);
+		hierarchy.SetLocalPosition(child, Nz::Vector3f(0.f, 1.f, 0.f));
+		hierarchy.SetExternalTransform(root, &externalNode);
+		hierarchy.Update();
+
+		Nz::Node childNode;
+		childNode.SetParent(externalNode);
+		childNode.SetPosition(Nz::Vector3f(0.f, 1.f, 0.f));
+
+		THEN("The root takes the node global transform")
+		{
+			CheckMatrix(hierarchy.GetWorldMatrix(root), externalNode.GetTransformMatrix());
+			CheckMatrix(hierarchy.GetWorldMatrix(child), childNode.GetTransformMatrix());
+		}
+
+		WHEN("The node parent moves and the root is invalidated")
+		{
+			parentNode.Move(Nz::Vector3f(5.f, 0.f, 0.f));
+			hierarchy.Invalidate(root);
+			hierarchy.Update();
+
+			THEN("The new global transform is read")
+			{
+				CHECK(hierarchy.WasUpdated(child));
+				CheckMatrix(hierarchy.GetWorldMatrix(root), externalNode.GetTransformMatrix());
+				CheckMatrix(hierarchy.GetWorldMatrix(child), childNode.GetTransformMatrix());
+			}
+		}
+
+		WHEN("We stop following the node")
+		{
+			hierarchy.SetExternalTransform(root, nullptr);
+			hierarchy.SetLocalTransform(root, Nz::Vector3f::Zero(), Nz::Quaternionf::Identity(), Nz::Vector3f::Unit());
+			parentNode.Move(Nz::Vector3f(5.f, 0.f, 0.f));
+			hierarchy.Update();
+
+			THEN("The local transform is used again")
+			{
+				CHECK(hierarchy.GetWorldPosition(root) == Nz::Vector3f::Zero());
+				CHECK(hierarchy.GetWorldPosition(child) == Nz::Vector3f(0.f, 1.f, 0.f));
+			}
+		}
+
+		WHEN("We destroy the root")
+		{
+			hierarchy.DestroyNode(root);
+			std::size_t newNode = hierarchy.CreateNode();
+			hierarchy.Update();
+
+			THEN("The reused node index doesn't follow the node")
+			{
+				CHECK(newNode == root);
+				CHECK(hierarchy.GetWorldPosition(newNode) == Nz::Vector3f::Zero());
+			}
+		}
+	}
+}
@@ -0,0 +1,22 @@
+option("benchmarks", { description = "Build benchmarks", default = false })
+
+if has_config("benchmarks") then
+	add_requires("nanobench")
+
+	target("NazaraBenchmarks", function ()
+		set_group("Tests")
+		set_kind("binary")
+
+		add_deps("NazaraCore", "NazaraNetwork", "NazaraPhysics2D", "NazaraUtility")
+		add_packages("nanobench")
+		add_headerfiles("Benchmarks/**.hpp", { prefixdir = "private", install = false })
+		add_files("Benchmarks/**.cpp")
+		add_includedirs(".")
+
+		if not is_mode("release", "releasedbg") then
+			after_build(function (target)
+				cprint("${yellow}NazaraBenchmarks was built in %s mode, results are only meaningful in release mode", get_config("mode"))
+			end)
+		end
+	end)
+end
@@ -0,0 +1,12 @@
+option("packer", { description = "Build Packer tool (packed archive creation)", default = false })
+
+if has_config("packer") then
+	target("NazaraPacker", function ()
+		set_group("Tools")
+		set_kind("binary")
+
+		add_deps("NazaraCore")
+
+		add_files("../src/Packer/**.cpp")
+	end)
+end
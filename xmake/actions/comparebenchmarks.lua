@@ -0,0 +1,104 @@
+task("compare-benchmarks")
+
+set_menu({
+	-- Settings menu usage
+	usage = "xmake compare-benchmarks [options] baseline current",
+	description = "Compare two NazaraBenchmarks JSON reports (generated with --json) and fail on performance regressions",
+	options =
+	{
+		{'t', "threshold", "kv", "5", "Slowdown (in percent) above which a benchmark is considered as a regression." },
+		{nil, "baseline", "v", nil, "Reference report (for example from the last release)." },
+		{nil, "current", "v", nil, "Report to check against the reference." }
+	}
+})
+
+local function LoadReport(filePath)
+	import("core.base.json")
+
+	if not os.isfile(filePath) then
+		raise("report %s doesn't exist", filePath)
+	end
+
+	local report = json.loadfile(filePath)
+
+	local results = {}
+	for _, result in ipairs(report.results or {}) do
+		local name = result.title .. " / " .. result.name
+		results[name] = {
+			name = name,
+			time = result["median(elapsed)"],
+			error = result["medianAbsolutePercentError(elapsed)"] or 0,
+			unit = result.unit
+		}
+	end
+
+	return results
+end
+
+local function FormatTime(seconds)
+	if seconds < 1e-6 then
+		return string.format("%.2f ns", seconds * 1e9)
+	elseif seconds < 1e-3 then
+		return string.format("%.2f us", seconds * 1e6)
+	elseif seconds < 1 then
+		return string.format("%.2f ms", seconds * 1e3)
+	else
+		return string.format("%.2f s", seconds)
+	end
+end
+
+on_run(function()
+	import("core.base.option")
+
+	local baselinePath = option.get("baseline")
+	local currentPath = option.get("current")
+	if not baselinePath or not currentPath then
+		raise("usage: xmake compare-benchmarks [options] baseline current")
+	end
+
+	local threshold = tonumber(option.get("threshold")) / 100
+
+	local baseline = LoadReport(baselinePath)
+	local current = LoadReport(currentPath)
+
+	local names = {}
+	for name, _ in pairs(current) do
+		table.insert(names, name)
+	end
+	table.sort(names)
+
+	local regressions = {}
+	for _, name in ipairs(names) do
+		local currentResult = current[name]
+		local baselineResult = baseline[name]
+		if baselineResult then
+			local ratio = currentResult.time / baselineResult.time
+			local text = string.format("%-70s %12s -> %12s per %s (%+.1f%%)", name, FormatTime(baselineResult.time), FormatTime(currentResult.time), currentResult.unit, (ratio - 1) * 100)
+
+			-- Don't report slowdowns that are within the measurement noise
+			local noise = baselineResult.error + currentResult.error
+			if ratio - 1 > math.max(threshold, noise) then
+				cprint("${red}%s", text)
+				table.insert(regressions, name)
+			elseif 1 - 1 / ratio > math.max(threshold, noise) then
+				cprint("${green}%s", text)
+			else
+				print(text)
+			end
+		else
+			cprint("${dim}%-70s (new)", name)
+		end
+	end
+
+	for name, _ in pairs(baseline) do
+		if not current[name] then
+			cprint("${yellow}%-70s (missing from current report)", name)
+		end
+	end
+
+	if #regressions > 0 then
+		raise("%d benchmark(s) regressed by more than %s%%", #regressions, option.get("threshold"))
+	end
+
+	cprint("${bright green}no regression found")
+end)